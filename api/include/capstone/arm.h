@@ -8,50 +8,49 @@
 extern "C" {
 #endif
 
-#include <stdint.h>
 #include "platform.h"
 
 #ifdef _MSC_VER
 #pragma warning(disable:4201)
 #endif
 
-//> ARM shift type
+/// ARM shift type
 typedef enum arm_shifter {
 	ARM_SFT_INVALID = 0,
-	ARM_SFT_ASR,	// shift with immediate const
-	ARM_SFT_LSL,	// shift with immediate const
-	ARM_SFT_LSR,	// shift with immediate const
-	ARM_SFT_ROR,	// shift with immediate const
-	ARM_SFT_RRX,	// shift with immediate const
-	ARM_SFT_ASR_REG,	// shift with register
-	ARM_SFT_LSL_REG,	// shift with register
-	ARM_SFT_LSR_REG,	// shift with register
-	ARM_SFT_ROR_REG,	// shift with register
-	ARM_SFT_RRX_REG,	// shift with register
+	ARM_SFT_ASR,	///< shift with immediate const
+	ARM_SFT_LSL,	///< shift with immediate const
+	ARM_SFT_LSR,	///< shift with immediate const
+	ARM_SFT_ROR,	///< shift with immediate const
+	ARM_SFT_RRX,	///< shift with immediate const
+	ARM_SFT_ASR_REG,	///< shift with register
+	ARM_SFT_LSL_REG,	///< shift with register
+	ARM_SFT_LSR_REG,	///< shift with register
+	ARM_SFT_ROR_REG,	///< shift with register
+	ARM_SFT_RRX_REG,	///< shift with register
 } arm_shifter;
 
-//> ARM condition code
+/// ARM condition code
 typedef enum arm_cc {
 	ARM_CC_INVALID = 0,
-	ARM_CC_EQ,            // Equal                      Equal
-	ARM_CC_NE,            // Not equal                  Not equal, or unordered
-	ARM_CC_HS,            // Carry set                  >, ==, or unordered
-	ARM_CC_LO,            // Carry clear                Less than
-	ARM_CC_MI,            // Minus, negative            Less than
-	ARM_CC_PL,            // Plus, positive or zero     >, ==, or unordered
-	ARM_CC_VS,            // Overflow                   Unordered
-	ARM_CC_VC,            // No overflow                Not unordered
-	ARM_CC_HI,            // Unsigned higher            Greater than, or unordered
-	ARM_CC_LS,            // Unsigned lower or same     Less than or equal
-	ARM_CC_GE,            // Greater than or equal      Greater than or equal
-	ARM_CC_LT,            // Less than                  Less than, or unordered
-	ARM_CC_GT,            // Greater than               Greater than
-	ARM_CC_LE,            // Less than or equal         <, ==, or unordered
-	ARM_CC_AL             // Always (unconditional)     Always (unconditional)
+	ARM_CC_EQ,            ///< Equal                      Equal
+	ARM_CC_NE,            ///< Not equal                  Not equal, or unordered
+	ARM_CC_HS,            ///< Carry set                  >, ==, or unordered
+	ARM_CC_LO,            ///< Carry clear                Less than
+	ARM_CC_MI,            ///< Minus, negative            Less than
+	ARM_CC_PL,            ///< Plus, positive or zero     >, ==, or unordered
+	ARM_CC_VS,            ///< Overflow                   Unordered
+	ARM_CC_VC,            ///< No overflow                Not unordered
+	ARM_CC_HI,            ///< Unsigned higher            Greater than, or unordered
+	ARM_CC_LS,            ///< Unsigned lower or same     Less than or equal
+	ARM_CC_GE,            ///< Greater than or equal      Greater than or equal
+	ARM_CC_LT,            ///< Less than                  Less than, or unordered
+	ARM_CC_GT,            ///< Greater than               Greater than
+	ARM_CC_LE,            ///< Less than or equal         <, ==, or unordered
+	ARM_CC_AL             ///< Always (unconditional)     Always (unconditional)
 } arm_cc;
 
 typedef enum arm_sysreg {
-	//> Special registers for MSR
+	/// Special registers for MSR
 	ARM_SYSREG_INVALID = 0,
 
 	// SPSR* registers can be OR combined
@@ -98,6 +97,17 @@ typedef enum arm_sysreg {
 	ARM_SYSREG_BASEPRI_MAX,
 	ARM_SYSREG_FAULTMASK,
 	ARM_SYSREG_CONTROL,
+	ARM_SYSREG_MSPLIM,
+	ARM_SYSREG_PSPLIM,
+	ARM_SYSREG_MSP_NS,
+	ARM_SYSREG_PSP_NS,
+	ARM_SYSREG_MSPLIM_NS,
+	ARM_SYSREG_PSPLIM_NS,
+	ARM_SYSREG_PRIMASK_NS,
+	ARM_SYSREG_BASEPRI_NS,
+	ARM_SYSREG_FAULTMASK_NS,
+	ARM_SYSREG_CONTROL_NS,
+	ARM_SYSREG_SP_NS,
 
 	// Banked Registers
 	ARM_SYSREG_R8_USR,
@@ -136,8 +146,8 @@ typedef enum arm_sysreg {
 	ARM_SYSREG_SPSR_HYP,
 } arm_sysreg;
 
-//> The memory barrier constants map directly to the 4-bit encoding of
-//> the option field for Memory Barrier operations.
+/// The memory barrier constants map directly to the 4-bit encoding of
+/// the option field for Memory Barrier operations.
 typedef enum arm_mem_barrier {
 	ARM_MB_INVALID = 0,
 	ARM_MB_RESERVED_0,
@@ -158,24 +168,24 @@ typedef enum arm_mem_barrier {
 	ARM_MB_SY,
 } arm_mem_barrier;
 
-//> Operand type for instruction's operands
+/// Operand type for instruction's operands
 typedef enum arm_op_type {
-	ARM_OP_INVALID = 0, // = CS_OP_INVALID (Uninitialized).
-	ARM_OP_REG, // = CS_OP_REG (Register operand).
-	ARM_OP_IMM, // = CS_OP_IMM (Immediate operand).
-	ARM_OP_MEM, // = CS_OP_MEM (Memory operand).
-	ARM_OP_FP,  // = CS_OP_FP (Floating-Point operand).
-	ARM_OP_CIMM = 64, // C-Immediate (coprocessor registers)
-	ARM_OP_PIMM, // P-Immediate (coprocessor registers)
-	ARM_OP_SETEND,	// operand for SETEND instruction
-	ARM_OP_SYSREG,	// MSR/MSR special register operand
+	ARM_OP_INVALID = 0, ///< = CS_OP_INVALID (Uninitialized).
+	ARM_OP_REG, ///< = CS_OP_REG (Register operand).
+	ARM_OP_IMM, ///< = CS_OP_IMM (Immediate operand).
+	ARM_OP_MEM, ///< = CS_OP_MEM (Memory operand).
+	ARM_OP_FP,  ///< = CS_OP_FP (Floating-Point operand).
+	ARM_OP_CIMM = 64, ///< C-Immediate (coprocessor registers)
+	ARM_OP_PIMM, ///< P-Immediate (coprocessor registers)
+	ARM_OP_SETEND,	///< operand for SETEND instruction
+	ARM_OP_SYSREG,	///< MSR/MRS special register operand
 } arm_op_type;
 
-//> Operand type for SETEND instruction
+/// Operand type for SETEND instruction
 typedef enum arm_setend_type {
-	ARM_SETEND_INVALID = 0,	// Uninitialized.
-	ARM_SETEND_BE,	// BE operand.
-	ARM_SETEND_LE, // LE operand
+	ARM_SETEND_INVALID = 0,	///< Uninitialized.
+	ARM_SETEND_BE,	///< BE operand.
+	ARM_SETEND_LE, ///< LE operand
 } arm_setend_type;
 
 typedef enum arm_cpsmode_type {
@@ -184,16 +194,16 @@ typedef enum arm_cpsmode_type {
 	ARM_CPSMODE_ID = 3
 } arm_cpsmode_type;
 
-//> Operand type for SETEND instruction
+/// Operand type for SETEND instruction
 typedef enum arm_cpsflag_type {
 	ARM_CPSFLAG_INVALID = 0,
 	ARM_CPSFLAG_F = 1,
 	ARM_CPSFLAG_I = 2,
 	ARM_CPSFLAG_A = 4,
-	ARM_CPSFLAG_NONE = 16,	// no flag
+	ARM_CPSFLAG_NONE = 16,	///< no flag
 } arm_cpsflag_type;
 
-//> Data type for elements of vector instructions.
+/// Data type for elements of vector instructions.
 typedef enum arm_vectordata_type {
 	ARM_VECTORDATA_INVALID = 0,
 
@@ -219,6 +229,7 @@ typedef enum arm_vectordata_type {
 	ARM_VECTORDATA_P8,
 
 	// Floating type
+	ARM_VECTORDATA_F16,
 	ARM_VECTORDATA_F32,
 	ARM_VECTORDATA_F64,
 
@@ -247,70 +258,13 @@ typedef enum arm_vectordata_type {
 	ARM_VECTORDATA_F64U16,	// f64.u16
 	ARM_VECTORDATA_F32U16,	// f32.u16
 	ARM_VECTORDATA_F64U32,	// f64.u32
+	ARM_VECTORDATA_F16U16,	// f16.u16
+	ARM_VECTORDATA_U16F16,	// u16.f16
+	ARM_VECTORDATA_F16U32,	// f16.u32
+	ARM_VECTORDATA_U32F16,	// u32.f16
 } arm_vectordata_type;
 
-// Instruction's operand referring to memory
-// This is associated with ARM_OP_MEM operand type above
-typedef struct arm_op_mem {
-	unsigned int base;	// base register
-	unsigned int index;	// index register
-	int scale;	// scale for index register (can be 1, or -1)
-	int disp;	// displacement/offset value
-	int lshift;	// left-shift on index register, or 0 if irrelevant.
-} arm_op_mem;
-
-// Instruction operand
-typedef struct cs_arm_op {
-	int vector_index;	// Vector Index for some vector operands (or -1 if irrelevant)
-
-	struct {
-		arm_shifter type;
-		unsigned int value;
-	} shift;
-
-	arm_op_type type;	// operand type
-
-	union {
-		unsigned int reg;	// register value for REG/SYSREG operand
-		int32_t imm;			// immediate value for C-IMM, P-IMM or IMM operand
-		double fp;			// floating point value for FP operand
-		arm_op_mem mem;		// base/index/scale/disp value for MEM operand
-		arm_setend_type setend; // SETEND instruction's operand type
-	};
-
-	// in some instructions, an operand can be subtracted or added to
-	// the base register,
-	bool subtracted; // if TRUE, this operand is subtracted. otherwise, it is added.
-
-	// How is this operand accessed? (READ, WRITE or READ|WRITE)
-	// This field is combined of cs_ac_type.
-	// NOTE: this field is irrelevant if engine is compiled in DIET mode.
-	uint8_t access;
-
-	// Neon lane index for NEON instructions (or -1 if irrelevant)
-	int8_t neon_lane;
-} cs_arm_op;
-
-// Instruction structure
-typedef struct cs_arm {
-	bool usermode;	// User-mode registers to be loaded (for LDM/STM instructions)
-	int vector_size; 	// Scalar size for vector instructions
-	arm_vectordata_type vector_data; // Data type for elements of vector instructions
-	arm_cpsmode_type cps_mode;	// CPS mode for CPS instruction
-	arm_cpsflag_type cps_flag;	// CPS mode for CPS instruction
-	arm_cc cc;			// conditional code for this insn
-	bool update_flags;	// does this insn update flags?
-	bool writeback;		// does this insn write-back?
-	arm_mem_barrier mem_barrier;	// Option for some memory barrier instructions
-
-	// Number of operands of this instruction, 
-	// or 0 when instruction has no operand.
-	uint8_t op_count;
-
-	cs_arm_op operands[36];	// operands for this instruction.
-} cs_arm;
-
-//> ARM registers
+/// ARM registers
 typedef enum arm_reg {
 	ARM_REG_INVALID = 0,
 	ARM_REG_APSR,
@@ -426,7 +380,7 @@ typedef enum arm_reg {
 
 	ARM_REG_ENDING,		// <-- mark the end of the list or registers
 
-	//> alias registers
+	// alias registers
 	ARM_REG_R13 = ARM_REG_SP,
 	ARM_REG_R14 = ARM_REG_LR,
 	ARM_REG_R15 = ARM_REG_PC,
@@ -437,27 +391,97 @@ typedef enum arm_reg {
 	ARM_REG_IP = ARM_REG_R12,
 } arm_reg;
 
-//> ARM instruction
+/// Instruction's operand referring to memory
+/// This is associated with ARM_OP_MEM operand type above
+typedef struct arm_op_mem {
+	arm_reg base;	///< base register
+	arm_reg index;	///< index register
+	int scale;	///< scale for index register (can be 1, or -1)
+	int disp;	///< displacement/offset value
+	/// left-shift on index register, or 0 if irrelevant
+	/// NOTE: this value can also be fetched via operand.shift.value
+	int lshift;
+} arm_op_mem;
+
+/// Instruction operand
+typedef struct cs_arm_op {
+	int vector_index;	///< Vector Index for some vector operands (or -1 if irrelevant)
+
+	struct {
+		arm_shifter type;
+		unsigned int value;
+	} shift;
+
+	arm_op_type type;	///< operand type
+
+	union {
+		int reg;	///< register value for REG/SYSREG operand
+		int32_t imm;			///< immediate value for C-IMM, P-IMM or IMM operand
+		double fp;			///< floating point value for FP operand
+		arm_op_mem mem;		///< base/index/scale/disp value for MEM operand
+		arm_setend_type setend; ///< SETEND instruction's operand type
+	};
+
+	/// in some instructions, an operand can be subtracted or added to
+	/// the base register,
+	/// if TRUE, this operand is subtracted. otherwise, it is added.
+	bool subtracted;
+
+	/// How is this operand accessed? (READ, WRITE or READ|WRITE)
+	/// This field is combined of cs_ac_type.
+	/// NOTE: this field is irrelevant if engine is compiled in DIET mode.
+	uint8_t access;
+
+	/// Neon lane index for NEON instructions (or -1 if irrelevant)
+	int8_t neon_lane;
+} cs_arm_op;
+
+/// Instruction structure
+typedef struct cs_arm {
+	bool usermode;	///< User-mode registers to be loaded (for LDM/STM instructions)
+	int vector_size; 	///< Scalar size for vector instructions
+	arm_vectordata_type vector_data; ///< Data type for elements of vector instructions
+	arm_cpsmode_type cps_mode;	///< CPS mode for CPS instruction
+	arm_cpsflag_type cps_flag;	///< CPS mode for CPS instruction
+	arm_cc cc;			///< conditional code for this insn
+	bool update_flags;	///< does this insn update flags?
+	bool writeback;		///< does this insn write-back?
+	arm_mem_barrier mem_barrier;	///< Option for some memory barrier instructions
+
+	/// Number of operands of this instruction,
+	/// or 0 when instruction has no operand.
+	uint8_t op_count;
+
+	cs_arm_op operands[36];	///< operands for this instruction.
+} cs_arm;
+
+/// ARM instruction
 typedef enum arm_insn {
 	ARM_INS_INVALID = 0,
 
 	ARM_INS_ADC,
 	ARM_INS_ADD,
+	ARM_INS_ADDW,
 	ARM_INS_ADR,
 	ARM_INS_AESD,
 	ARM_INS_AESE,
 	ARM_INS_AESIMC,
 	ARM_INS_AESMC,
 	ARM_INS_AND,
+	ARM_INS_ASR,
+	ARM_INS_B,
 	ARM_INS_BFC,
 	ARM_INS_BFI,
 	ARM_INS_BIC,
 	ARM_INS_BKPT,
 	ARM_INS_BL,
 	ARM_INS_BLX,
+	ARM_INS_BLXNS,
 	ARM_INS_BX,
 	ARM_INS_BXJ,
-	ARM_INS_B,
+	ARM_INS_BXNS,
+	ARM_INS_CBNZ,
+	ARM_INS_CBZ,
 	ARM_INS_CDP,
 	ARM_INS_CDP2,
 	ARM_INS_CLREX,
@@ -471,21 +495,37 @@ typedef enum arm_insn {
 	ARM_INS_CRC32CW,
 	ARM_INS_CRC32H,
 	ARM_INS_CRC32W,
+	ARM_INS_CSDB,
 	ARM_INS_DBG,
+	ARM_INS_DCPS1,
+	ARM_INS_DCPS2,
+	ARM_INS_DCPS3,
+	ARM_INS_DFB,
 	ARM_INS_DMB,
 	ARM_INS_DSB,
 	ARM_INS_EOR,
 	ARM_INS_ERET,
-	ARM_INS_VMOV,
+	ARM_INS_ESB,
+	ARM_INS_FADDD,
+	ARM_INS_FADDS,
+	ARM_INS_FCMPZD,
+	ARM_INS_FCMPZS,
+	ARM_INS_FCONSTD,
+	ARM_INS_FCONSTS,
 	ARM_INS_FLDMDBX,
 	ARM_INS_FLDMIAX,
-	ARM_INS_VMRS,
+	ARM_INS_FMDHR,
+	ARM_INS_FMDLR,
+	ARM_INS_FMSTAT,
 	ARM_INS_FSTMDBX,
 	ARM_INS_FSTMIAX,
+	ARM_INS_FSUBD,
+	ARM_INS_FSUBS,
 	ARM_INS_HINT,
 	ARM_INS_HLT,
 	ARM_INS_HVC,
 	ARM_INS_ISB,
+	ARM_INS_IT,
 	ARM_INS_LDA,
 	ARM_INS_LDAB,
 	ARM_INS_LDAEX,
@@ -493,16 +533,17 @@ typedef enum arm_insn {
 	ARM_INS_LDAEXD,
 	ARM_INS_LDAEXH,
 	ARM_INS_LDAH,
-	ARM_INS_LDC2L,
+	ARM_INS_LDC,
 	ARM_INS_LDC2,
+	ARM_INS_LDC2L,
 	ARM_INS_LDCL,
-	ARM_INS_LDC,
+	ARM_INS_LDM,
 	ARM_INS_LDMDA,
 	ARM_INS_LDMDB,
-	ARM_INS_LDM,
 	ARM_INS_LDMIB,
-	ARM_INS_LDRBT,
+	ARM_INS_LDR,
 	ARM_INS_LDRB,
+	ARM_INS_LDRBT,
 	ARM_INS_LDRD,
 	ARM_INS_LDREX,
 	ARM_INS_LDREXB,
@@ -515,7 +556,8 @@ typedef enum arm_insn {
 	ARM_INS_LDRSH,
 	ARM_INS_LDRSHT,
 	ARM_INS_LDRT,
-	ARM_INS_LDR,
+	ARM_INS_LSL,
+	ARM_INS_LSR,
 	ARM_INS_MCR,
 	ARM_INS_MCR2,
 	ARM_INS_MCRR,
@@ -523,6 +565,7 @@ typedef enum arm_insn {
 	ARM_INS_MLA,
 	ARM_INS_MLS,
 	ARM_INS_MOV,
+	ARM_INS_MOVS,
 	ARM_INS_MOVT,
 	ARM_INS_MOVW,
 	ARM_INS_MRC,
@@ -533,12 +576,17 @@ typedef enum arm_insn {
 	ARM_INS_MSR,
 	ARM_INS_MUL,
 	ARM_INS_MVN,
+	ARM_INS_NEG,
+	ARM_INS_NOP,
+	ARM_INS_ORN,
 	ARM_INS_ORR,
 	ARM_INS_PKHBT,
 	ARM_INS_PKHTB,
-	ARM_INS_PLDW,
 	ARM_INS_PLD,
+	ARM_INS_PLDW,
 	ARM_INS_PLI,
+	ARM_INS_POP,
+	ARM_INS_PUSH,
 	ARM_INS_QADD,
 	ARM_INS_QADD16,
 	ARM_INS_QADD8,
@@ -557,6 +605,8 @@ typedef enum arm_insn {
 	ARM_INS_RFEDB,
 	ARM_INS_RFEIA,
 	ARM_INS_RFEIB,
+	ARM_INS_ROR,
+	ARM_INS_RRX,
 	ARM_INS_RSB,
 	ARM_INS_RSC,
 	ARM_INS_SADD16,
@@ -567,6 +617,10 @@ typedef enum arm_insn {
 	ARM_INS_SDIV,
 	ARM_INS_SEL,
 	ARM_INS_SETEND,
+	ARM_INS_SETPAN,
+	ARM_INS_SEV,
+	ARM_INS_SEVL,
+	ARM_INS_SG,
 	ARM_INS_SHA1C,
 	ARM_INS_SHA1H,
 	ARM_INS_SHA1M,
@@ -629,10 +683,10 @@ typedef enum arm_insn {
 	ARM_INS_SSAX,
 	ARM_INS_SSUB16,
 	ARM_INS_SSUB8,
-	ARM_INS_STC2L,
+	ARM_INS_STC,
 	ARM_INS_STC2,
+	ARM_INS_STC2L,
 	ARM_INS_STCL,
-	ARM_INS_STC,
 	ARM_INS_STL,
 	ARM_INS_STLB,
 	ARM_INS_STLEX,
@@ -640,12 +694,13 @@ typedef enum arm_insn {
 	ARM_INS_STLEXD,
 	ARM_INS_STLEXH,
 	ARM_INS_STLH,
+	ARM_INS_STM,
 	ARM_INS_STMDA,
 	ARM_INS_STMDB,
-	ARM_INS_STM,
 	ARM_INS_STMIB,
-	ARM_INS_STRBT,
+	ARM_INS_STR,
 	ARM_INS_STRB,
+	ARM_INS_STRBT,
 	ARM_INS_STRD,
 	ARM_INS_STREX,
 	ARM_INS_STREXB,
@@ -654,8 +709,9 @@ typedef enum arm_insn {
 	ARM_INS_STRH,
 	ARM_INS_STRHT,
 	ARM_INS_STRT,
-	ARM_INS_STR,
 	ARM_INS_SUB,
+	ARM_INS_SUBS,
+	ARM_INS_SUBW,
 	ARM_INS_SVC,
 	ARM_INS_SWP,
 	ARM_INS_SWPB,
@@ -665,9 +721,16 @@ typedef enum arm_insn {
 	ARM_INS_SXTB,
 	ARM_INS_SXTB16,
 	ARM_INS_SXTH,
+	ARM_INS_TBB,
+	ARM_INS_TBH,
 	ARM_INS_TEQ,
 	ARM_INS_TRAP,
+	ARM_INS_TSB,
 	ARM_INS_TST,
+	ARM_INS_TT,
+	ARM_INS_TTA,
+	ARM_INS_TTAT,
+	ARM_INS_TTT,
 	ARM_INS_UADD16,
 	ARM_INS_UADD8,
 	ARM_INS_UASX,
@@ -702,13 +765,15 @@ typedef enum arm_insn {
 	ARM_INS_UXTB,
 	ARM_INS_UXTB16,
 	ARM_INS_UXTH,
-	ARM_INS_VABAL,
 	ARM_INS_VABA,
-	ARM_INS_VABDL,
+	ARM_INS_VABAL,
 	ARM_INS_VABD,
+	ARM_INS_VABDL,
 	ARM_INS_VABS,
 	ARM_INS_VACGE,
 	ARM_INS_VACGT,
+	ARM_INS_VACLE,
+	ARM_INS_VACLT,
 	ARM_INS_VADD,
 	ARM_INS_VADDHN,
 	ARM_INS_VADDL,
@@ -718,6 +783,7 @@ typedef enum arm_insn {
 	ARM_INS_VBIF,
 	ARM_INS_VBIT,
 	ARM_INS_VBSL,
+	ARM_INS_VCADD,
 	ARM_INS_VCEQ,
 	ARM_INS_VCGE,
 	ARM_INS_VCGT,
@@ -725,15 +791,17 @@ typedef enum arm_insn {
 	ARM_INS_VCLS,
 	ARM_INS_VCLT,
 	ARM_INS_VCLZ,
+	ARM_INS_VCMLA,
 	ARM_INS_VCMP,
 	ARM_INS_VCMPE,
 	ARM_INS_VCNT,
+	ARM_INS_VCVT,
 	ARM_INS_VCVTA,
 	ARM_INS_VCVTB,
-	ARM_INS_VCVT,
 	ARM_INS_VCVTM,
 	ARM_INS_VCVTN,
 	ARM_INS_VCVTP,
+	ARM_INS_VCVTR,
 	ARM_INS_VCVTT,
 	ARM_INS_VDIV,
 	ARM_INS_VDUP,
@@ -745,6 +813,8 @@ typedef enum arm_insn {
 	ARM_INS_VFNMS,
 	ARM_INS_VHADD,
 	ARM_INS_VHSUB,
+	ARM_INS_VINS,
+	ARM_INS_VJCVT,
 	ARM_INS_VLD1,
 	ARM_INS_VLD2,
 	ARM_INS_VLD3,
@@ -752,16 +822,21 @@ typedef enum arm_insn {
 	ARM_INS_VLDMDB,
 	ARM_INS_VLDMIA,
 	ARM_INS_VLDR,
-	ARM_INS_VMAXNM,
+	ARM_INS_VLLDM,
+	ARM_INS_VLSTM,
 	ARM_INS_VMAX,
-	ARM_INS_VMINNM,
+	ARM_INS_VMAXNM,
 	ARM_INS_VMIN,
+	ARM_INS_VMINNM,
 	ARM_INS_VMLA,
 	ARM_INS_VMLAL,
 	ARM_INS_VMLS,
 	ARM_INS_VMLSL,
+	ARM_INS_VMOV,
 	ARM_INS_VMOVL,
 	ARM_INS_VMOVN,
+	ARM_INS_VMOVX,
+	ARM_INS_VMRS,
 	ARM_INS_VMSR,
 	ARM_INS_VMUL,
 	ARM_INS_VMULL,
@@ -773,19 +848,23 @@ typedef enum arm_insn {
 	ARM_INS_VORN,
 	ARM_INS_VORR,
 	ARM_INS_VPADAL,
-	ARM_INS_VPADDL,
 	ARM_INS_VPADD,
+	ARM_INS_VPADDL,
 	ARM_INS_VPMAX,
 	ARM_INS_VPMIN,
+	ARM_INS_VPOP,
+	ARM_INS_VPUSH,
 	ARM_INS_VQABS,
 	ARM_INS_VQADD,
 	ARM_INS_VQDMLAL,
 	ARM_INS_VQDMLSL,
 	ARM_INS_VQDMULH,
 	ARM_INS_VQDMULL,
-	ARM_INS_VQMOVUN,
 	ARM_INS_VQMOVN,
+	ARM_INS_VQMOVUN,
 	ARM_INS_VQNEG,
+	ARM_INS_VQRDMLAH,
+	ARM_INS_VQRDMLSH,
 	ARM_INS_VQRDMULH,
 	ARM_INS_VQRSHL,
 	ARM_INS_VQRSHRN,
@@ -810,20 +889,21 @@ typedef enum arm_insn {
 	ARM_INS_VRINTX,
 	ARM_INS_VRINTZ,
 	ARM_INS_VRSHL,
-	ARM_INS_VRSHRN,
 	ARM_INS_VRSHR,
+	ARM_INS_VRSHRN,
 	ARM_INS_VRSQRTE,
 	ARM_INS_VRSQRTS,
 	ARM_INS_VRSRA,
 	ARM_INS_VRSUBHN,
+	ARM_INS_VSDOT,
 	ARM_INS_VSELEQ,
 	ARM_INS_VSELGE,
 	ARM_INS_VSELGT,
 	ARM_INS_VSELVS,
-	ARM_INS_VSHLL,
 	ARM_INS_VSHL,
-	ARM_INS_VSHRN,
+	ARM_INS_VSHLL,
 	ARM_INS_VSHR,
+	ARM_INS_VSHRN,
 	ARM_INS_VSLI,
 	ARM_INS_VSQRT,
 	ARM_INS_VSRA,
@@ -842,55 +922,31 @@ typedef enum arm_insn {
 	ARM_INS_VSWP,
 	ARM_INS_VTBL,
 	ARM_INS_VTBX,
-	ARM_INS_VCVTR,
 	ARM_INS_VTRN,
 	ARM_INS_VTST,
+	ARM_INS_VUDOT,
 	ARM_INS_VUZP,
 	ARM_INS_VZIP,
-	ARM_INS_ADDW,
-	ARM_INS_ASR,
-	ARM_INS_DCPS1,
-	ARM_INS_DCPS2,
-	ARM_INS_DCPS3,
-	ARM_INS_IT,
-	ARM_INS_LSL,
-	ARM_INS_LSR,
-	ARM_INS_ORN,
-	ARM_INS_ROR,
-	ARM_INS_RRX,
-	ARM_INS_SUBW,
-	ARM_INS_TBB,
-	ARM_INS_TBH,
-	ARM_INS_CBNZ,
-	ARM_INS_CBZ,
-	ARM_INS_POP,
-	ARM_INS_PUSH,
-
-	// special instructions
-	ARM_INS_NOP,
-	ARM_INS_YIELD,
 	ARM_INS_WFE,
 	ARM_INS_WFI,
-	ARM_INS_SEV,
-	ARM_INS_SEVL,
-	ARM_INS_VPUSH,
-	ARM_INS_VPOP,
+	ARM_INS_YIELD,
 
 	ARM_INS_ENDING,	// <-- mark the end of the list of instructions
 } arm_insn;
 
-//> Group of ARM instructions
+/// Group of ARM instructions
 typedef enum arm_insn_group {
-	ARM_GRP_INVALID = 0, // = CS_GRP_INVALID
+	ARM_GRP_INVALID = 0, ///< = CS_GRP_INVALID
 
-	//> Generic groups
+	// Generic groups
 	// all jump instructions (conditional+direct+indirect jumps)
-	ARM_GRP_JUMP,	// = CS_GRP_JUMP
-	ARM_GRP_CALL,	// = CS_GRP_CALL
-	ARM_GRP_INT = 4, // = CS_GRP_INT
-	ARM_GRP_PRIVILEGE = 6, // = CS_GRP_PRIVILEGE
+	ARM_GRP_JUMP,	///< = CS_GRP_JUMP
+	ARM_GRP_CALL,	///< = CS_GRP_CALL
+	ARM_GRP_INT = 4, ///< = CS_GRP_INT
+	ARM_GRP_PRIVILEGE = 6, ///< = CS_GRP_PRIVILEGE
+	ARM_GRP_BRANCH_RELATIVE, ///< = CS_GRP_BRANCH_RELATIVE
 
-	//> Architecture-specific groups
+	// Architecture-specific groups
 	ARM_GRP_CRYPTO = 128,
 	ARM_GRP_DATABARRIER,
 	ARM_GRP_DIVIDE,
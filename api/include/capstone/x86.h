@@ -8,12 +8,14 @@
 extern "C" {
 #endif
 
-#include <stdint.h>
+#include "platform.h"
 
-// Calculate relative address for X86-64, given cs_insn structure
-#define X86_REL_ADDR(insn) (insn.address + insn.size + insn.detail->x86.disp)
+/// Calculate relative address for X86-64, given cs_insn structure
+#define X86_REL_ADDR(insn) (((insn).detail->x86.operands[0].type == X86_OP_IMM) \
+	? (uint64_t)((insn).detail->x86.operands[0].imm) \
+	: (((insn).address + (insn).size) + (uint64_t)(insn).detail->x86.disp))
 
-//> X86 registers
+/// X86 registers
 typedef enum x86_reg {
 	X86_REG_INVALID = 0,
 	X86_REG_AH, X86_REG_AL, X86_REG_AX, X86_REG_BH, X86_REG_BL,
@@ -65,11 +67,12 @@ typedef enum x86_reg {
 	X86_REG_R9D, X86_REG_R10D, X86_REG_R11D, X86_REG_R12D, X86_REG_R13D,
 	X86_REG_R14D, X86_REG_R15D, X86_REG_R8W, X86_REG_R9W, X86_REG_R10W,
 	X86_REG_R11W, X86_REG_R12W, X86_REG_R13W, X86_REG_R14W, X86_REG_R15W,
+	X86_REG_BND0, X86_REG_BND1, X86_REG_BND2, X86_REG_BND3,
 
 	X86_REG_ENDING		// <-- mark the end of the list of registers
 } x86_reg;
 
-//> Sub-flags of EFLAGS
+// Sub-flags of EFLAGS
 #define X86_EFLAGS_MODIFY_AF (1ULL << 0)
 #define X86_EFLAGS_MODIFY_CF (1ULL << 1)
 #define X86_EFLAGS_MODIFY_SF (1ULL << 2)
@@ -116,19 +119,53 @@ typedef enum x86_reg {
 #define X86_EFLAGS_UNDEFINED_PF (1ULL << 43)
 #define X86_EFLAGS_UNDEFINED_AF (1ULL << 44)
 #define X86_EFLAGS_UNDEFINED_CF (1ULL << 45)
+#define X86_EFLAGS_RESET_RF (1ULL << 46)
+#define X86_EFLAGS_TEST_RF (1ULL << 47)
+#define X86_EFLAGS_TEST_IF (1ULL << 48)
+#define X86_EFLAGS_TEST_TF (1ULL << 49)
+#define X86_EFLAGS_TEST_AF (1ULL << 50)
+#define X86_EFLAGS_RESET_ZF (1ULL << 51)
+#define X86_EFLAGS_SET_OF (1ULL << 52)
+#define X86_EFLAGS_SET_SF (1ULL << 53)
+#define X86_EFLAGS_SET_ZF (1ULL << 54)
+#define X86_EFLAGS_SET_AF (1ULL << 55)
+#define X86_EFLAGS_SET_PF (1ULL << 56)
+#define X86_EFLAGS_RESET_0F (1ULL << 57)
+#define X86_EFLAGS_RESET_AC (1ULL << 58)
 
-//> Operand type for instruction's operands
+#define X86_FPU_FLAGS_MODIFY_C0 (1ULL << 0)
+#define X86_FPU_FLAGS_MODIFY_C1 (1ULL << 1)
+#define X86_FPU_FLAGS_MODIFY_C2 (1ULL << 2)
+#define X86_FPU_FLAGS_MODIFY_C3 (1ULL << 3)
+#define X86_FPU_FLAGS_RESET_C0 (1ULL << 4)
+#define X86_FPU_FLAGS_RESET_C1 (1ULL << 5)
+#define X86_FPU_FLAGS_RESET_C2 (1ULL << 6)
+#define X86_FPU_FLAGS_RESET_C3 (1ULL << 7)
+#define X86_FPU_FLAGS_SET_C0 (1ULL << 8)
+#define X86_FPU_FLAGS_SET_C1 (1ULL << 9)
+#define X86_FPU_FLAGS_SET_C2 (1ULL << 10)
+#define X86_FPU_FLAGS_SET_C3 (1ULL << 11)
+#define X86_FPU_FLAGS_UNDEFINED_C0 (1ULL << 12)
+#define X86_FPU_FLAGS_UNDEFINED_C1 (1ULL << 13)
+#define X86_FPU_FLAGS_UNDEFINED_C2 (1ULL << 14)
+#define X86_FPU_FLAGS_UNDEFINED_C3 (1ULL << 15)
+#define X86_FPU_FLAGS_TEST_C0 (1ULL << 16)
+#define X86_FPU_FLAGS_TEST_C1 (1ULL << 17)
+#define X86_FPU_FLAGS_TEST_C2 (1ULL << 18)
+#define X86_FPU_FLAGS_TEST_C3 (1ULL << 19)
+
+
+/// Operand type for instruction's operands
 typedef enum x86_op_type {
-	X86_OP_INVALID = 0, // = CS_OP_INVALID (Uninitialized).
-	X86_OP_REG, // = CS_OP_REG (Register operand).
-	X86_OP_IMM, // = CS_OP_IMM (Immediate operand).
-	X86_OP_MEM, // = CS_OP_MEM (Memory operand).
-	X86_OP_FP,  //  = CS_OP_FP  (Floating-Point operand).
+	X86_OP_INVALID = 0, ///< = CS_OP_INVALID (Uninitialized).
+	X86_OP_REG, ///< = CS_OP_REG (Register operand).
+	X86_OP_IMM, ///< = CS_OP_IMM (Immediate operand).
+	X86_OP_MEM, ///< = CS_OP_MEM (Memory operand).
 } x86_op_type;
 
-//> XOP Code Condition type
+/// XOP Code Condition type
 typedef enum x86_xop_cc {
-	X86_XOP_CC_INVALID = 0,	// Uninitialized.
+	X86_XOP_CC_INVALID = 0,	///< Uninitialized.
 	X86_XOP_CC_LT,
 	X86_XOP_CC_LE,
 	X86_XOP_CC_GT,
@@ -139,18 +176,18 @@ typedef enum x86_xop_cc {
 	X86_XOP_CC_TRUE,
 } x86_xop_cc;
 
-//> AVX broadcast type
+/// AVX broadcast type
 typedef enum x86_avx_bcast {
-	X86_AVX_BCAST_INVALID = 0,	// Uninitialized.
-	X86_AVX_BCAST_2,	// AVX512 broadcast type {1to2}
-	X86_AVX_BCAST_4,	// AVX512 broadcast type {1to4}
-	X86_AVX_BCAST_8,	// AVX512 broadcast type {1to8}
-	X86_AVX_BCAST_16,	// AVX512 broadcast type {1to16}
+	X86_AVX_BCAST_INVALID = 0,	///< Uninitialized.
+	X86_AVX_BCAST_2,	///< AVX512 broadcast type {1to2}
+	X86_AVX_BCAST_4,	///< AVX512 broadcast type {1to4}
+	X86_AVX_BCAST_8,	///< AVX512 broadcast type {1to8}
+	X86_AVX_BCAST_16,	///< AVX512 broadcast type {1to16}
 } x86_avx_bcast;
 
-//> SSE Code Condition type
+/// SSE Code Condition type
 typedef enum x86_sse_cc {
-	X86_SSE_CC_INVALID = 0,	// Uninitialized.
+	X86_SSE_CC_INVALID = 0,	///< Uninitialized.
 	X86_SSE_CC_EQ,
 	X86_SSE_CC_LT,
 	X86_SSE_CC_LE,
@@ -161,9 +198,9 @@ typedef enum x86_sse_cc {
 	X86_SSE_CC_ORD,
 } x86_sse_cc;
 
-//> AVX Code Condition type
+/// AVX Code Condition type
 typedef enum x86_avx_cc {
-	X86_AVX_CC_INVALID = 0,	// Uninitialized.
+	X86_AVX_CC_INVALID = 0,	///< Uninitialized.
 	X86_AVX_CC_EQ,
 	X86_AVX_CC_LT,
 	X86_AVX_CC_LE,
@@ -198,134 +235,153 @@ typedef enum x86_avx_cc {
 	X86_AVX_CC_TRUE_US,
 } x86_avx_cc;
 
-//> AVX static rounding mode type
+/// AVX static rounding mode type
 typedef enum x86_avx_rm {
-	X86_AVX_RM_INVALID = 0,	// Uninitialized.
-	X86_AVX_RM_RN,	// Round to nearest
-	X86_AVX_RM_RD,	// Round down
-	X86_AVX_RM_RU,	// Round up
-	X86_AVX_RM_RZ,	// Round toward zero
+	X86_AVX_RM_INVALID = 0,	///< Uninitialized.
+	X86_AVX_RM_RN,	///< Round to nearest
+	X86_AVX_RM_RD,	///< Round down
+	X86_AVX_RM_RU,	///< Round up
+	X86_AVX_RM_RZ,	///< Round toward zero
 } x86_avx_rm;
 
-//> Instruction prefixes - to be used in cs_x86.prefix[]
+/// Instruction prefixes - to be used in cs_x86.prefix[]
 typedef enum x86_prefix {
-	X86_PREFIX_LOCK		= 	0xf0,	// lock (cs_x86.prefix[0]
-	X86_PREFIX_REP		= 	0xf3,	// rep (cs_x86.prefix[0]
-	X86_PREFIX_REPE		= 	0xf3,	// repe/repz (cs_x86.prefix[0]
-	X86_PREFIX_REPNE	= 	0xf2,	// repne/repnz (cs_x86.prefix[0]
+	X86_PREFIX_LOCK		= 	0xf0,	///< lock (cs_x86.prefix[0]
+	X86_PREFIX_REP		= 	0xf3,	///< rep (cs_x86.prefix[0]
+	X86_PREFIX_REPE		= 	0xf3,	///< repe/repz (cs_x86.prefix[0]
+	X86_PREFIX_REPNE	= 	0xf2,	///< repne/repnz (cs_x86.prefix[0]
 
-	X86_PREFIX_CS		= 	0x2e,	// segment override CS (cs_x86.prefix[1]
-	X86_PREFIX_SS		= 	0x36,	// segment override SS (cs_x86.prefix[1]
-	X86_PREFIX_DS		= 	0x3e,	// segment override DS (cs_x86.prefix[1]
-	X86_PREFIX_ES		= 	0x26,	// segment override ES (cs_x86.prefix[1]
-	X86_PREFIX_FS		= 	0x64,	// segment override FS (cs_x86.prefix[1]
-	X86_PREFIX_GS		= 	0x65,	// segment override GS (cs_x86.prefix[1]
+	X86_PREFIX_CS		= 	0x2e,	///< segment override CS (cs_x86.prefix[1]
+	X86_PREFIX_SS		= 	0x36,	///< segment override SS (cs_x86.prefix[1]
+	X86_PREFIX_DS		= 	0x3e,	///< segment override DS (cs_x86.prefix[1]
+	X86_PREFIX_ES		= 	0x26,	///< segment override ES (cs_x86.prefix[1]
+	X86_PREFIX_FS		= 	0x64,	///< segment override FS (cs_x86.prefix[1]
+	X86_PREFIX_GS		= 	0x65,	///< segment override GS (cs_x86.prefix[1]
 
-	X86_PREFIX_OPSIZE	=	0x66,	// operand-size override (cs_x86.prefix[2]
-	X86_PREFIX_ADDRSIZE	=	0x67,	// address-size override (cs_x86.prefix[3]
+	X86_PREFIX_OPSIZE	=	0x66,	///< operand-size override (cs_x86.prefix[2]
+	X86_PREFIX_ADDRSIZE	=	0x67,	///< address-size override (cs_x86.prefix[3]
 } x86_prefix;
 
-// Instruction's operand referring to memory
-// This is associated with X86_OP_MEM operand type above
+/// Instruction's operand referring to memory
+/// This is associated with X86_OP_MEM operand type above
 typedef struct x86_op_mem {
-	x86_reg segment; // segment register (or X86_REG_INVALID if irrelevant)
-	x86_reg base;	// base register (or X86_REG_INVALID if irrelevant)
-	x86_reg index;	// index register (or X86_REG_INVALID if irrelevant)
-	int scale;	// scale for index register
-	int64_t disp;	// displacement value
+	x86_reg segment; ///< segment register (or X86_REG_INVALID if irrelevant)
+	x86_reg base;	///< base register (or X86_REG_INVALID if irrelevant)
+	x86_reg index;	///< index register (or X86_REG_INVALID if irrelevant)
+	int scale;	///< scale for index register
+	int64_t disp;	///< displacement value
 } x86_op_mem;
 
-// Instruction operand
+/// Instruction operand
 typedef struct cs_x86_op {
-		x86_op_type type;	// operand type
-		union {
-			x86_reg reg;	  // register value for REG operand
-			int64_t imm;		// immediate value for IMM operand
-			double fp;		// floating point value for FP operand
-			x86_op_mem mem;		// base/index/scale/disp value for MEM operand
-		};
+	x86_op_type type;	///< operand type
+	union {
+		x86_reg reg;	  ///< register value for REG operand
+		int64_t imm;		///< immediate value for IMM operand
+		x86_op_mem mem;		///< base/index/scale/disp value for MEM operand
+	};
 
-		// size of this operand (in bytes).
-		uint8_t size;
+	/// size of this operand (in bytes).
+	uint8_t size;
 
-		// How is this operand accessed? (READ, WRITE or READ|WRITE)
-		// This field is combined of cs_ac_type.
-		// NOTE: this field is irrelevant if engine is compiled in DIET mode.
-		uint8_t access;
+	/// How is this operand accessed? (READ, WRITE or READ|WRITE)
+	/// This field is combined of cs_ac_type.
+	/// NOTE: this field is irrelevant if engine is compiled in DIET mode.
+	uint8_t access;
 
-		// AVX broadcast type, or 0 if irrelevant
-		x86_avx_bcast avx_bcast;
+	/// AVX broadcast type, or 0 if irrelevant
+	x86_avx_bcast avx_bcast;
 
-		// AVX zero opmask {z}
-		bool avx_zero_opmask;
+	/// AVX zero opmask {z}
+	bool avx_zero_opmask;
 } cs_x86_op;
 
-// Instruction structure
+typedef struct cs_x86_encoding {
+	/// ModR/M offset, or 0 when irrelevant
+	uint8_t modrm_offset;
+
+	/// Displacement offset, or 0 when irrelevant.
+	uint8_t disp_offset;
+	uint8_t disp_size;
+
+	/// Immediate offset, or 0 when irrelevant.
+	uint8_t imm_offset;
+	uint8_t imm_size;
+} cs_x86_encoding;
+
+/// Instruction structure
 typedef struct cs_x86 {
-	// Instruction prefix, which can be up to 4 bytes.
-	// A prefix byte gets value 0 when irrelevant.
-	// prefix[0] indicates REP/REPNE/LOCK prefix (See X86_PREFIX_REP/REPNE/LOCK above)
-	// prefix[1] indicates segment override (irrelevant for x86_64):
-	// See X86_PREFIX_CS/SS/DS/ES/FS/GS above.
-	// prefix[2] indicates operand-size override (X86_PREFIX_OPSIZE)
-	// prefix[3] indicates address-size override (X86_PREFIX_ADDRSIZE)
+	/// Instruction prefix, which can be up to 4 bytes.
+	/// A prefix byte gets value 0 when irrelevant.
+	/// prefix[0] indicates REP/REPNE/LOCK prefix (See X86_PREFIX_REP/REPNE/LOCK above)
+	/// prefix[1] indicates segment override (irrelevant for x86_64):
+	/// See X86_PREFIX_CS/SS/DS/ES/FS/GS above.
+	/// prefix[2] indicates operand-size override (X86_PREFIX_OPSIZE)
+	/// prefix[3] indicates address-size override (X86_PREFIX_ADDRSIZE)
 	uint8_t prefix[4];
 
-	// Instruction opcode, wich can be from 1 to 4 bytes in size.
-	// This contains VEX opcode as well.
-	// An trailing opcode byte gets value 0 when irrelevant.
+	/// Instruction opcode, which can be from 1 to 4 bytes in size.
+	/// This contains VEX opcode as well.
+	/// An trailing opcode byte gets value 0 when irrelevant.
 	uint8_t opcode[4];
 
-	// REX prefix: only a non-zero value is relavant for x86_64
+	/// REX prefix: only a non-zero value is relevant for x86_64
 	uint8_t rex;
 
-	// Address size, which can be overrided with above prefix[5].
+	/// Address size, which can be overridden with above prefix[5].
 	uint8_t addr_size;
 
-	// ModR/M byte
+	/// ModR/M byte
 	uint8_t modrm;
 
-	// SIB value, or 0 when irrelevant.
+	/// SIB value, or 0 when irrelevant.
 	uint8_t sib;
 
-	// Displacement value, or 0 when irrelevant.
-	int32_t disp;
+	/// Displacement value, valid if encoding.disp_offset != 0
+	int64_t disp;
 
-	/* SIB state */
-	// SIB index register, or X86_REG_INVALID when irrelevant.
+	/// SIB index register, or X86_REG_INVALID when irrelevant.
 	x86_reg sib_index;
-	// SIB scale. only applicable if sib_index is relavant.
+	/// SIB scale, only applicable if sib_index is valid.
 	int8_t sib_scale;
-	// SIB base register, or X86_REG_INVALID when irrelevant.
+	/// SIB base register, or X86_REG_INVALID when irrelevant.
 	x86_reg sib_base;
 
-	// XOP Code Condition
+	/// XOP Code Condition
 	x86_xop_cc xop_cc;
 
-	// SSE Code Condition
+	/// SSE Code Condition
 	x86_sse_cc sse_cc;
 
-	// AVX Code Condition
+	/// AVX Code Condition
 	x86_avx_cc avx_cc;
 
-	// AVX Suppress all Exception
+	/// AVX Suppress all Exception
 	bool avx_sae;
 
-	// AVX static rounding mode
+	/// AVX static rounding mode
 	x86_avx_rm avx_rm;
 
-	// EFLAGS updated by this instruction.
-	// This can be formed from OR combination of X86_EFLAGS_* symbols in x86.h
-	uint64_t eflags;
+	
+	union {
+		/// EFLAGS updated by this instruction.
+		/// This can be formed from OR combination of X86_EFLAGS_* symbols in x86.h
+		uint64_t eflags;
+		/// FPU_FLAGS updated by this instruction.
+		/// This can be formed from OR combination of X86_FPU_FLAGS_* symbols in x86.h
+		uint64_t fpu_flags;
+	};
 
-	// Number of operands of this instruction,
-	// or 0 when instruction has no operand.
+	/// Number of operands of this instruction,
+	/// or 0 when instruction has no operand.
 	uint8_t op_count;
 
-	cs_x86_op operands[8];	// operands for this instruction.
+	cs_x86_op operands[8];	///< operands for this instruction.
+
+	cs_x86_encoding encoding;  ///< encoding information
 } cs_x86;
 
-//> X86 instructions
+/// X86 instructions
 typedef enum x86_insn {
 	X86_INS_INVALID = 0,
 
@@ -345,7 +401,6 @@ typedef enum x86_insn {
 	X86_INS_ADDSUBPS,
 	X86_INS_FADD,
 	X86_INS_FIADD,
-	X86_INS_FADDP,
 	X86_INS_ADOX,
 	X86_INS_AESDECLAST,
 	X86_INS_AESDEC,
@@ -375,6 +430,13 @@ typedef enum x86_insn {
 	X86_INS_BLSIC,
 	X86_INS_BLSMSK,
 	X86_INS_BLSR,
+	X86_INS_BNDCL,
+	X86_INS_BNDCN,
+	X86_INS_BNDCU,
+	X86_INS_BNDLDX,
+	X86_INS_BNDMK,
+	X86_INS_BNDMOV,
+	X86_INS_BNDSTX,
 	X86_INS_BOUND,
 	X86_INS_BSF,
 	X86_INS_BSR,
@@ -392,12 +454,15 @@ typedef enum x86_insn {
 	X86_INS_CLAC,
 	X86_INS_CLC,
 	X86_INS_CLD,
+	X86_INS_CLDEMOTE,
 	X86_INS_CLFLUSH,
 	X86_INS_CLFLUSHOPT,
 	X86_INS_CLGI,
 	X86_INS_CLI,
+	X86_INS_CLRSSBSY,
 	X86_INS_CLTS,
 	X86_INS_CLWB,
+	X86_INS_CLZERO,
 	X86_INS_CMC,
 	X86_INS_CMOVA,
 	X86_INS_CMOVAE,
@@ -418,6 +483,7 @@ typedef enum x86_insn {
 	X86_INS_CMOVNO,
 	X86_INS_CMOVNP,
 	X86_INS_FCMOVNU,
+	X86_INS_FCMOVNP,
 	X86_INS_CMOVNS,
 	X86_INS_CMOVO,
 	X86_INS_CMOVP,
@@ -479,21 +545,27 @@ typedef enum x86_insn {
 	X86_INS_FDIVP,
 	X86_INS_DPPD,
 	X86_INS_DPPS,
-	X86_INS_RET,
 	X86_INS_ENCLS,
 	X86_INS_ENCLU,
+	X86_INS_ENCLV,
+	X86_INS_ENDBR32,
+	X86_INS_ENDBR64,
 	X86_INS_ENTER,
 	X86_INS_EXTRACTPS,
 	X86_INS_EXTRQ,
 	X86_INS_F2XM1,
 	X86_INS_LCALL,
 	X86_INS_LJMP,
+	X86_INS_JMP,
 	X86_INS_FBLD,
 	X86_INS_FBSTP,
 	X86_INS_FCOMPP,
 	X86_INS_FDECSTP,
+	X86_INS_FDISI8087_NOP,
 	X86_INS_FEMMS,
+	X86_INS_FENI8087_NOP,
 	X86_INS_FFREE,
+	X86_INS_FFREEP,
 	X86_INS_FICOM,
 	X86_INS_FICOMP,
 	X86_INS_FINCSTP,
@@ -510,10 +582,10 @@ typedef enum x86_insn {
 	X86_INS_FNSTCW,
 	X86_INS_FNSTSW,
 	X86_INS_FPATAN,
+	X86_INS_FSTPNCE,
 	X86_INS_FPREM,
 	X86_INS_FPREM1,
 	X86_INS_FPTAN,
-	X86_INS_FFREEP,
 	X86_INS_FRNDINT,
 	X86_INS_FRSTOR,
 	X86_INS_FNSAVE,
@@ -529,15 +601,10 @@ typedef enum x86_insn {
 	X86_INS_FXTRACT,
 	X86_INS_FYL2X,
 	X86_INS_FYL2XP1,
-	X86_INS_MOVAPD,
-	X86_INS_MOVAPS,
-	X86_INS_ORPD,
-	X86_INS_ORPS,
-	X86_INS_VMOVAPD,
-	X86_INS_VMOVAPS,
-	X86_INS_XORPD,
-	X86_INS_XORPS,
 	X86_INS_GETSEC,
+	X86_INS_GF2P8AFFINEINVQB,
+	X86_INS_GF2P8AFFINEQB,
+	X86_INS_GF2P8MULB,
 	X86_INS_HADDPD,
 	X86_INS_HADDPS,
 	X86_INS_HLT,
@@ -548,6 +615,8 @@ typedef enum x86_insn {
 	X86_INS_IMUL,
 	X86_INS_IN,
 	X86_INS_INC,
+	X86_INS_INCSSPD,
+	X86_INS_INCSSPQ,
 	X86_INS_INSB,
 	X86_INS_INSERTPS,
 	X86_INS_INSERTQ,
@@ -569,22 +638,6 @@ typedef enum x86_insn {
 	X86_INS_FISTTP,
 	X86_INS_FIST,
 	X86_INS_FISTP,
-	X86_INS_UCOMISD,
-	X86_INS_UCOMISS,
-	X86_INS_VCOMISD,
-	X86_INS_VCOMISS,
-	X86_INS_VCVTSD2SS,
-	X86_INS_VCVTSI2SD,
-	X86_INS_VCVTSI2SS,
-	X86_INS_VCVTSS2SD,
-	X86_INS_VCVTTSD2SI,
-	X86_INS_VCVTTSD2USI,
-	X86_INS_VCVTTSS2SI,
-	X86_INS_VCVTTSS2USI,
-	X86_INS_VCVTUSI2SD,
-	X86_INS_VCVTUSI2SS,
-	X86_INS_VUCOMISD,
-	X86_INS_VUCOMISS,
 	X86_INS_JAE,
 	X86_INS_JA,
 	X86_INS_JBE,
@@ -596,7 +649,6 @@ typedef enum x86_insn {
 	X86_INS_JG,
 	X86_INS_JLE,
 	X86_INS_JL,
-	X86_INS_JMP,
 	X86_INS_JNE,
 	X86_INS_JNO,
 	X86_INS_JNP,
@@ -605,6 +657,10 @@ typedef enum x86_insn {
 	X86_INS_JP,
 	X86_INS_JRCXZ,
 	X86_INS_JS,
+	X86_INS_KADDB,
+	X86_INS_KADDD,
+	X86_INS_KADDQ,
+	X86_INS_KADDW,
 	X86_INS_KANDB,
 	X86_INS_KANDD,
 	X86_INS_KANDNB,
@@ -637,7 +693,13 @@ typedef enum x86_insn {
 	X86_INS_KSHIFTRD,
 	X86_INS_KSHIFTRQ,
 	X86_INS_KSHIFTRW,
+	X86_INS_KTESTB,
+	X86_INS_KTESTD,
+	X86_INS_KTESTQ,
+	X86_INS_KTESTW,
 	X86_INS_KUNPCKBW,
+	X86_INS_KUNPCKDQ,
+	X86_INS_KUNPCKWD,
 	X86_INS_KXNORB,
 	X86_INS_KXNORD,
 	X86_INS_KXNORQ,
@@ -663,10 +725,9 @@ typedef enum x86_insn {
 	X86_INS_LGS,
 	X86_INS_LIDT,
 	X86_INS_LLDT,
+	X86_INS_LLWPCB,
 	X86_INS_LMSW,
-	X86_INS_OR,
-	X86_INS_SUB,
-	X86_INS_XOR,
+	X86_INS_LOCK,
 	X86_INS_LODSB,
 	X86_INS_LODSD,
 	X86_INS_LODSQ,
@@ -679,7 +740,8 @@ typedef enum x86_insn {
 	X86_INS_LSL,
 	X86_INS_LSS,
 	X86_INS_LTR,
-	X86_INS_XADD,
+	X86_INS_LWPINS,
+	X86_INS_LWPVAL,
 	X86_INS_LZCNT,
 	X86_INS_MASKMOVDQU,
 	X86_INS_MAXPD,
@@ -700,10 +762,10 @@ typedef enum x86_insn {
 	X86_INS_EMMS,
 	X86_INS_MASKMOVQ,
 	X86_INS_MOVD,
+	X86_INS_MOVQ,
 	X86_INS_MOVDQ2Q,
 	X86_INS_MOVNTQ,
 	X86_INS_MOVQ2DQ,
-	X86_INS_MOVQ,
 	X86_INS_PABSB,
 	X86_INS_PABSD,
 	X86_INS_PABSW,
@@ -730,9 +792,9 @@ typedef enum x86_insn {
 	X86_INS_PCMPGTD,
 	X86_INS_PCMPGTW,
 	X86_INS_PEXTRW,
+	X86_INS_PHADDD,
 	X86_INS_PHADDSW,
 	X86_INS_PHADDW,
-	X86_INS_PHADDD,
 	X86_INS_PHSUBD,
 	X86_INS_PHSUBSW,
 	X86_INS_PHSUBW,
@@ -779,12 +841,17 @@ typedef enum x86_insn {
 	X86_INS_PUNPCKLDQ,
 	X86_INS_PUNPCKLWD,
 	X86_INS_PXOR,
+	X86_INS_MONITORX,
 	X86_INS_MONITOR,
 	X86_INS_MONTMUL,
 	X86_INS_MOV,
 	X86_INS_MOVABS,
+	X86_INS_MOVAPD,
+	X86_INS_MOVAPS,
 	X86_INS_MOVBE,
 	X86_INS_MOVDDUP,
+	X86_INS_MOVDIR64B,
+	X86_INS_MOVDIRI,
 	X86_INS_MOVDQA,
 	X86_INS_MOVDQU,
 	X86_INS_MOVHLPS,
@@ -824,10 +891,14 @@ typedef enum x86_insn {
 	X86_INS_FMUL,
 	X86_INS_FIMUL,
 	X86_INS_FMULP,
+	X86_INS_MWAITX,
 	X86_INS_MWAIT,
 	X86_INS_NEG,
 	X86_INS_NOP,
 	X86_INS_NOT,
+	X86_INS_OR,
+	X86_INS_ORPD,
+	X86_INS_ORPS,
 	X86_INS_OUT,
 	X86_INS_OUTSB,
 	X86_INS_OUTSD,
@@ -844,7 +915,7 @@ typedef enum x86_insn {
 	X86_INS_PCMPGTQ,
 	X86_INS_PCMPISTRI,
 	X86_INS_PCMPISTRM,
-	X86_INS_PCOMMIT,
+	X86_INS_PCONFIG,
 	X86_INS_PDEP,
 	X86_INS_PEXT,
 	X86_INS_PEXTRB,
@@ -911,6 +982,7 @@ typedef enum x86_insn {
 	X86_INS_PREFETCHT1,
 	X86_INS_PREFETCHT2,
 	X86_INS_PREFETCHW,
+	X86_INS_PREFETCHWT1,
 	X86_INS_PSHUFD,
 	X86_INS_PSHUFHW,
 	X86_INS_PSHUFLW,
@@ -918,6 +990,7 @@ typedef enum x86_insn {
 	X86_INS_PSRLDQ,
 	X86_INS_PSWAPD,
 	X86_INS_PTEST,
+	X86_INS_PTWRITE,
 	X86_INS_PUNPCKHQDQ,
 	X86_INS_PUNPCKLQDQ,
 	X86_INS_PUSH,
@@ -933,11 +1006,19 @@ typedef enum x86_insn {
 	X86_INS_RDFSBASE,
 	X86_INS_RDGSBASE,
 	X86_INS_RDMSR,
+	X86_INS_RDPID,
+	X86_INS_RDPKRU,
 	X86_INS_RDPMC,
 	X86_INS_RDRAND,
 	X86_INS_RDSEED,
+	X86_INS_RDSSPD,
+	X86_INS_RDSSPQ,
 	X86_INS_RDTSC,
 	X86_INS_RDTSCP,
+	X86_INS_REPNE,
+	X86_INS_REP,
+	X86_INS_RET,
+	X86_INS_REX64,
 	X86_INS_ROL,
 	X86_INS_ROR,
 	X86_INS_RORX,
@@ -948,11 +1029,13 @@ typedef enum x86_insn {
 	X86_INS_RSM,
 	X86_INS_RSQRTPS,
 	X86_INS_RSQRTSS,
+	X86_INS_RSTORSSP,
 	X86_INS_SAHF,
 	X86_INS_SAL,
 	X86_INS_SALC,
 	X86_INS_SAR,
 	X86_INS_SARX,
+	X86_INS_SAVEPREVSSP,
 	X86_INS_SBB,
 	X86_INS_SCASB,
 	X86_INS_SCASD,
@@ -973,6 +1056,7 @@ typedef enum x86_insn {
 	X86_INS_SETNS,
 	X86_INS_SETO,
 	X86_INS_SETP,
+	X86_INS_SETSSBSY,
 	X86_INS_SETS,
 	X86_INS_SFENCE,
 	X86_INS_SGDT,
@@ -995,6 +1079,7 @@ typedef enum x86_insn {
 	X86_INS_FSIN,
 	X86_INS_SKINIT,
 	X86_INS_SLDT,
+	X86_INS_SLWPCB,
 	X86_INS_SMSW,
 	X86_INS_SQRTPD,
 	X86_INS_SQRTPS,
@@ -1014,8 +1099,7 @@ typedef enum x86_insn {
 	X86_INS_STR,
 	X86_INS_FST,
 	X86_INS_FSTP,
-	X86_INS_FSTPNCE,
-	X86_INS_FXCH,
+	X86_INS_SUB,
 	X86_INS_SUBPD,
 	X86_INS_SUBPS,
 	X86_INS_FSUBR,
@@ -1030,23 +1114,35 @@ typedef enum x86_insn {
 	X86_INS_SYSCALL,
 	X86_INS_SYSENTER,
 	X86_INS_SYSEXIT,
+	X86_INS_SYSEXITQ,
 	X86_INS_SYSRET,
+	X86_INS_SYSRETQ,
 	X86_INS_T1MSKC,
 	X86_INS_TEST,
-	X86_INS_UD2,
+	X86_INS_TPAUSE,
 	X86_INS_FTST,
 	X86_INS_TZCNT,
 	X86_INS_TZMSK,
+	X86_INS_UCOMISD,
+	X86_INS_UCOMISS,
 	X86_INS_FUCOMPI,
 	X86_INS_FUCOMI,
 	X86_INS_FUCOMPP,
 	X86_INS_FUCOMP,
 	X86_INS_FUCOM,
-	X86_INS_UD2B,
+	X86_INS_UD0,
+	X86_INS_UD1,
+	X86_INS_UD2,
+	X86_INS_UMONITOR,
+	X86_INS_UMWAIT,
 	X86_INS_UNPCKHPD,
 	X86_INS_UNPCKHPS,
 	X86_INS_UNPCKLPD,
 	X86_INS_UNPCKLPS,
+	X86_INS_V4FMADDPS,
+	X86_INS_V4FMADDSS,
+	X86_INS_V4FNMADDPS,
+	X86_INS_V4FNMADDSS,
 	X86_INS_VADDPD,
 	X86_INS_VADDPS,
 	X86_INS_VADDSD,
@@ -1072,39 +1168,71 @@ typedef enum x86_insn {
 	X86_INS_VBLENDVPD,
 	X86_INS_VBLENDVPS,
 	X86_INS_VBROADCASTF128,
+	X86_INS_VBROADCASTF32X2,
+	X86_INS_VBROADCASTF32X4,
+	X86_INS_VBROADCASTF32X8,
+	X86_INS_VBROADCASTF64X2,
+	X86_INS_VBROADCASTF64X4,
+	X86_INS_VBROADCASTI128,
+	X86_INS_VBROADCASTI32X2,
 	X86_INS_VBROADCASTI32X4,
+	X86_INS_VBROADCASTI32X8,
+	X86_INS_VBROADCASTI64X2,
 	X86_INS_VBROADCASTI64X4,
 	X86_INS_VBROADCASTSD,
 	X86_INS_VBROADCASTSS,
+	X86_INS_VCMP,
 	X86_INS_VCMPPD,
 	X86_INS_VCMPPS,
 	X86_INS_VCMPSD,
 	X86_INS_VCMPSS,
+	X86_INS_VCOMISD,
+	X86_INS_VCOMISS,
 	X86_INS_VCOMPRESSPD,
 	X86_INS_VCOMPRESSPS,
 	X86_INS_VCVTDQ2PD,
 	X86_INS_VCVTDQ2PS,
-	X86_INS_VCVTPD2DQX,
 	X86_INS_VCVTPD2DQ,
-	X86_INS_VCVTPD2PSX,
 	X86_INS_VCVTPD2PS,
+	X86_INS_VCVTPD2QQ,
 	X86_INS_VCVTPD2UDQ,
+	X86_INS_VCVTPD2UQQ,
 	X86_INS_VCVTPH2PS,
 	X86_INS_VCVTPS2DQ,
 	X86_INS_VCVTPS2PD,
 	X86_INS_VCVTPS2PH,
+	X86_INS_VCVTPS2QQ,
 	X86_INS_VCVTPS2UDQ,
+	X86_INS_VCVTPS2UQQ,
+	X86_INS_VCVTQQ2PD,
+	X86_INS_VCVTQQ2PS,
 	X86_INS_VCVTSD2SI,
+	X86_INS_VCVTSD2SS,
 	X86_INS_VCVTSD2USI,
+	X86_INS_VCVTSI2SD,
+	X86_INS_VCVTSI2SS,
+	X86_INS_VCVTSS2SD,
 	X86_INS_VCVTSS2SI,
 	X86_INS_VCVTSS2USI,
-	X86_INS_VCVTTPD2DQX,
 	X86_INS_VCVTTPD2DQ,
+	X86_INS_VCVTTPD2QQ,
 	X86_INS_VCVTTPD2UDQ,
+	X86_INS_VCVTTPD2UQQ,
 	X86_INS_VCVTTPS2DQ,
+	X86_INS_VCVTTPS2QQ,
 	X86_INS_VCVTTPS2UDQ,
+	X86_INS_VCVTTPS2UQQ,
+	X86_INS_VCVTTSD2SI,
+	X86_INS_VCVTTSD2USI,
+	X86_INS_VCVTTSS2SI,
+	X86_INS_VCVTTSS2USI,
 	X86_INS_VCVTUDQ2PD,
 	X86_INS_VCVTUDQ2PS,
+	X86_INS_VCVTUQQ2PD,
+	X86_INS_VCVTUQQ2PS,
+	X86_INS_VCVTUSI2SD,
+	X86_INS_VCVTUSI2SS,
+	X86_INS_VDBPSADBW,
 	X86_INS_VDIVPD,
 	X86_INS_VDIVPS,
 	X86_INS_VDIVSD,
@@ -1119,99 +1247,107 @@ typedef enum x86_insn {
 	X86_INS_VEXPANDPS,
 	X86_INS_VEXTRACTF128,
 	X86_INS_VEXTRACTF32X4,
+	X86_INS_VEXTRACTF32X8,
+	X86_INS_VEXTRACTF64X2,
 	X86_INS_VEXTRACTF64X4,
 	X86_INS_VEXTRACTI128,
 	X86_INS_VEXTRACTI32X4,
+	X86_INS_VEXTRACTI32X8,
+	X86_INS_VEXTRACTI64X2,
 	X86_INS_VEXTRACTI64X4,
 	X86_INS_VEXTRACTPS,
+	X86_INS_VFIXUPIMMPD,
+	X86_INS_VFIXUPIMMPS,
+	X86_INS_VFIXUPIMMSD,
+	X86_INS_VFIXUPIMMSS,
 	X86_INS_VFMADD132PD,
 	X86_INS_VFMADD132PS,
-	X86_INS_VFMADDPD,
+	X86_INS_VFMADD132SD,
+	X86_INS_VFMADD132SS,
 	X86_INS_VFMADD213PD,
-	X86_INS_VFMADD231PD,
-	X86_INS_VFMADDPS,
 	X86_INS_VFMADD213PS,
-	X86_INS_VFMADD231PS,
-	X86_INS_VFMADDSD,
 	X86_INS_VFMADD213SD,
-	X86_INS_VFMADD132SD,
-	X86_INS_VFMADD231SD,
-	X86_INS_VFMADDSS,
 	X86_INS_VFMADD213SS,
-	X86_INS_VFMADD132SS,
+	X86_INS_VFMADD231PD,
+	X86_INS_VFMADD231PS,
+	X86_INS_VFMADD231SD,
 	X86_INS_VFMADD231SS,
+	X86_INS_VFMADDPD,
+	X86_INS_VFMADDPS,
+	X86_INS_VFMADDSD,
+	X86_INS_VFMADDSS,
 	X86_INS_VFMADDSUB132PD,
 	X86_INS_VFMADDSUB132PS,
-	X86_INS_VFMADDSUBPD,
 	X86_INS_VFMADDSUB213PD,
-	X86_INS_VFMADDSUB231PD,
-	X86_INS_VFMADDSUBPS,
 	X86_INS_VFMADDSUB213PS,
+	X86_INS_VFMADDSUB231PD,
 	X86_INS_VFMADDSUB231PS,
+	X86_INS_VFMADDSUBPD,
+	X86_INS_VFMADDSUBPS,
 	X86_INS_VFMSUB132PD,
 	X86_INS_VFMSUB132PS,
+	X86_INS_VFMSUB132SD,
+	X86_INS_VFMSUB132SS,
+	X86_INS_VFMSUB213PD,
+	X86_INS_VFMSUB213PS,
+	X86_INS_VFMSUB213SD,
+	X86_INS_VFMSUB213SS,
+	X86_INS_VFMSUB231PD,
+	X86_INS_VFMSUB231PS,
+	X86_INS_VFMSUB231SD,
+	X86_INS_VFMSUB231SS,
 	X86_INS_VFMSUBADD132PD,
 	X86_INS_VFMSUBADD132PS,
-	X86_INS_VFMSUBADDPD,
 	X86_INS_VFMSUBADD213PD,
-	X86_INS_VFMSUBADD231PD,
-	X86_INS_VFMSUBADDPS,
 	X86_INS_VFMSUBADD213PS,
+	X86_INS_VFMSUBADD231PD,
 	X86_INS_VFMSUBADD231PS,
+	X86_INS_VFMSUBADDPD,
+	X86_INS_VFMSUBADDPS,
 	X86_INS_VFMSUBPD,
-	X86_INS_VFMSUB213PD,
-	X86_INS_VFMSUB231PD,
 	X86_INS_VFMSUBPS,
-	X86_INS_VFMSUB213PS,
-	X86_INS_VFMSUB231PS,
 	X86_INS_VFMSUBSD,
-	X86_INS_VFMSUB213SD,
-	X86_INS_VFMSUB132SD,
-	X86_INS_VFMSUB231SD,
 	X86_INS_VFMSUBSS,
-	X86_INS_VFMSUB213SS,
-	X86_INS_VFMSUB132SS,
-	X86_INS_VFMSUB231SS,
 	X86_INS_VFNMADD132PD,
 	X86_INS_VFNMADD132PS,
-	X86_INS_VFNMADDPD,
+	X86_INS_VFNMADD132SD,
+	X86_INS_VFNMADD132SS,
 	X86_INS_VFNMADD213PD,
-	X86_INS_VFNMADD231PD,
-	X86_INS_VFNMADDPS,
 	X86_INS_VFNMADD213PS,
-	X86_INS_VFNMADD231PS,
-	X86_INS_VFNMADDSD,
 	X86_INS_VFNMADD213SD,
-	X86_INS_VFNMADD132SD,
-	X86_INS_VFNMADD231SD,
-	X86_INS_VFNMADDSS,
 	X86_INS_VFNMADD213SS,
-	X86_INS_VFNMADD132SS,
+	X86_INS_VFNMADD231PD,
+	X86_INS_VFNMADD231PS,
+	X86_INS_VFNMADD231SD,
 	X86_INS_VFNMADD231SS,
+	X86_INS_VFNMADDPD,
+	X86_INS_VFNMADDPS,
+	X86_INS_VFNMADDSD,
+	X86_INS_VFNMADDSS,
 	X86_INS_VFNMSUB132PD,
 	X86_INS_VFNMSUB132PS,
-	X86_INS_VFNMSUBPD,
+	X86_INS_VFNMSUB132SD,
+	X86_INS_VFNMSUB132SS,
 	X86_INS_VFNMSUB213PD,
-	X86_INS_VFNMSUB231PD,
-	X86_INS_VFNMSUBPS,
 	X86_INS_VFNMSUB213PS,
-	X86_INS_VFNMSUB231PS,
-	X86_INS_VFNMSUBSD,
 	X86_INS_VFNMSUB213SD,
-	X86_INS_VFNMSUB132SD,
-	X86_INS_VFNMSUB231SD,
-	X86_INS_VFNMSUBSS,
 	X86_INS_VFNMSUB213SS,
-	X86_INS_VFNMSUB132SS,
+	X86_INS_VFNMSUB231PD,
+	X86_INS_VFNMSUB231PS,
+	X86_INS_VFNMSUB231SD,
 	X86_INS_VFNMSUB231SS,
+	X86_INS_VFNMSUBPD,
+	X86_INS_VFNMSUBPS,
+	X86_INS_VFNMSUBSD,
+	X86_INS_VFNMSUBSS,
+	X86_INS_VFPCLASSPD,
+	X86_INS_VFPCLASSPS,
+	X86_INS_VFPCLASSSD,
+	X86_INS_VFPCLASSSS,
 	X86_INS_VFRCZPD,
 	X86_INS_VFRCZPS,
 	X86_INS_VFRCZSD,
 	X86_INS_VFRCZSS,
-	X86_INS_VORPD,
-	X86_INS_VORPS,
-	X86_INS_VXORPD,
-	X86_INS_VXORPS,
 	X86_INS_VGATHERDPD,
 	X86_INS_VGATHERDPS,
 	X86_INS_VGATHERPF0DPD,
@@ -1224,6 +1360,17 @@ typedef enum x86_insn {
 	X86_INS_VGATHERPF1QPS,
 	X86_INS_VGATHERQPD,
 	X86_INS_VGATHERQPS,
+	X86_INS_VGETEXPPD,
+	X86_INS_VGETEXPPS,
+	X86_INS_VGETEXPSD,
+	X86_INS_VGETEXPSS,
+	X86_INS_VGETMANTPD,
+	X86_INS_VGETMANTPS,
+	X86_INS_VGETMANTSD,
+	X86_INS_VGETMANTSS,
+	X86_INS_VGF2P8AFFINEINVQB,
+	X86_INS_VGF2P8AFFINEQB,
+	X86_INS_VGF2P8MULB,
 	X86_INS_VHADDPD,
 	X86_INS_VHADDPS,
 	X86_INS_VHSUBPD,
@@ -1259,6 +1406,8 @@ typedef enum x86_insn {
 	X86_INS_VMLOAD,
 	X86_INS_VMMCALL,
 	X86_INS_VMOVQ,
+	X86_INS_VMOVAPD,
+	X86_INS_VMOVAPS,
 	X86_INS_VMOVDDUP,
 	X86_INS_VMOVD,
 	X86_INS_VMOVDQA32,
@@ -1301,6 +1450,10 @@ typedef enum x86_insn {
 	X86_INS_VMWRITE,
 	X86_INS_VMXOFF,
 	X86_INS_VMXON,
+	X86_INS_VORPD,
+	X86_INS_VORPS,
+	X86_INS_VP4DPWSSDS,
+	X86_INS_VP4DPWSSD,
 	X86_INS_VPABSB,
 	X86_INS_VPABSD,
 	X86_INS_VPABSQ,
@@ -1341,6 +1494,7 @@ typedef enum x86_insn {
 	X86_INS_VPBROADCASTW,
 	X86_INS_VPCLMULQDQ,
 	X86_INS_VPCMOV,
+	X86_INS_VPCMP,
 	X86_INS_VPCMPB,
 	X86_INS_VPCMPD,
 	X86_INS_VPCMPEQB,
@@ -1361,10 +1515,13 @@ typedef enum x86_insn {
 	X86_INS_VPCMPUQ,
 	X86_INS_VPCMPUW,
 	X86_INS_VPCMPW,
+	X86_INS_VPCOM,
 	X86_INS_VPCOMB,
 	X86_INS_VPCOMD,
+	X86_INS_VPCOMPRESSB,
 	X86_INS_VPCOMPRESSD,
 	X86_INS_VPCOMPRESSQ,
+	X86_INS_VPCOMPRESSW,
 	X86_INS_VPCOMQ,
 	X86_INS_VPCOMUB,
 	X86_INS_VPCOMUD,
@@ -1373,26 +1530,38 @@ typedef enum x86_insn {
 	X86_INS_VPCOMW,
 	X86_INS_VPCONFLICTD,
 	X86_INS_VPCONFLICTQ,
+	X86_INS_VPDPBUSDS,
+	X86_INS_VPDPBUSD,
+	X86_INS_VPDPWSSDS,
+	X86_INS_VPDPWSSD,
 	X86_INS_VPERM2F128,
 	X86_INS_VPERM2I128,
+	X86_INS_VPERMB,
 	X86_INS_VPERMD,
+	X86_INS_VPERMI2B,
 	X86_INS_VPERMI2D,
 	X86_INS_VPERMI2PD,
 	X86_INS_VPERMI2PS,
 	X86_INS_VPERMI2Q,
+	X86_INS_VPERMI2W,
 	X86_INS_VPERMIL2PD,
-	X86_INS_VPERMIL2PS,
 	X86_INS_VPERMILPD,
+	X86_INS_VPERMIL2PS,
 	X86_INS_VPERMILPS,
 	X86_INS_VPERMPD,
 	X86_INS_VPERMPS,
 	X86_INS_VPERMQ,
+	X86_INS_VPERMT2B,
 	X86_INS_VPERMT2D,
 	X86_INS_VPERMT2PD,
 	X86_INS_VPERMT2PS,
 	X86_INS_VPERMT2Q,
+	X86_INS_VPERMT2W,
+	X86_INS_VPERMW,
+	X86_INS_VPEXPANDB,
 	X86_INS_VPEXPANDD,
 	X86_INS_VPEXPANDQ,
+	X86_INS_VPEXPANDW,
 	X86_INS_VPEXTRB,
 	X86_INS_VPEXTRD,
 	X86_INS_VPEXTRQ,
@@ -1441,6 +1610,8 @@ typedef enum x86_insn {
 	X86_INS_VPMACSWW,
 	X86_INS_VPMADCSSWD,
 	X86_INS_VPMADCSWD,
+	X86_INS_VPMADD52HUQ,
+	X86_INS_VPMADD52LUQ,
 	X86_INS_VPMADDUBSW,
 	X86_INS_VPMADDWD,
 	X86_INS_VPMASKMOVD,
@@ -1461,6 +1632,8 @@ typedef enum x86_insn {
 	X86_INS_VPMINUD,
 	X86_INS_VPMINUQ,
 	X86_INS_VPMINUW,
+	X86_INS_VPMOVB2M,
+	X86_INS_VPMOVD2M,
 	X86_INS_VPMOVDB,
 	X86_INS_VPMOVDW,
 	X86_INS_VPMOVM2B,
@@ -1468,6 +1641,7 @@ typedef enum x86_insn {
 	X86_INS_VPMOVM2Q,
 	X86_INS_VPMOVM2W,
 	X86_INS_VPMOVMSKB,
+	X86_INS_VPMOVQ2M,
 	X86_INS_VPMOVQB,
 	X86_INS_VPMOVQD,
 	X86_INS_VPMOVQW,
@@ -1476,6 +1650,7 @@ typedef enum x86_insn {
 	X86_INS_VPMOVSQB,
 	X86_INS_VPMOVSQD,
 	X86_INS_VPMOVSQW,
+	X86_INS_VPMOVSWB,
 	X86_INS_VPMOVSXBD,
 	X86_INS_VPMOVSXBQ,
 	X86_INS_VPMOVSXBW,
@@ -1487,6 +1662,9 @@ typedef enum x86_insn {
 	X86_INS_VPMOVUSQB,
 	X86_INS_VPMOVUSQD,
 	X86_INS_VPMOVUSQW,
+	X86_INS_VPMOVUSWB,
+	X86_INS_VPMOVW2M,
+	X86_INS_VPMOVWB,
 	X86_INS_VPMOVZXBD,
 	X86_INS_VPMOVZXBQ,
 	X86_INS_VPMOVZXBW,
@@ -1500,11 +1678,24 @@ typedef enum x86_insn {
 	X86_INS_VPMULLD,
 	X86_INS_VPMULLQ,
 	X86_INS_VPMULLW,
+	X86_INS_VPMULTISHIFTQB,
 	X86_INS_VPMULUDQ,
+	X86_INS_VPOPCNTB,
+	X86_INS_VPOPCNTD,
+	X86_INS_VPOPCNTQ,
+	X86_INS_VPOPCNTW,
 	X86_INS_VPORD,
 	X86_INS_VPORQ,
 	X86_INS_VPOR,
 	X86_INS_VPPERM,
+	X86_INS_VPROLD,
+	X86_INS_VPROLQ,
+	X86_INS_VPROLVD,
+	X86_INS_VPROLVQ,
+	X86_INS_VPRORD,
+	X86_INS_VPRORQ,
+	X86_INS_VPRORVD,
+	X86_INS_VPRORVQ,
 	X86_INS_VPROTB,
 	X86_INS_VPROTD,
 	X86_INS_VPROTQ,
@@ -1519,9 +1710,22 @@ typedef enum x86_insn {
 	X86_INS_VPSHAQ,
 	X86_INS_VPSHAW,
 	X86_INS_VPSHLB,
+	X86_INS_VPSHLDD,
+	X86_INS_VPSHLDQ,
+	X86_INS_VPSHLDVD,
+	X86_INS_VPSHLDVQ,
+	X86_INS_VPSHLDVW,
+	X86_INS_VPSHLDW,
 	X86_INS_VPSHLD,
 	X86_INS_VPSHLQ,
 	X86_INS_VPSHLW,
+	X86_INS_VPSHRDD,
+	X86_INS_VPSHRDQ,
+	X86_INS_VPSHRDVD,
+	X86_INS_VPSHRDVQ,
+	X86_INS_VPSHRDVW,
+	X86_INS_VPSHRDW,
+	X86_INS_VPSHUFBITQMB,
 	X86_INS_VPSHUFB,
 	X86_INS_VPSHUFD,
 	X86_INS_VPSHUFHW,
@@ -1534,17 +1738,20 @@ typedef enum x86_insn {
 	X86_INS_VPSLLQ,
 	X86_INS_VPSLLVD,
 	X86_INS_VPSLLVQ,
+	X86_INS_VPSLLVW,
 	X86_INS_VPSLLW,
 	X86_INS_VPSRAD,
 	X86_INS_VPSRAQ,
 	X86_INS_VPSRAVD,
 	X86_INS_VPSRAVQ,
+	X86_INS_VPSRAVW,
 	X86_INS_VPSRAW,
 	X86_INS_VPSRLDQ,
 	X86_INS_VPSRLD,
 	X86_INS_VPSRLQ,
 	X86_INS_VPSRLVD,
 	X86_INS_VPSRLVQ,
+	X86_INS_VPSRLVW,
 	X86_INS_VPSRLW,
 	X86_INS_VPSUBB,
 	X86_INS_VPSUBD,
@@ -1554,10 +1761,16 @@ typedef enum x86_insn {
 	X86_INS_VPSUBUSB,
 	X86_INS_VPSUBUSW,
 	X86_INS_VPSUBW,
+	X86_INS_VPTERNLOGD,
+	X86_INS_VPTERNLOGQ,
+	X86_INS_VPTESTMB,
 	X86_INS_VPTESTMD,
 	X86_INS_VPTESTMQ,
+	X86_INS_VPTESTMW,
+	X86_INS_VPTESTNMB,
 	X86_INS_VPTESTNMD,
 	X86_INS_VPTESTNMQ,
+	X86_INS_VPTESTNMW,
 	X86_INS_VPTEST,
 	X86_INS_VPUNPCKHBW,
 	X86_INS_VPUNPCKHDQ,
@@ -1570,6 +1783,10 @@ typedef enum x86_insn {
 	X86_INS_VPXORD,
 	X86_INS_VPXORQ,
 	X86_INS_VPXOR,
+	X86_INS_VRANGEPD,
+	X86_INS_VRANGEPS,
+	X86_INS_VRANGESD,
+	X86_INS_VRANGESS,
 	X86_INS_VRCP14PD,
 	X86_INS_VRCP14PS,
 	X86_INS_VRCP14SD,
@@ -1580,6 +1797,10 @@ typedef enum x86_insn {
 	X86_INS_VRCP28SS,
 	X86_INS_VRCPPS,
 	X86_INS_VRCPSS,
+	X86_INS_VREDUCEPD,
+	X86_INS_VREDUCEPS,
+	X86_INS_VREDUCESD,
+	X86_INS_VREDUCESS,
 	X86_INS_VRNDSCALEPD,
 	X86_INS_VRNDSCALEPS,
 	X86_INS_VRNDSCALESD,
@@ -1598,6 +1819,10 @@ typedef enum x86_insn {
 	X86_INS_VRSQRT28SS,
 	X86_INS_VRSQRTPS,
 	X86_INS_VRSQRTSS,
+	X86_INS_VSCALEFPD,
+	X86_INS_VSCALEFPS,
+	X86_INS_VSCALEFSD,
+	X86_INS_VSCALEFSS,
 	X86_INS_VSCATTERDPD,
 	X86_INS_VSCATTERDPS,
 	X86_INS_VSCATTERPF0DPD,
@@ -1610,6 +1835,10 @@ typedef enum x86_insn {
 	X86_INS_VSCATTERPF1QPS,
 	X86_INS_VSCATTERQPD,
 	X86_INS_VSCATTERQPS,
+	X86_INS_VSHUFF32X4,
+	X86_INS_VSHUFF64X2,
+	X86_INS_VSHUFI32X4,
+	X86_INS_VSHUFI64X2,
 	X86_INS_VSHUFPD,
 	X86_INS_VSHUFPS,
 	X86_INS_VSQRTPD,
@@ -1623,21 +1852,33 @@ typedef enum x86_insn {
 	X86_INS_VSUBSS,
 	X86_INS_VTESTPD,
 	X86_INS_VTESTPS,
+	X86_INS_VUCOMISD,
+	X86_INS_VUCOMISS,
 	X86_INS_VUNPCKHPD,
 	X86_INS_VUNPCKHPS,
 	X86_INS_VUNPCKLPD,
 	X86_INS_VUNPCKLPS,
+	X86_INS_VXORPD,
+	X86_INS_VXORPS,
 	X86_INS_VZEROALL,
 	X86_INS_VZEROUPPER,
 	X86_INS_WAIT,
 	X86_INS_WBINVD,
+	X86_INS_WBNOINVD,
 	X86_INS_WRFSBASE,
 	X86_INS_WRGSBASE,
 	X86_INS_WRMSR,
+	X86_INS_WRPKRU,
+	X86_INS_WRSSD,
+	X86_INS_WRSSQ,
+	X86_INS_WRUSSD,
+	X86_INS_WRUSSQ,
 	X86_INS_XABORT,
 	X86_INS_XACQUIRE,
+	X86_INS_XADD,
 	X86_INS_XBEGIN,
 	X86_INS_XCHG,
+	X86_INS_FXCH,
 	X86_INS_XCRYPTCBC,
 	X86_INS_XCRYPTCFB,
 	X86_INS_XCRYPTCTR,
@@ -1646,6 +1887,9 @@ typedef enum x86_insn {
 	X86_INS_XEND,
 	X86_INS_XGETBV,
 	X86_INS_XLATB,
+	X86_INS_XOR,
+	X86_INS_XORPD,
+	X86_INS_XORPS,
 	X86_INS_XRELEASE,
 	X86_INS_XRSTOR,
 	X86_INS_XRSTOR64,
@@ -1664,32 +1908,32 @@ typedef enum x86_insn {
 	X86_INS_XSHA256,
 	X86_INS_XSTORE,
 	X86_INS_XTEST,
-	X86_INS_FDISI8087_NOP,
-	X86_INS_FENI8087_NOP,
 
 	X86_INS_ENDING, // mark the end of the list of insn
 } x86_insn;
 
-//> Group of X86 instructions
+/// Group of X86 instructions
 typedef enum  x86_insn_group {
-	X86_GRP_INVALID = 0, // = CS_GRP_INVALID
+	X86_GRP_INVALID = 0, ///< = CS_GRP_INVALID
 
-	//> Generic groups
+	// Generic groups
 	// all jump instructions (conditional+direct+indirect jumps)
-	X86_GRP_JUMP,	// = CS_GRP_JUMP
+	X86_GRP_JUMP,	///< = CS_GRP_JUMP
 	// all call instructions
-	X86_GRP_CALL,	// = CS_GRP_CALL
+	X86_GRP_CALL,	///< = CS_GRP_CALL
 	// all return instructions
-	X86_GRP_RET,	// = CS_GRP_RET
+	X86_GRP_RET,	///< = CS_GRP_RET
 	// all interrupt instructions (int+syscall)
-	X86_GRP_INT,	// = CS_GRP_INT
+	X86_GRP_INT,	///< = CS_GRP_INT
 	// all interrupt return instructions
-	X86_GRP_IRET,	// = CS_GRP_IRET
+	X86_GRP_IRET,	///< = CS_GRP_IRET
 	// all privileged instructions
-	X86_GRP_PRIVILEGE,	// = CS_GRP_PRIVILEGE
+	X86_GRP_PRIVILEGE,	///< = CS_GRP_PRIVILEGE
+	// all relative branching instructions
+	X86_GRP_BRANCH_RELATIVE, ///< = CS_GRP_BRANCH_RELATIVE
 
-	//> Architecture-specific groups
-	X86_GRP_VM = 128,	// all virtualization instructions (VT-x + AMD-V)
+	// Architecture-specific groups
+	X86_GRP_VM = 128,	///< all virtualization instructions (VT-x + AMD-V)
 	X86_GRP_3DNOW,
 	X86_GRP_AES,
 	X86_GRP_ADX,
@@ -1730,6 +1974,7 @@ typedef enum  x86_insn_group {
 	X86_GRP_VLX,
 	X86_GRP_SMAP,
 	X86_GRP_NOVLX,
+	X86_GRP_FPU,
 
 	X86_GRP_ENDING
 } x86_insn_group;
@@ -115,8 +115,16 @@ typedef enum PDEventType {
 
     // setbreakpoint send a breakpoint to the backend with supplied id
     // Back end will reply if this worked correct with supplied ID
+    //
+    // Optional fields:
+    //   "condition" (data) byte code (see pd_expression.h) that has to evaluate to non-zero for the target to stop
+    //   "hit_count" (u32) only stop when the breakpoint (and its condition) has been hit at least this many times
 
     PDEventType_SetBreakpoint,
+
+    // Reply to SyncBreakpoints. Has a "breakpoints" array with one entry per synced breakpoint:
+    //   "id" (u32) id of the breakpoint, "status" (u8) 1 if the breakpoint could be set, 0 otherwise
+
     PDEventType_ReplyBreakpoint,
 
     PDEventType_DeleteBreakpoint,
@@ -139,6 +147,53 @@ typedef enum PDEventType {
     PDEventType_RequestEvalExpression,
     PDEventType_ReplyEvalExpression,
 
+    // Pull records from the tracepoint buffer of the backend. Optional "max_records" (u32) limits the reply.
+    // The backend replies with one or more SetTraceData events (see pd_trace.h)
+
+    PDEventType_GetTraceData,
+    PDEventType_SetTraceData,
+
+    // Batch of breakpoint changes. Has a "breakpoints" array where each entry has
+    //   "id" (u32) stable id assigned by the frontend, "action" (u8) PDBreakpointAction
+    //   "address" (u64) or "filename" (string) + "line" (u32) for the location (also sent for removes)
+    //   optional "condition" and "hit_count" as in SetBreakpoint
+    //   optional "watch" (u8) PDWatchType and "size" (u32). If set this is a data watchpoint on
+    //   [address, address + size) that stops the target when the memory is read and/or written (also sent for removes)
+    //   optional "tracepoint" (u8). If non-zero the target never stops here, instead each hit (where the condition is
+    //   true) records the "captures" (data, see pd_trace.h) into the backend trace buffer
+    // Removes always comes before adds/modifies in the array. The backend replies with ReplyBreakpoint.
+
+    PDEventType_SyncBreakpoints,
+
+    // Search memory in [address_start, address_start + size) for "pattern" (data). Optional fields are "mask" (data,
+    // same size as the pattern) where only the bits that are set are compared, "alignment" (u32) to only report
+    // matches at addresses that are a multiple of it and "max_hits" (u32).
+    // The backend replies with a SetSearchResults event with "address_start" (u64) from the request, "hits" (data,
+    // array of u64 addresses in increasing order) and "searched_to" (u64), the address the search got to (the end of
+    // the range unless max_hits was reached). Backends that don't support this don't reply and the frontend searches
+    // memory read with GetMemory instead.
+
+    PDEventType_SearchMemory,
+    PDEventType_SetSearchResults,
+
+    // Asks which architecture the target is so the frontend can disassemble memory by itself with Capstone. The
+    // backend replies with a SetTargetInfo event with "capstone_arch" (u32, cs_arch) and "capstone_mode" (u32,
+    // cs_mode, including the endianness) as found in capstone/capstone.h and "address_width" (u32) in bytes. The
+    // optional "build_id" (string) identifies the binary (such as the hex of the GNU build id) so the frontend can
+    // keep decoded code on disk between sessions. The optional "load_bias" (u64) is how far the executable was moved
+    // from its link addresses when loaded (position independent executables), only sent once it's known. Backends
+    // that don't know the target yet (or don't support this) don't reply and are asked again at the next stop.
+
+    PDEventType_GetTargetInfo,
+    PDEventType_SetTargetInfo,
+
+    // Asks for the line tables of the target. The backend replies with a SetLineTable event per compile unit holding
+    // its rows in bulk, split over several replies for large programs (see pd_line_table.h). Backends without line
+    // information don't reply.
+
+    PDEventType_GetLineTable,
+    PDEventType_SetLineTable,
+
     // End of events
 
     PDEventType_End,
@@ -150,6 +205,22 @@ typedef enum PDEventType {
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+typedef enum PDBreakpointAction {
+    PDBreakpointAction_Add,
+    PDBreakpointAction_Remove,
+    PDBreakpointAction_Modify,
+} PDBreakpointAction;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+typedef enum PDWatchType {
+    PDWatchType_Read = 1,
+    PDWatchType_Write = 2,
+    PDWatchType_Access = 3,
+} PDWatchType;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 typedef struct PDBackendPlugin {
     const char* name;
 
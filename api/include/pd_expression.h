@@ -0,0 +1,291 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Compiled expressions
+//
+// Expressions (such as "eax + 0x10" or "*(sp + 4) == 2") are compiled by the frontend to a small stack based byte
+// code where all values are unsigned 64-bit integers. The evaluator is header only so backends can evaluate the same
+// code in place (for breakpoint conditions and tracepoints) without having a parser of their own.
+//
+// Encoding: each instruction is one byte (PDExprOp) followed by its operands. All multi-byte operands are stored in
+// little endian order. Registers are referred to by index in the order the backend sent them in SetRegisters.
+
+typedef enum PDExprOp {
+    PDExprOp_End,
+    // push 64-bit constant (8 bytes operand)
+    PDExprOp_Const,
+    // push register value (2 bytes register index)
+    PDExprOp_Register,
+    // pop address, push memory value (1 byte operand with size 1, 2, 4 or 8)
+    PDExprOp_Load,
+    // unary ops
+    PDExprOp_Neg,
+    PDExprOp_Not,
+    PDExprOp_LogicalNot,
+    // binary ops
+    PDExprOp_Add,
+    PDExprOp_Sub,
+    PDExprOp_Mul,
+    PDExprOp_Div,
+    PDExprOp_Mod,
+    PDExprOp_And,
+    PDExprOp_Or,
+    PDExprOp_Xor,
+    PDExprOp_Shl,
+    PDExprOp_Shr,
+    PDExprOp_Eq,
+    PDExprOp_Ne,
+    PDExprOp_Lt,
+    PDExprOp_Le,
+    PDExprOp_Gt,
+    PDExprOp_Ge,
+    PDExprOp_LogicalAnd,
+    PDExprOp_LogicalOr,
+    // short-circuit for && and || (2 bytes forward offset from the end of the operand). If the top of the stack is
+    // zero (JumpIfFalse) or non-zero (JumpIfTrue) it's replaced with 0 or 1 and execution continues at the offset,
+    // otherwise the value is left on the stack for the LogicalAnd/LogicalOr that follows the right hand side
+    PDExprOp_JumpIfFalse,
+    PDExprOp_JumpIfTrue,
+    PDExprOp_Count
+} PDExprOp;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+typedef enum PDExprStatus {
+    PDExprStatus_Ok,
+    PDExprStatus_InvalidCode,
+    PDExprStatus_StackOverflow,
+    PDExprStatus_DivideByZero,
+    PDExprStatus_BadRegister,
+    PDExprStatus_BadMemory,
+} PDExprStatus;
+
+#define PD_EXPR_STACK_SIZE 32
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Callbacks used by the evaluator to fetch registers and memory. Both returns 0 on failure. read_memory is expected
+// to return the value in the endianess of the target.
+
+typedef struct PDExprContext {
+    void* user_data;
+    int (*read_register)(void* user_data, uint16_t index, uint64_t* value);
+    int (*read_memory)(void* user_data, uint64_t address, int size, uint64_t* value);
+} PDExprContext;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(_MSC_VER) && !defined(__cplusplus)
+#define PD_EXPR_INLINE static __inline
+#else
+#define PD_EXPR_INLINE static inline
+#endif
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+PD_EXPR_INLINE uint64_t PDExpr_read_u64(const uint8_t* p) {
+    return ((uint64_t)p[0]) | ((uint64_t)p[1] << 8) | ((uint64_t)p[2] << 16) | ((uint64_t)p[3] << 24) |
+           ((uint64_t)p[4] << 32) | ((uint64_t)p[5] << 40) | ((uint64_t)p[6] << 48) | ((uint64_t)p[7] << 56);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+PD_EXPR_INLINE PDExprStatus PDExpr_eval(const uint8_t* code, uint32_t size, const PDExprContext* ctx,
+                                        uint64_t* result) {
+    uint64_t stack[PD_EXPR_STACK_SIZE];
+    const uint8_t* end = code + size;
+    int sp = 0;
+
+    while (code < end) {
+        uint8_t op = *code++;
+
+        if (op == PDExprOp_End) {
+            break;
+        }
+
+        switch (op) {
+            case PDExprOp_Const: {
+                if (end - code < 8 || sp >= PD_EXPR_STACK_SIZE) {
+                    return end - code < 8 ? PDExprStatus_InvalidCode : PDExprStatus_StackOverflow;
+                }
+
+                stack[sp++] = PDExpr_read_u64(code);
+                code += 8;
+                continue;
+            }
+
+            case PDExprOp_Register: {
+                uint64_t value = 0;
+                uint16_t index;
+
+                if (end - code < 2 || sp >= PD_EXPR_STACK_SIZE) {
+                    return end - code < 2 ? PDExprStatus_InvalidCode : PDExprStatus_StackOverflow;
+                }
+
+                index = (uint16_t)(code[0] | (code[1] << 8));
+                code += 2;
+
+                if (!ctx->read_register || !ctx->read_register(ctx->user_data, index, &value)) {
+                    return PDExprStatus_BadRegister;
+                }
+
+                stack[sp++] = value;
+                continue;
+            }
+
+            case PDExprOp_Load: {
+                uint64_t value = 0;
+                int load_size;
+
+                if (end - code < 1 || sp < 1) {
+                    return PDExprStatus_InvalidCode;
+                }
+
+                load_size = *code++;
+
+                if (!ctx->read_memory || !ctx->read_memory(ctx->user_data, stack[sp - 1], load_size, &value)) {
+                    return PDExprStatus_BadMemory;
+                }
+
+                stack[sp - 1] = value;
+                continue;
+            }
+
+            case PDExprOp_Neg:
+            case PDExprOp_Not:
+            case PDExprOp_LogicalNot: {
+                if (sp < 1) {
+                    return PDExprStatus_InvalidCode;
+                }
+
+                if (op == PDExprOp_Neg) {
+                    stack[sp - 1] = 0 - stack[sp - 1];
+                } else if (op == PDExprOp_Not) {
+                    stack[sp - 1] = ~stack[sp - 1];
+                } else {
+                    stack[sp - 1] = stack[sp - 1] == 0;
+                }
+
+                continue;
+            }
+
+            case PDExprOp_JumpIfFalse:
+            case PDExprOp_JumpIfTrue: {
+                int jump_value = op == PDExprOp_JumpIfTrue;
+                uint16_t offset;
+
+                if (end - code < 2 || sp < 1) {
+                    return PDExprStatus_InvalidCode;
+                }
+
+                offset = (uint16_t)(code[0] | (code[1] << 8));
+                code += 2;
+
+                if ((stack[sp - 1] != 0) == jump_value) {
+                    if (end - code < offset) {
+                        return PDExprStatus_InvalidCode;
+                    }
+
+                    stack[sp - 1] = (uint64_t)jump_value;
+                    code += offset;
+                }
+
+                continue;
+            }
+        }
+
+        // Binary ops
+
+        if (op >= PDExprOp_Count || sp < 2) {
+            return PDExprStatus_InvalidCode;
+        }
+
+        {
+            uint64_t b = stack[--sp];
+            uint64_t a = stack[sp - 1];
+            uint64_t r = 0;
+
+            switch (op) {
+                case PDExprOp_Add:
+                    r = a + b;
+                    break;
+                case PDExprOp_Sub:
+                    r = a - b;
+                    break;
+                case PDExprOp_Mul:
+                    r = a * b;
+                    break;
+                case PDExprOp_Div:
+                case PDExprOp_Mod: {
+                    if (b == 0) {
+                        return PDExprStatus_DivideByZero;
+                    }
+                    r = op == PDExprOp_Div ? a / b : a % b;
+                    break;
+                }
+                case PDExprOp_And:
+                    r = a & b;
+                    break;
+                case PDExprOp_Or:
+                    r = a | b;
+                    break;
+                case PDExprOp_Xor:
+                    r = a ^ b;
+                    break;
+                case PDExprOp_Shl:
+                    r = b >= 64 ? 0 : a << b;
+                    break;
+                case PDExprOp_Shr:
+                    r = b >= 64 ? 0 : a >> b;
+                    break;
+                case PDExprOp_Eq:
+                    r = a == b;
+                    break;
+                case PDExprOp_Ne:
+                    r = a != b;
+                    break;
+                case PDExprOp_Lt:
+                    r = a < b;
+                    break;
+                case PDExprOp_Le:
+                    r = a <= b;
+                    break;
+                case PDExprOp_Gt:
+                    r = a > b;
+                    break;
+                case PDExprOp_Ge:
+                    r = a >= b;
+                    break;
+                case PDExprOp_LogicalAnd:
+                    r = a && b;
+                    break;
+                case PDExprOp_LogicalOr:
+                    r = a || b;
+                    break;
+                default:
+                    return PDExprStatus_InvalidCode;
+            }
+
+            stack[sp - 1] = r;
+        }
+    }
+
+    if (sp != 1) {
+        return PDExprStatus_InvalidCode;
+    }
+
+    *result = stack[0];
+
+    return PDExprStatus_Ok;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifdef __cplusplus
+}
+#endif
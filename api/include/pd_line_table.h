@@ -0,0 +1,78 @@
+#pragma once
+
+#include <stdint.h>
+#include "pd_backend.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Line tables
+//
+// The frontend keeps the line tables of the target so mapping between addresses and source lines (for the pc, the
+// breakpoint margins and mixed source/disassembly) doesn't need to ask the backend each time. It asks for them with
+// PDEventType_GetLineTable once the target has been loaded (and again at the first stop, when the load addresses are
+// known) and the backend replies with one PDEventType_SetLineTable event per compile unit with these fields:
+//
+//   "unit"      (string) name of the compile unit (optional)
+//   "files"     (data)   paths of the files the rows refer to as zero terminated strings one after another. Rows use
+//                        the index of the path in this list
+//   "rows"      (data)   array of PDLineRow in host byte order, sorted by address
+//   "row_count" (u32)    number of rows in "rows"
+//
+// A row covers the addresses from its address up to the address of the next row. Rows with line 0 end a sequence of
+// code (the address after its last instruction) so the gaps between functions don't map to any line. Backends that
+// don't have line information don't reply.
+//
+// Large programs are sent over several replies so no single reply has to hold all the units. The request can carry
+// "module" and "unit" (u32, 0 if missing) to start at a given compile unit of a given module. A backend that stops
+// before the last unit ends its reply with a SetLineTable event without rows holding "next_module" and "next_unit"
+// (u32) and the frontend asks again from there.
+
+typedef struct PDLineRow {
+    uint64_t address;
+    uint32_t file;
+    uint32_t line;
+} PDLineRow;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(_MSC_VER) && !defined(__cplusplus)
+#define PD_LINE_TABLE_INLINE static __inline
+#else
+#define PD_LINE_TABLE_INLINE static inline
+#endif
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Writes the SetLineTable event of one compile unit. files is files_size bytes of zero terminated paths
+
+PD_LINE_TABLE_INLINE void PDLineTable_write_unit(PDWriter* writer, const char* unit, const char* files,
+                                                 uint32_t files_size, const PDLineRow* rows, uint32_t row_count) {
+    PDWrite_event_begin(writer, PDEventType_SetLineTable);
+
+    if (unit) {
+        PDWrite_string(writer, "unit", unit);
+    }
+
+    PDWrite_data(writer, "files", (void*)files, files_size);
+    PDWrite_data(writer, "rows", (void*)rows, row_count * (uint32_t)sizeof(PDLineRow));
+    PDWrite_u32(writer, "row_count", row_count);
+    PDWrite_event_end(writer);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Ends a reply that stopped early. The frontend asks for the rest starting at the given module and unit
+
+PD_LINE_TABLE_INLINE void PDLineTable_write_next(PDWriter* writer, uint32_t module, uint32_t unit) {
+    PDWrite_event_begin(writer, PDEventType_SetLineTable);
+    PDWrite_u32(writer, "next_module", module);
+    PDWrite_u32(writer, "next_unit", unit);
+    PDWrite_event_end(writer);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifdef __cplusplus
+}
+#endif
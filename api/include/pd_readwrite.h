@@ -46,6 +46,8 @@ typedef enum PDReadType {
     PDReadType_Array,
     /// Array type
     PDReadType_ArrayEntry,
+    /// data array (void*) written with PDWriter::write_data_ref. Read the same way as PDReadType_Data
+    PDReadType_DataRef,
     /// total count of types
     PDReadType_Count
 } PDReadType;
@@ -381,6 +383,21 @@ typedef struct PDWriter {
      */
     PDWriteStatus (*write_data)(struct PDWriter* writer, const char* id, void* data, unsigned int len);
 
+    /**
+     *
+     * Writes an array of data to the writer by reference. Only the pointer and size are stored and the reader gets
+     * the pointer back from PDRead_find_data, so the data isn't copied. The data must stay valid and unchanged until
+     * the next time the plugin is updated. Writers that send the data out of the process (such as the remote API)
+     * copy it like write_data.
+     *
+     * @param writer writer object
+     * @param id key to associate the value with and must be non-NULL unless inside a writerHeaderScope. See PDWriter::write_header_array_begin
+     * @param data array of data to reference
+     * @param len size in bytes of the data
+     *
+     */
+    PDWriteStatus (*write_data_ref)(struct PDWriter* writer, const char* id, void* data, unsigned int len);
+
 } PDWriter;
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -571,6 +588,7 @@ typedef struct PDReader {
 #define PDWrite_double(w, id, v) w->write_double(w, id, v)
 #define PDWrite_string(w, id, v) w->write_string(w, id, v)
 #define PDWrite_data(w, id, data, len) w->write_data(w, id, data, len)
+#define PDWrite_data_ref(w, id, data, len) w->write_data_ref(w, id, data, len)
 
 /**
  *
@@ -0,0 +1,233 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "pd_backend.h"
+#include "pd_expression.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tracepoints
+//
+// A tracepoint is a breakpoint that never stops the target. Each hit instead evaluates a set of capture expressions
+// (compiled byte code, see pd_expression.h) and stores the values in a fixed-size ring buffer owned by the backend.
+// When the buffer is full the oldest records are overwritten (and counted as dropped) so the target never has to
+// wait for the frontend.
+//
+// The frontend pulls the buffer in bulk with PDEventType_GetTraceData and the backend replies with one or more
+// PDEventType_SetTraceData events (PDTrace_write_events does this) with the following fields:
+//
+//   "records"      (data) array of PDTraceRecord in host byte order
+//   "record_count" (u32)  number of records in "records"
+//   "dropped"      (u64)  number of records overwritten since the last pull (only in the first event)
+//
+// Backends run in the same process as the frontend so the records are sent as-is without any conversion.
+
+#define PD_TRACE_MAX_VALUES 8
+
+typedef struct PDTraceRecord {
+    uint64_t address;
+    uint64_t values[PD_TRACE_MAX_VALUES];
+    uint32_t value_count;
+    // Bit n is set if values[n] failed to evaluate (bad memory access, etc)
+    uint32_t error_mask;
+} PDTraceRecord;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+typedef struct PDTraceBuffer {
+    PDTraceRecord* records;
+    // capacity - 1 (capacity is always a power of two)
+    uint32_t mask;
+    uint64_t write;
+    uint64_t read;
+    uint64_t dropped;
+} PDTraceBuffer;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Capture expressions of a tracepoint as sent in a PDEventType_SyncBreakpoints entry with "tracepoint" set. The
+// "captures" data field holds each expression as a u32 size (host byte order) followed by that many bytes of code
+
+typedef struct PDTraceCaptures {
+    uint8_t* code[PD_TRACE_MAX_VALUES];
+    uint32_t size[PD_TRACE_MAX_VALUES];
+    uint32_t count;
+} PDTraceCaptures;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(_MSC_VER) && !defined(__cplusplus)
+#define PD_TRACE_INLINE static __inline
+#else
+#define PD_TRACE_INLINE static inline
+#endif
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Capacity is rounded down to a power of two. Returns 0 if the buffer couldn't be allocated
+
+PD_TRACE_INLINE int PDTrace_create(PDTraceBuffer* buffer, uint32_t capacity) {
+    uint32_t size = 1;
+
+    while ((size << 1) <= capacity && (size << 1) != 0) {
+        size <<= 1;
+    }
+
+    memset(buffer, 0, sizeof(PDTraceBuffer));
+
+    if (!(buffer->records = (PDTraceRecord*)malloc(size * sizeof(PDTraceRecord)))) {
+        return 0;
+    }
+
+    buffer->mask = size - 1;
+
+    return 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+PD_TRACE_INLINE void PDTrace_destroy(PDTraceBuffer* buffer) {
+    free(buffer->records);
+    memset(buffer, 0, sizeof(PDTraceBuffer));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Returns the next record to fill in. Overwrites the oldest record if the buffer is full.
+
+PD_TRACE_INLINE PDTraceRecord* PDTrace_alloc(PDTraceBuffer* buffer) {
+    if (buffer->write - buffer->read > buffer->mask) {
+        buffer->read++;
+        buffer->dropped++;
+    }
+
+    return &buffer->records[buffer->write++ & buffer->mask];
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Evaluate the captures and append a record. This is what a backend calls on each tracepoint hit.
+
+PD_TRACE_INLINE void PDTrace_record(PDTraceBuffer* buffer, const PDTraceCaptures* captures, uint64_t address,
+                                    const PDExprContext* ctx) {
+    PDTraceRecord* record;
+    uint32_t i;
+
+    if (!buffer->records) {
+        return;
+    }
+
+    record = PDTrace_alloc(buffer);
+    record->address = address;
+    record->value_count = captures->count;
+    record->error_mask = 0;
+
+    for (i = 0; i < captures->count; ++i) {
+        record->values[i] = 0;
+
+        if (PDExpr_eval(captures->code[i], captures->size[i], ctx, &record->values[i]) != PDExprStatus_Ok) {
+            record->error_mask |= 1u << i;
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Reads the captures from an entry of a PDEventType_SyncBreakpoints array. The code is copied so it stays valid after
+// the event has been processed. Returns 0 if the entry isn't a tracepoint.
+
+PD_TRACE_INLINE int PDTrace_read_captures(PDReader* reader, PDReaderIterator it, PDTraceCaptures* captures) {
+    const uint8_t* data = 0;
+    uint64_t data_size = 0;
+    uint64_t offset = 0;
+    uint8_t tracepoint = 0;
+
+    memset(captures, 0, sizeof(PDTraceCaptures));
+
+    if (PDRead_find_u8(reader, &tracepoint, "tracepoint", it) == PDReadStatus_NotFound || !tracepoint) {
+        return 0;
+    }
+
+    if (PDRead_find_data(reader, (void**)&data, &data_size, "captures", it) == PDReadStatus_NotFound) {
+        return 1;
+    }
+
+    while (offset + sizeof(uint32_t) <= data_size && captures->count < PD_TRACE_MAX_VALUES) {
+        uint32_t size;
+
+        memcpy(&size, data + offset, sizeof(uint32_t));
+        offset += sizeof(uint32_t);
+
+        if (size == 0 || size > data_size - offset) {
+            break;
+        }
+
+        captures->code[captures->count] = (uint8_t*)malloc(size);
+        captures->size[captures->count] = size;
+        memcpy(captures->code[captures->count], data + offset, size);
+        captures->count++;
+
+        offset += size;
+    }
+
+    return 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+PD_TRACE_INLINE void PDTrace_free_captures(PDTraceCaptures* captures) {
+    uint32_t i;
+
+    for (i = 0; i < captures->count; ++i) {
+        free(captures->code[i]);
+    }
+
+    memset(captures, 0, sizeof(PDTraceCaptures));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Reply to PDEventType_GetTraceData. Sends (and consumes) at most max_records records (0 = all). As the buffer may
+// wrap this writes up to two events with one contiguous block each.
+
+PD_TRACE_INLINE void PDTrace_write_events(PDTraceBuffer* buffer, PDWriter* writer, uint32_t max_records) {
+    uint64_t count = buffer->write - buffer->read;
+    int first = 1;
+
+    if (!buffer->records) {
+        return;
+    }
+
+    if (max_records != 0 && count > max_records) {
+        count = max_records;
+    }
+
+    do {
+        uint32_t start = (uint32_t)(buffer->read & buffer->mask);
+        uint32_t chunk = (uint32_t)count;
+
+        if (start + chunk > buffer->mask + 1) {
+            chunk = buffer->mask + 1 - start;
+        }
+
+        PDWrite_event_begin(writer, PDEventType_SetTraceData);
+        PDWrite_data(writer, "records", &buffer->records[start], chunk * (uint32_t)sizeof(PDTraceRecord));
+        PDWrite_u32(writer, "record_count", chunk);
+
+        if (first) {
+            PDWrite_u64(writer, "dropped", buffer->dropped);
+            buffer->dropped = 0;
+            first = 0;
+        }
+
+        PDWrite_event_end(writer);
+
+        buffer->read += chunk;
+        count -= chunk;
+    } while (count > 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifdef __cplusplus
+}
+#endif
@@ -126,6 +126,11 @@ pub struct CPDWriterAPI {
                                   d: *const c_uchar,
                                   l: c_uint)
                                   -> WriteStatus,
+    pub write_data_ref: extern "C" fn(w: *mut c_void,
+                                      id: *const c_char,
+                                      d: *const c_uchar,
+                                      l: c_uint)
+                                      -> WriteStatus,
 }
 
 pub struct Reader {
@@ -156,6 +161,7 @@ pub enum ReadType {
     Event,
     Array,
     ArrayEntry,
+    DataRef,
     Count,
 }
 
@@ -73,7 +73,7 @@ static inline int32_t getU32(const uint8_t* ptr) {
 
 static inline int64_t getS64(const uint8_t* ptr) {
     int64_t v = ((uint64_t)ptr[0] << 56) | ((uint64_t)ptr[1] << 48) | ((uint64_t)ptr[2] << 40) | ((uint64_t)ptr[3] << 32) |
-                (ptr[4] << 24) | (ptr[5] << 16) | (ptr[6] << 8) | ptr[7];
+                ((uint64_t)ptr[4] << 24) | (ptr[5] << 16) | (ptr[6] << 8) | ptr[7];
     return v;
 }
 
@@ -81,7 +81,7 @@ static inline int64_t getS64(const uint8_t* ptr) {
 
 static inline uint64_t getU64(const uint8_t* ptr) {
     uint64_t v = ((uint64_t)ptr[0] << 56) | ((uint64_t)ptr[1] << 48) | ((uint64_t)ptr[2] << 40) | ((uint64_t)ptr[3] << 32) |
-                 (ptr[4] << 24) | (ptr[5] << 16) | (ptr[6] << 8) | ptr[7];
+                 ((uint64_t)ptr[4] << 24) | (ptr[5] << 16) | (ptr[6] << 8) | ptr[7];
     return v;
 }
 
@@ -178,6 +178,7 @@ static const char* typeTable[] =
     "PDReadType_Event",
     "PDReadType_Array",
     "PDReadType_ArrayEntry",
+    "PDReadType_DataRef",
 };
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -194,7 +195,7 @@ static uint8_t* findIdByRange(const char* id, uint8_t* start, uint8_t* end) {
 
         // data is a special case as it has 32-bit size instead of 64k
 
-        if (typeId == PDReadType_Data || typeId == PDReadType_Array) {
+        if (typeId == PDReadType_Data || typeId == PDReadType_DataRef || typeId == PDReadType_Array) {
             size = getU32(start + 1);
 
             if (!strcmp((char*)start + 5, id))
@@ -378,11 +379,21 @@ static uint32_t read_find_data(struct PDReader* reader, void** data, uint64_t* s
 
     type = *dataPtr;
 
-    if (type != PDReadType_Data)
+    if (type != PDReadType_Data && type != PDReadType_DataRef)
         return (PDReadType)type | PDReadStatus_IllegalType;
 
     idLength = (int)strlen((const char*)dataPtr + 5) + 1;
 
+    // The data is owned by the writer (see PDWriter::write_data_ref)
+
+    if (type == PDReadType_DataRef) {
+        uint64_t ptr;
+        memcpy(&ptr, dataPtr + 5 + idLength, 8);
+        *size = (uint32_t)getU32(dataPtr + 5 + idLength + 8);
+        *data = (void*)(uintptr_t)ptr;
+        return PDReadType_Data | PDReadStatus_Ok;
+    }
+
     // find the offset to the string
 
     *size = (getU32(dataPtr + 1) - idLength) - 5;   // fix hard-coded values
@@ -469,7 +480,7 @@ static void read_dump_data(struct PDReader* reader) {
             const char* idOffset = (const char*)rData->data + 3;
 
             if (type < PDReadType_Count) {
-                if (type == PDReadType_Array) {
+                if (type == PDReadType_Array || type == PDReadType_Data || type == PDReadType_DataRef) {
                     // need to handle array here, now just grab the correct size and idOffset
 
                     size = getU32(rData->data + 1);
@@ -19,6 +19,7 @@ typedef struct WriterData {
     unsigned int entryCount;
     unsigned int maxSize;
     unsigned int size;
+    unsigned int overflow;
 } WriterData;
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -29,10 +30,82 @@ typedef struct WriterData {
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-static inline uint8_t* writeIdSize(uint8_t* data, const char* id, uint8_t type, uint16_t typeSize) {
+// The size of a reply is stored in 30 bits (the top 2 bits of the size are used for flags when sending it)
+
+#define MAX_WRITER_SIZE 0x3fffffff
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Makes sure there is room for size more bytes. The buffer is grown when a reply doesn't fit and the offsets into it
+// are moved along. If that isn't possible nothing more is written to the reply and the write calls return
+// PDWriteStatus_Fail
+
+static int reserve(WriterData* wData, size_t size) {
+    size_t used = (size_t)(wData->data - wData->dataStart);
+    size_t newSize = wData->maxSize;
+    uint8_t* newStart;
+
+    if (wData->overflow) {
+        return 0;
+    }
+
+    if (used + size <= wData->maxSize) {
+        return 1;
+    }
+
+    if (used + size > MAX_WRITER_SIZE) {
+        // \todo proper logging here
+        printf("Reply is larger than %u bytes and is cut short\n", (unsigned int)MAX_WRITER_SIZE);
+        wData->overflow = 1;
+        return 0;
+    }
+
+    while (newSize < used + size) {
+        newSize *= 2;
+    }
+
+    if (newSize > MAX_WRITER_SIZE) {
+        newSize = MAX_WRITER_SIZE;
+    }
+
+    if (!(newStart = realloc(wData->dataStart, newSize))) {
+        // \todo proper logging here
+        printf("Unable to grow writer to %u bytes, the reply is cut short\n", (unsigned int)newSize);
+        wData->overflow = 1;
+        return 0;
+    }
+
+    if (wData->eventOffset) {
+        wData->eventOffset = newStart + (wData->eventOffset - wData->dataStart);
+    }
+
+    if (wData->arrayOffset) {
+        wData->arrayOffset = newStart + (wData->arrayOffset - wData->dataStart);
+    }
+
+    if (wData->entryOffset) {
+        wData->entryOffset = newStart + (wData->entryOffset - wData->dataStart);
+    }
+
+    wData->data = newStart + used;
+    wData->dataStart = newStart;
+    wData->maxSize = (unsigned int)newSize;
+
+    return 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Returns where the value of the field goes or 0 if it doesn't fit
+
+static inline uint8_t* writeIdSize(WriterData* wData, const char* id, uint8_t type, size_t typeSize) {
+    uint8_t* data;
     size_t len = strlen(id);
-    uint16_t totalSize = ((uint16_t)len) + typeSize + 4;    // + 4 for: type (1 byte) size (2 bytes) null term (1 byte)
+    size_t totalSize = len + typeSize + 4;    // + 4 for: type (1 byte) size (2 bytes) null term (1 byte)
+
+    if (totalSize > 0xffff || !reserve(wData, totalSize)) {
+        return 0;
+    }
 
+    data = wData->data;
     data[0] = type;
     data[1] = (totalSize >> 8) & 0xff;
     data[2] = (totalSize >> 0) & 0xff;
@@ -46,7 +119,13 @@ static inline uint8_t* writeIdSize(uint8_t* data, const char* id, uint8_t type,
 
 static PDWriteStatus write_s8(struct PDWriter* writer, const char* id, int8_t v) {
     WriterData* wData = (WriterData*)writer->data;
-    wData->data = writeIdSize(wData->data, id, PDReadType_S8, sizeof(int8_t));
+    uint8_t* data = writeIdSize(wData, id, PDReadType_S8, sizeof(int8_t));
+
+    if (!data) {
+        return PDWriteStatus_Fail;
+    }
+
+    wData->data = data;
     *wData->data++ = v;
 
     if (wData->writingArrayEntry) {
@@ -60,7 +139,13 @@ static PDWriteStatus write_s8(struct PDWriter* writer, const char* id, int8_t v)
 
 static PDWriteStatus write_u8(struct PDWriter* writer, const char* id, uint8_t v) {
     WriterData* wData = (WriterData*)writer->data;
-    wData->data = writeIdSize(wData->data, id, PDReadType_U8, sizeof(uint8_t));
+    uint8_t* data = writeIdSize(wData, id, PDReadType_U8, sizeof(uint8_t));
+
+    if (!data) {
+        return PDWriteStatus_Fail;
+    }
+
+    wData->data = data;
     *wData->data++ = v;
 
     if (wData->writingArrayEntry) {
@@ -74,7 +159,13 @@ static PDWriteStatus write_u8(struct PDWriter* writer, const char* id, uint8_t v
 
 static PDWriteStatus write_s16(struct PDWriter* writer, const char* id, int16_t v) {
     WriterData* wData = (WriterData*)writer->data;
-    wData->data = writeIdSize(wData->data, id, PDReadType_S16, sizeof(int16_t));
+    uint8_t* data = writeIdSize(wData, id, PDReadType_S16, sizeof(int16_t));
+
+    if (!data) {
+        return PDWriteStatus_Fail;
+    }
+
+    wData->data = data;
 
     wData->data[0] = (v >> 8) & 0xff;
     wData->data[1] = (v >> 0) & 0xff;
@@ -91,7 +182,13 @@ static PDWriteStatus write_s16(struct PDWriter* writer, const char* id, int16_t
 
 static PDWriteStatus write_u16(struct PDWriter* writer, const char* id, uint16_t v) {
     WriterData* wData = (WriterData*)writer->data;
-    wData->data = writeIdSize(wData->data, id, PDReadType_U16, sizeof(uint16_t));
+    uint8_t* data = writeIdSize(wData, id, PDReadType_U16, sizeof(uint16_t));
+
+    if (!data) {
+        return PDWriteStatus_Fail;
+    }
+
+    wData->data = data;
 
     wData->data[0] = (v >> 8) & 0xff;
     wData->data[1] = (v >> 0) & 0xff;
@@ -108,7 +205,13 @@ static PDWriteStatus write_u16(struct PDWriter* writer, const char* id, uint16_t
 
 static PDWriteStatus write_s32(struct PDWriter* writer, const char* id, int32_t v) {
     WriterData* wData = (WriterData*)writer->data;
-    wData->data = writeIdSize(wData->data, id, PDReadType_S32, sizeof(int32_t));
+    uint8_t* data = writeIdSize(wData, id, PDReadType_S32, sizeof(int32_t));
+
+    if (!data) {
+        return PDWriteStatus_Fail;
+    }
+
+    wData->data = data;
 
     wData->data[0] = (v >> 24) & 0xff;
     wData->data[1] = (v >> 16) & 0xff;
@@ -127,7 +230,13 @@ static PDWriteStatus write_s32(struct PDWriter* writer, const char* id, int32_t
 
 static PDWriteStatus write_u32(struct PDWriter* writer, const char* id, uint32_t v) {
     WriterData* wData = (WriterData*)writer->data;
-    wData->data = writeIdSize(wData->data, id, PDReadType_U32, sizeof(uint32_t));
+    uint8_t* data = writeIdSize(wData, id, PDReadType_U32, sizeof(uint32_t));
+
+    if (!data) {
+        return PDWriteStatus_Fail;
+    }
+
+    wData->data = data;
 
     wData->data[0] = (v >> 24) & 0xff;
     wData->data[1] = (v >> 16) & 0xff;
@@ -146,7 +255,13 @@ static PDWriteStatus write_u32(struct PDWriter* writer, const char* id, uint32_t
 
 static PDWriteStatus write_s64(struct PDWriter* writer, const char* id, int64_t v) {
     WriterData* wData = (WriterData*)writer->data;
-    wData->data = writeIdSize(wData->data, id, PDReadType_S64, sizeof(int64_t));
+    uint8_t* data = writeIdSize(wData, id, PDReadType_S64, sizeof(int64_t));
+
+    if (!data) {
+        return PDWriteStatus_Fail;
+    }
+
+    wData->data = data;
 
     wData->data[0] = (v >> 56) & 0xff;
     wData->data[1] = (v >> 48) & 0xff;
@@ -169,7 +284,13 @@ static PDWriteStatus write_s64(struct PDWriter* writer, const char* id, int64_t
 
 static PDWriteStatus write_u64(struct PDWriter* writer, const char* id, uint64_t v) {
     WriterData* wData = (WriterData*)writer->data;
-    wData->data = writeIdSize(wData->data, id, PDReadType_U64, sizeof(uint64_t));
+    uint8_t* data = writeIdSize(wData, id, PDReadType_U64, sizeof(uint64_t));
+
+    if (!data) {
+        return PDWriteStatus_Fail;
+    }
+
+    wData->data = data;
 
     wData->data[0] = (v >> 56) & 0xff;
     wData->data[1] = (v >> 48) & 0xff;
@@ -202,7 +323,13 @@ union Convert {
 static PDWriteStatus write_float(struct PDWriter* writer, const char* id, float v) {
     union Convert c;
     WriterData* wData = (WriterData*)writer->data;
-    wData->data = writeIdSize(wData->data, id, PDReadType_Float, sizeof(uint32_t));
+    uint8_t* data = writeIdSize(wData, id, PDReadType_Float, sizeof(uint32_t));
+
+    if (!data) {
+        return PDWriteStatus_Fail;
+    }
+
+    wData->data = data;
 
     c.fv = v;
 
@@ -224,7 +351,13 @@ static PDWriteStatus write_float(struct PDWriter* writer, const char* id, float
 static PDWriteStatus write_double(struct PDWriter* writer, const char* id, double v) {
     union Convert c;
     WriterData* wData = (WriterData*)writer->data;
-    wData->data = writeIdSize(wData->data, id, PDReadType_Double, sizeof(uint64_t));
+    uint8_t* data = writeIdSize(wData, id, PDReadType_Double, sizeof(uint64_t));
+
+    if (!data) {
+        return PDWriteStatus_Fail;
+    }
+
+    wData->data = data;
 
     c.dv = v;
 
@@ -248,12 +381,15 @@ static PDWriteStatus write_double(struct PDWriter* writer, const char* id, doubl
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 static PDWriteStatus write_string(struct PDWriter* writer, const char* id, const char* v) {
-    size_t len;
     WriterData* wData = (WriterData*)writer->data;
+    size_t len = strlen(v) + 1;
+    uint8_t* data = writeIdSize(wData, id, PDReadType_String, len);
 
-    len = strlen(v) + 1;
+    if (!data) {
+        return PDWriteStatus_Fail;
+    }
 
-    wData->data = writeIdSize(wData->data, id, PDReadType_String, (uint16_t)len);
+    wData->data = data;
     memcpy(wData->data, v, len);
 
     wData->data += len;
@@ -273,7 +409,11 @@ static PDWriteStatus write_data(struct PDWriter* writer, const char* id, void* d
 
     // for data we special case a bit with having the size in 32-bit instead to support > 64k size
 
-    uint32_t totalSize = ((uint16_t)idLen) + 4 + 1 + len + 1; // size (4) + type (1) + id_len (+1) null teminator
+    size_t totalSize = idLen + 4 + 1 + (size_t)len + 1; // size (4) + type (1) + id_len (+1) null teminator
+
+    if (!reserve(wData, totalSize)) {
+        return PDWriteStatus_Fail;
+    }
 
     wData->data[0] = PDReadType_Data;
     wData->data[1] = (totalSize >> 24) & 0xff;
@@ -293,6 +433,43 @@ static PDWriteStatus write_data(struct PDWriter* writer, const char* id, void* d
     return PDWriteStatus_ok;
 }
 
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Only the pointer (8 bytes) and the size (4 bytes) are stored in the stream. The reader returns the pointer as is
+
+static PDWriteStatus write_data_ref(struct PDWriter* writer, const char* id, void* data, unsigned int len) {
+    WriterData* wData = (WriterData*)writer->data;
+    size_t idLen = strlen(id);
+    uint64_t ptr = (uint64_t)(uintptr_t)data;
+
+    size_t totalSize = idLen + 4 + 1 + 8 + 4 + 1; // size (4) + type (1) + ptr (8) + len (4) + null
+
+    if (!reserve(wData, totalSize)) {
+        return PDWriteStatus_Fail;
+    }
+
+    wData->data[0] = PDReadType_DataRef;
+    wData->data[1] = (totalSize >> 24) & 0xff;
+    wData->data[2] = (totalSize >> 16) & 0xff;
+    wData->data[3] = (totalSize >> 8) & 0xff;
+    wData->data[4] = (totalSize >> 0) & 0xff;
+
+    memcpy(wData->data + 5, id, idLen + 1);
+    memcpy(wData->data + 5 + idLen + 1, &ptr, 8);
+
+    wData->data[5 + idLen + 1 + 8 + 0] = (len >> 24) & 0xff;
+    wData->data[5 + idLen + 1 + 8 + 1] = (len >> 16) & 0xff;
+    wData->data[5 + idLen + 1 + 8 + 2] = (len >> 8) & 0xff;
+    wData->data[5 + idLen + 1 + 8 + 3] = (len >> 0) & 0xff;
+
+    wData->data += totalSize;
+
+    if (wData->writingArrayEntry) {
+        wData->entryCount++;
+    }
+
+    return PDWriteStatus_ok;
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 static uint64_t write_event_begin(struct PDWriter* writer, uint16_t event) {
@@ -306,6 +483,10 @@ static uint64_t write_event_begin(struct PDWriter* writer, uint16_t event) {
         return PDWriteStatus_Fail;
     }
 
+    if (!reserve(wData, 7)) {
+        return PDWriteStatus_Fail;
+    }
+
     wData->data[0] = PDReadType_Event;
     wData->data[1] = (event >> 8) & 0xff;
     wData->data[2] = (event >> 0) & 0xff;
@@ -327,6 +508,11 @@ static PDWriteStatus write_event_end(struct PDWriter* writer) {
     WriterData* wData = (WriterData*)writer->data;
 
     if (!wData->writingEvent) {
+        // An event that didn't fit has already been reported
+        if (wData->overflow) {
+            return PDWriteStatus_Fail;
+        }
+
         // \todo proper logging here
         printf("Unable to write endEvent as no evenhBegin has been called before this call\n");
         return PDWriteStatus_Fail;
@@ -370,6 +556,10 @@ static PDWriteStatus write_array_entry_begin(struct PDWriter* writer) {
         return PDWriteStatus_Fail;
     }
 
+    if (!reserve(wData, 7)) {
+        return PDWriteStatus_Fail;
+    }
+
     wData->data[0] = PDReadType_ArrayEntry;
     wData->writingArrayEntry = 1;
     wData->entryCount = 0;
@@ -387,6 +577,10 @@ static PDWriteStatus write_array_entry_end(struct PDWriter* writer) {
     WriterData* wData = (WriterData*)writer->data;
 
     if (!wData->writingArrayEntry) {
+        if (wData->overflow) {
+            return PDWriteStatus_Fail;
+        }
+
         // \todo proper logging here
         printf("Unable to write arrayEntryEnd as no arrayEntryBegin has been called before this call\n");
         return PDWriteStatus_Fail;
@@ -419,6 +613,10 @@ static PDWriteStatus write_array_begin(struct PDWriter* writer, const char* name
         return PDWriteStatus_Fail;
     }
 
+    if (!reserve(wData, (size_t)len + 5)) {
+        return PDWriteStatus_Fail;
+    }
+
     wData->data[0] = PDReadType_Array;
     memcpy(wData->data + 5, name, len);
     wData->writingArray = 1;
@@ -436,6 +634,10 @@ static PDWriteStatus write_array_end(struct PDWriter* writer) {
     WriterData* wData = (WriterData*)writer->data;
 
     if (!wData->writingArray) {
+        if (wData->overflow) {
+            return PDWriteStatus_Fail;
+        }
+
         // \todo proper logging here
         printf("Unable to write arrayEnd as no arrayBegin has been called before this call\n");
         return PDWriteStatus_Fail;
@@ -483,6 +685,7 @@ void pd_binary_writer_init(PDWriter* writer) {
     writer->write_double = write_double;
     writer->write_string = write_string;
     writer->write_data = write_data;
+    writer->write_data_ref = write_data_ref;
 
     //printf("pd_binary_writer_init\n");
 
@@ -491,7 +694,7 @@ void pd_binary_writer_init(PDWriter* writer) {
 
     data = (WriterData*)writer->data;
 
-    // \todo: Make this tweakble/custom allocator 2 meg should be enough most of the time
+    // \todo: Make this tweakble/custom allocator 2 meg should be enough most of the time. Bigger replies grow it
 
 	data->request_id = 1;
     data->data = data->dataStart = malloc(1024 * 1024 * 2);
@@ -546,9 +749,11 @@ unsigned int pd_binary_writer_get_size(PDWriter* writer) {
 void pd_binary_writer_reset(PDWriter* writer) {
     WriterData* data = (WriterData*)writer->data;
     uint64_t request_id = data->request_id;
+    unsigned int maxSize = data->maxSize;
     void* tempData = data->dataStart;
     memset(data, 0, sizeof(WriterData));
     data->request_id = request_id;
+    data->maxSize = maxSize;
     data->data = data->dataStart = (uint8_t*)tempData;
     data->data += 4;
 }
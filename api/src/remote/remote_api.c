@@ -113,6 +113,9 @@ int PDRemote_update(int sleepTime) {
     pd_binary_writer_init(s_writer);
     pd_binary_reader_init_stream(s_reader, recvData, recvSize);
 
+    // The data is sent to another process so references has to be copied
+    s_writer->write_data_ref = s_writer->write_data;
+
     s_plugin->update(s_userData, (PDAction)action, s_reader, s_writer);
 
     //PDWrite_event_begin(s_writer, PDEventType_setStatus);
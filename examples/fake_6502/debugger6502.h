@@ -1,14 +1,67 @@
 #ifndef _DEBUGGER6502_H_
 #define _DEBUGGER6502_H_
 
+#include <stdint.h>
+#include <pd_trace.h>
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Breakpoint with optional condition (byte code from pd_expression.h). Stops when the condition is true and the
+// breakpoint has been hit at least hitCount times. Tracepoints never stops but records the captures in the trace buffer
+
+typedef struct Breakpoint6502
+{
+    uint8_t* condition;
+    uint32_t conditionSize;
+    uint32_t hitCount;
+    uint32_t hits;
+    int tracepoint;
+    PDTraceCaptures captures;
+
+} Breakpoint6502;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Data watchpoint on [address, address + size). type is a PDWatchType
+
+typedef struct Watchpoint6502
+{
+    uint16_t address;
+    uint32_t size;
+    uint8_t type;
+    uint8_t* condition;
+    uint32_t conditionSize;
+    uint32_t hitCount;
+    uint32_t hits;
+
+} Watchpoint6502;
+
+#define MAX_WATCHPOINTS_6502 64
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 typedef struct Debugger6502
 {
     int runState;
+    int hitBreakpoint;
+    Breakpoint6502* breakpoints[65536];    // one slot per address so the check in the cpu loop is a single lookup
+    PDTraceBuffer trace;
+    Watchpoint6502 watchpoints[MAX_WATCHPOINTS_6502];
+    int watchpointCount;
+    uint8_t readWatchPages[32];     // one bit per 256 byte page that has a read watchpoint in it
+    uint8_t writeWatchPages[32];    // same for write watchpoints
 
 } Debugger6502;
 
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Returns 1 if execution should stop at the breakpoint at address
+
+int checkBreakpoint6502(Debugger6502* debugger, uint16_t address);
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Returns 1 if execution should stop because of a watchpoint on a data access (type is PDWatchType_Read or
+// PDWatchType_Write). The cpu only calls this if the page bit for the address is set.
+
+int checkWatchpoint6502(Debugger6502* debugger, uint16_t address, uint8_t type);
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 extern Debugger6502* g_debugger;
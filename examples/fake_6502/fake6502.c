@@ -188,26 +188,46 @@ static uint8_t opcode;
 extern uint8_t read6502(uint16_t address);
 extern void write6502(uint16_t address, uint8_t value);
 
+//data watchpoints. Only data accesses (operands and the stack) are checked, not instruction fetches. A hit stops the
+//cpu before the next instruction as hardware watchpoints do
+static void watch6502(uint16_t address, const uint8_t* pages, uint8_t type) {
+    if ((pages[address >> 11] & (1 << ((address >> 8) & 7))) && checkWatchpoint6502(g_debugger, address, type)) {
+        g_debugger->runState = PDDebugState_StopBreakpoint;
+        g_debugger->hitBreakpoint = 1;
+    }
+}
+
+static uint8_t readData6502(uint16_t address) {
+    watch6502(address, g_debugger->readWatchPages, PDWatchType_Read);
+    return read6502(address);
+}
+
+static void writeData6502(uint16_t address, uint8_t value) {
+    watch6502(address, g_debugger->writeWatchPages, PDWatchType_Write);
+    write6502(address, value);
+}
+
 //a few general functions used by various other functions
 void push16(uint16_t pushval) {
-    write6502(BASE_STACK + sp, (pushval >> 8) & 0xFF);
-    write6502(BASE_STACK + ((sp - 1) & 0xFF), pushval & 0xFF);
+    writeData6502(BASE_STACK + sp, (pushval >> 8) & 0xFF);
+    writeData6502(BASE_STACK + ((sp - 1) & 0xFF), pushval & 0xFF);
     sp -= 2;
 }
 
 void push8(uint8_t pushval) {
-    write6502(BASE_STACK + sp--, pushval);
+    writeData6502(BASE_STACK + sp--, pushval);
 }
 
 uint16_t pull16() {
     uint16_t temp16;
-    temp16 = read6502(BASE_STACK + ((sp + 1) & 0xFF)) | ((uint16_t)read6502(BASE_STACK + ((sp + 2) & 0xFF)) << 8);
+    temp16 = readData6502(BASE_STACK + ((sp + 1) & 0xFF)) |
+             ((uint16_t)readData6502(BASE_STACK + ((sp + 2) & 0xFF)) << 8);
     sp += 2;
     return(temp16);
 }
 
 uint8_t pull8() {
-    return (read6502(BASE_STACK + ++sp));
+    return (readData6502(BASE_STACK + ++sp));
 }
 
 void reset6502() {
@@ -312,12 +332,12 @@ static void indy() { // (indirect),Y
 
 static uint16_t getvalue() {
     if (addrtable[opcode] == acc) return((uint16_t)a);
-        else return((uint16_t)read6502(ea));
+        else return((uint16_t)readData6502(ea));
 }
 
 static void putvalue(uint16_t saveval) {
     if (addrtable[opcode] == acc) a = (uint8_t)(saveval & 0x00FF);
-        else write6502(ea, (saveval & 0x00FF));
+        else writeData6502(ea, (saveval & 0x00FF));
 }
 
 
@@ -995,9 +1015,16 @@ void step6502(int printRegs)
 
 void execute6502()
 {
+    if (g_debugger->runState == PDDebugState_Running && g_debugger->breakpoints[pc] &&
+        checkBreakpoint6502(g_debugger, pc))
+    {
+        g_debugger->runState = PDDebugState_StopBreakpoint;
+        g_debugger->hitBreakpoint = 1;
+    }
+
     // if we should break we should stop here and just have a loop that waits for the next thing to happen
 
-    if (g_debugger->runState == PDDebugState_StopException)
+    if (g_debugger->runState == PDDebugState_StopException || g_debugger->runState == PDDebugState_StopBreakpoint)
     {
         for (;;) 
         {
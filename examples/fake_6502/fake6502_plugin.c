@@ -1,4 +1,6 @@
 #include <pd_backend.h>
+#include <pd_expression.h>
+#include <pd_trace.h>
 #include "debugger6502.h"
 #include <string.h>
 #include <stdlib.h>
@@ -7,6 +9,7 @@
 Debugger6502* g_debugger;
 extern uint16_t pc;
 extern uint8_t sp, a, x, y, status;
+extern uint8_t read6502(uint16_t address);
 extern int disassembleToBuffer(char* dest, int* address, int* instCount);
 extern struct PDBackendPlugin s_debuggerPlugin;
 
@@ -21,6 +24,8 @@ static void* createInstance(ServiceFunc* serviceFunc)
 
     g_debugger->runState = PDDebugState_Running;
 
+    PDTrace_create(&g_debugger->trace, 64 * 1024);
+
     return g_debugger;
 }
 
@@ -28,6 +33,24 @@ static void* createInstance(ServiceFunc* serviceFunc)
 
 static void destroyInstance(void* userData)
 {
+    Debugger6502* debugger = (Debugger6502*)userData;
+    int i;
+
+    for (i = 0; i < 65536; ++i)
+    {
+        if (debugger->breakpoints[i])
+        {
+            free(debugger->breakpoints[i]->condition);
+            PDTrace_free_captures(&debugger->breakpoints[i]->captures);
+            free(debugger->breakpoints[i]);
+        }
+    }
+
+    for (i = 0; i < debugger->watchpointCount; ++i)
+        free(debugger->watchpoints[i].condition);
+
+    PDTrace_destroy(&debugger->trace);
+
     free(userData);
     g_debugger = 0;
 }
@@ -36,6 +59,8 @@ static void destroyInstance(void* userData)
 
 static void writeRegister(PDWriter* writer, const char* name, uint8_t size, uint16_t reg, uint8_t readOnly)
 {
+    uint8_t data[2];
+
     PDWrite_array_entry_begin(writer);
     PDWrite_string(writer, "name", name);
     PDWrite_u8(writer, "size", size);
@@ -43,10 +68,19 @@ static void writeRegister(PDWriter* writer, const char* name, uint8_t size, uint
     if (readOnly)
         PDWrite_u8(writer, "read_only", 1);
 
+    // registers are sent as big endian data
+
     if (size == 2)
-    	PDWrite_u16(writer, "register", reg);
-	else
-    	PDWrite_u8(writer, "register", (uint8_t)reg);
+    {
+        data[0] = (uint8_t)(reg >> 8);
+        data[1] = (uint8_t)reg;
+    }
+    else
+    {
+        data[0] = (uint8_t)reg;
+    }
+
+    PDWrite_data(writer, "register", data, size);
 
     PDWrite_entry_end(writer);
 }
@@ -111,6 +145,346 @@ static void getDisassembly(PDReader* reader, PDWriter* writer)
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+// Register indices matches the order in setRegisters
+
+static int readRegister(void* userData, uint16_t index, uint64_t* value)
+{
+    (void)userData;
+
+    switch (index)
+    {
+        case 0 : *value = pc; return 1;
+        case 1 : *value = sp; return 1;
+        case 2 : *value = a; return 1;
+        case 3 : *value = x; return 1;
+        case 4 : *value = y; return 1;
+        case 5 : *value = status; return 1;
+    }
+
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static int readMemory(void* userData, uint64_t address, int size, uint64_t* value)
+{
+    int i;
+
+    (void)userData;
+
+    if (address + (uint64_t)size > 65536)
+        return 0;
+
+    *value = 0;
+
+    // 6502 is little endian
+
+    for (i = size - 1; i >= 0; --i)
+        *value = (*value << 8) | read6502((uint16_t)(address + i));
+
+    return 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int checkBreakpoint6502(Debugger6502* debugger, uint16_t address)
+{
+    Breakpoint6502* bp = debugger->breakpoints[address];
+    PDExprContext context = { debugger, readRegister, readMemory };
+
+    if (!bp)
+        return 0;
+
+    if (bp->condition)
+    {
+        uint64_t result = 0;
+
+        // if the condition can't be evaluated we stop anyway so the user can see what is going on
+
+        if (PDExpr_eval(bp->condition, bp->conditionSize, &context, &result) == PDExprStatus_Ok && result == 0)
+            return 0;
+    }
+
+    if (bp->tracepoint)
+    {
+        PDTrace_record(&debugger->trace, &bp->captures, address, &context);
+        return 0;
+    }
+
+    return ++bp->hits >= bp->hitCount;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int checkWatchpoint6502(Debugger6502* debugger, uint16_t address, uint8_t type)
+{
+    PDExprContext context = { debugger, readRegister, readMemory };
+    int i;
+
+    if (debugger->runState != PDDebugState_Running)
+        return 0;
+
+    for (i = 0; i < debugger->watchpointCount; ++i)
+    {
+        Watchpoint6502* wp = &debugger->watchpoints[i];
+        uint64_t result = 0;
+
+        if (!(wp->type & type) || address < wp->address || address >= wp->address + wp->size)
+            continue;
+
+        if (wp->condition &&
+            PDExpr_eval(wp->condition, wp->conditionSize, &context, &result) == PDExprStatus_Ok && result == 0)
+            continue;
+
+        if (++wp->hits >= wp->hitCount)
+            return 1;
+    }
+
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void updateWatchPages(Debugger6502* debugger)
+{
+    int i;
+
+    memset(debugger->readWatchPages, 0, sizeof(debugger->readWatchPages));
+    memset(debugger->writeWatchPages, 0, sizeof(debugger->writeWatchPages));
+
+    for (i = 0; i < debugger->watchpointCount; ++i)
+    {
+        const Watchpoint6502* wp = &debugger->watchpoints[i];
+        uint32_t end = wp->address + wp->size - 1;
+        uint32_t page;
+
+        if (end > 0xffff)
+            end = 0xffff;
+
+        for (page = wp->address >> 8; page <= (end >> 8); ++page)
+        {
+            if (wp->type & PDWatchType_Read)
+                debugger->readWatchPages[page >> 3] |= (uint8_t)(1 << (page & 7));
+
+            if (wp->type & PDWatchType_Write)
+                debugger->writeWatchPages[page >> 3] |= (uint8_t)(1 << (page & 7));
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static Watchpoint6502* findWatchpoint(Debugger6502* debugger, uint16_t address)
+{
+    int i;
+
+    for (i = 0; i < debugger->watchpointCount; ++i)
+    {
+        if (debugger->watchpoints[i].address == address)
+            return &debugger->watchpoints[i];
+    }
+
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static int setWatchpoint(Debugger6502* debugger, PDReader* reader, PDReaderIterator it, uint16_t address, uint8_t type)
+{
+    uint32_t watchSize = 1;
+    uint32_t hitCount = 0;
+    uint64_t size = 0;
+    void* condition = 0;
+    Watchpoint6502* wp;
+
+    PDRead_find_u32(reader, &watchSize, "size", it);
+    PDRead_find_u32(reader, &hitCount, "hit_count", it);
+    PDRead_find_data(reader, &condition, &size, "condition", it);
+
+    if (watchSize == 0 || !(type & PDWatchType_Access))
+        return 0;
+
+    wp = findWatchpoint(debugger, address);
+
+    if (!wp)
+    {
+        if (debugger->watchpointCount >= MAX_WATCHPOINTS_6502)
+        {
+            printf("fake6502: Max number of watchpoints reached\n");
+            return 0;
+        }
+
+        wp = &debugger->watchpoints[debugger->watchpointCount++];
+        memset(wp, 0, sizeof(Watchpoint6502));
+    }
+
+    free(wp->condition);
+
+    wp->address = address;
+    wp->size = watchSize;
+    wp->type = type;
+    wp->condition = 0;
+    wp->conditionSize = 0;
+    wp->hitCount = hitCount;
+    wp->hits = 0;
+
+    if (condition && size > 0)
+    {
+        wp->condition = malloc(size);
+        wp->conditionSize = (uint32_t)size;
+        memcpy(wp->condition, condition, size);
+    }
+
+    updateWatchPages(debugger);
+
+    return 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static int deleteWatchpoint(Debugger6502* debugger, uint16_t address)
+{
+    Watchpoint6502* wp = findWatchpoint(debugger, address);
+
+    if (!wp)
+        return 0;
+
+    free(wp->condition);
+    *wp = debugger->watchpoints[--debugger->watchpointCount];
+
+    updateWatchPages(debugger);
+
+    return 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// reads the breakpoint from the event (it = 0) or from an entry in a SyncBreakpoints array
+
+static int setBreakpoint(Debugger6502* debugger, PDReader* reader, PDReaderIterator it)
+{
+    uint64_t address = 0;
+    uint64_t size = 0;
+    uint32_t hitCount = 0;
+    uint8_t watch = 0;
+    void* condition = 0;
+    Breakpoint6502* bp;
+
+    if (PDRead_find_u64(reader, &address, "address", it) == PDReadStatus_NotFound || address > 0xffff)
+        return 0;
+
+    PDRead_find_u8(reader, &watch, "watch", it);
+
+    if (watch)
+        return setWatchpoint(debugger, reader, it, (uint16_t)address, watch);
+
+    PDRead_find_u32(reader, &hitCount, "hit_count", it);
+    PDRead_find_data(reader, &condition, &size, "condition", it);
+
+    bp = debugger->breakpoints[address];
+
+    if (!bp)
+    {
+        bp = malloc(sizeof(Breakpoint6502));
+        memset(bp, 0, sizeof(Breakpoint6502));
+        debugger->breakpoints[address] = bp;
+    }
+
+    free(bp->condition);
+    PDTrace_free_captures(&bp->captures);
+
+    bp->tracepoint = PDTrace_read_captures(reader, it, &bp->captures);
+    bp->condition = 0;
+    bp->conditionSize = 0;
+    bp->hitCount = hitCount;
+    bp->hits = 0;
+
+    if (condition && size > 0)
+    {
+        bp->condition = malloc(size);
+        bp->conditionSize = (uint32_t)size;
+        memcpy(bp->condition, condition, size);
+    }
+
+    return 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static int deleteBreakpoint(Debugger6502* debugger, PDReader* reader, PDReaderIterator it)
+{
+    uint64_t address = 0;
+    uint8_t watch = 0;
+
+    if (PDRead_find_u64(reader, &address, "address", it) == PDReadStatus_NotFound || address > 0xffff)
+        return 0;
+
+    PDRead_find_u8(reader, &watch, "watch", it);
+
+    if (watch)
+        return deleteWatchpoint(debugger, (uint16_t)address);
+
+    if (!debugger->breakpoints[address])
+        return 0;
+
+    free(debugger->breakpoints[address]->condition);
+    PDTrace_free_captures(&debugger->breakpoints[address]->captures);
+    free(debugger->breakpoints[address]);
+    debugger->breakpoints[address] = 0;
+
+    return 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void syncBreakpoints(Debugger6502* debugger, PDReader* reader, PDWriter* writer)
+{
+    PDReaderIterator it;
+
+    if (PDRead_find_array(reader, &it, "breakpoints", 0) == PDReadStatus_NotFound)
+        return;
+
+    // all changes are acked in one reply
+
+    PDWrite_event_begin(writer, PDEventType_ReplyBreakpoint);
+    PDWrite_array_begin(writer, "breakpoints");
+
+    while (PDRead_get_next_entry(reader, &it))
+    {
+        uint32_t id = 0;
+        uint8_t action = PDBreakpointAction_Add;
+        int status;
+
+        PDRead_find_u32(reader, &id, "id", it);
+        PDRead_find_u8(reader, &action, "action", it);
+
+        if (action == PDBreakpointAction_Remove)
+            status = deleteBreakpoint(debugger, reader, it);
+        else
+            status = setBreakpoint(debugger, reader, it);
+
+        PDWrite_array_entry_begin(writer);
+        PDWrite_u32(writer, "id", id);
+        PDWrite_u8(writer, "status", (uint8_t)status);
+        PDWrite_entry_end(writer);
+    }
+
+    PDWrite_array_end(writer);
+    PDWrite_event_end(writer);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void getTraceData(Debugger6502* debugger, PDReader* reader, PDWriter* writer)
+{
+    uint32_t maxRecords = 0;
+
+    PDRead_find_u32(reader, &maxRecords, "max_records", 0);
+    PDTrace_write_events(&debugger->trace, writer, maxRecords);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 static void sendState(PDWriter* writer)
 {
     setExceptionLocation(writer);
@@ -160,24 +534,31 @@ static void doAction(Debugger6502* debugger, PDAction action, PDWriter* writer)
 
 static PDDebugState update(void* userData, PDAction action, PDReader* reader, PDWriter* writer)
 {
-    //int event = 0;
-
-    (void)reader;
+    int event = 0;
 
     Debugger6502* debugger = (Debugger6502*)userData;
 
     doAction(debugger, action, writer);
 
-	/*
     while ((event = PDRead_get_event(reader)) != 0)
     {
         switch (event)
         {
-            case PDEventType_getDisassembly : getDisassembly(reader, writer); break;
-            case PDEventType_getRegisters : setRegisters(writer); break;
+            case PDEventType_GetRegisters : setRegisters(writer); break;
+            case PDEventType_SetBreakpoint : setBreakpoint(debugger, reader, 0); break;
+            case PDEventType_DeleteBreakpoint : deleteBreakpoint(debugger, reader, 0); break;
+            case PDEventType_SyncBreakpoints : syncBreakpoints(debugger, reader, writer); break;
+            case PDEventType_GetTraceData : getTraceData(debugger, reader, writer); break;
         }
     }
-    */
+
+    // the cpu loop has stopped on a breakpoint since last update so let the frontend know where we are
+
+    if (debugger->hitBreakpoint)
+    {
+        debugger->hitBreakpoint = 0;
+        sendState(writer);
+    }
 
     return debugger->runState;
 }
@@ -0,0 +1,950 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+#include "capstone/capstone.h"
+#include "pd_backend.h"
+#include "pd_backend_messages.h"
+#include "pd_host.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Post-mortem backend for ELF core files and raw memory dumps.
+//
+// The file is memory mapped when the target is opened and never read up front, so opening a dump is instant no
+// matter how large it is and the OS pages in what is looked at. The mapping is read only and private. Pages that are
+// written by memory edits are made writable one by one so they are copied on write and the file is never changed
+// (memory edits aren't supported on Windows).
+//
+// GetMemory and GetRegisters are answered with by-reference data fields (see PDWriter::write_data_ref) pointing into
+// the mapping so nothing is copied on the backend side. The mapping lives as long as the instance so the pointers
+// are valid until the next update as required.
+//
+// Targets are opened with file_target_request. ELF files (cores and executables) are mapped by their PT_LOAD
+// segments and for cores the registers of the first thread in the NT_PRSTATUS notes are shown. Any other file is a
+// raw dump of memory that starts at address 0 or at the address given after an @ (such as "dump.bin@0x80000000").
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Memory of the target [address, address + size) that is found at offset in the mapping
+struct Segment {
+    uint64_t address;
+    uint64_t size;
+    uint64_t offset;
+};
+
+struct Register {
+    const char* name;
+    uint8_t size;
+    // Big endian value. Points into the mapping for big endian cores and into register_data otherwise
+    uint8_t* data;
+};
+
+// Layout of pr_reg in the NT_PRSTATUS note for an ELF machine
+struct RegisterLayout {
+    uint16_t machine;
+    uint8_t register_size;
+    uint8_t pc_index;
+    uint32_t offset;
+    int count;
+    const char* const* names;
+};
+
+#define MAX_REGISTERS 64
+#define MAX_SEARCH_HITS 4096
+#define MAX_BUILD_ID 64
+
+struct CoreDumpPlugin {
+    PDDebugState state;
+    uint8_t* mapping;
+    uint64_t mapping_size;
+#ifdef _WIN32
+    HANDLE file;
+    HANDLE file_mapping;
+#endif
+    // Sorted on address and not overlapping
+    std::vector<Segment> segments;
+    uint32_t address_width;
+    // ELF machine and endianness (machine is 0 for raw dumps)
+    uint16_t machine;
+    bool big_endian;
+    // NT_GNU_BUILD_ID of the program as hex (empty if not found)
+    char build_id[MAX_BUILD_ID * 2 + 1];
+    Register registers[MAX_REGISTERS];
+    int register_count;
+    int pc_register;
+    uint8_t register_data[MAX_REGISTERS * 8];
+    // Hits of the current search_memory request
+    uint64_t search_hits[MAX_SEARCH_HITS];
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static const char* const s_x86_64_registers[] = {
+    "r15", "r14", "r13", "r12", "rbp", "rbx", "r11", "r10", "r9", "r8", "rax", "rcx", "rdx", "rsi",
+    "rdi", "orig_rax", "rip", "cs", "eflags", "rsp", "ss", "fs_base", "gs_base", "ds", "es", "fs", "gs",
+};
+
+static const char* const s_i386_registers[] = {
+    "ebx", "ecx", "edx", "esi", "edi", "ebp", "eax", "ds", "es", "fs", "gs", "orig_eax", "eip", "cs", "eflags", "esp",
+    "ss",
+};
+
+static const char* const s_aarch64_registers[] = {
+    "x0",  "x1",  "x2",  "x3",  "x4",  "x5",  "x6",  "x7",  "x8",  "x9",  "x10", "x11", "x12", "x13", "x14", "x15",
+    "x16", "x17", "x18", "x19", "x20", "x21", "x22", "x23", "x24", "x25", "x26", "x27", "x28", "x29", "x30", "sp",
+    "pc",  "pstate",
+};
+
+static const char* const s_arm_registers[] = {
+    "r0", "r1", "r2", "r3", "r4", "r5", "r6", "r7", "r8", "r9", "r10", "r11", "r12", "sp", "lr", "pc", "cpsr",
+    "orig_r0",
+};
+
+#define sizeof_array(t) (sizeof(t) / sizeof(t[0]))
+
+// pr_reg is at offset 72 in elf_prstatus for 32-bit targets and at 112 for 64-bit ones
+
+static const RegisterLayout s_register_layouts[] = {
+    {62, 8, 16, 112, (int)sizeof_array(s_x86_64_registers), s_x86_64_registers},
+    {3, 4, 12, 72, (int)sizeof_array(s_i386_registers), s_i386_registers},
+    {183, 8, 32, 112, (int)sizeof_array(s_aarch64_registers), s_aarch64_registers},
+    {40, 4, 15, 72, (int)sizeof_array(s_arm_registers), s_arm_registers},
+};
+
+// Capstone arch/mode for an ELF machine. The endianness of the file is added to the mode
+
+struct MachineArch {
+    uint16_t machine;
+    uint8_t word_size;
+    cs_arch arch;
+    int mode;
+};
+
+static const MachineArch s_machine_archs[] = {
+    {62, 8, CS_ARCH_X86, CS_MODE_64},
+    {3, 4, CS_ARCH_X86, CS_MODE_32},
+    {183, 8, CS_ARCH_ARM64, CS_MODE_ARM},
+    {40, 4, CS_ARCH_ARM, CS_MODE_ARM},
+    {4, 4, CS_ARCH_M68K, CS_MODE_M68K_040},
+    {8, 4, CS_ARCH_MIPS, CS_MODE_MIPS32},
+    {8, 8, CS_ARCH_MIPS, CS_MODE_MIPS64},
+    {20, 4, CS_ARCH_PPC, CS_MODE_32},
+    {21, 8, CS_ARCH_PPC, CS_MODE_64},
+    {243, 4, CS_ARCH_RISCV, CS_MODE_RISCV32 | CS_MODE_RISCVC},
+    {243, 8, CS_ARCH_RISCV, CS_MODE_RISCV64 | CS_MODE_RISCVC},
+};
+
+enum {
+    ElfClass_32 = 1,
+    ElfData_BigEndian = 2,
+    ElfType_Core = 4,
+    ElfSegment_Load = 1,
+    ElfSegment_Note = 4,
+    ElfNote_PrStatus = 1,
+    ElfNote_GnuBuildId = 3,
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static uint64_t read_elf(const uint8_t* data, int size, bool big_endian) {
+    uint64_t v = 0;
+
+    for (int i = 0; i < size; ++i) {
+        int shift = big_endian ? (size - 1 - i) * 8 : i * 8;
+        v |= uint64_t(data[i]) << shift;
+    }
+
+    return v;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static bool in_mapping(const CoreDumpPlugin* plugin, uint64_t offset, uint64_t size) {
+    return offset <= plugin->mapping_size && size <= plugin->mapping_size - offset;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void* create_instance(ServiceFunc* serviceFunc) {
+    (void)serviceFunc;
+
+    CoreDumpPlugin* plugin = new CoreDumpPlugin();
+    plugin->state = PDDebugState_NoTarget;
+    plugin->pc_register = -1;
+#ifdef _WIN32
+    plugin->file = INVALID_HANDLE_VALUE;
+#endif
+
+    return plugin;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void close_file(CoreDumpPlugin* plugin) {
+#ifdef _WIN32
+    if (plugin->mapping) {
+        UnmapViewOfFile(plugin->mapping);
+    }
+
+    if (plugin->file_mapping) {
+        CloseHandle(plugin->file_mapping);
+    }
+
+    if (plugin->file != INVALID_HANDLE_VALUE) {
+        CloseHandle(plugin->file);
+    }
+
+    plugin->file = INVALID_HANDLE_VALUE;
+    plugin->file_mapping = 0;
+#else
+    if (plugin->mapping) {
+        munmap(plugin->mapping, plugin->mapping_size);
+    }
+#endif
+
+    plugin->mapping = 0;
+    plugin->mapping_size = 0;
+    plugin->segments.clear();
+    plugin->machine = 0;
+    plugin->build_id[0] = 0;
+    plugin->register_count = 0;
+    plugin->pc_register = -1;
+    plugin->state = PDDebugState_NoTarget;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void destroy_instance(void* user_data) {
+    CoreDumpPlugin* plugin = (CoreDumpPlugin*)user_data;
+    close_file(plugin);
+    delete plugin;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Maps the whole file. Pages are only read from disk when they are touched.
+
+static bool map_file(CoreDumpPlugin* plugin, const char* filename) {
+#ifdef _WIN32
+    LARGE_INTEGER size;
+
+    plugin->file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, 0);
+
+    if (plugin->file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    if (!GetFileSizeEx(plugin->file, &size) || size.QuadPart == 0) {
+        close_file(plugin);
+        return false;
+    }
+
+    plugin->file_mapping = CreateFileMappingA(plugin->file, 0, PAGE_READONLY, 0, 0, 0);
+
+    if (!plugin->file_mapping) {
+        close_file(plugin);
+        return false;
+    }
+
+    plugin->mapping = (uint8_t*)MapViewOfFile(plugin->file_mapping, FILE_MAP_READ, 0, 0, 0);
+    plugin->mapping_size = uint64_t(size.QuadPart);
+#else
+    struct stat st;
+    int fd = open(filename, O_RDONLY);
+
+    if (fd == -1) {
+        return false;
+    }
+
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        return false;
+    }
+
+    // The mapping keeps the file open so the descriptor isn't needed after this. It's mapped read only as a writable
+    // private mapping would be charged as if all of it was copied, which may fail for large dumps
+
+    void* mapping = mmap(0, size_t(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (mapping == MAP_FAILED) {
+        return false;
+    }
+
+    plugin->mapping = (uint8_t*)mapping;
+    plugin->mapping_size = uint64_t(st.st_size);
+#endif
+
+    if (!plugin->mapping) {
+        close_file(plugin);
+        return false;
+    }
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Registers of the first thread in the core (the one that caused the dump). The host wants the values in big endian
+// so for little endian cores they are swapped into register_data once, otherwise they are used from the mapping.
+
+static void read_prstatus(CoreDumpPlugin* plugin, uint16_t machine, bool big_endian, uint8_t* desc, uint64_t size) {
+    const RegisterLayout* layout = 0;
+
+    for (size_t i = 0; i < sizeof_array(s_register_layouts); ++i) {
+        if (s_register_layouts[i].machine == machine) {
+            layout = &s_register_layouts[i];
+            break;
+        }
+    }
+
+    if (!layout || layout->offset + uint64_t(layout->count) * layout->register_size > size) {
+        return;
+    }
+
+    for (int i = 0; i < layout->count; ++i) {
+        Register* reg = &plugin->registers[i];
+        uint8_t* value = desc + layout->offset + i * layout->register_size;
+
+        reg->name = layout->names[i];
+        reg->size = layout->register_size;
+        reg->data = value;
+
+        if (!big_endian) {
+            reg->data = plugin->register_data + i * 8;
+
+            for (int t = 0; t < reg->size; ++t) {
+                reg->data[t] = value[reg->size - 1 - t];
+            }
+        }
+    }
+
+    plugin->register_count = layout->count;
+    plugin->pc_register = layout->pc_index;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void read_notes(CoreDumpPlugin* plugin, uint16_t machine, bool big_endian, uint64_t offset, uint64_t size) {
+    const uint64_t end = offset + size;
+
+    while (plugin->register_count == 0 && offset + 12 <= end) {
+        const uint8_t* note = plugin->mapping + offset;
+        const uint64_t name_size = read_elf(note + 0, 4, big_endian);
+        const uint64_t desc_size = read_elf(note + 4, 4, big_endian);
+        const uint64_t type = read_elf(note + 8, 4, big_endian);
+        const uint64_t desc = offset + 12 + ((name_size + 3) & ~3ull);
+
+        if (desc > end || desc_size > end - desc) {
+            return;
+        }
+
+        if (type == ElfNote_PrStatus) {
+            read_prstatus(plugin, machine, big_endian, plugin->mapping + desc, desc_size);
+        }
+
+        offset = desc + ((desc_size + 3) & ~3ull);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static const Segment* find_segment(const CoreDumpPlugin* plugin, uint64_t address) {
+    auto it = std::upper_bound(plugin->segments.begin(), plugin->segments.end(), address,
+                               [](uint64_t a, const Segment& s) { return a < s.address; });
+
+    if (it == plugin->segments.begin()) {
+        return 0;
+    }
+
+    --it;
+
+    return address - it->address < it->size ? &*it : 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Looks for the NT_GNU_BUILD_ID note in size bytes of ELF notes. Other notes of type 3 (such as NT_PRPSINFO in cores)
+// have a different name
+
+static bool read_build_id(CoreDumpPlugin* plugin, const uint8_t* notes, uint64_t size, bool big_endian) {
+    uint64_t offset = 0;
+
+    while (offset + 12 <= size) {
+        const uint8_t* note = notes + offset;
+        const uint64_t name_size = read_elf(note + 0, 4, big_endian);
+        const uint64_t desc_size = read_elf(note + 4, 4, big_endian);
+        const uint64_t type = read_elf(note + 8, 4, big_endian);
+        const uint64_t desc = offset + 12 + ((name_size + 3) & ~3ull);
+
+        if (desc > size || desc_size > size - desc) {
+            return false;
+        }
+
+        if (type == ElfNote_GnuBuildId && name_size == 4 && memcmp(note + 12, "GNU", 4) == 0 && desc_size > 0 &&
+            desc_size <= MAX_BUILD_ID) {
+            for (uint64_t i = 0; i < desc_size; ++i) {
+                sprintf(plugin->build_id + i * 2, "%02x", notes[desc + i]);
+            }
+
+            return true;
+        }
+
+        offset = desc + ((desc_size + 3) & ~3ull);
+    }
+
+    return false;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Cores don't have the build id of the program but its first page (with the ELF and program headers) is dumped by
+// default. The program is the lowest ELF image in memory as shared libraries are mapped above it.
+
+static void read_image_build_id(CoreDumpPlugin* plugin, bool is_32, bool big_endian) {
+    const int word = is_32 ? 4 : 8;
+
+    for (const Segment& segment : plugin->segments) {
+        const uint8_t* header = plugin->mapping + segment.offset;
+
+        if (segment.size < 64 || memcmp(header, "\x7f" "ELF", 4) != 0) {
+            continue;
+        }
+
+        const uint64_t ph_offset = read_elf(header + (is_32 ? 28 : 32), word, big_endian);
+        const uint64_t ph_size = read_elf(header + (is_32 ? 42 : 54), 2, big_endian);
+        const uint64_t ph_count = read_elf(header + (is_32 ? 44 : 56), 2, big_endian);
+
+        if (ph_size < uint64_t(is_32 ? 32 : 56) || ph_offset > segment.size ||
+            ph_size * ph_count > segment.size - ph_offset) {
+            return;
+        }
+
+        // Position independent programs are loaded at an offset from the addresses in the program headers. The
+        // segment that starts at file offset 0 is where the header was found
+
+        uint64_t base = 0;
+
+        for (uint64_t i = 0; i < ph_count; ++i) {
+            const uint8_t* ph = header + ph_offset + i * ph_size;
+
+            const uint64_t segment_type = read_elf(ph, 4, big_endian);
+
+            if (segment_type == ElfSegment_Load && read_elf(ph + (is_32 ? 4 : 8), word, big_endian) == 0) {
+                base = segment.address - read_elf(ph + (is_32 ? 8 : 16), word, big_endian);
+                break;
+            }
+        }
+
+        for (uint64_t i = 0; i < ph_count; ++i) {
+            const uint8_t* ph = header + ph_offset + i * ph_size;
+            const uint64_t address = base + read_elf(ph + (is_32 ? 8 : 16), word, big_endian);
+            const uint64_t size = read_elf(ph + (is_32 ? 16 : 32), word, big_endian);
+            const Segment* notes = find_segment(plugin, address);
+
+            if (read_elf(ph, 4, big_endian) != ElfSegment_Note || !notes ||
+                size > notes->size - (address - notes->address)) {
+                continue;
+            }
+
+            if (read_build_id(plugin, plugin->mapping + notes->offset + (address - notes->address), size, big_endian)) {
+                return;
+            }
+        }
+
+        return;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Builds the segment table from the program headers. Only the part of a segment that is in the file can be read
+// (memory that wasn't dumped or a truncated core is shown as unreadable).
+
+static bool parse_elf(CoreDumpPlugin* plugin) {
+    const uint8_t* header = plugin->mapping;
+
+    if (plugin->mapping_size < 52 || memcmp(header, "\x7f" "ELF", 4) != 0) {
+        return false;
+    }
+
+    const bool is_32 = header[4] == ElfClass_32;
+    const bool big_endian = header[5] == ElfData_BigEndian;
+    const int word = is_32 ? 4 : 8;
+    const uint64_t type = read_elf(header + 16, 2, big_endian);
+    const uint16_t machine = uint16_t(read_elf(header + 18, 2, big_endian));
+    const uint64_t ph_offset = read_elf(header + (is_32 ? 28 : 32), word, big_endian);
+    const uint64_t ph_size = read_elf(header + (is_32 ? 42 : 54), 2, big_endian);
+    const uint64_t ph_count = read_elf(header + (is_32 ? 44 : 56), 2, big_endian);
+
+    if (!in_mapping(plugin, ph_offset, ph_size * ph_count) || ph_size < uint64_t(is_32 ? 32 : 56)) {
+        return false;
+    }
+
+    plugin->address_width = uint32_t(word);
+    plugin->machine = machine;
+    plugin->big_endian = big_endian;
+
+    for (uint64_t i = 0; i < ph_count; ++i) {
+        const uint8_t* ph = header + ph_offset + i * ph_size;
+        const uint32_t segment_type = uint32_t(read_elf(ph, 4, big_endian));
+        const uint64_t offset = read_elf(ph + (is_32 ? 4 : 8), word, big_endian);
+        const uint64_t address = read_elf(ph + (is_32 ? 8 : 16), word, big_endian);
+        uint64_t file_size = read_elf(ph + (is_32 ? 16 : 32), word, big_endian);
+
+        if (offset >= plugin->mapping_size) {
+            continue;
+        }
+
+        file_size = std::min(file_size, plugin->mapping_size - offset);
+
+        if (segment_type == ElfSegment_Note) {
+            read_notes(plugin, machine, big_endian, offset, file_size);
+            read_build_id(plugin, plugin->mapping + offset, file_size, big_endian);
+        } else if (segment_type == ElfSegment_Load && file_size > 0) {
+            plugin->segments.push_back({address, file_size, offset});
+        }
+    }
+
+    std::sort(plugin->segments.begin(), plugin->segments.end(),
+              [](const Segment& a, const Segment& b) { return a.address < b.address; });
+
+    // Overlapping segments are clipped so lookups can assume they are disjoint
+
+    for (size_t i = 1; i < plugin->segments.size(); ++i) {
+        Segment& prev = plugin->segments[i - 1];
+
+        if (prev.address + prev.size > plugin->segments[i].address) {
+            prev.size = plugin->segments[i].address - prev.address;
+        }
+    }
+
+    if (type == ElfType_Core) {
+        read_image_build_id(plugin, is_32, big_endian);
+    }
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Opens filename as the target. Returns an error message or NULL if it worked
+
+static const char* open_target(CoreDumpPlugin* plugin, const char* filename) {
+    uint64_t base = 0;
+
+    close_file(plugin);
+
+    if (!map_file(plugin, filename)) {
+        // Raw dumps may have the start address after the filename
+
+        const char* at = strrchr(filename, '@');
+
+        if (!at) {
+            return "Unable to open file";
+        }
+
+        char path[4096];
+        size_t len = size_t(at - filename);
+
+        if (len >= sizeof(path)) {
+            return "Unable to open file";
+        }
+
+        memcpy(path, filename, len);
+        path[len] = 0;
+        base = strtoull(at + 1, 0, 0);
+
+        if (!map_file(plugin, path)) {
+            return "Unable to open file";
+        }
+    }
+
+    if (!parse_elf(plugin)) {
+        plugin->segments.push_back({base, plugin->mapping_size, 0});
+        plugin->address_width = (base + plugin->mapping_size) > 0x100000000ull ? 8 : 4;
+    }
+
+    if (plugin->segments.empty()) {
+        close_file(plugin);
+        return "No memory found in the file";
+    }
+
+    plugin->state = PDDebugState_StopException;
+
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// The reply only covers the segment the start address is in. Memory after it is asked for again by the host if
+// needed and pages that start outside of the segments get no reply at all.
+
+static void get_memory(CoreDumpPlugin* plugin, PDReader* reader, PDWriter* writer) {
+    uint64_t address = 0;
+    uint64_t size = 0;
+
+    PDRead_find_u64(reader, &address, "address_start", 0);
+    PDRead_find_u64(reader, &size, "size", 0);
+
+    const Segment* segment = find_segment(plugin, address);
+
+    if (!segment || size == 0) {
+        return;
+    }
+
+    size = std::min(size, segment->address + segment->size - address);
+    size = std::min(size, uint64_t(0xffffffff));
+
+    PDWrite_event_begin(writer, PDEventType_SetMemory);
+    PDWrite_u64(writer, "address", address);
+    PDWrite_u32(writer, "address_width", plugin->address_width);
+    PDWrite_data_ref(writer, "data", plugin->mapping + segment->offset + (address - segment->address), uint32_t(size));
+    PDWrite_event_end(writer);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// The pages that are written are made writable first. They get a private copy then so the file isn't changed
+
+static void update_memory(CoreDumpPlugin* plugin, PDReader* reader) {
+#ifdef _WIN32
+    (void)plugin;
+    (void)reader;
+#else
+    void* data;
+    uint64_t address = 0;
+    uint64_t size = 0;
+
+    PDRead_find_u64(reader, &address, "address", 0);
+
+    if (PDRead_find_data(reader, &data, &size, "data", 0) == PDReadStatus_NotFound) {
+        return;
+    }
+
+    const Segment* segment = find_segment(plugin, address);
+
+    if (!segment) {
+        return;
+    }
+
+    uint8_t* target = plugin->mapping + segment->offset + (address - segment->address);
+    const uintptr_t page_size = uintptr_t(sysconf(_SC_PAGESIZE));
+    const uintptr_t first_page = uintptr_t(target) & ~(page_size - 1);
+
+    size = std::min(size, segment->address + segment->size - address);
+
+    if (mprotect((void*)first_page, uintptr_t(target) + size - first_page, PROT_READ | PROT_WRITE) != 0) {
+        return;
+    }
+
+    memcpy(target, data, size);
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static bool match_masked(const uint8_t* data, const uint8_t* pattern, const uint8_t* mask, uint64_t size) {
+    if (!mask) {
+        return memcmp(data, pattern, size) == 0;
+    }
+
+    for (uint64_t i = 0; i < size; ++i) {
+        if ((data[i] ^ pattern[i]) & mask[i]) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Searches the segments in place. Matches that cross from one segment into the next aren't found.
+
+static void search_memory(CoreDumpPlugin* plugin, PDReader* reader, PDWriter* writer) {
+    uint64_t* hits = plugin->search_hits;
+    uint64_t request_start = 0;
+    uint64_t size = 0;
+    uint64_t pattern_size = 0;
+    uint64_t mask_size = 0;
+    uint32_t alignment = 1;
+    uint32_t max_hits = MAX_SEARCH_HITS;
+    uint8_t* pattern = 0;
+    uint8_t* mask = 0;
+    uint32_t hit_count = 0;
+    uint64_t anchor = 0;
+
+    PDRead_find_u64(reader, &request_start, "address_start", 0);
+    PDRead_find_u64(reader, &size, "size", 0);
+    PDRead_find_u32(reader, &alignment, "alignment", 0);
+    PDRead_find_u32(reader, &max_hits, "max_hits", 0);
+
+    if (PDRead_find_data(reader, (void**)&pattern, &pattern_size, "pattern", 0) == PDReadStatus_NotFound) {
+        return;
+    }
+
+    if (PDRead_find_data(reader, (void**)&mask, &mask_size, "mask", 0) == PDReadStatus_NotFound ||
+        mask_size != pattern_size) {
+        mask = 0;
+    }
+
+    alignment = std::max(alignment, 1u);
+
+    if (max_hits == 0 || max_hits > MAX_SEARCH_HITS) {
+        max_hits = MAX_SEARCH_HITS;
+    }
+
+    // Candidates are found with memchr on the first byte that has to match exactly
+
+    if (mask) {
+        for (anchor = 0; anchor < pattern_size && mask[anchor] != 0xff; ++anchor) {
+        }
+    }
+
+    const uint64_t request_end = request_start + size;
+    uint64_t searched_to = request_end;
+    bool done = pattern_size == 0;
+
+    for (const Segment& segment : plugin->segments) {
+        const uint64_t start = std::max(request_start, segment.address);
+        const uint64_t end = std::min(request_end, segment.address + segment.size);
+        const uint8_t* memory = plugin->mapping + segment.offset;
+
+        if (done) {
+            break;
+        }
+
+        if (start >= end || end - start < pattern_size) {
+            continue;
+        }
+
+        // Offsets are relative to the start of the segment and a match can start at offset < last
+
+        const uint64_t last = end - segment.address - pattern_size + 1;
+
+        for (uint64_t offset = start - segment.address; offset < last; ++offset) {
+            if (anchor < pattern_size) {
+                const uint8_t* found =
+                    (const uint8_t*)memchr(memory + offset + anchor, pattern[anchor], last - offset);
+
+                if (!found) {
+                    break;
+                }
+
+                offset = uint64_t(found - memory) - anchor;
+            }
+
+            const uint64_t address = segment.address + offset;
+
+            if ((address % alignment) != 0 || !match_masked(memory + offset, pattern, mask, pattern_size)) {
+                continue;
+            }
+
+            if (hit_count == max_hits) {
+                searched_to = address;
+                done = true;
+                break;
+            }
+
+            hits[hit_count++] = address;
+        }
+    }
+
+    PDWrite_event_begin(writer, PDEventType_SetSearchResults);
+    PDWrite_u64(writer, "address_start", request_start);
+    PDWrite_data(writer, "hits", hits, hit_count * uint32_t(sizeof(uint64_t)));
+    PDWrite_u64(writer, "searched_to", searched_to);
+    PDWrite_event_end(writer);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Registers are read only as there is nothing to resume
+
+static void send_registers(CoreDumpPlugin* plugin, PDWriter* writer) {
+    PDWrite_event_begin(writer, PDEventType_SetRegisters);
+    PDWrite_array_begin(writer, "registers");
+
+    for (int i = 0; i < plugin->register_count; ++i) {
+        const Register* reg = &plugin->registers[i];
+
+        PDWrite_array_entry_begin(writer);
+        PDWrite_string(writer, "name", reg->name);
+        PDWrite_u8(writer, "read_only", 1);
+        PDWrite_data_ref(writer, "register", reg->data, reg->size);
+        PDWrite_entry_end(writer);
+    }
+
+    PDWrite_array_end(writer);
+    PDWrite_event_end(writer);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Raw dumps and unknown machines get no reply as there is no way to tell what the code is
+
+static void send_target_info(CoreDumpPlugin* plugin, PDWriter* writer) {
+    for (size_t i = 0; i < sizeof_array(s_machine_archs); ++i) {
+        const MachineArch& arch = s_machine_archs[i];
+
+        if (arch.machine != plugin->machine || arch.word_size != plugin->address_width) {
+            continue;
+        }
+
+        const uint32_t mode = uint32_t(arch.mode) | (plugin->big_endian ? uint32_t(CS_MODE_BIG_ENDIAN) : 0);
+
+        PDWrite_event_begin(writer, PDEventType_SetTargetInfo);
+        PDWrite_u32(writer, "capstone_arch", uint32_t(arch.arch));
+        PDWrite_u32(writer, "capstone_mode", mode);
+        PDWrite_u32(writer, "address_width", plugin->address_width);
+
+        if (plugin->build_id[0]) {
+            PDWrite_string(writer, "build_id", plugin->build_id);
+        }
+
+        PDWrite_event_end(writer);
+        return;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static uint64_t get_pc(const CoreDumpPlugin* plugin) {
+    if (plugin->pc_register == -1) {
+        return 0;
+    }
+
+    return read_elf(plugin->registers[plugin->pc_register].data, plugin->registers[plugin->pc_register].size, true);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void exception_location_reply(CoreDumpPlugin* plugin, PDWriter* writer) {
+    flatbuffers::FlatBufferBuilder builder(1024);
+    auto name = builder.CreateString("");
+
+    ExceptionLocationReplyBuilder reply(builder);
+    reply.add_filename(name);
+    reply.add_line(-1);
+    reply.add_address(get_pc(plugin));
+
+    PDMessage_end_msg(writer, reply, builder);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void target_reply(CoreDumpPlugin* plugin, const FileTargetRequest* request, PDWriter* writer) {
+    flatbuffers::FlatBufferBuilder builder(1024);
+
+    const char* filename = request->path()->c_str();
+    const char* error = open_target(plugin, filename);
+
+    auto error_str = builder.CreateString(error ? error : "");
+
+    TargetReplyBuilder reply(builder);
+    reply.add_status(error == 0);
+    reply.add_error_message(error_str);
+    PDMessage_end_msg(writer, reply, builder);
+
+    // The location is picked up by the host when the state changes to stopped
+
+    if (!error) {
+        exception_location_reply(plugin, writer);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void process_message(CoreDumpPlugin* plugin, PDReader* reader, PDWriter* writer) {
+    void* data = nullptr;
+    uint64_t size = 0;
+
+    if (PDRead_find_data(reader, &data, &size, "data", 0) == PDReadStatus_NotFound) {
+        return;
+    }
+
+    const Message* msg = GetMessage(data);
+
+    switch (msg->message_type()) {
+        case MessageType_exception_location_request: {
+            exception_location_reply(plugin, writer);
+            break;
+        }
+
+        case MessageType_file_target_request: {
+            target_reply(plugin, msg->message_as_file_target_request(), writer);
+            break;
+        }
+
+        default: break;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static PDDebugState update(void* user_data, PDAction action, PDReader* reader, PDWriter* writer) {
+    CoreDumpPlugin* plugin = (CoreDumpPlugin*)user_data;
+    uint32_t event;
+
+    // A dump can't be run or stepped so actions are ignored
+    (void)action;
+
+    while ((event = PDRead_get_event(reader))) {
+        if (event == PDEventType_Dummy) {
+            process_message(plugin, reader, writer);
+            continue;
+        }
+
+        if (!plugin->mapping) {
+            continue;
+        }
+
+        switch (event) {
+            case PDEventType_GetMemory: {
+                get_memory(plugin, reader, writer);
+                break;
+            }
+
+            case PDEventType_UpdateMemory: {
+                update_memory(plugin, reader);
+                break;
+            }
+
+            case PDEventType_SearchMemory: {
+                search_memory(plugin, reader, writer);
+                break;
+            }
+
+            case PDEventType_GetRegisters: {
+                send_registers(plugin, writer);
+                break;
+            }
+
+            case PDEventType_GetTargetInfo: {
+                send_target_info(plugin, writer);
+                break;
+            }
+
+            default: break;
+        }
+    }
+
+    return plugin->state;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static PDBackendPlugin plugin = {
+    "Core Dump Backend", create_instance, destroy_instance, update,
+    0,  // save_state
+    0,  // load_state
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+extern "C" PD_EXPORT void InitPlugin(RegisterPlugin* registerPlugin, void* private_data) {
+    registerPlugin(PD_BACKEND_API_VERSION, &plugin, private_data);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
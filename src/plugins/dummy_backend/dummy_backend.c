@@ -1,6 +1,9 @@
 #include "pd_backend.h"
+#include "capstone/capstone.h"
+#include "pd_expression.h"
 #include "pd_host.h"
 #include "pd_io.h"
+#include "pd_trace.h"
 #include <stdint.h>
 #include <stdlib.h>
 #include <stdio.h>
@@ -409,7 +412,55 @@ double get_reg_for_expression(const Register* reg) {
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+// Breakpoint with an optional condition (byte code from pd_expression.h) that is evaluated in place so the target
+// only stops when the condition is true and it has been hit at least hit_count times
+
+typedef struct Breakpoint {
+    uint64_t address;
+    uint8_t* condition;
+    uint32_t condition_size;
+    uint32_t hit_count;
+    uint32_t hits;
+    int tracepoint;
+    PDTraceCaptures captures;
+} Breakpoint;
+
+#define MAX_BREAKPOINTS 256
+
+// Data watchpoint on [address, address + size). type is a PDWatchType
+
+typedef struct Watchpoint {
+    uint64_t address;
+    uint32_t size;
+    uint8_t type;
+    uint8_t* condition;
+    uint32_t condition_size;
+    uint32_t hit_count;
+    uint32_t hits;
+} Watchpoint;
+
+#define MAX_WATCHPOINTS 64
+
+// Memory accesses are first checked against a bitmap with one bit per page that has a watchpoint in it so the
+// common case (no watchpoint on the page) is a single bit test
+#define WATCH_PAGE_SHIFT 12
+#define WATCH_PAGE_COUNT ((1 * 1024 * 1024) >> WATCH_PAGE_SHIFT)
+
+// Number of instructions the dummy target "executes" for each update while running
+#define INSTRUCTIONS_PER_UPDATE 64
+
+// Data region the simulated loads and stores of the instructions go to, away from the code in s_disasm_data
+#define SCRATCH_START 0x2000
+#define SCRATCH_SIZE 0x1000
+
+#define TRACE_BUFFER_SIZE (16 * 1024)
+
+#define MAX_SEARCH_HITS 4096
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 typedef struct DummyPlugin {
+    PDDebugState state;
     int exception_location;
     int prev_exception_location;
     // 1 MB of memory, range is 0x10000
@@ -419,6 +470,15 @@ typedef struct DummyPlugin {
     int register_type;
     Register *registers;
     int registers_count;
+    Breakpoint breakpoints[MAX_BREAKPOINTS];
+    int breakpoint_count;
+    Watchpoint watchpoints[MAX_WATCHPOINTS];
+    int watchpoint_count;
+    uint8_t read_watch_pages[WATCH_PAGE_COUNT / 8];
+    uint8_t write_watch_pages[WATCH_PAGE_COUNT / 8];
+    PDTraceBuffer trace;
+    // Hits of the current search_memory request
+    uint64_t search_hits[MAX_SEARCH_HITS];
 } DummyPlugin;
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -442,6 +502,9 @@ void* create_instance(ServiceFunc* serviceFunc) {
     plugin->memory = malloc(1 * 1024 * 1024);
     plugin->memory_start = 0;
     plugin->memory_end = (1 * 1024 * 1024) + plugin->memory_start;
+    plugin->state = PDDebugState_Running;
+
+    PDTrace_create(&plugin->trace, TRACE_BUFFER_SIZE);
 
     srand(0xc0cac01a);
 
@@ -509,6 +572,20 @@ void* create_instance(ServiceFunc* serviceFunc) {
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 void destroy_instance(void* user_data) {
+    DummyPlugin* plugin = (DummyPlugin*)user_data;
+    int i;
+
+    for (i = 0; i < plugin->breakpoint_count; ++i) {
+        free(plugin->breakpoints[i].condition);
+        PDTrace_free_captures(&plugin->breakpoints[i].captures);
+    }
+
+    for (i = 0; i < plugin->watchpoint_count; ++i) {
+        free(plugin->watchpoints[i].condition);
+    }
+
+    PDTrace_destroy(&plugin->trace);
+
     free(user_data);
 }
 
@@ -676,6 +753,116 @@ static void get_memory(DummyPlugin* data, PDReader* reader, PDWriter* writer) {
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+static int match_masked(const uint8_t* data, const uint8_t* pattern, const uint8_t* mask, uint64_t size) {
+    uint64_t i;
+
+    if (!mask) {
+        return memcmp(data, pattern, size) == 0;
+    }
+
+    for (i = 0; i < size; ++i) {
+        if ((data[i] ^ pattern[i]) & mask[i]) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void search_memory(DummyPlugin* data, PDReader* reader, PDWriter* writer) {
+    uint64_t* hits = data->search_hits;
+    uint64_t request_start = 0;
+    uint64_t size = 0;
+    uint64_t pattern_size = 0;
+    uint64_t mask_size = 0;
+    uint32_t alignment = 1;
+    uint32_t max_hits = MAX_SEARCH_HITS;
+    uint8_t* pattern = 0;
+    uint8_t* mask = 0;
+    uint32_t hit_count = 0;
+    uint64_t start, end, searched_to, offset, anchor = 0;
+
+    PDRead_find_u64(reader, &request_start, "address_start", 0);
+    PDRead_find_u64(reader, &size, "size", 0);
+    PDRead_find_u32(reader, &alignment, "alignment", 0);
+    PDRead_find_u32(reader, &max_hits, "max_hits", 0);
+
+    if (PDRead_find_data(reader, (void**)&pattern, &pattern_size, "pattern", 0) == PDReadStatus_NotFound) {
+        return;
+    }
+
+    if (PDRead_find_data(reader, (void**)&mask, &mask_size, "mask", 0) == PDReadStatus_NotFound ||
+        mask_size != pattern_size) {
+        mask = 0;
+    }
+
+    if (alignment == 0) {
+        alignment = 1;
+    }
+
+    if (max_hits == 0 || max_hits > MAX_SEARCH_HITS) {
+        max_hits = MAX_SEARCH_HITS;
+    }
+
+    // Only the memory of the target can match
+
+    start = request_start;
+    end = request_start + size;
+    searched_to = end;
+
+    if (start < (uint64_t)data->memory_start) {
+        start = (uint64_t)data->memory_start;
+    }
+
+    if (end > (uint64_t)data->memory_end) {
+        end = (uint64_t)data->memory_end;
+    }
+
+    // Find the candidates with memchr on the first byte that has to match exactly
+
+    if (mask) {
+        for (anchor = 0; anchor < pattern_size && mask[anchor] != 0xff; ++anchor) {
+        }
+    }
+
+    for (offset = start; pattern_size > 0 && offset + pattern_size <= end; ++offset) {
+        const uint8_t* memory = data->memory + (offset - data->memory_start);
+
+        if (anchor < pattern_size) {
+            const uint64_t remaining = end - pattern_size + 1 - offset;
+            const uint8_t* found = memchr(memory + anchor, pattern[anchor], remaining);
+
+            if (!found) {
+                break;
+            }
+
+            offset += (uint64_t)(found - (memory + anchor));
+            memory = data->memory + (offset - data->memory_start);
+        }
+
+        if ((offset % alignment) != 0 || !match_masked(memory, pattern, mask, pattern_size)) {
+            continue;
+        }
+
+        if (hit_count == max_hits) {
+            searched_to = offset;
+            break;
+        }
+
+        hits[hit_count++] = offset;
+    }
+
+    PDWrite_event_begin(writer, PDEventType_SetSearchResults);
+    PDWrite_u64(writer, "address_start", request_start);
+    PDWrite_data(writer, "hits", hits, hit_count * (uint32_t)sizeof(uint64_t));
+    PDWrite_u64(writer, "searched_to", searched_to);
+    PDWrite_event_end(writer);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 static void update_memory(DummyPlugin* plugin, PDReader* reader) {
     void* data;
     uint64_t address = 0;
@@ -691,6 +878,17 @@ static void update_memory(DummyPlugin* plugin, PDReader* reader) {
     memcpy(plugin->memory + (address - (uint64_t)plugin->memory_start), data, size);
 }
 
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// The code in s_disasm_data is 6502 so the frontend disassembles memory as that
+
+static void send_target_info(PDWriter* writer) {
+    PDWrite_event_begin(writer, PDEventType_SetTargetInfo);
+    PDWrite_u32(writer, "capstone_arch", CS_ARCH_MOS65XX);
+    PDWrite_u32(writer, "capstone_mode", CS_MODE_MOS65XX_6502);
+    PDWrite_u32(writer, "address_width", 2);
+    PDWrite_event_end(writer);
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 static int find_instruction_index(uint64_t address) {
@@ -760,6 +958,410 @@ static void get_disassembly(PDReader* reader, PDWriter* writer) {
     PDWrite_event_end(writer);
 }
 
+static int read_register_value(void* user_data, uint16_t index, uint64_t* value) {
+    DummyPlugin* plugin = (DummyPlugin*)user_data;
+    const uint8_t* data;
+    int i, start;
+
+    if (index >= plugin->registers_count) {
+        return 0;
+    }
+
+    // Registers are stored in big endian, only the lower 64 bits are used for wider ones
+
+    data = (const uint8_t*)plugin->registers[index].data;
+    start = plugin->registers[index].size > 8 ? plugin->registers[index].size - 8 : 0;
+
+    *value = 0;
+
+    for (i = start; i < plugin->registers[index].size; ++i) {
+        *value = (*value << 8) | data[i];
+    }
+
+    return 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static int read_memory_value(void* user_data, uint64_t address, int size, uint64_t* value) {
+    DummyPlugin* plugin = (DummyPlugin*)user_data;
+    int i;
+
+    if (address < (uint64_t)plugin->memory_start || address + (uint64_t)size > (uint64_t)plugin->memory_end) {
+        return 0;
+    }
+
+    *value = 0;
+
+    for (i = size - 1; i >= 0; --i) {
+        *value = (*value << 8) | plugin->memory[address - (uint64_t)plugin->memory_start + (uint64_t)i];
+    }
+
+    return 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static Breakpoint* find_breakpoint(DummyPlugin* plugin, uint64_t address) {
+    int i;
+
+    for (i = 0; i < plugin->breakpoint_count; ++i) {
+        if (plugin->breakpoints[i].address == address) {
+            return &plugin->breakpoints[i];
+        }
+    }
+
+    return NULL;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static Watchpoint* find_watchpoint(DummyPlugin* plugin, uint64_t address) {
+    int i;
+
+    for (i = 0; i < plugin->watchpoint_count; ++i) {
+        if (plugin->watchpoints[i].address == address) {
+            return &plugin->watchpoints[i];
+        }
+    }
+
+    return NULL;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void update_watch_pages(DummyPlugin* plugin) {
+    int i;
+
+    memset(plugin->read_watch_pages, 0, sizeof(plugin->read_watch_pages));
+    memset(plugin->write_watch_pages, 0, sizeof(plugin->write_watch_pages));
+
+    for (i = 0; i < plugin->watchpoint_count; ++i) {
+        const Watchpoint* wp = &plugin->watchpoints[i];
+        uint64_t start = wp->address - (uint64_t)plugin->memory_start;
+        uint64_t page;
+
+        // Watchpoints outside of the memory range can never be hit
+
+        if (wp->address < (uint64_t)plugin->memory_start || wp->address >= (uint64_t)plugin->memory_end) {
+            continue;
+        }
+
+        for (page = start >> WATCH_PAGE_SHIFT;
+             page <= ((start + wp->size - 1) >> WATCH_PAGE_SHIFT) && page < WATCH_PAGE_COUNT; ++page) {
+            if (wp->type & PDWatchType_Read) {
+                plugin->read_watch_pages[page >> 3] |= (uint8_t)(1 << (page & 7));
+            }
+
+            if (wp->type & PDWatchType_Write) {
+                plugin->write_watch_pages[page >> 3] |= (uint8_t)(1 << (page & 7));
+            }
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static int set_watchpoint(DummyPlugin* plugin, PDReader* reader, PDReaderIterator it, uint64_t address, uint8_t type) {
+    uint32_t watch_size = 1;
+    uint32_t hit_count = 0;
+    uint64_t size = 0;
+    void* condition = NULL;
+    Watchpoint* wp;
+
+    PDRead_find_u32(reader, &watch_size, "size", it);
+    PDRead_find_u32(reader, &hit_count, "hit_count", it);
+    PDRead_find_data(reader, &condition, &size, "condition", it);
+
+    if (watch_size == 0 || !(type & PDWatchType_Access)) {
+        return 0;
+    }
+
+    if (!(wp = find_watchpoint(plugin, address))) {
+        if (plugin->watchpoint_count >= MAX_WATCHPOINTS) {
+            printf("dummy_backend: Max number of watchpoints reached\n");
+            return 0;
+        }
+
+        wp = &plugin->watchpoints[plugin->watchpoint_count++];
+        memset(wp, 0, sizeof(Watchpoint));
+    }
+
+    free(wp->condition);
+
+    wp->address = address;
+    wp->size = watch_size;
+    wp->type = type;
+    wp->hit_count = hit_count;
+    wp->hits = 0;
+    wp->condition = NULL;
+    wp->condition_size = 0;
+
+    if (condition && size > 0) {
+        wp->condition = malloc(size);
+        wp->condition_size = (uint32_t)size;
+        memcpy(wp->condition, condition, size);
+    }
+
+    update_watch_pages(plugin);
+
+    return 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static int delete_watchpoint(DummyPlugin* plugin, uint64_t address) {
+    Watchpoint* wp;
+
+    if (!(wp = find_watchpoint(plugin, address))) {
+        return 0;
+    }
+
+    free(wp->condition);
+
+    *wp = plugin->watchpoints[--plugin->watchpoint_count];
+
+    update_watch_pages(plugin);
+
+    return 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Reads a breakpoint from the event (it = 0) or from an entry in a SyncBreakpoints array. Returns 0 on failure.
+
+static int set_breakpoint(DummyPlugin* plugin, PDReader* reader, PDReaderIterator it) {
+    uint64_t address = 0;
+    uint32_t hit_count = 0;
+    uint64_t size = 0;
+    uint8_t watch = 0;
+    void* condition = NULL;
+    Breakpoint* bp;
+
+    // The dummy target has no debug info so only address breakpoints are supported
+
+    if (PDRead_find_u64(reader, &address, "address", it) == PDReadStatus_NotFound) {
+        return 0;
+    }
+
+    PDRead_find_u8(reader, &watch, "watch", it);
+
+    if (watch) {
+        return set_watchpoint(plugin, reader, it, address, watch);
+    }
+
+    PDRead_find_u32(reader, &hit_count, "hit_count", it);
+    PDRead_find_data(reader, &condition, &size, "condition", it);
+
+    if (!(bp = find_breakpoint(plugin, address))) {
+        if (plugin->breakpoint_count >= MAX_BREAKPOINTS) {
+            printf("dummy_backend: Max number of breakpoints reached\n");
+            return 0;
+        }
+
+        bp = &plugin->breakpoints[plugin->breakpoint_count++];
+        memset(bp, 0, sizeof(Breakpoint));
+    }
+
+    free(bp->condition);
+    PDTrace_free_captures(&bp->captures);
+
+    // A sync that turns a tracepoint into a breakpoint (or back) modifies the same entry as both are per address
+    bp->tracepoint = PDTrace_read_captures(reader, it, &bp->captures);
+    bp->address = address;
+    bp->hit_count = hit_count;
+    bp->hits = 0;
+    bp->condition = NULL;
+    bp->condition_size = 0;
+
+    if (condition && size > 0) {
+        bp->condition = malloc(size);
+        bp->condition_size = (uint32_t)size;
+        memcpy(bp->condition, condition, size);
+    }
+
+    return 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static int delete_breakpoint(DummyPlugin* plugin, PDReader* reader, PDReaderIterator it) {
+    uint64_t address = 0;
+    uint8_t watch = 0;
+    Breakpoint* bp;
+
+    if (PDRead_find_u64(reader, &address, "address", it) == PDReadStatus_NotFound) {
+        return 0;
+    }
+
+    PDRead_find_u8(reader, &watch, "watch", it);
+
+    if (watch) {
+        return delete_watchpoint(plugin, address);
+    }
+
+    if (!(bp = find_breakpoint(plugin, address))) {
+        return 0;
+    }
+
+    free(bp->condition);
+    PDTrace_free_captures(&bp->captures);
+
+    *bp = plugin->breakpoints[--plugin->breakpoint_count];
+
+    return 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Applies a batch of breakpoint changes and acks all of them in one ReplyBreakpoint
+
+static void sync_breakpoints(DummyPlugin* plugin, PDReader* reader, PDWriter* writer) {
+    PDReaderIterator it;
+
+    if (PDRead_find_array(reader, &it, "breakpoints", 0) == PDReadStatus_NotFound) {
+        return;
+    }
+
+    PDWrite_event_begin(writer, PDEventType_ReplyBreakpoint);
+    PDWrite_array_begin(writer, "breakpoints");
+
+    while (PDRead_get_next_entry(reader, &it)) {
+        uint32_t id = 0;
+        uint8_t action = PDBreakpointAction_Add;
+        int status;
+
+        PDRead_find_u32(reader, &id, "id", it);
+        PDRead_find_u8(reader, &action, "action", it);
+
+        if (action == PDBreakpointAction_Remove) {
+            status = delete_breakpoint(plugin, reader, it);
+        } else {
+            status = set_breakpoint(plugin, reader, it);
+        }
+
+        PDWrite_array_entry_begin(writer);
+        PDWrite_u32(writer, "id", id);
+        PDWrite_u8(writer, "status", (uint8_t)status);
+        PDWrite_entry_end(writer);
+    }
+
+    PDWrite_array_end(writer);
+    PDWrite_event_end(writer);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Returns 1 if the target should stop at the breakpoint. A condition that fails to evaluate (bad memory access, etc)
+// will stop the target so the user can see what is going on. Tracepoints never stop, they only record a trace entry.
+
+static int should_stop(DummyPlugin* plugin, Breakpoint* bp) {
+    PDExprContext context = { plugin, read_register_value, read_memory_value };
+
+    if (bp->condition) {
+        uint64_t result = 0;
+
+        if (PDExpr_eval(bp->condition, bp->condition_size, &context, &result) == PDExprStatus_Ok && result == 0) {
+            return 0;
+        }
+    }
+
+    if (bp->tracepoint) {
+        PDTrace_record(&plugin->trace, &bp->captures, bp->address, &context);
+        return 0;
+    }
+
+    return ++bp->hits >= bp->hit_count;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Called for each memory access done by the target. Returns 1 if a watchpoint covering the access should stop it.
+
+static int check_watchpoints(DummyPlugin* plugin, uint64_t address, uint32_t size, uint8_t type) {
+    const uint8_t* pages = type == PDWatchType_Write ? plugin->write_watch_pages : plugin->read_watch_pages;
+    uint64_t offset = address - (uint64_t)plugin->memory_start;
+    uint64_t page = offset >> WATCH_PAGE_SHIFT;
+    uint64_t last_page = (offset + size - 1) >> WATCH_PAGE_SHIFT;
+    int i;
+
+    // Fast path: accesses to pages without any watchpoints
+
+    if (!(pages[page >> 3] & (1 << (page & 7))) &&
+        (last_page >= WATCH_PAGE_COUNT || !(pages[last_page >> 3] & (1 << (last_page & 7))))) {
+        return 0;
+    }
+
+    for (i = 0; i < plugin->watchpoint_count; ++i) {
+        Watchpoint* wp = &plugin->watchpoints[i];
+        PDExprContext context = { plugin, read_register_value, read_memory_value };
+        uint64_t result = 0;
+
+        if (!(wp->type & type) || address >= wp->address + wp->size || address + size <= wp->address) {
+            continue;
+        }
+
+        if (wp->condition &&
+            PDExpr_eval(wp->condition, wp->condition_size, &context, &result) == PDExprStatus_Ok && result == 0) {
+            continue;
+        }
+
+        if (++wp->hits >= wp->hit_count) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// The dummy target doesn't execute the instructions in s_disasm_data for real. To have some memory traffic for data
+// watchpoints each instruction loads a 32-bit counter of its own in the scratch region, increments it and stores it
+// back. Returns 1 if a watchpoint stopped the target.
+
+static int execute_memory_access(DummyPlugin* plugin) {
+    uint64_t address = SCRATCH_START + (((uint64_t)plugin->exception_location * 4) % SCRATCH_SIZE);
+    uint64_t offset = address - (uint64_t)plugin->memory_start;
+    uint64_t value = 0;
+
+    if (plugin->watchpoint_count > 0 && check_watchpoints(plugin, address, 4, PDWatchType_Read)) {
+        return 1;
+    }
+
+    read_memory_value(plugin, address, 4, &value);
+    value++;
+
+    plugin->memory[offset + 0] = (uint8_t)(value >> 0);
+    plugin->memory[offset + 1] = (uint8_t)(value >> 8);
+    plugin->memory[offset + 2] = (uint8_t)(value >> 16);
+    plugin->memory[offset + 3] = (uint8_t)(value >> 24);
+
+    return plugin->watchpoint_count > 0 && check_watchpoints(plugin, address, 4, PDWatchType_Write);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void run_target(DummyPlugin* plugin) {
+    int i;
+
+    for (i = 0; i < INSTRUCTIONS_PER_UPDATE; ++i) {
+        Breakpoint* bp;
+
+        step_to_next_location(plugin);
+
+        if (execute_memory_access(plugin)) {
+            plugin->state = PDDebugState_StopBreakpoint;
+            return;
+        }
+
+        if (plugin->breakpoint_count == 0) {
+            continue;
+        }
+
+        if ((bp = find_breakpoint(plugin, (uint64_t)plugin->exception_location)) && should_stop(plugin, bp)) {
+            plugin->state = PDDebugState_StopBreakpoint;
+            return;
+        }
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /*
 
@@ -824,6 +1426,19 @@ static PDDebugState update(void* user_data,
         case PDAction_Step:
         {
             step_to_next_location(data);
+            data->state = PDDebugState_Trace;
+            break;
+        }
+
+        case PDAction_Run:
+        {
+            data->state = PDDebugState_Running;
+            break;
+        }
+
+        case PDAction_Break:
+        {
+            data->state = PDDebugState_StopException;
             break;
         }
 
@@ -860,12 +1475,24 @@ static PDDebugState update(void* user_data,
                 break;
             }
 
+            case PDEventType_GetTargetInfo:
+            {
+                send_target_info(writer);
+                break;
+            }
+
             case PDEventType_UpdateMemory:
             {
                 update_memory(data, reader);
                 break;
             }
 
+            case PDEventType_SearchMemory:
+            {
+                search_memory(data, reader, writer);
+                break;
+            }
+
             case PDEventType_GetRegisters:
             {
                 send_registers(data, writer);
@@ -878,6 +1505,32 @@ static PDDebugState update(void* user_data,
                 break;
             }
 
+            case PDEventType_SetBreakpoint:
+            {
+                set_breakpoint(data, reader, 0);
+                break;
+            }
+
+            case PDEventType_DeleteBreakpoint:
+            {
+                delete_breakpoint(data, reader, 0);
+                break;
+            }
+
+            case PDEventType_SyncBreakpoints:
+            {
+                sync_breakpoints(data, reader, writer);
+                break;
+            }
+
+            case PDEventType_GetTraceData:
+            {
+                uint32_t max_records = 0;
+                PDRead_find_u32(reader, &max_records, "max_records", 0);
+                PDTrace_write_events(&data->trace, writer, max_records);
+                break;
+            }
+
             /*
             case PDEventType_RequestEvalExpression:
             {
@@ -888,10 +1541,19 @@ static PDDebugState update(void* user_data,
         }
     }
 
-    set_exception_location(data, writer);
+    if (data->state == PDDebugState_Running) {
+        run_target(data);
+    }
+
+    // Only report the location when stopped as it changes all the time while running
+
+    if (data->state != PDDebugState_Running) {
+        set_exception_location(data, writer);
+    }
+
     // printf("Update backend\n");
 
-    return PDDebugState_Running;
+    return data->state;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1,24 +1,34 @@
 #ifndef _WIN32
 
+#include <LLDB/SBAddress.h>
 #include <LLDB/SBBreakpoint.h>
 #include <LLDB/SBCommandInterpreter.h>
 #include <LLDB/SBCommandReturnObject.h>
+#include <LLDB/SBCompileUnit.h>
 #include <LLDB/SBDebugger.h>
+#include <LLDB/SBError.h>
 #include <LLDB/SBEvent.h>
 #include <LLDB/SBHostOS.h>
+#include <LLDB/SBLineEntry.h>
 #include <LLDB/SBListener.h>
+#include <LLDB/SBModule.h>
 #include <LLDB/SBModuleSpec.h>
 #include <LLDB/SBProcess.h>
 #include <LLDB/SBStream.h>
 #include <LLDB/SBTarget.h>
 #include <LLDB/SBThread.h>
 #include <LLDB/SBValueList.h>
+#include <LLDB/SBWatchpoint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <map>
+#include <string>
+#include <vector>
+#include "capstone/capstone.h"
 #include "pd_backend.h"
 #include "pd_host.h"
+#include "pd_line_table.h"
 #include "pd_backend_messages.h"
 
 // static PDMessageFuncs* s_messageFuncs;
@@ -28,6 +38,8 @@
 struct Breakpoint {
     const char* filename;
     int line;
+    // id from SyncBreakpoints (0 if not set that way)
+    uint32_t id;
 };
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -44,6 +56,9 @@ typedef struct LLDBPlugin {
     const char* targetName;
     std::map<lldb::tid_t, uint32_t> frameSelection;
     std::vector<Breakpoint> breakpoints;
+    // SyncBreakpoints ids to the LLDB breakpoint/watchpoint ids so they can be removed again
+    std::map<uint32_t, lldb::break_id_t> breakpoint_ids;
+    std::map<uint32_t, lldb::watch_id_t> watchpoint_ids;
 
 } LLDBPlugin;
 
@@ -312,8 +327,14 @@ static void target_reply(LLDBPlugin* plugin, const FileTargetRequest* request, P
             if (!breakpoint.IsValid()) {
                 // TODO: Send message back that this breakpoint could't be set
                 printf("Unable to set breakpoint %s:%d\n", bp.filename, bp.line);
+            } else if (bp.id != 0) {
+                plugin->breakpoint_ids[bp.id] = breakpoint.GetID();
             }
+
+            free((void*)bp.filename);
         }
+
+        plugin->breakpoints.clear();
         printf("LLDBPlugin: Ok target\n");
 
         TargetReplyBuilder reply(builder);
@@ -599,12 +620,376 @@ static void do_action(LLDBPlugin* plugin, PDAction action) {
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+// Applies one entry of a SyncBreakpoints event. Hit counts maps to the ignore count. Returns false if the breakpoint
+// couldn't be set.
+
+static bool sync_breakpoint(LLDBPlugin* plugin, PDReader* reader, PDReaderIterator it, uint32_t id, uint8_t action) {
+    const char* filename = nullptr;
+    void* condition = nullptr;
+    uint64_t condition_size = 0;
+    uint64_t address = 0;
+    uint32_t line = 0;
+    uint32_t hit_count = 0;
+    uint32_t size = 1;
+    uint8_t watch = 0;
+    uint8_t tracepoint = 0;
+
+    PDRead_find_u8(reader, &watch, "watch", it);
+    PDRead_find_u32(reader, &hit_count, "hit_count", it);
+
+    // Modify is handled as remove + add as LLDB can't change the location or range of an existing breakpoint
+
+    auto bp_iter = plugin->breakpoint_ids.find(id);
+    auto wp_iter = plugin->watchpoint_ids.find(id);
+
+    if (bp_iter != plugin->breakpoint_ids.end()) {
+        plugin->target.BreakpointDelete(bp_iter->second);
+        plugin->breakpoint_ids.erase(bp_iter);
+    }
+
+    if (wp_iter != plugin->watchpoint_ids.end()) {
+        plugin->target.DeleteWatchpoint(wp_iter->second);
+        plugin->watchpoint_ids.erase(wp_iter);
+    }
+
+    if (action == PDBreakpointAction_Remove) {
+        return true;
+    }
+
+    // LLDB can't evaluate the byte code conditions from the frontend. Setting the breakpoint without its condition
+    // would stop every time so it's reported as failed instead
+
+    PDRead_find_data(reader, &condition, &condition_size, "condition", it);
+
+    if (condition_size > 0) {
+        printf("LLDBPlugin: Breakpoint conditions are not supported, breakpoint %u is not set\n", id);
+        return false;
+    }
+
+    // Same for tracepoints, there is no trace buffer here
+
+    PDRead_find_u8(reader, &tracepoint, "tracepoint", it);
+
+    if (tracepoint) {
+        printf("LLDBPlugin: Tracepoints are not supported, tracepoint %u is not set\n", id);
+        return false;
+    }
+
+    if (watch) {
+        lldb::SBError error;
+
+        PDRead_find_u64(reader, &address, "address", it);
+        PDRead_find_u32(reader, &size, "size", it);
+
+        // Watchpoints can only be set once the process is running as they uses the debug registers of the cpu
+
+        if (!plugin->process.IsValid()) {
+            printf("LLDBPlugin: Unable to set watchpoint at 0x%llx without a running process\n",
+                   (unsigned long long)address);
+            return false;
+        }
+
+        lldb::SBWatchpoint watchpoint = plugin->target.WatchAddress(
+            address, size, (watch & PDWatchType_Read) != 0, (watch & PDWatchType_Write) != 0, error);
+
+        if (!watchpoint.IsValid()) {
+            printf("LLDBPlugin: Unable to set watchpoint at 0x%llx: %s\n", (unsigned long long)address,
+                   error.GetCString());
+            return false;
+        }
+
+        if (hit_count > 1) {
+            watchpoint.SetIgnoreCount(hit_count - 1);
+        }
+
+        plugin->watchpoint_ids[id] = watchpoint.GetID();
+
+        return true;
+    }
+
+    if (PDRead_find_string(reader, &filename, "filename", it) != PDReadStatus_NotFound) {
+        PDRead_find_u32(reader, &line, "line", it);
+
+        // Without a target the breakpoint is kept and set when the target is created (see target_reply)
+
+        if (!plugin->target.IsValid()) {
+            Breakpoint bp = {strdup(filename), (int)line, id};
+            plugin->breakpoints.push_back(bp);
+            return true;
+        }
+
+        lldb::SBBreakpoint breakpoint = plugin->target.BreakpointCreateByLocation(filename, line);
+
+        if (!breakpoint.IsValid()) {
+            return false;
+        }
+
+        if (hit_count > 1) {
+            breakpoint.SetIgnoreCount(hit_count - 1);
+        }
+
+        plugin->breakpoint_ids[id] = breakpoint.GetID();
+
+        return true;
+    }
+
+    if (PDRead_find_u64(reader, &address, "address", it) == PDReadStatus_NotFound || !plugin->target.IsValid()) {
+        return false;
+    }
+
+    lldb::SBBreakpoint breakpoint = plugin->target.BreakpointCreateByAddress(address);
+
+    if (!breakpoint.IsValid()) {
+        return false;
+    }
+
+    if (hit_count > 1) {
+        breakpoint.SetIgnoreCount(hit_count - 1);
+    }
+
+    plugin->breakpoint_ids[id] = breakpoint.GetID();
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void sync_breakpoints(LLDBPlugin* plugin, PDReader* reader, PDWriter* writer) {
+    PDReaderIterator it;
+
+    if (PDRead_find_array(reader, &it, "breakpoints", 0) == PDReadStatus_NotFound) {
+        return;
+    }
+
+    PDWrite_event_begin(writer, PDEventType_ReplyBreakpoint);
+    PDWrite_array_begin(writer, "breakpoints");
+
+    while (PDRead_get_next_entry(reader, &it)) {
+        uint32_t id = 0;
+        uint8_t action = PDBreakpointAction_Add;
+
+        PDRead_find_u32(reader, &id, "id", it);
+        PDRead_find_u8(reader, &action, "action", it);
+
+        // Deferred file/line breakpoints are looked up by id so a remove before the target exists drops it too
+
+        for (auto bp = plugin->breakpoints.begin(); bp != plugin->breakpoints.end(); ++bp) {
+            if (bp->id == id) {
+                free((void*)bp->filename);
+                plugin->breakpoints.erase(bp);
+                break;
+            }
+        }
+
+        bool status = sync_breakpoint(plugin, reader, it, id, action);
+
+        PDWrite_array_entry_begin(writer);
+        PDWrite_u32(writer, "id", id);
+        PDWrite_u8(writer, "status", status ? 1 : 0);
+        PDWrite_entry_end(writer);
+    }
+
+    PDWrite_array_end(writer);
+    PDWrite_event_end(writer);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Line entries are sent as they are in the compile units. Load addresses are used once the process is running and
+// file addresses before that
+
+static lldb::addr_t line_address(LLDBPlugin* plugin, const lldb::SBAddress& address) {
+    lldb::addr_t load_address = address.GetLoadAddress(plugin->target);
+    return load_address != LLDB_INVALID_ADDRESS ? load_address : address.GetFileAddress();
+}
+
+// Units are sent until about this many bytes are in the reply and the rest is sent when the frontend asks again
+
+static const size_t s_line_table_reply_size = 1024 * 1024;
+
+static void send_line_table(LLDBPlugin* plugin, PDReader* reader, PDWriter* writer) {
+    if (!plugin->target.IsValid()) {
+        return;
+    }
+
+    std::vector<PDLineRow> rows;
+    std::string files;
+    std::map<std::string, uint32_t> file_ids;
+    uint32_t first_module = 0;
+    uint32_t first_unit = 0;
+    size_t reply_size = 0;
+
+    PDRead_find_u32(reader, &first_module, "module", 0);
+    PDRead_find_u32(reader, &first_unit, "unit", 0);
+
+    const uint32_t module_count = plugin->target.GetNumModules();
+
+    for (uint32_t im = first_module; im < module_count; ++im) {
+        lldb::SBModule module(plugin->target.GetModuleAtIndex(im));
+
+        const uint32_t unit_count = module.GetNumCompileUnits();
+
+        for (uint32_t ic = im == first_module ? first_unit : 0; ic < unit_count; ++ic) {
+            lldb::SBCompileUnit unit(module.GetCompileUnitAtIndex(ic));
+            char path[4096];
+
+            rows.clear();
+            files.clear();
+            file_ids.clear();
+
+            const uint32_t entry_count = unit.GetNumLineEntries();
+            lldb::addr_t end = LLDB_INVALID_ADDRESS;
+
+            for (uint32_t ie = 0; ie < entry_count; ++ie) {
+                lldb::SBLineEntry entry(unit.GetLineEntryAtIndex(ie));
+                const lldb::addr_t start = line_address(plugin, entry.GetStartAddress());
+
+                if (start == LLDB_INVALID_ADDRESS) {
+                    continue;
+                }
+
+                // Gaps between entries (the end of a sequence) don't belong to any line
+
+                if (end != LLDB_INVALID_ADDRESS && end != start) {
+                    rows.push_back({end, 0, 0});
+                }
+
+                path[0] = 0;
+                entry.GetFileSpec().GetPath(path, sizeof(path));
+
+                auto it = file_ids.find(path);
+
+                if (it == file_ids.end()) {
+                    it = file_ids.insert(std::make_pair(std::string(path), (uint32_t)file_ids.size())).first;
+                    files.append(path, strlen(path) + 1);
+                }
+
+                rows.push_back({start, it->second, entry.GetLine()});
+                end = line_address(plugin, entry.GetEndAddress());
+            }
+
+            if (rows.empty()) {
+                continue;
+            }
+
+            if (end != LLDB_INVALID_ADDRESS) {
+                rows.push_back({end, 0, 0});
+            }
+
+            path[0] = 0;
+            unit.GetFileSpec().GetPath(path, sizeof(path));
+
+            const size_t unit_size = strlen(path) + files.size() + rows.size() * sizeof(PDLineRow);
+
+            if (reply_size > 0 && reply_size + unit_size > s_line_table_reply_size) {
+                PDLineTable_write_next(writer, im, ic);
+                return;
+            }
+
+            PDLineTable_write_unit(writer, path, files.data(), (uint32_t)files.size(), rows.data(),
+                                   (uint32_t)rows.size());
+
+            reply_size += unit_size;
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// The load bias is only known once the process has been launched and the executable is mapped
+
+static void send_target_info(LLDBPlugin* plugin, PDWriter* writer) {
+    if (!plugin->target.IsValid()) {
+        return;
+    }
+
+    const char* triple = plugin->target.GetTriple();
+    const uint32_t address_width = plugin->target.GetAddressByteSize();
+    cs_arch arch;
+    uint32_t mode;
+
+    if (!triple) {
+        return;
+    }
+
+    if (!strncmp(triple, "x86_64", 6)) {
+        arch = CS_ARCH_X86;
+        mode = CS_MODE_64;
+    } else if (triple[0] == 'i' && !strncmp(triple + 2, "86", 2)) {
+        arch = CS_ARCH_X86;
+        mode = CS_MODE_32;
+    } else if (!strncmp(triple, "aarch64", 7) || !strncmp(triple, "arm64", 5)) {
+        arch = CS_ARCH_ARM64;
+        mode = CS_MODE_ARM;
+    } else if (!strncmp(triple, "arm", 3)) {
+        arch = CS_ARCH_ARM;
+        mode = CS_MODE_ARM;
+    } else {
+        return;
+    }
+
+    if (plugin->target.GetByteOrder() == lldb::eByteOrderBig) {
+        mode |= CS_MODE_BIG_ENDIAN;
+    }
+
+    PDWrite_event_begin(writer, PDEventType_SetTargetInfo);
+    PDWrite_u32(writer, "capstone_arch", uint32_t(arch));
+    PDWrite_u32(writer, "capstone_mode", mode);
+    PDWrite_u32(writer, "address_width", address_width);
+
+    lldb::SBModule module(plugin->target.FindModule(plugin->target.GetExecutable()));
+
+    if (module.IsValid()) {
+        const char* uuid = module.GetUUIDString();
+
+        if (uuid && uuid[0]) {
+            PDWrite_string(writer, "build_id", uuid);
+        }
+    }
+
+    if (module.IsValid() && plugin->process.IsValid()) {
+        lldb::SBAddress header(module.GetObjectFileHeaderAddress());
+        const lldb::addr_t load_address = header.GetLoadAddress(plugin->target);
+
+        if (load_address != LLDB_INVALID_ADDRESS) {
+            PDWrite_u64(writer, "load_bias", load_address - header.GetFileAddress());
+        }
+    }
+
+    PDWrite_event_end(writer);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 static void process_events(LLDBPlugin* plugin, PDReader* reader, PDWriter* writer) {
     uint32_t event;
     void* data = nullptr;
     uint64_t size = 0;
 
     while ((event = PDRead_get_event(reader))) {
+        // Regular backend events are not wrapped in a message
+
+        if (event != PDEventType_Dummy) {
+            switch (event) {
+                case PDEventType_SyncBreakpoints: {
+                    sync_breakpoints(plugin, reader, writer);
+                    break;
+                }
+
+                case PDEventType_GetLineTable: {
+                    send_line_table(plugin, reader, writer);
+                    break;
+                }
+
+                case PDEventType_GetTargetInfo: {
+                    send_target_info(plugin, writer);
+                    break;
+                }
+
+                default: break;
+            }
+
+            continue;
+        }
+
         // TODO: This wrapping is temporary right now
         PDRead_find_data(reader, &data, &size, "data", 0);
         const Message* msg = GetMessage(data);
@@ -684,7 +1069,13 @@ static void update_lldb_event(LLDBPlugin* plugin, PDWriter* writer) {
 
     lldb::SBEvent evt;
 
-    plugin->listener.WaitForEvent(1, evt);
+    // Several sessions can share the same worker thread in the frontend so only poll for events here
+    // instead of blocking the worker while waiting for the target.
+
+    if (!plugin->listener.WaitForEvent(0, evt)) {
+        return;
+    }
+
     lldb::StateType state = lldb::SBProcess::GetStateFromEvent(evt);
 
     printf("event = %s\n", lldb::SBDebugger::StateAsCString(state));
@@ -797,11 +1188,18 @@ static void update_lldb_event(LLDBPlugin* plugin, PDWriter* writer) {
                         break;
                     }
 
-                    case lldb::eStopReasonWatchpoint:
+                    case lldb::eStopReasonWatchpoint: {
                         select_thread = true;
+
+                        if (plugin->state != PDDebugState_StopBreakpoint)
+                            send_exception_state(plugin, writer);
+
+                        plugin->state = PDDebugState_StopBreakpoint;
+
                         if (m_verbose)
                             printf("watchpoint id = %ld\n", thread.GetStopReasonDataAtIndex(0));
                         break;
+                    }
                     case lldb::eStopReasonSignal:
                         select_thread = true;
                         if (m_verbose)
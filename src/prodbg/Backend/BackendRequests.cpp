@@ -7,6 +7,22 @@ namespace prodbg {
 
 BackendRequests::BackendRequests(BackendSession* session) {
     connect(this, &BackendRequests::file_target_request_signal, session, &BackendSession::file_target_request);
+    connect(this, &BackendRequests::evaluate_expressions_signal, session, &BackendSession::evaluate_expressions);
+    connect(this, &BackendRequests::add_address_breakpoint_signal, session, &BackendSession::add_address_breakpoint);
+    connect(this, &BackendRequests::add_file_line_breakpoint_signal, session,
+            &BackendSession::add_file_line_breakpoint);
+    connect(this, &BackendRequests::sync_breakpoints_signal, session, &BackendSession::sync_breakpoints);
+    connect(this, &BackendRequests::fetch_trace_data_signal, session, &BackendSession::fetch_trace_data);
+    connect(this, &BackendRequests::read_memory_pages_signal, session, &BackendSession::read_memory_pages);
+    connect(this, &BackendRequests::search_memory_signal, session, &BackendSession::search_memory);
+    connect(this, &BackendRequests::write_memory_signal, session, &BackendSession::write_memory);
+    connect(this, &BackendRequests::request_target_info_signal, session, &BackendSession::request_target_info);
+    connect(this, &BackendRequests::set_symbols_signal, session, &BackendSession::set_symbols);
+    connect(this, &BackendRequests::request_line_table_signal, session, &BackendSession::request_line_table);
+    connect(this, &BackendRequests::remove_address_breakpoint_signal, session,
+            &BackendSession::remove_address_breakpoint);
+    connect(this, &BackendRequests::remove_file_line_breakpoint_signal, session,
+            &BackendSession::remove_file_line_breakpoint);
 
     /*
     connect(this, &BackendRequests::sendCustomStr, session, &BackendSession::sendCustomString);
@@ -15,9 +31,6 @@ BackendRequests::BackendRequests(BackendSession* session) {
     connect(this, &BackendRequests::requestDisassembly, session, &BackendSession::beginDisassembly);
     connect(this, &BackendRequests::readRegisters, session, &BackendSession::beginReadRegisters);
 
-    connect(this, &BackendRequests::toggleAddressBreakpoint, session, &BackendSession::toggleAddressBreakpoint);
-    connect(this, &BackendRequests::toggleFileLineBreakpoint, session, &BackendSession::toggleFileLineBreakpoint);
-
     connect(this, &BackendRequests::evalExpression, session, &BackendSession::evalExpression);
     */
 
@@ -30,6 +43,14 @@ BackendRequests::BackendRequests(BackendSession* session) {
 
     connect(session, &BackendSession::program_counter_changed, this, &BackendRequests::program_counter_changed);
     connect(session, &BackendSession::session_ended, this, &BackendRequests::session_ended);
+    connect(session, &BackendSession::expressions_evaluated, this, &BackendRequests::expressions_evaluated);
+    connect(session, &BackendSession::breakpoints_acknowledged, this, &BackendRequests::breakpoints_acknowledged);
+    connect(session, &BackendSession::trace_data_received, this, &BackendRequests::trace_data_received);
+    connect(session, &BackendSession::memory_pages_received, this, &BackendRequests::memory_pages_received);
+    connect(session, &BackendSession::memory_search_results, this, &BackendRequests::memory_search_results);
+    connect(session, &BackendSession::target_info_received, this, &BackendRequests::target_info_received);
+    connect(session, &BackendSession::line_table_received, this, &BackendRequests::line_table_received);
+    connect(session, &BackendSession::breakpoint_condition_error, this, &BackendRequests::breakpoint_condition_error);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -38,35 +59,93 @@ void BackendRequests::file_target_request(const QString& path) {
     file_target_request_signal(path);
 }
 
-/*
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void BackendRequests::sendCustomString(uint16_t id, const QString& text) {
-    sendCustomStr(id, text);
+void BackendRequests::evaluate_expressions(const QStringList& expressions) {
+    evaluate_expressions_signal(expressions);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void BackendRequests::add_address_breakpoint(uint64_t address, const QString& condition, uint32_t hit_count) {
+    add_address_breakpoint_signal(address, condition, hit_count);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void BackendRequests::add_file_line_breakpoint(const QString& filename, int line, const QString& condition,
+                                               uint32_t hit_count) {
+    add_file_line_breakpoint_signal(filename, line, condition, hit_count);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void BackendRequests::sync_breakpoints(const QVector<BreakpointChange>& changes) {
+    sync_breakpoints_signal(changes);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void BackendRequests::beginAddAddressBreakpoint(uint64_t address) {
-    toggleAddressBreakpoint(address, true);
+void BackendRequests::fetch_trace_data(uint32_t max_records) {
+    fetch_trace_data_signal(max_records);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void BackendRequests::beginAddFileLineBreakpoint(const QString& filename, int line) {
-    toggleFileLineBreakpoint(filename, line, true);
+uint64_t BackendRequests::read_memory_pages(const QVector<uint64_t>& addresses, uint32_t page_size) {
+    const uint64_t request_id = ++m_memory_request;
+    read_memory_pages_signal(addresses, page_size, request_id);
+    return request_id;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void BackendRequests::beginRemoveAddressBreakpoint(uint64_t address) {
-    toggleAddressBreakpoint(address, false);
+void BackendRequests::search_memory(uint64_t address, uint64_t size, const QByteArray& pattern,
+                                    const QByteArray& mask, uint32_t alignment, uint32_t max_hits) {
+    search_memory_signal(address, size, pattern, mask, alignment, max_hits);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void BackendRequests::beginRemoveFileLineBreakpoint(const QString& filename, int line) {
-    toggleFileLineBreakpoint(filename, line, false);
+void BackendRequests::write_memory(uint64_t address, const QByteArray& data) {
+    write_memory_signal(address, data);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void BackendRequests::request_target_info() {
+    request_target_info_signal();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void BackendRequests::set_symbols(const QSharedPointer<const SymbolTable>& symbols) {
+    set_symbols_signal(symbols);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void BackendRequests::request_line_table() {
+    request_line_table_signal();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void BackendRequests::remove_address_breakpoint(uint64_t address) {
+    remove_address_breakpoint_signal(address);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void BackendRequests::remove_file_line_breakpoint(const QString& filename, int line) {
+    remove_file_line_breakpoint_signal(filename, line);
+}
+
+/*
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void BackendRequests::sendCustomString(uint16_t id, const QString& text) {
+    sendCustomStr(id, text);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1,6 +1,9 @@
 #pragma once
 
 #include <QtCore/QObject>
+#include <QtCore/QStringList>
+#include "Core/LineTable.h"
+#include "Core/SymbolTable.h"
 #include "IBackendRequests.h"
 
 namespace prodbg {
@@ -18,6 +21,24 @@ public:
     // Request to start a file for debugging
     void file_target_request(const QString& path);
 
+    void evaluate_expressions(const QStringList& expressions) override;
+
+    void add_address_breakpoint(uint64_t address, const QString& condition = QString(),
+                                uint32_t hit_count = 0) override;
+    void add_file_line_breakpoint(const QString& filename, int line, const QString& condition = QString(),
+                                  uint32_t hit_count = 0) override;
+    void sync_breakpoints(const QVector<BreakpointChange>& changes) override;
+    void fetch_trace_data(uint32_t max_records = 0) override;
+    uint64_t read_memory_pages(const QVector<uint64_t>& addresses, uint32_t page_size) override;
+    void search_memory(uint64_t address, uint64_t size, const QByteArray& pattern, const QByteArray& mask,
+                       uint32_t alignment, uint32_t max_hits) override;
+    void write_memory(uint64_t address, const QByteArray& data) override;
+    void request_target_info() override;
+    void set_symbols(const QSharedPointer<const SymbolTable>& symbols) override;
+    void request_line_table() override;
+    void remove_address_breakpoint(uint64_t address) override;
+    void remove_file_line_breakpoint(const QString& filename, int line) override;
+
     // Send a custom event to the backend. The id should be registers using the
     // IdService_register This can be done in the same way using the id service
     // on the backend side. This allows the front-end to send custom commands to
@@ -25,18 +46,6 @@ public:
     /*
     void sendCustomString(uint16_t id, const QString& text);
 
-    // Add a breakpoint at a specific address
-    void beginAddAddressBreakpoint(uint64_t address);
-
-    // Add a breakpoint on a specific file and line number
-    void beginAddFileLineBreakpoint(const QString& filename, int line);
-
-    // Remove a breakpoint at a specific address
-    void beginRemoveAddressBreakpoint(uint64_t address);
-
-    // Remove a breakpoint on a specific file and line number
-    void beginRemoveFileLineBreakpoint(const QString& filename, int line);
-
     // Get hw registers from the backend
     // registers = array of registers
     void beginReadRegisters(QVector<Register>* registers);
@@ -59,14 +68,30 @@ public:
 
 private:
     Q_SIGNAL void file_target_request_signal(const QString& filename);
+    Q_SIGNAL void evaluate_expressions_signal(const QStringList& expressions);
+    Q_SIGNAL void add_address_breakpoint_signal(uint64_t address, const QString& condition, uint32_t hit_count);
+    Q_SIGNAL void add_file_line_breakpoint_signal(const QString& filename, int line, const QString& condition,
+                                                  uint32_t hit_count);
+    Q_SIGNAL void sync_breakpoints_signal(const QVector<IBackendRequests::BreakpointChange>& changes);
+    Q_SIGNAL void fetch_trace_data_signal(uint32_t max_records);
+    Q_SIGNAL void read_memory_pages_signal(const QVector<uint64_t>& addresses, uint32_t page_size,
+                                           uint64_t request_id);
+    Q_SIGNAL void search_memory_signal(uint64_t address, uint64_t size, const QByteArray& pattern,
+                                       const QByteArray& mask, uint32_t alignment, uint32_t max_hits);
+    Q_SIGNAL void write_memory_signal(uint64_t address, const QByteArray& data);
+    Q_SIGNAL void request_target_info_signal();
+    Q_SIGNAL void set_symbols_signal(const QSharedPointer<const SymbolTable>& symbols);
+    Q_SIGNAL void request_line_table_signal();
+    Q_SIGNAL void remove_address_breakpoint_signal(uint64_t address);
+    Q_SIGNAL void remove_file_line_breakpoint_signal(const QString& filename, int line);
+
+    // Id of the last read_memory_pages request
+    uint64_t m_memory_request = 0;
 
     /*
     Q_SIGNAL void evalExpression(const QString& expr, uint64_t* out);
     Q_SIGNAL void sendCustomStr(uint16_t id, const QString& text);
 
-    Q_SIGNAL void toggleFileLineBreakpoint(const QString& filename, int line, bool add);
-    Q_SIGNAL void toggleAddressBreakpoint(uint64_t address, bool add);
-
     Q_SIGNAL void readRegisters(QVector<Register>* registers);
     Q_SIGNAL void requestMem(uint64_t lo, uint64_t hi, QVector<uint16_t>* target);
     Q_SIGNAL void requestDisassembly(uint64_t address, uint32_t count,
@@ -1,10 +1,13 @@
 #include "BackendSession.h"
 #include <pd_backend.h>
+#include <pd_capstone.h>
 #include <pd_io.h>
+#include <pd_line_table.h>
 #include <pd_readwrite.h>
-#include <tinyexpr.h>
+#include <pd_trace.h>
 #include <QtCore/QDebug>
 #include <QtCore/QString>
+#include <QtCore/QStringList>
 #include <QtCore/QTimer>
 #include "Core/PluginHandler.h"
 #include "IBackendRequests.h"
@@ -99,10 +102,6 @@ void BackendSession::destory_plugin_data() {
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void BackendSession::thread_finished() { delete this; }
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
 static QString s_stateTable[] = {
     QStringLiteral("No target"),        QStringLiteral("Running"),          QStringLiteral("Stop (breakpoint)"),
     QStringLiteral("Stop (exception)"), QStringLiteral("Trace (stepping)"), QStringLiteral("Unknown"),
@@ -224,118 +223,6 @@ static void updateRegisters(QVector<IBackendRequests::Register>* target, PDReade
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-static uint16_t getU16(uint8_t* ptr) {
-    uint16_t v = (ptr[0] << 8) | ptr[1];
-    return v;
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-static uint32_t getU32(uint8_t* ptr) {
-    uint32_t v = (ptr[0] << 24) | (ptr[1] << 16) | (ptr[2] << 8) | ptr[3];
-    return v;
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-static uint64_t getU64(uint8_t* ptr) {
-    uint64_t v = ((uint64_t)ptr[0] << 56) | ((uint64_t)ptr[1] << 48) | ((uint64_t)ptr[2] << 40) |
-                 ((uint64_t)ptr[3] << 32) | (ptr[4] << 24) | (ptr[5] << 16) | (ptr[6] << 8) | ptr[7];
-    return v;
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-static uint64_t getRegValue(uint8_t* data, int size) {
-    switch (size) {
-        case 1: {
-            return data[1];
-        }
-
-        case 2: {
-            return getU16(data);
-        }
-
-        case 4: {
-            return getU32(data);
-        }
-
-        case 8: {
-            return getU64(data);
-            break;
-        }
-
-        default: {
-            // printf("getRegValue: size %d not supported, returing 0\n");
-            return 0;
-        }
-    }
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-static int buildExpressionVars(te_variable* variables, uint64_t* values, int maxRegs, PDReader* reader) {
-    PDReaderIterator it;
-
-    if (PDRead_find_array(reader, &it, "registers", 0) == PDReadStatus_NotFound) {
-        printf("Unable to find registers array\n");
-        return 0;
-    }
-
-    int index = 0;
-
-    while (PDRead_get_next_entry(reader, &it)) {
-        const char* name = "";
-        uint8_t* data = 0;
-        uint64_t size = 0;
-        uint8_t read_only = 0;
-
-        PDRead_find_string(reader, &name, "name", it);
-        PDRead_find_u8(reader, &read_only, "read_only", it);
-        PDRead_find_data(reader, (void**)&data, &size, "register", it);
-
-        values[index] = getRegValue(data, size);
-
-        variables[index].name = name;  // this is safe as we use this result
-                                       // directly without reseting any streams
-        variables[index].address = &values[index];
-        variables[index].type = 0;
-        variables[index].context = nullptr;
-
-        ++index;
-
-        if (index >= maxRegs) {
-            printf("buildExpressionVars: Reached max regs, no more will be added");
-            break;
-        }
-    }
-
-    return index;
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-void BackendSession::toggleAddressBreakpoint(uint64_t address, bool add) {
-    PDWrite_event_begin(m_currentWriter, PDEventType_SetBreakpoint);
-    PDWrite_u64(m_currentWriter, "address", address);
-    PDWrite_event_end(m_currentWriter);
-
-    update();
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-void BackendSession::toggleFileLineBreakpoint(const QString& filename, int line, bool add) {
-    PDWrite_event_begin(m_currentWriter, PDEventType_SetBreakpoint);
-    PDWrite_string(m_currentWriter, "filename", filename.toUtf8().data());
-    PDWrite_u32(m_currentWriter, "line", line);
-    PDWrite_event_end(m_currentWriter);
-
-    update();
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
 void BackendSession::beginReadRegisters(QVector<IBackendRequests::Register>* target) {
     uint32_t event = 0;
 
@@ -435,7 +322,15 @@ Q_SLOT void BackendSession::file_target_request(const QString& path) {
 
     while ((event = PDRead_get_event(m_reader))) {
         printf("looking for reply\n");
-        PDRead_find_data(m_reader, &data, &size, "data", 0);
+
+        if (event != PDEventType_Dummy) {
+            continue;
+        }
+
+        if (PDRead_find_data(m_reader, &data, &size, "data", 0) == PDReadStatus_NotFound) {
+            continue;
+        }
+
         const Message* msg = GetMessage(data);
 
         if (msg->message_type() == MessageType_target_reply) {
@@ -462,48 +357,778 @@ void BackendSession::sendCustomString(uint16_t id, const QString& text) {
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-/*
-void BackendSession::evalExpression(const QString& expression, uint64_t* out) {
-    te_variable variables[512];
-    uint64_t values[512];
+// Registers are sent in big endian order. Registers wider than 64-bit (such as xmm) only keeps the lower 64 bits
+
+static uint64_t get_register_value(const uint8_t* data, uint64_t size) {
+    uint64_t value = 0;
 
+    for (uint64_t i = size > 8 ? size - 8 : 0; i < size; ++i) {
+        value = (value << 8) | data[i];
+    }
+
+    return value;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void BackendSession::refresh_register_snapshot() {
     uint32_t event = 0;
-    int error = 0;
-    int maxRegs = 512;
-    int regCount = 0;
 
-    // Get the registers
+    // Registers only changes when the target has been stopped/stepped so reuse the current snapshot if possible
+
+    if (m_registers.epoch == m_stop_epoch && !m_registers.names.isEmpty() && m_debugState != PDDebugState_Running) {
+        return;
+    }
 
     PDWrite_event_begin(m_currentWriter, PDEventType_GetRegisters);
     PDWrite_event_end(m_currentWriter);
 
     update();
 
+    m_registers.epoch = m_stop_epoch;
+    m_registers.names.resize(0);
+    m_registers.values.resize(0);
+
     while ((event = PDRead_get_event(m_reader))) {
+        PDReaderIterator it;
+
         if (event != PDEventType_SetRegisters) {
             continue;
         }
 
-        regCount = buildExpressionVars(variables, values, maxRegs, m_reader);
+        if (PDRead_find_array(m_reader, &it, "registers", 0) == PDReadStatus_NotFound) {
+            printf("Unable to find registers array\n");
+            continue;
+        }
+
+        while (PDRead_get_next_entry(m_reader, &it)) {
+            const char* name = "";
+            uint8_t* data = nullptr;
+            uint64_t size = 0;
+
+            PDRead_find_string(m_reader, &name, "name", it);
+            PDRead_find_data(m_reader, (void**)&data, &size, "register", it);
 
-        break;
+            m_registers.names.append(QString::fromUtf8(name));
+            m_registers.values.append(data ? get_register_value(data, size) : 0);
+        }
     }
 
-    // qDebug() << "eval expression " << expression;
+    m_expressions.set_registers(m_registers.names);
+}
 
-    te_expr* expr = te_compile(expression.toUtf8().data(), variables, regCount, &error);
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Memory used by expressions is fetched in small lines and kept until the target runs again. A watch list with many
+// expressions using the same stack frame will then only do a few round trips to the backend.
 
-    if (error != 0) {
-        endResolveAddress(nullptr);
-    } else {
-        *out = te_eval(expr);
-        endResolveAddress(out);
+bool BackendSession::read_expression_memory(uint64_t address, int size, uint64_t* value) {
+    enum { LineSize = 64 };
+
+    uint64_t result = 0;
+
+    for (int i = 0; i < size; ++i) {
+        uint64_t byte_address = address + uint64_t(i);
+        uint64_t line_address = byte_address & ~uint64_t(LineSize - 1);
+
+        auto it = m_expression_memory.find(line_address);
+
+        if (it == m_expression_memory.end()) {
+            uint32_t event = 0;
+            QByteArray line;
+
+            PDWrite_event_begin(m_currentWriter, PDEventType_GetMemory);
+            PDWrite_u64(m_currentWriter, "address_start", line_address);
+            PDWrite_u64(m_currentWriter, "size", LineSize);
+            PDWrite_event_end(m_currentWriter);
+
+            update();
+
+            while ((event = PDRead_get_event(m_reader))) {
+                uint8_t* data = nullptr;
+                uint64_t data_size = 0;
+                uint32_t address_width = 0;
+
+                if (event != PDEventType_SetMemory) {
+                    continue;
+                }
+
+                if (PDRead_find_u32(m_reader, &address_width, "address_width", 0) != PDReadStatus_NotFound) {
+                    m_expressions.set_address_width(int(address_width));
+                }
+
+                if (PDRead_find_data(m_reader, (void**)&data, &data_size, "data", 0) != PDReadStatus_NotFound) {
+                    line = QByteArray((const char*)data, int(data_size));
+                }
+            }
+
+            it = m_expression_memory.insert(line_address, line);
+        }
+
+        int offset = int(byte_address - line_address);
+
+        if (offset >= it.value().size()) {
+            return false;
+        }
+
+        const int shift = m_target_big_endian ? (size - 1 - i) * 8 : i * 8;
+
+        result |= uint64_t(uint8_t(it.value().at(offset))) << shift;
     }
+
+    *value = result;
+
+    return true;
 }
-*/
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void BackendSession::evaluate_expressions(const QStringList& expressions) {
+    QVector<IBackendRequests::ExpressionResult> results;
+    results.reserve(expressions.size());
+
+    refresh_register_snapshot();
+
+    if (m_expression_memory_epoch != m_stop_epoch) {
+        m_expression_memory.clear();
+        m_expression_memory_epoch = m_stop_epoch;
+    }
+
+    uint64_t epoch = m_stop_epoch;
+
+    auto memory_reader = [this](uint64_t address, int size, uint64_t* value) {
+        return read_expression_memory(address, size, value);
+    };
+
+    for (const QString& text : expressions) {
+        IBackendRequests::ExpressionResult result;
+        result.expression = text;
+        result.value = 0;
+        result.valid = m_expressions.evaluate(text, m_registers, memory_reader, &result.value, &result.error);
+        results.append(result);
+    }
+
+    expressions_evaluated(results, epoch);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Conditions are compiled here and sent as byte code so the backend can evaluate them in place without stopping the
+// target. Returns false (and reports the error) if the condition doesn't compile. Register operands are indices in
+// the order of the backend so the names has to be known, callers compiling many conditions refresh them once up front
+// and pass refresh_registers = false.
+
+bool BackendSession::compile_breakpoint_condition(const QString& condition, QVector<uint8_t>* code,
+                                                  bool refresh_registers) {
+    if (condition.trimmed().isEmpty()) {
+        return true;
+    }
+
+    if (refresh_registers) {
+        refresh_register_snapshot();
+    }
+
+    CompiledExpression expr = m_expressions.compile(condition);
+
+    if (!expr.is_valid()) {
+        breakpoint_condition_error(condition, expr.error);
+        return false;
+    }
+
+    *code = expr.code;
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Captures are compiled the same way as conditions so any failure is reported with the same signal
+
+bool BackendSession::compile_tracepoint_captures(const QStringList& captures, QVector<QVector<uint8_t>>* code) {
+    if (captures.size() > PD_TRACE_MAX_VALUES) {
+        breakpoint_condition_error(captures.join(QStringLiteral(", ")),
+                                   QStringLiteral("At most %1 values can be captured").arg(PD_TRACE_MAX_VALUES));
+        return false;
+    }
+
+    for (const QString& capture : captures) {
+        QVector<uint8_t> capture_code;
+
+        if (!compile_breakpoint_condition(capture, &capture_code, false)) {
+            return false;
+        }
+
+        code->append(capture_code);
+    }
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void BackendSession::write_breakpoint_condition(const QVector<uint8_t>& code, uint32_t hit_count) {
+    if (!code.isEmpty()) {
+        PDWrite_data(m_currentWriter, "condition", (void*)code.constData(), uint32_t(code.size()));
+    }
+
+    if (hit_count > 0) {
+        PDWrite_u32(m_currentWriter, "hit_count", hit_count);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void BackendSession::add_address_breakpoint(uint64_t address, const QString& condition, uint32_t hit_count) {
+    QVector<uint8_t> code;
+
+    if (!compile_breakpoint_condition(condition, &code)) {
+        return;
+    }
+
+    PDWrite_event_begin(m_currentWriter, PDEventType_SetBreakpoint);
+    PDWrite_u64(m_currentWriter, "address", address);
+    write_breakpoint_condition(code, hit_count);
+    PDWrite_event_end(m_currentWriter);
+
+    update();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void BackendSession::add_file_line_breakpoint(const QString& filename, int line, const QString& condition,
+                                              uint32_t hit_count) {
+    QVector<uint8_t> code;
+
+    if (!compile_breakpoint_condition(condition, &code)) {
+        return;
+    }
+
+    PDWrite_event_begin(m_currentWriter, PDEventType_SetBreakpoint);
+    PDWrite_string(m_currentWriter, "filename", filename.toUtf8().data());
+    PDWrite_u32(m_currentWriter, "line", line);
+    write_breakpoint_condition(code, hit_count);
+    PDWrite_event_end(m_currentWriter);
+
+    update();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// All pages are requested with one update. Backends answer each GetMemory with a SetMemory at the address that was
+// asked for, pages that couldn't be read are sent back empty so the caller doesn't ask for them again.
+
+void BackendSession::read_memory_pages(const QVector<uint64_t>& addresses, uint32_t page_size, uint64_t request_id) {
+    QVector<IBackendRequests::MemoryPage> pages;
+    uint32_t address_width = 0;
+    uint32_t event = 0;
+
+    if (addresses.isEmpty()) {
+        return;
+    }
+
+    pages.reserve(addresses.size());
+
+    for (uint64_t address : addresses) {
+        PDWrite_event_begin(m_currentWriter, PDEventType_GetMemory);
+        PDWrite_u64(m_currentWriter, "address_start", address);
+        PDWrite_u64(m_currentWriter, "size", page_size);
+        PDWrite_event_end(m_currentWriter);
+
+        IBackendRequests::MemoryPage page;
+        page.address = address;
+        pages.append(page);
+    }
+
+    update();
+
+    while ((event = PDRead_get_event(m_reader))) {
+        uint8_t* data = nullptr;
+        uint64_t size = 0;
+        uint64_t address = 0;
+
+        if (event != PDEventType_SetMemory) {
+            continue;
+        }
+
+        PDRead_find_u32(m_reader, &address_width, "address_width", 0);
+        PDRead_find_u64(m_reader, &address, "address", 0);
+
+        if (PDRead_find_data(m_reader, (void**)&data, &size, "data", 0) == PDReadStatus_NotFound) {
+            continue;
+        }
+
+        for (IBackendRequests::MemoryPage& page : pages) {
+            if (page.address == address) {
+                page.data = QByteArray((const char*)data, int(qMin(size, uint64_t(page_size))));
+                break;
+            }
+        }
+    }
+
+    memory_pages_received(request_id, pages, int(address_width), m_stop_epoch);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void BackendSession::search_memory(uint64_t address, uint64_t size, const QByteArray& pattern,
+                                   const QByteArray& mask, uint32_t alignment, uint32_t max_hits) {
+    QVector<uint64_t> hits;
+    uint64_t searched_to = address + size;
+    bool supported = false;
+    uint32_t event = 0;
+
+    PDWrite_event_begin(m_currentWriter, PDEventType_SearchMemory);
+    PDWrite_u64(m_currentWriter, "address_start", address);
+    PDWrite_u64(m_currentWriter, "size", size);
+    PDWrite_data(m_currentWriter, "pattern", pattern.constData(), uint32_t(pattern.size()));
+
+    if (!mask.isEmpty()) {
+        PDWrite_data(m_currentWriter, "mask", mask.constData(), uint32_t(mask.size()));
+    }
+
+    PDWrite_u32(m_currentWriter, "alignment", alignment);
+    PDWrite_u32(m_currentWriter, "max_hits", max_hits);
+    PDWrite_event_end(m_currentWriter);
+
+    update();
+
+    while ((event = PDRead_get_event(m_reader))) {
+        uint64_t* data = nullptr;
+        uint64_t data_size = 0;
+        uint64_t reply_address = 0;
+
+        if (event != PDEventType_SetSearchResults) {
+            continue;
+        }
+
+        PDRead_find_u64(m_reader, &reply_address, "address_start", 0);
+
+        if (reply_address != address) {
+            continue;
+        }
+
+        PDRead_find_u64(m_reader, &searched_to, "searched_to", 0);
+
+        if (PDRead_find_data(m_reader, (void**)&data, &data_size, "hits", 0) != PDReadStatus_NotFound) {
+            const int count = int(data_size / sizeof(uint64_t));
+            hits.resize(count);
+
+            // The data isn't guaranteed to be aligned in the reader
+            memcpy(hits.data(), data, size_t(count) * sizeof(uint64_t));
+        }
+
+        supported = true;
+    }
+
+    memory_search_results(address, hits, searched_to, supported);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void BackendSession::write_memory(uint64_t address, const QByteArray& data) {
+    PDWrite_event_begin(m_currentWriter, PDEventType_UpdateMemory);
+    PDWrite_u64(m_currentWriter, "address", address);
+    PDWrite_data(m_currentWriter, "data", data.constData(), uint32_t(data.size()));
+    PDWrite_event_end(m_currentWriter);
+
+    update();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void BackendSession::request_target_info() {
+    uint32_t event = 0;
+
+    PDWrite_event_begin(m_currentWriter, PDEventType_GetTargetInfo);
+    PDWrite_event_end(m_currentWriter);
+
+    update();
+
+    while ((event = PDRead_get_event(m_reader))) {
+        const char* build_id = nullptr;
+        uint32_t arch = 0;
+        uint32_t mode = 0;
+        uint32_t address_width = 0;
+        uint64_t load_bias = 0;
+
+        if (event != PDEventType_SetTargetInfo) {
+            continue;
+        }
+
+        if (PDRead_find_u32(m_reader, &arch, "capstone_arch", 0) == PDReadStatus_NotFound) {
+            continue;
+        }
+
+        PDRead_find_u32(m_reader, &mode, "capstone_mode", 0);
+        PDRead_find_u32(m_reader, &address_width, "address_width", 0);
+        PDRead_find_string(m_reader, &build_id, "build_id", 0);
+
+        const bool has_load_bias = PDRead_find_u64(m_reader, &load_bias, "load_bias", 0) != PDReadStatus_NotFound;
+
+        const bool big_endian = (mode & CS_MODE_BIG_ENDIAN) != 0;
+
+        m_target_big_endian = big_endian;
+
+        target_info_received({int(arch), int(mode), int(address_width), big_endian, QString::fromUtf8(build_id),
+                              has_load_bias, load_bias});
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// The units are read straight from the reply and the table is sorted here so the UI thread only gets the result.
+// Large programs come in several replies and the next one is asked for until the backend has sent all units
+
+void BackendSession::request_line_table() {
+    QSharedPointer<LineTable> table;
+    uint32_t module = 0;
+    uint32_t unit = 0;
+    bool more = true;
+
+    while (more) {
+        uint32_t event = 0;
+
+        PDWrite_event_begin(m_currentWriter, PDEventType_GetLineTable);
+        PDWrite_u32(m_currentWriter, "module", module);
+        PDWrite_u32(m_currentWriter, "unit", unit);
+        PDWrite_event_end(m_currentWriter);
+
+        update();
+
+        more = false;
+
+        while ((event = PDRead_get_event(m_reader))) {
+            const char* name = nullptr;
+            const char* files = nullptr;
+            void* rows = nullptr;
+            uint64_t files_size = 0;
+            uint64_t rows_size = 0;
+            uint32_t row_count = 0;
+            uint32_t next_module = 0;
+            uint32_t next_unit = 0;
+
+            if (event != PDEventType_SetLineTable) {
+                continue;
+            }
+
+            // The cursor has to move forward or a confused backend would keep us here forever
+
+            if (PDRead_find_u32(m_reader, &next_module, "next_module", 0) != PDReadStatus_NotFound) {
+                PDRead_find_u32(m_reader, &next_unit, "next_unit", 0);
+
+                if (next_module > module || (next_module == module && next_unit > unit)) {
+                    module = next_module;
+                    unit = next_unit;
+                    more = true;
+                }
+
+                continue;
+            }
+
+            PDRead_find_string(m_reader, &name, "unit", 0);
+            PDRead_find_data(m_reader, (void**)&files, &files_size, "files", 0);
+            PDRead_find_data(m_reader, &rows, &rows_size, "rows", 0);
+            PDRead_find_u32(m_reader, &row_count, "row_count", 0);
+
+            if (uint64_t(row_count) * sizeof(PDLineRow) > rows_size) {
+                continue;
+            }
+
+            QStringList paths;
+
+            for (uint64_t start = 0, i = 0; i < files_size; ++i) {
+                if (files[i] == 0) {
+                    paths.append(QString::fromUtf8(files + start, int(i - start)));
+                    start = i + 1;
+                }
+            }
+
+            if (!table) {
+                table.reset(new LineTable);
+            }
+
+            // PDLineRow and LineTable::Row have the same layout. The data isn't aligned in the reply so it's copied
+            static_assert(sizeof(PDLineRow) == sizeof(LineTable::Row), "Line row layouts differ");
+
+            QVector<LineTable::Row> unit_rows(int(row_count));
+            memcpy(unit_rows.data(), rows, row_count * sizeof(PDLineRow));
+
+            table->add_unit(QString::fromUtf8(name), paths, unit_rows.constData(), unit_rows.size());
+        }
+    }
+
+    if (table) {
+        table->finish();
+        line_table_received(table);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Symbols are resolved when expressions are compiled so the resolver holds on to the table it was given
+
+void BackendSession::set_symbols(const QSharedPointer<const SymbolTable>& symbols) {
+    if (!symbols) {
+        m_expressions.set_symbol_resolver(ExpressionEngine::SymbolResolver());
+        return;
+    }
+
+    m_expressions.set_symbol_resolver([symbols](const QString& name, uint64_t* value) {
+        const int index = symbols->find(name.toUtf8());
+
+        if (index < 0) {
+            return false;
+        }
+
+        *value = symbols->at(index).address;
+        return true;
+    });
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// The whole trace buffer is pulled in one go so the cost is one round trip per fetch no matter how many times the
+// tracepoints has been hit.
+
+void BackendSession::fetch_trace_data(uint32_t max_records) {
+    QVector<IBackendRequests::TraceRecord> records;
+    uint64_t dropped = 0;
+    uint32_t event = 0;
+
+    PDWrite_event_begin(m_currentWriter, PDEventType_GetTraceData);
+
+    if (max_records > 0) {
+        PDWrite_u32(m_currentWriter, "max_records", max_records);
+    }
+
+    PDWrite_event_end(m_currentWriter);
+
+    update();
+
+    while ((event = PDRead_get_event(m_reader))) {
+        uint8_t* data = nullptr;
+        uint64_t size = 0;
+        uint64_t event_dropped = 0;
+
+        if (event != PDEventType_SetTraceData) {
+            continue;
+        }
+
+        if (PDRead_find_u64(m_reader, &event_dropped, "dropped", 0) != PDReadStatus_NotFound) {
+            dropped += event_dropped;
+        }
+
+        if (PDRead_find_data(m_reader, (void**)&data, &size, "records", 0) == PDReadStatus_NotFound) {
+            continue;
+        }
+
+        uint64_t count = size / sizeof(PDTraceRecord);
+        records.reserve(records.size() + int(count));
+
+        for (uint64_t i = 0; i < count; ++i) {
+            PDTraceRecord trace;
+            memcpy(&trace, data + i * sizeof(PDTraceRecord), sizeof(PDTraceRecord));
+
+            IBackendRequests::TraceRecord record;
+            record.address = trace.address;
+            record.error_mask = trace.error_mask;
+            record.values.resize(int(qMin(trace.value_count, uint32_t(PD_TRACE_MAX_VALUES))));
+
+            for (int v = 0, value_count = record.values.size(); v < value_count; ++v) {
+                record.values[v] = trace.values[v];
+            }
+
+            records.append(record);
+        }
+    }
+
+    trace_data_received(records, dropped);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void BackendSession::sync_breakpoints(const QVector<IBackendRequests::BreakpointChange>& changes) {
+    // Fetching the registers is a round trip (that flushes the pending batch) so it's done once for the whole sync
+    // and before looking at the pending state
+
+    for (const IBackendRequests::BreakpointChange& change : changes) {
+        if (change.action != IBackendRequests::BreakpointChange::Remove &&
+            (!change.condition.trimmed().isEmpty() || !change.captures.isEmpty())) {
+            refresh_register_snapshot();
+            break;
+        }
+    }
+
+    for (const IBackendRequests::BreakpointChange& change : changes) {
+        PendingBreakpoint pending;
+        pending.change = change;
+
+        if (change.action == IBackendRequests::BreakpointChange::Remove) {
+            auto it = m_pending_breakpoints.find(change.id);
+            bool pending_add = it != m_pending_breakpoints.end() &&
+                               it.value().change.action == IBackendRequests::BreakpointChange::Add;
+
+            // Never sent to the backend so just drop it
+            if (pending_add) {
+                m_pending_breakpoints.erase(it);
+            } else {
+                m_pending_breakpoints.insert(change.id, pending);
+            }
+
+            continue;
+        }
+
+        if (!compile_breakpoint_condition(change.condition, &pending.code, false) ||
+            !compile_tracepoint_captures(change.captures, &pending.captures)) {
+            continue;
+        }
+
+        auto it = m_pending_breakpoints.find(change.id);
+
+        if (it != m_pending_breakpoints.end() && it.value().change.action == IBackendRequests::BreakpointChange::Add) {
+            pending.change.action = IBackendRequests::BreakpointChange::Add;
+        }
+
+        m_pending_breakpoints.insert(change.id, pending);
+    }
+
+    // While running the timer will flush the batch on the next tick, otherwise do it directly
+
+    if (m_debugState != PDDebugState_Running && !m_pending_breakpoints.isEmpty()) {
+        update();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void BackendSession::write_breakpoint_batch() {
+    if (m_pending_breakpoints.isEmpty()) {
+        return;
+    }
+
+    PDWrite_event_begin(m_currentWriter, PDEventType_SyncBreakpoints);
+    PDWrite_array_begin(m_currentWriter, "breakpoints");
+
+    // Removes are written first so backends that looks up breakpoints by location handles remove + add on the same
+    // location correctly
+
+    for (int pass = 0; pass < 2; ++pass) {
+        for (const PendingBreakpoint& pending : m_pending_breakpoints) {
+            const IBackendRequests::BreakpointChange& change = pending.change;
+            bool remove = change.action == IBackendRequests::BreakpointChange::Remove;
+
+            if (remove != (pass == 0)) {
+                continue;
+            }
+
+            PDWrite_array_entry_begin(m_currentWriter);
+            PDWrite_u32(m_currentWriter, "id", change.id);
+            PDWrite_u8(m_currentWriter, "action", uint8_t(change.action));
+
+            if (change.filename.isEmpty()) {
+                PDWrite_u64(m_currentWriter, "address", change.address);
+            } else {
+                PDWrite_string(m_currentWriter, "filename", change.filename.toUtf8().data());
+                PDWrite_u32(m_currentWriter, "line", change.line);
+            }
+
+            if (change.watch) {
+                PDWrite_u8(m_currentWriter, "watch", change.watch);
+                PDWrite_u32(m_currentWriter, "size", change.size);
+            }
+
+            if (!remove) {
+                write_breakpoint_condition(pending.code, change.hit_count);
+            }
+
+            if (!remove && change.tracepoint) {
+                write_tracepoint_captures(pending.captures);
+            }
+
+            PDWrite_entry_end(m_currentWriter);
+        }
+    }
+
+    PDWrite_array_end(m_currentWriter);
+    PDWrite_event_end(m_currentWriter);
+
+    m_pending_breakpoints.clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// The captures are packed in one data field as entries can't hold arrays (see PDTrace_read_captures)
+
+void BackendSession::write_tracepoint_captures(const QVector<QVector<uint8_t>>& captures) {
+    QByteArray packed;
+
+    for (const QVector<uint8_t>& capture : captures) {
+        const uint32_t size = uint32_t(capture.size());
+        packed.append(reinterpret_cast<const char*>(&size), sizeof(size));
+        packed.append(reinterpret_cast<const char*>(capture.constData()), capture.size());
+    }
+
+    PDWrite_u8(m_currentWriter, "tracepoint", 1);
+
+    if (!packed.isEmpty()) {
+        PDWrite_data(m_currentWriter, "captures", (void*)packed.constData(), uint32_t(packed.size()));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void BackendSession::read_breakpoint_replies() {
+    QVector<uint32_t> accepted;
+    QVector<uint32_t> rejected;
+    uint32_t event = 0;
+
+    while ((event = PDRead_get_event(m_reader))) {
+        PDReaderIterator it;
+
+        if (event != PDEventType_ReplyBreakpoint) {
+            continue;
+        }
+
+        if (PDRead_find_array(m_reader, &it, "breakpoints", 0) == PDReadStatus_NotFound) {
+            continue;
+        }
+
+        while (PDRead_get_next_entry(m_reader, &it)) {
+            uint32_t id = 0;
+            uint8_t status = 0;
+
+            PDRead_find_u32(m_reader, &id, "id", it);
+            PDRead_find_u8(m_reader, &status, "status", it);
+
+            if (status) {
+                accepted.append(id);
+            } else {
+                rejected.append(id);
+            }
+        }
+    }
+
+    pd_binary_reader_reset(m_reader);
+
+    if (!accepted.isEmpty() || !rejected.isEmpty()) {
+        breakpoints_acknowledged(accepted, rejected);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void BackendSession::remove_address_breakpoint(uint64_t address) {
+    PDWrite_event_begin(m_currentWriter, PDEventType_DeleteBreakpoint);
+    PDWrite_u64(m_currentWriter, "address", address);
+    PDWrite_event_end(m_currentWriter);
+
+    update();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void BackendSession::remove_file_line_breakpoint(const QString& filename, int line) {
+    PDWrite_event_begin(m_currentWriter, PDEventType_DeleteBreakpoint);
+    PDWrite_string(m_currentWriter, "filename", filename.toUtf8().data());
+    PDWrite_u32(m_currentWriter, "line", line);
+    PDWrite_event_end(m_currentWriter);
+
+    update();
+}
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void BackendSession::update_current_pc() {
     uint32_t event = 0;
     void* data;
@@ -512,7 +1137,15 @@ void BackendSession::update_current_pc() {
     pd_binary_reader_reset(m_reader);
 
     while ((event = PDRead_get_event(m_reader))) {
-        PDRead_find_data(m_reader, &data, &size, "data", 0);
+        // Only flatbuffer messages are wrapped in the Dummy event
+        if (event != PDEventType_Dummy) {
+            continue;
+        }
+
+        if (PDRead_find_data(m_reader, &data, &size, "data", 0) == PDReadStatus_NotFound) {
+            continue;
+        }
+
         const Message* msg = GetMessage(data);
 
         if (msg->message_type() == MessageType_exception_location_reply) {
@@ -579,6 +1212,9 @@ PDDebugState BackendSession::internal_update(PDAction action) {
         return PDDebugState_NoTarget;
     }
 
+    // Breakpoint changes are piggybacked on the next update so they are sent as one message per tick
+    write_breakpoint_batch();
+
     pd_binary_writer_finalize(m_currentWriter);
 
     unsigned int req_data_size = pd_binary_writer_get_size(m_currentWriter);
@@ -596,6 +1232,15 @@ PDDebugState BackendSession::internal_update(PDAction action) {
     pd_binary_reader_reset(m_reader);
     pd_binary_writer_reset(m_currentWriter);
 
+    read_breakpoint_replies();
+
+    // Any action or stop may change registers and memory so results cached against the old epoch are stale now.
+    // While running everything is considered stale on each update.
+
+    if (action != PDAction_None || state != m_debugState || state == PDDebugState_Running) {
+        m_stop_epoch++;
+    }
+
     // Send state change if state is different from the last time
 
     if (state != m_debugState) {
@@ -633,12 +1278,15 @@ void BackendSession::start() {
 
     printf("starting the backend!\n");
 
-    internal_update(PDAction_Run);
+    // The timer is created here (and not in the constructor) so it lives on the worker thread the session has been
+    // moved to. It's only active while the target is running so idle sessions doesn't use any CPU.
 
-    m_timer = new QTimer(this);
-    connect(m_timer, &QTimer::timeout, this, &BackendSession::update);
+    if (!m_timer) {
+        m_timer = new QTimer(this);
+        connect(m_timer, &QTimer::timeout, this, &BackendSession::update);
+    }
 
-    m_timer->start(50);
+    internal_update(PDAction_Run);
 }
 
 /*
@@ -1,7 +1,13 @@
 #pragma once
 
 #include <pd_backend.h>
+#include <QtCore/QByteArray>
+#include <QtCore/QHash>
 #include <QtCore/QObject>
+#include <QtCore/QStringList>
+#include "Core/LineTable.h"
+#include "Core/SymbolTable.h"
+#include "ExpressionEngine.h"
 #include "IBackendRequests.h"
 
 class QString;
@@ -24,10 +30,25 @@ public:
     static BackendSession* create_backend_session(const QString& backendName);
     bool set_backend(const QString& backendName);
 
-    Q_SLOT void thread_finished();
     Q_SLOT void update();
     Q_SLOT void file_target_request(const QString& path);
     Q_SLOT void start();
+    Q_SLOT void evaluate_expressions(const QStringList& expressions);
+
+    Q_SLOT void add_address_breakpoint(uint64_t address, const QString& condition, uint32_t hit_count);
+    Q_SLOT void add_file_line_breakpoint(const QString& filename, int line, const QString& condition,
+                                         uint32_t hit_count);
+    Q_SLOT void fetch_trace_data(uint32_t max_records);
+    Q_SLOT void read_memory_pages(const QVector<uint64_t>& addresses, uint32_t page_size, uint64_t request_id);
+    Q_SLOT void search_memory(uint64_t address, uint64_t size, const QByteArray& pattern, const QByteArray& mask,
+                              uint32_t alignment, uint32_t max_hits);
+    Q_SLOT void write_memory(uint64_t address, const QByteArray& data);
+    Q_SLOT void request_target_info();
+    Q_SLOT void set_symbols(const QSharedPointer<const SymbolTable>& symbols);
+    Q_SLOT void request_line_table();
+    Q_SLOT void sync_breakpoints(const QVector<IBackendRequests::BreakpointChange>& changes);
+    Q_SLOT void remove_address_breakpoint(uint64_t address);
+    Q_SLOT void remove_file_line_breakpoint(const QString& filename, int line);
 
     /*
     Q_SLOT void start();
@@ -36,13 +57,8 @@ public:
     Q_SLOT void stepOver();
     Q_SLOT void breakContDebug();
 
-    Q_SLOT void evalExpression(const QString& expression, uint64_t* out);
-
     Q_SLOT void sendCustomString(uint16_t id, const QString& text);
 
-    Q_SLOT void toggleAddressBreakpoint(uint64_t address, bool add);
-    Q_SLOT void toggleFileLineBreakpoint(const QString& filename, int line, bool add);
-
     Q_SLOT void beginReadRegisters(QVector<IBackendRequests::Register>* target);
     Q_SLOT void beginReadMemory(uint64_t lo, uint64_t hi, QVector<uint16_t>* target);
     Q_SLOT void beginDisassembly(uint64_t address,
@@ -50,7 +66,6 @@ public:
                                  QVector<IBackendRequests::AssemblyInstruction>* target);
 
     // Signals
-    Q_SIGNAL void endResolveAddress(uint64_t* out);
     Q_SIGNAL void endReadRegisters(QVector<IBackendRequests::Register>* registers);
     Q_SIGNAL void endDisassembly(QVector<IBackendRequests::AssemblyInstruction>* instructions, int adressWidth);
     Q_SIGNAL void endReadMemory(QVector<uint16_t>* res, uint64_t address, int addressWidth);
@@ -59,11 +74,29 @@ public:
     // Q_SIGNAL void sourceFileLineChanged(const QString& filename, uint32_t line);
     Q_SIGNAL void program_counter_changed(const IBackendRequests::ProgramCounterChange& pc);
     Q_SIGNAL void target_reply(bool status, const QString& error_message);
+    Q_SIGNAL void expressions_evaluated(const QVector<IBackendRequests::ExpressionResult>& results, uint64_t epoch);
+    Q_SIGNAL void trace_data_received(const QVector<IBackendRequests::TraceRecord>& records, uint64_t dropped);
+    Q_SIGNAL void memory_pages_received(uint64_t request_id, const QVector<IBackendRequests::MemoryPage>& pages,
+                                        int address_width, uint64_t epoch);
+    Q_SIGNAL void memory_search_results(uint64_t address, const QVector<uint64_t>& hits, uint64_t searched_to,
+                                        bool supported);
+    Q_SIGNAL void target_info_received(const IBackendRequests::TargetInfo& info);
+    Q_SIGNAL void line_table_received(const QSharedPointer<const LineTable>& table);
+    Q_SIGNAL void breakpoints_acknowledged(const QVector<uint32_t>& accepted, const QVector<uint32_t>& rejected);
+    Q_SIGNAL void breakpoint_condition_error(const QString& condition, const QString& error);
     Q_SIGNAL void session_ended();
 
 private:
     void update_current_pc();
     void destory_plugin_data();
+    void refresh_register_snapshot();
+    bool read_expression_memory(uint64_t address, int size, uint64_t* value);
+    bool compile_breakpoint_condition(const QString& condition, QVector<uint8_t>* code, bool refresh_registers = true);
+    bool compile_tracepoint_captures(const QStringList& captures, QVector<QVector<uint8_t>>* code);
+    void write_breakpoint_condition(const QVector<uint8_t>& code, uint32_t hit_count);
+    void write_tracepoint_captures(const QVector<QVector<uint8_t>>& captures);
+    void write_breakpoint_batch();
+    void read_breakpoint_replies();
 
     PDDebugState internal_update(PDAction action);
 
@@ -73,6 +106,25 @@ private:
     uint32_t m_currentLine = 0;
     uint64_t m_currentPc = 0;
 
+    // Bumped each time the target stops or is stepped. Cached registers/memory are only valid for one epoch
+    uint64_t m_stop_epoch = 1;
+
+    ExpressionEngine m_expressions;
+    RegisterSnapshot m_registers;
+    QHash<uint64_t, QByteArray> m_expression_memory;
+    uint64_t m_expression_memory_epoch = 0;
+    // Byte order of memory read by expressions. From the last target info (little endian until it's known)
+    bool m_target_big_endian = false;
+
+    // Breakpoint changes waiting to be sent to the backend (by id) with the compiled condition
+    struct PendingBreakpoint {
+        IBackendRequests::BreakpointChange change;
+        QVector<uint8_t> code;
+        QVector<QVector<uint8_t>> captures;
+    };
+
+    QHash<uint32_t, PendingBreakpoint> m_pending_breakpoints;
+
     // Writers/Read for communitaction between backend and UI
     PDWriter* m_writer0;
     PDWriter* m_writer1;
@@ -0,0 +1,579 @@
+#include "ExpressionEngine.h"
+#include <pd_expression.h>
+#include <QtCore/QByteArray>
+#include <string.h>
+
+namespace prodbg {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+struct BinaryOp {
+    const char* text;
+    int length;
+    int precedence;
+    PDExprOp op;
+};
+
+// Longer operators has to come before their prefixes ("<<" before "<")
+
+static const BinaryOp s_binary_ops[] = {
+    { "||", 2, 1, PDExprOp_LogicalOr }, { "&&", 2, 2, PDExprOp_LogicalAnd }, { "==", 2, 6, PDExprOp_Eq },
+    { "!=", 2, 6, PDExprOp_Ne },        { "<=", 2, 7, PDExprOp_Le },         { ">=", 2, 7, PDExprOp_Ge },
+    { "<<", 2, 8, PDExprOp_Shl },       { ">>", 2, 8, PDExprOp_Shr },        { "|", 1, 3, PDExprOp_Or },
+    { "^", 1, 4, PDExprOp_Xor },        { "&", 1, 5, PDExprOp_And },         { "<", 1, 7, PDExprOp_Lt },
+    { ">", 1, 7, PDExprOp_Gt },         { "+", 1, 9, PDExprOp_Add },         { "-", 1, 9, PDExprOp_Sub },
+    { "*", 1, 10, PDExprOp_Mul },       { "/", 1, 10, PDExprOp_Div },        { "%", 1, 10, PDExprOp_Mod },
+};
+
+enum {
+    ConstSize = 9,
+    MaxNesting = 256,
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static bool is_ident_start(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' || c == '.';
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static bool is_ident_char(char c) {
+    return is_ident_start(c) || (c >= '0' && c <= '9') || c == ':';
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static int hex_value(char c) {
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    } else if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    } else if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+
+    return -1;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Recursive descent (precedence climbing) parser that emits byte code directly. Sub-expressions that end up as
+// constants are folded as soon as they are complete.
+
+struct Parser {
+    const char* pos;
+    QVector<uint8_t>& code;
+    const QHash<QString, int>& registers;
+    const ExpressionEngine::SymbolResolver& symbols;
+    int address_width;
+    int depth = 0;
+    int max_depth = 0;
+    int nesting = 0;
+    QString error;
+
+    Parser(const char* text, QVector<uint8_t>& c, const QHash<QString, int>& regs,
+           const ExpressionEngine::SymbolResolver& syms, int width)
+        : pos(text), code(c), registers(regs), symbols(syms), address_width(width) {}
+
+    void skip_whitespace() {
+        while (*pos == ' ' || *pos == '\t') {
+            pos++;
+        }
+    }
+
+    void push(int count) {
+        depth += count;
+        max_depth = depth > max_depth ? depth : max_depth;
+    }
+
+    void emit_const(uint64_t value) {
+        code.append(PDExprOp_Const);
+
+        for (int i = 0; i < 8; ++i) {
+            code.append(uint8_t(value >> (i * 8)));
+        }
+
+        push(1);
+    }
+
+    void emit_register(int index) {
+        code.append(PDExprOp_Register);
+        code.append(uint8_t(index));
+        code.append(uint8_t(index >> 8));
+        push(1);
+    }
+
+    void emit_load(int size) {
+        code.append(PDExprOp_Load);
+        code.append(uint8_t(size));
+    }
+
+    bool is_const(int start, int end) const {
+        return end - start == ConstSize && code[start] == PDExprOp_Const;
+    }
+
+    // Evaluate the code from start and replace it with a single constant. Ops that fail (such as divide by zero) are
+    // left as is and will report the error when evaluated.
+    void fold(int start) {
+        PDExprContext context = { nullptr, nullptr, nullptr };
+        uint64_t value = 0;
+
+        if (PDExpr_eval(code.constData() + start, uint32_t(code.size() - start), &context, &value) !=
+            PDExprStatus_Ok) {
+            return;
+        }
+
+        int saved_depth = depth;
+        int saved_max_depth = max_depth;
+        code.resize(start);
+        emit_const(value);
+        depth = saved_depth;
+        max_depth = saved_max_depth;
+    }
+
+    bool fail(const QString& message) {
+        if (error.isEmpty()) {
+            error = message;
+        }
+
+        return false;
+    }
+
+    bool expect(char c) {
+        skip_whitespace();
+
+        if (*pos != c) {
+            return fail(QStringLiteral("Expected '%1'").arg(QLatin1Char(c)));
+        }
+
+        pos++;
+        return true;
+    }
+
+    bool parse_number() {
+        uint64_t value = 0;
+        int base = 10;
+
+        if (*pos == '$') {
+            base = 16;
+            pos += 1;
+        } else if (pos[0] == '0' && (pos[1] == 'x' || pos[1] == 'X')) {
+            base = 16;
+            pos += 2;
+        } else if (pos[0] == '0' && (pos[1] == 'b' || pos[1] == 'B')) {
+            base = 2;
+            pos += 2;
+        }
+
+        const char* start = pos;
+
+        for (;;) {
+            int digit = hex_value(*pos);
+
+            if (digit < 0 || digit >= base) {
+                break;
+            }
+
+            if (value > (~uint64_t(0) - uint64_t(digit)) / uint64_t(base)) {
+                return fail(QStringLiteral("Constant doesn't fit in 64 bits"));
+            }
+
+            value = value * uint64_t(base) + uint64_t(digit);
+            pos++;
+        }
+
+        if (pos == start || is_ident_char(*pos)) {
+            return fail(QStringLiteral("Invalid number"));
+        }
+
+        emit_const(value);
+        return true;
+    }
+
+    bool parse_load(int size, char close) {
+        if (!parse_binary(1)) {
+            return false;
+        }
+
+        if (!expect(close)) {
+            return false;
+        }
+
+        emit_load(size);
+        return true;
+    }
+
+    bool parse_identifier() {
+        const char* start = pos;
+
+        while (is_ident_char(*pos)) {
+            pos++;
+        }
+
+        QString name = QString::fromUtf8(start, int(pos - start));
+
+        // Sized memory access such as u16[a0]
+
+        skip_whitespace();
+
+        if (*pos == '[') {
+            static const char* sizes[] = { "u8", "u16", "u32", "u64" };
+
+            for (int i = 0; i < 4; ++i) {
+                if (name == QLatin1String(sizes[i])) {
+                    pos++;
+                    return parse_load(1 << i, ']');
+                }
+            }
+        }
+
+        auto reg = registers.find(name.toLower());
+
+        if (reg != registers.end()) {
+            emit_register(reg.value());
+            return true;
+        }
+
+        uint64_t value = 0;
+
+        if (symbols && symbols(name, &value)) {
+            emit_const(value);
+            return true;
+        }
+
+        return fail(QStringLiteral("Unknown identifier '%1'").arg(name));
+    }
+
+    bool parse_unary() {
+        skip_whitespace();
+
+        char c = *pos;
+
+        if (c == '-' || c == '~' || c == '!' || c == '+' || c == '*') {
+            pos++;
+
+            int start = code.size();
+
+            if (++nesting > MaxNesting) {
+                return fail(QStringLiteral("Expression is nested too deep"));
+            }
+
+            if (!parse_unary()) {
+                return false;
+            }
+
+            nesting--;
+
+            switch (c) {
+                case '-':
+                    code.append(PDExprOp_Neg);
+                    break;
+                case '~':
+                    code.append(PDExprOp_Not);
+                    break;
+                case '!':
+                    code.append(PDExprOp_LogicalNot);
+                    break;
+                case '*':
+                    // Never fold loads as memory changes between evaluations
+                    emit_load(address_width);
+                    return true;
+                default:
+                    return true;
+            }
+
+            if (is_const(start, code.size() - 1)) {
+                fold(start);
+            }
+
+            return true;
+        }
+
+        return parse_primary();
+    }
+
+    bool parse_primary() {
+        char c = *pos;
+
+        if (c == '(') {
+            pos++;
+
+            if (!parse_binary(1)) {
+                return false;
+            }
+
+            return expect(')');
+        }
+
+        if (c == '[') {
+            pos++;
+            return parse_load(address_width, ']');
+        }
+
+        if ((c >= '0' && c <= '9') || (c == '$' && hex_value(pos[1]) >= 0)) {
+            return parse_number();
+        }
+
+        if (is_ident_start(c)) {
+            return parse_identifier();
+        }
+
+        if (c == 0) {
+            return fail(QStringLiteral("Unexpected end of expression"));
+        }
+
+        return fail(QStringLiteral("Unexpected '%1'").arg(QLatin1Char(c)));
+    }
+
+    const BinaryOp* match_binary() const {
+        for (const BinaryOp& op : s_binary_ops) {
+            if (strncmp(pos, op.text, size_t(op.length)) == 0) {
+                return &op;
+            }
+        }
+
+        return nullptr;
+    }
+
+    bool parse_binary(int min_precedence) {
+        if (++nesting > MaxNesting) {
+            return fail(QStringLiteral("Expression is nested too deep"));
+        }
+
+        int start = code.size();
+
+        if (!parse_unary()) {
+            return false;
+        }
+
+        for (;;) {
+            skip_whitespace();
+
+            const BinaryOp* op = match_binary();
+
+            if (!op || op->precedence < min_precedence) {
+                break;
+            }
+
+            pos += op->length;
+
+            // && and || skip the right hand side (and the op itself) once the left hand side decides the result
+            int lhs_end = code.size();
+            bool logical = op->op == PDExprOp_LogicalAnd || op->op == PDExprOp_LogicalOr;
+
+            if (logical) {
+                code.append(op->op == PDExprOp_LogicalAnd ? PDExprOp_JumpIfFalse : PDExprOp_JumpIfTrue);
+                code.append(0);
+                code.append(0);
+            }
+
+            int rhs_start = code.size();
+
+            if (!parse_binary(op->precedence + 1)) {
+                return false;
+            }
+
+            bool lhs_constant = is_const(start, lhs_end);
+            bool constant = lhs_constant && is_const(rhs_start, code.size());
+
+            code.append(uint8_t(op->op));
+            depth -= 1;
+
+            if (logical) {
+                int offset = code.size() - rhs_start;
+
+                if (offset > 0xffff) {
+                    return fail(QStringLiteral("Expression is too long"));
+                }
+
+                code[rhs_start - 2] = uint8_t(offset);
+                code[rhs_start - 1] = uint8_t(offset >> 8);
+            }
+
+            // A constant left hand side can decide && and || without evaluating the right hand side
+            if (constant || (logical && lhs_constant)) {
+                fold(start);
+            }
+        }
+
+        nesting--;
+        return true;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct EvalContext {
+    const RegisterSnapshot* regs;
+    const ExpressionEngine::MemoryReader* memory;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static int read_register(void* user_data, uint16_t index, uint64_t* value) {
+    auto context = static_cast<EvalContext*>(user_data);
+
+    if (index >= context->regs->values.size()) {
+        return 0;
+    }
+
+    *value = context->regs->values[index];
+    return 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static int read_memory(void* user_data, uint64_t address, int size, uint64_t* value) {
+    auto context = static_cast<EvalContext*>(user_data);
+
+    if (!*context->memory) {
+        return 0;
+    }
+
+    return (*context->memory)(address, size, value) ? 1 : 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static QString status_text(PDExprStatus status) {
+    switch (status) {
+        case PDExprStatus_Ok:
+            return QString();
+        case PDExprStatus_StackOverflow:
+            return QStringLiteral("Expression is too complex");
+        case PDExprStatus_DivideByZero:
+            return QStringLiteral("Division by zero");
+        case PDExprStatus_BadRegister:
+            return QStringLiteral("Register not available");
+        case PDExprStatus_BadMemory:
+            return QStringLiteral("Unable to read memory");
+        default:
+            return QStringLiteral("Invalid expression");
+    }
+}
+
+}  // namespace
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void ExpressionEngine::set_registers(const QVector<QString>& names) {
+    if (names == m_register_names) {
+        return;
+    }
+
+    m_register_names = names;
+    m_register_lookup.clear();
+
+    for (int i = 0, count = names.size(); i < count; ++i) {
+        m_register_lookup.insert(names[i].toLower(), i);
+    }
+
+    clear_cache();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void ExpressionEngine::set_symbol_resolver(const SymbolResolver& resolver) {
+    m_symbol_resolver = resolver;
+    clear_cache();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void ExpressionEngine::set_address_width(int width) {
+    if (width != m_address_width) {
+        m_address_width = width;
+        clear_cache();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void ExpressionEngine::clear_cache() {
+    m_cache.clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+CompiledExpression ExpressionEngine::compile(const QString& text) {
+    auto it = m_cache.find(text);
+
+    if (it != m_cache.end()) {
+        return it.value();
+    }
+
+    CompiledExpression expr;
+    QByteArray utf8 = text.trimmed().toUtf8();
+
+    Parser parser(utf8.constData(), expr.code, m_register_lookup, m_symbol_resolver, m_address_width);
+
+    if (parser.parse_binary(1)) {
+        parser.skip_whitespace();
+
+        if (*parser.pos != 0) {
+            parser.fail(QStringLiteral("Unexpected '%1'").arg(QLatin1Char(*parser.pos)));
+        } else if (parser.max_depth > PD_EXPR_STACK_SIZE) {
+            parser.fail(QStringLiteral("Expression is too complex"));
+        }
+    }
+
+    expr.error = parser.error;
+
+    if (!expr.is_valid()) {
+        expr.code.clear();
+    } else if (parser.is_const(0, expr.code.size())) {
+        expr.is_constant = true;
+        expr.constant = PDExpr_read_u64(expr.code.constData() + 1);
+    }
+
+    // Watch lists evaluates the same set of expressions over and over so a simple size cap is enough here
+
+    if (m_cache.size() >= MaxCacheSize) {
+        m_cache.clear();
+    }
+
+    m_cache.insert(text, expr);
+
+    return expr;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool ExpressionEngine::evaluate(const QString& text, const RegisterSnapshot& regs, const MemoryReader& memory,
+                                uint64_t* out, QString* error) {
+    return evaluate(compile(text), regs, memory, out, error);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool ExpressionEngine::evaluate(const CompiledExpression& expr, const RegisterSnapshot& regs,
+                                const MemoryReader& memory, uint64_t* out, QString* error) {
+    if (!expr.is_valid()) {
+        if (error) {
+            *error = expr.error;
+        }
+
+        return false;
+    }
+
+    if (expr.is_constant) {
+        *out = expr.constant;
+        return true;
+    }
+
+    EvalContext eval_context = { &regs, &memory };
+    PDExprContext context = { &eval_context, read_register, read_memory };
+
+    PDExprStatus status = PDExpr_eval(expr.code.constData(), uint32_t(expr.code.size()), &context, out);
+
+    if (error) {
+        *error = status_text(status);
+    }
+
+    return status == PDExprStatus_Ok;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
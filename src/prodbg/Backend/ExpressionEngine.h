@@ -0,0 +1,79 @@
+#pragma once
+
+#include <stdint.h>
+#include <QtCore/QHash>
+#include <QtCore/QString>
+#include <QtCore/QVector>
+#include <functional>
+
+namespace prodbg {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Values of the registers when the target stopped. The epoch is bumped every time the target stops (or is stepped)
+// so results evaluated against a snapshot can be cached until the next stop.
+
+struct RegisterSnapshot {
+    uint64_t epoch = 0;
+    QVector<QString> names;
+    QVector<uint64_t> values;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Expression compiled to the byte code described in pd_expression.h
+
+struct CompiledExpression {
+    QVector<uint8_t> code;
+    QString error;
+    // Set if the expression only depends on constants and symbols and has been folded to a single value
+    bool is_constant = false;
+    uint64_t constant = 0;
+
+    bool is_valid() const { return error.isEmpty(); }
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Compiles and evaluates integer expressions such as "eax + 0x10", "*(sp + 4) & 0xff" or "u16[main + 2] == $4e75".
+// All math is done in unsigned 64-bit so addresses keep full precision. Compiled expressions are cached by text.
+//
+// Supported syntax:
+//   numbers      123, 0x1f, $1f (hex), 0b101
+//   identifiers  registers (case insensitive) or symbols (resolved with the symbol resolver at compile time)
+//   memory       *expr and [expr] (address width sized), u8[expr], u16[expr], u32[expr], u64[expr]
+//   operators    unary - ~ ! and binary * / % + - << >> < <= > >= == != & ^ | && || with C precedence
+
+class ExpressionEngine {
+public:
+    typedef std::function<bool(const QString& name, uint64_t* value)> SymbolResolver;
+    typedef std::function<bool(uint64_t address, int size, uint64_t* value)> MemoryReader;
+
+    // Register names in the order the backend sends them. Register operands in the byte code refers to this order
+    // so the cache is dropped if the names change.
+    void set_registers(const QVector<QString>& names);
+    void set_symbol_resolver(const SymbolResolver& resolver);
+    // Size in bytes used for *expr and [expr]
+    void set_address_width(int width);
+
+    CompiledExpression compile(const QString& text);
+
+    bool evaluate(const QString& text, const RegisterSnapshot& regs, const MemoryReader& memory, uint64_t* out,
+                  QString* error = nullptr);
+
+    static bool evaluate(const CompiledExpression& expr, const RegisterSnapshot& regs, const MemoryReader& memory,
+                         uint64_t* out, QString* error = nullptr);
+
+    // Needs to be called when symbols has changed as they are resolved at compile time
+    void clear_cache();
+    int cache_size() const { return m_cache.size(); }
+
+private:
+    enum { MaxCacheSize = 4096 };
+
+    QHash<QString, CompiledExpression> m_cache;
+    QVector<QString> m_register_names;
+    QHash<QString, int> m_register_lookup;
+    SymbolResolver m_symbol_resolver;
+    int m_address_width = 8;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
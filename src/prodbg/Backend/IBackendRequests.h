@@ -1,13 +1,18 @@
 #pragma once
 
 #include <stdint.h>
+#include <QtCore/QByteArray>
 #include <QtCore/QObject>
+#include <QtCore/QSharedPointer>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
 #include <QtCore/QVector>
 
-class QString;
-
 namespace prodbg {
 
+class LineTable;
+class SymbolTable;
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 class IBackendRequests : public QObject {
@@ -56,34 +61,125 @@ public:
     };
 
     //
-    // Describes the memory as sent back from beginReadMemory. These flags
-    // indicates what kind of memory it is (read/write/unmapped/etc)
+    // Result of evaluating an expression. The value is only valid if valid is set, otherwise error describes what
+    // went wrong
+    //
+    struct ExpressionResult {
+        QString expression;
+        uint64_t value;
+        bool valid;
+        QString error;
+    };
+
+    //
+    // One hit of a tracepoint. values holds the captured expressions in the order they were given when adding the
+    // tracepoint. Bit n in error_mask is set if values[n] failed to evaluate in the backend.
+    //
+    struct TraceRecord {
+        uint64_t address;
+        QVector<uint64_t> values;
+        uint32_t error_mask;
+    };
+
+    //
+    // One entry in a batch of breakpoint changes sent with sync_breakpoints. id is a stable id assigned by the
+    // BreakpointModel. Address breakpoints have an empty filename. Action values matches PDBreakpointAction.
+    // Data watchpoints has watch set (PDWatchType) and cover size bytes from address. Tracepoints are address
+    // breakpoints with tracepoint set that never stops the target, each hit records the captures (expressions such as
+    // "a0" or "u32[a0]", at most 8) in the trace buffer of the backend instead.
+    //
+    struct BreakpointChange {
+        enum Action {
+            Add,
+            Remove,
+            Modify,
+        };
+
+        Action action;
+        uint32_t id;
+        QString filename;
+        int line;
+        uint64_t address;
+        QString condition;
+        uint32_t hit_count;
+        uint8_t watch;
+        uint32_t size;
+        bool tracepoint;
+        QStringList captures;
+    };
+
+    //
+    // One page of target memory as sent back for read_memory_pages. data is shorter than the page size (or empty) if
+    // the backend couldn't read all of it.
+    //
+    struct MemoryPage {
+        uint64_t address;
+        QByteArray data;
+    };
+
+    //
+    // Architecture of the target as declared by the backend. arch and mode are Capstone cs_arch/cs_mode values and
+    // big_endian is the byte order from the mode. build_id identifies the binary being debugged (empty if the backend
+    // doesn't know it)
+    //
+    struct TargetInfo {
+        int arch;
+        int mode;
+        int address_width;
+        bool big_endian;
+        QString build_id;
+        // Added to the link addresses of a position independent executable. Only valid with has_load_bias
+        bool has_load_bias;
+        uint64_t load_bias;
+    };
+
+    //
+    // Describes the memory as read from the MemoryCache (stored as runs in a
+    // MemorySpan). These flags indicates what kind of memory it is
+    // (read/write/unmapped/etc)
     //
     enum MemoryAddressFlags {
         // Set if memory is read-able
         Readable = 1 << 8,
         // Set if memory is write-able
-        Writable = 1 << 9
+        Writable = 1 << 9,
+        // Set if the byte differs from the last time it was read at an earlier stop
+        Changed = 1 << 10
     };
 
 public:
+    // Id of the session (as given by the SessionPool) these requests are bound to
+    int session_id() const { return m_session_id; }
+    void set_session_id(int id) { m_session_id = id; }
+
     // Send a custom event to the backend. The id should be registers using the
     // IdService_register This can be done in the same way using the id service
     // on the backend side. This allows the front-end to send custom commands to
     // the backend that doesn't fit any general backend
     // virtual void sendCustomString(uint16_t id, const QString& text) = 0;
 
-    // Add a breakpoint at a specific address
-    // virtual void beginAddAddressBreakpoint(uint64_t address) = 0;
+    // Add a breakpoint at a specific address. condition is an optional expression that is evaluated by the backend
+    // and the target only stops when it's true and has been hit at least hit_count times
+    virtual void add_address_breakpoint(uint64_t address, const QString& condition = QString(),
+                                        uint32_t hit_count = 0) = 0;
 
-    // Add a breakpoint on a specific file and line number
-    // virtual void beginAddFileLineBreakpoint(const QString& filename, int line) = 0;
+    // Add a breakpoint on a specific file and line number (with optional condition as above)
+    virtual void add_file_line_breakpoint(const QString& filename, int line, const QString& condition = QString(),
+                                          uint32_t hit_count = 0) = 0;
+
+    // Send a batch of breakpoint changes (see BreakpointModel::get_changes_since). The session sends all pending
+    // changes to the backend in one message per update and the backend acks with breakpoints_acknowledged.
+    virtual void sync_breakpoints(const QVector<BreakpointChange>& changes) = 0;
+
+    // Pull (and consume) the records in the trace buffer of the backend. The result is sent with trace_data_received.
+    // max_records = 0 fetches everything.
+    virtual void fetch_trace_data(uint32_t max_records = 0) = 0;
 
     // Remove a breakpoint at a specific address
-    // virtual void beginRemoveAddressBreakpoint(uint64_t address) = 0;
+    virtual void remove_address_breakpoint(uint64_t address) = 0;
 
     // Remove a breakpoint on a specific file and line number
-    // virtual void beginRemoveFileLineBreakpoint(const QString& filename, int line) = 0;
+    virtual void remove_file_line_breakpoint(const QString& filename, int line) = 0;
 
     // Get hw registers from the backend
     // registers = array of registers
@@ -97,10 +193,9 @@ public:
     //                              uint32_t instructionCount,
     //                              QVector<AssemblyInstruction>* instructions) = 0;
 
-    // Evaluate expressions such ass 0x120+12 (useful for memory view)
-    // expression = expression to evaluate (for example 0x124 + 2)
-    // out = result of the operation
-    // virtual void beginResolveAddress(const QString& expression, uint64_t* out) = 0;
+    // Evaluate a batch of expressions such as "0x120 + 12", "a0 + 4" or "u32[sp + 8]" against the registers of the
+    // last stop. The result is sent back with expressions_evaluated in the same order as requested.
+    virtual void evaluate_expressions(const QStringList& expressions) = 0;
 
     // Read a block of memory from the target.
     // lo = starting memory range
@@ -110,6 +205,34 @@ public:
     //          of MemoryAddressFlags
     // virtual bool beginReadMemory(uint64_t lo, uint64_t hi, QVector<uint16_t>* target) = 0;
 
+    // Read a set of page_size sized pages from the target in one round trip to the backend. The result is sent with
+    // memory_pages_received along with the returned id, which tells the replies of the users of the interface apart.
+    // Use MemoryCache instead of calling this directly from views.
+    virtual uint64_t read_memory_pages(const QVector<uint64_t>& addresses, uint32_t page_size) = 0;
+
+    // Search size bytes of target memory at address for pattern in the backend. Only the bits set in mask are
+    // compared (an empty mask compares all bits) and matches are only reported at multiples of alignment. The backend
+    // stops after max_hits matches. The result is sent with memory_search_results. Use MemorySearcher instead of
+    // calling this directly as it falls back to searching memory read with read_memory_pages.
+    virtual void search_memory(uint64_t address, uint64_t size, const QByteArray& pattern, const QByteArray& mask,
+                               uint32_t alignment, uint32_t max_hits) = 0;
+
+    // Write data to target memory at address. There is no reply, use MemoryCache::write so cached pages (and the
+    // decoded code in them) are updated as well.
+    virtual void write_memory(uint64_t address, const QByteArray& data) = 0;
+
+    // Ask the backend which architecture the target is (used to disassemble on the host, see DisassemblyEngine). The
+    // result is sent with target_info_received. Backends that don't know don't reply.
+    virtual void request_target_info() = 0;
+
+    // Symbols of the target (see SymbolIndex) used for names in expressions and conditions. The table is shared with
+    // the session thread and doesn't change once set.
+    virtual void set_symbols(const QSharedPointer<const SymbolTable>& symbols) = 0;
+
+    // Ask the backend for the line tables of the target (see LineTableStore). The result is sent with
+    // line_table_received. Backends without line information don't reply.
+    virtual void request_line_table() = 0;
+
 public:
     // Get hw registers from the backend
     // registers = array of registers
@@ -123,12 +246,43 @@ public:
     // dest = output of the evalutation
     // Q_SIGNAL void endResolveAddress(uint64_t* dest);
 
+    // Response signal for evaluate_expressions. epoch changes every time the target has been stopped so results with
+    // the same epoch can be reused
+    Q_SIGNAL void expressions_evaluated(const QVector<ExpressionResult>& results, uint64_t epoch);
+
+    // Response signal for fetch_trace_data. dropped is the number of records the backend had to overwrite since the
+    // last fetch because the buffer was full
+    Q_SIGNAL void trace_data_received(const QVector<TraceRecord>& records, uint64_t dropped);
+
+    // Response signal for sync_breakpoints with the ids of the breakpoints the backend could and couldn't set
+    Q_SIGNAL void breakpoints_acknowledged(const QVector<uint32_t>& accepted, const QVector<uint32_t>& rejected);
+
+    // Sent if a breakpoint condition failed to compile. The breakpoint isn't sent to the backend in that case
+    Q_SIGNAL void breakpoint_condition_error(const QString& condition, const QString& error);
+
     // Response signal for a memory request. If target size is 0 the operation
     // failed. TODO: Better way target = filled with requested memory (if
     // successful) address = starting address addressWidth = number of bytes an
     // address uses. E.g. 4 for a 32-bit target.
     // Q_SIGNAL void endReadMemory(QVector<uint16_t>* target, uint64_t address, int addressWidth);
 
+    // Response signal for read_memory_pages with the id it returned and one entry per requested page. epoch is the
+    // stop epoch (see expressions_evaluated) the memory was read in
+    Q_SIGNAL void memory_pages_received(uint64_t request_id, const QVector<MemoryPage>& pages, int address_width,
+                                        uint64_t epoch);
+
+    // Response signal for search_memory with the matches in increasing order. searched_to is the address the backend
+    // got to, which is address + size unless max_hits was reached. supported is false if the backend can't search
+    // memory (hits is empty then)
+    Q_SIGNAL void memory_search_results(uint64_t address, const QVector<uint64_t>& hits, uint64_t searched_to,
+                                        bool supported);
+
+    // Response signal for request_target_info
+    Q_SIGNAL void target_info_received(const TargetInfo& info);
+
+    // Response signal for request_line_table with the line tables of all compile units
+    Q_SIGNAL void line_table_received(const QSharedPointer<const LineTable>& table);
+
     // This signal is being sent when the program counter of the debugged
     // application has changed This can be used to figure out if it's needed to
     // re-request data. For example a Memory view may want to use this as the
@@ -139,6 +293,9 @@ public:
     // This signal is being sent when the the current debugging session has
     // ended
     Q_SIGNAL void session_ended();
+
+protected:
+    int m_session_id = -1;
 };
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,150 @@
+#include "SessionPool.h"
+#include <QtCore/QDebug>
+#include <QtCore/QString>
+#include <QtCore/QThread>
+#include <algorithm>
+#include "BackendRequests.h"
+#include "BackendSession.h"
+
+namespace prodbg {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+SessionPool::SessionPool(QObject* parent) : QObject(parent) {
+    m_max_workers = qMax(1, QThread::idealThreadCount());
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+SessionPool::~SessionPool() {
+    close_all();
+
+    // Sessions are deleted with deleteLater on their worker thread. QThread will flush pending deferred deletes
+    // when it finishes so waiting for the workers here makes sure all plugin instances has been destroyed.
+
+    for (auto worker : m_workers) {
+        worker->quit();
+        worker->wait();
+        delete worker;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+QThread* SessionPool::pick_worker() {
+    QVector<int> load(m_workers.size(), 0);
+
+    for (auto& entry : m_sessions) {
+        load[m_workers.indexOf(entry.worker)] += 1;
+    }
+
+    int best = -1;
+
+    for (int i = 0, count = load.size(); i < count; ++i) {
+        if (best == -1 || load[i] < load[best]) {
+            best = i;
+        }
+    }
+
+    // Only spin up a new worker when all the current ones are busy
+
+    if (best != -1 && (load[best] == 0 || m_workers.size() >= m_max_workers)) {
+        return m_workers[best];
+    }
+
+    QThread* worker = new QThread;
+    worker->setObjectName(QStringLiteral("BackendWorker %1").arg(m_workers.size()));
+    worker->start();
+
+    m_workers.append(worker);
+
+    return worker;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int SessionPool::create_session(const QString& backend_name) {
+    BackendSession* session = BackendSession::create_backend_session(backend_name);
+
+    if (!session) {
+        qDebug() << "SessionPool: Unable to create session for " << backend_name;
+        return -1;
+    }
+
+    int id = m_next_id++;
+
+    Entry entry;
+    entry.worker = pick_worker();
+    entry.session = session;
+
+    session->moveToThread(entry.worker);
+
+    entry.requests = new BackendRequests(session);
+    entry.requests->set_session_id(id);
+
+    m_sessions.insert(id, entry);
+
+    session_added(id);
+
+    return id;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void SessionPool::close_session(int id) {
+    auto it = m_sessions.find(id);
+
+    if (it == m_sessions.end()) {
+        return;
+    }
+
+    Entry entry = it.value();
+    m_sessions.erase(it);
+
+    // Views may still hold a QPointer to the requests object so it's deleted here on the UI thread while the
+    // session itself (and the plugin instance) is destroyed on the worker it runs on
+
+    delete entry.requests;
+    entry.session->deleteLater();
+
+    session_removed(id);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void SessionPool::close_all() {
+    for (int id : m_sessions.keys()) {
+        close_session(id);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BackendSession* SessionPool::session(int id) const {
+    auto it = m_sessions.find(id);
+    return it != m_sessions.end() ? it.value().session : nullptr;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BackendRequests* SessionPool::requests(int id) const {
+    auto it = m_sessions.find(id);
+    return it != m_sessions.end() ? it.value().requests : nullptr;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+QVector<int> SessionPool::session_ids() const {
+    QVector<int> ids;
+
+    for (auto it = m_sessions.begin(), end = m_sessions.end(); it != end; ++it) {
+        ids.append(it.key());
+    }
+
+    std::sort(ids.begin(), ids.end());
+
+    return ids;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
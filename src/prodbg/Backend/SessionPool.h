@@ -0,0 +1,61 @@
+#pragma once
+
+#include <QtCore/QHash>
+#include <QtCore/QObject>
+#include <QtCore/QVector>
+
+class QString;
+class QThread;
+
+namespace prodbg {
+
+class BackendSession;
+class BackendRequests;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Owns all active backend sessions. Instead of giving each session its own thread the sessions are spread over a
+// small set of worker threads (at most QThread::idealThreadCount()). Each session still has its own plugin instance
+// and its own BackendRequests so views can be bound to one specific session.
+
+class SessionPool : public QObject {
+    Q_OBJECT
+
+public:
+    explicit SessionPool(QObject* parent = nullptr);
+    ~SessionPool();
+
+    // Creates a new session for the backend plugin with the given name. Returns the id of the session or -1 if
+    // no plugin with that name could be found
+    int create_session(const QString& backend_name);
+
+    // Schedules the session for deletion on its worker thread and removes it from the pool
+    void close_session(int id);
+    void close_all();
+
+    BackendSession* session(int id) const;
+    BackendRequests* requests(int id) const;
+    QVector<int> session_ids() const;
+
+    int session_count() const { return m_sessions.size(); }
+    int worker_count() const { return m_workers.size(); }
+
+    Q_SIGNAL void session_added(int id);
+    Q_SIGNAL void session_removed(int id);
+
+private:
+    QThread* pick_worker();
+
+    struct Entry {
+        BackendSession* session;
+        BackendRequests* requests;
+        QThread* worker;
+    };
+
+    QVector<QThread*> m_workers;
+    QHash<int, Entry> m_sessions;
+    int m_max_workers = 1;
+    int m_next_id = 1;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
@@ -1,61 +1,395 @@
 #include "BreakpointModel.h"
+#include <algorithm>
 
 namespace prodbg {
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+BreakpointModel::BreakpointModel(QObject* parent) : QObject(parent) {
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static bool line_less(const BreakpointModel::FileLineBreakpoint& bp, int line) {
+    return bp.line < line;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static bool address_less(const BreakpointModel::AddressBreakpoint& bp, uint64_t address) {
+    return bp.address < address;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static bool watch_less(const BreakpointModel::Watchpoint& wp, uint64_t address) {
+    return wp.address < address;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int BreakpointModel::find_file_id(const QString& filename) const {
+    return m_file_ids.value(filename, -1);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int BreakpointModel::intern_file(const QString& filename) {
+    auto it = m_file_ids.find(filename);
+
+    if (it != m_file_ids.end()) {
+        return it.value();
+    }
+
+    int id = m_files.size();
+
+    FileBreakpoints file;
+    file.filename = filename;
+
+    m_files.append(file);
+    m_file_ids.insert(filename, id);
+
+    return id;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BreakpointModel::FileLineBreakpoint* BreakpointModel::find_file_line(const QString& filename, int line) {
+    int id = find_file_id(filename);
+
+    if (id == -1) {
+        return nullptr;
+    }
+
+    QVector<FileLineBreakpoint>& lines = m_files[id].lines;
+    auto it = std::lower_bound(lines.begin(), lines.end(), line, line_less);
+
+    return (it != lines.end() && it->line == line) ? &*it : nullptr;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BreakpointModel::AddressBreakpoint* BreakpointModel::find_address(uint64_t address) {
+    auto it = std::lower_bound(m_address_breakpoints.begin(), m_address_breakpoints.end(), address, address_less);
+    return (it != m_address_breakpoints.end() && it->address == address) ? &*it : nullptr;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 bool BreakpointModel::toggle_file_line_breakpoint(const QString& filename, int line) {
-    for (int i = 0, count = m_file_line_breakpoints.count(); i < count; ++i) {
-        if (m_file_line_breakpoints[i].line == line && m_file_line_breakpoints[i].filename == filename) {
-            m_file_line_breakpoints.remove(i);
-            return false;
-        }
+    QVector<FileLineBreakpoint>& lines = m_files[intern_file(filename)].lines;
+    auto it = std::lower_bound(lines.begin(), lines.end(), line, line_less);
+
+    m_version++;
+
+    if (it != lines.end() && it->line == line) {
+        RemovedBreakpoint removed = {it->id, filename, line, 0, 0, 0, it->added_version, m_version};
+        m_removed.append(removed);
+
+        lines.erase(it);
+        changed();
+        return false;
     }
 
-    FileLineBreakpoint bp = {filename, line};
+    FileLineBreakpoint bp = {filename, line, QString(), 0, m_next_id++, m_version, m_version};
 
-    m_file_line_breakpoints.append(bp);
+    lines.insert(it, bp);
+    changed();
 
     return true;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-bool BreakpointModel::has_breakpoint_file_line(const QString& filename, int line) {
-    for (auto& bp : m_file_line_breakpoints) {
-        if (bp.line == line && bp.filename == filename) {
-            return true;
-        }
+bool BreakpointModel::has_breakpoint_file_line(const QString& filename, int line) const {
+    return has_breakpoint_file_line(find_file_id(filename), line);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool BreakpointModel::has_breakpoint_file_line(int file_id, int line) const {
+    if (file_id < 0 || file_id >= m_files.size()) {
+        return false;
+    }
+
+    const QVector<FileLineBreakpoint>& lines = m_files[file_id].lines;
+    auto it = std::lower_bound(lines.begin(), lines.end(), line, line_less);
+
+    return it != lines.end() && it->line == line;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool BreakpointModel::has_breakpoint_address(uint64_t address) const {
+    auto it = std::lower_bound(m_address_breakpoints.begin(), m_address_breakpoints.end(), address, address_less);
+    return it != m_address_breakpoints.end() && it->address == address;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool BreakpointModel::toggle_address_breakpoint(uint64_t address) {
+    auto it = std::lower_bound(m_address_breakpoints.begin(), m_address_breakpoints.end(), address, address_less);
+
+    m_version++;
+
+    if (it != m_address_breakpoints.end() && it->address == address) {
+        RemovedBreakpoint removed = {it->id, QString(), 0, address, 0, 0, it->added_version, m_version};
+        m_removed.append(removed);
+
+        m_address_breakpoints.erase(it);
+        changed();
+        return false;
     }
 
-    return false;
+    AddressBreakpoint bp = {address, QString(), 0, m_next_id++, m_version, m_version};
+
+    m_address_breakpoints.insert(it, bp);
+    changed();
+
+    return true;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-bool BreakpointModel::has_breakpoint_address(uint64_t address) {
+void BreakpointModel::set_address_tracepoint(uint64_t address, const QStringList& captures, const QString& condition) {
+    auto it = std::lower_bound(m_address_breakpoints.begin(), m_address_breakpoints.end(), address, address_less);
+
+    m_version++;
+
+    if (it != m_address_breakpoints.end() && it->address == address) {
+        it->condition = condition;
+        it->hit_count = 0;
+        it->tracepoint = true;
+        it->captures = captures;
+        it->changed_version = m_version;
+    } else {
+        AddressBreakpoint bp = {address, condition, 0, m_next_id++, m_version, m_version, true, captures};
+        m_address_breakpoints.insert(it, bp);
+    }
+
+    changed();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool BreakpointModel::remove_address_breakpoint(uint64_t address) {
+    return has_breakpoint_address(address) && !toggle_address_breakpoint(address);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool BreakpointModel::has_tracepoint(uint64_t address) const {
+    auto it = std::lower_bound(m_address_breakpoints.begin(), m_address_breakpoints.end(), address, address_less);
+    return it != m_address_breakpoints.end() && it->address == address && it->tracepoint;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void BreakpointModel::set_watchpoint(uint64_t address, uint32_t size, WatchType type, const QString& condition,
+                                     uint32_t hit_count) {
+    auto it = std::lower_bound(m_watchpoints.begin(), m_watchpoints.end(), address, watch_less);
+
+    m_version++;
+
+    // Changing the range or type of an existing watchpoint is a modify so it keeps its id
+
+    if (it != m_watchpoints.end() && it->address == address) {
+        it->size = size;
+        it->type = type;
+        it->condition = condition;
+        it->hit_count = hit_count;
+        it->changed_version = m_version;
+    } else {
+        Watchpoint wp = {address, size, type, condition, hit_count, m_next_id++, m_version, m_version};
+        m_watchpoints.insert(it, wp);
+    }
+
+    changed();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool BreakpointModel::remove_watchpoint(uint64_t address) {
+    auto it = std::lower_bound(m_watchpoints.begin(), m_watchpoints.end(), address, watch_less);
+
+    if (it == m_watchpoints.end() || it->address != address) {
+        return false;
+    }
+
+    m_version++;
+
+    RemovedBreakpoint removed = {
+        it->id, QString(), 0, address, uint8_t(it->type), it->size, it->added_version, m_version,
+    };
+    m_removed.append(removed);
+
+    m_watchpoints.erase(it);
+    changed();
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool BreakpointModel::has_watchpoint(uint64_t address) const {
+    auto it = std::lower_bound(m_watchpoints.begin(), m_watchpoints.end(), address, watch_less);
+    return it != m_watchpoints.end() && it->address == address;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool BreakpointModel::set_file_line_condition(const QString& filename, int line, const QString& condition,
+                                              uint32_t hit_count) {
+    FileLineBreakpoint* bp = find_file_line(filename, line);
+
+    if (!bp) {
+        return false;
+    }
+
+    bp->condition = condition;
+    bp->hit_count = hit_count;
+    bp->changed_version = ++m_version;
+
+    changed();
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool BreakpointModel::set_address_condition(uint64_t address, const QString& condition, uint32_t hit_count) {
+    AddressBreakpoint* bp = find_address(address);
+
+    if (!bp) {
+        return false;
+    }
+
+    bp->condition = condition;
+    bp->hit_count = hit_count;
+    bp->changed_version = ++m_version;
+
+    changed();
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void BreakpointModel::get_lines_in_range(int file_id, int first_line, int last_line, QVector<int>* lines) const {
+    lines->resize(0);
+
+    if (file_id < 0 || file_id >= m_files.size()) {
+        return;
+    }
+
+    const QVector<FileLineBreakpoint>& file_lines = m_files[file_id].lines;
+
+    for (auto it = std::lower_bound(file_lines.begin(), file_lines.end(), first_line, line_less);
+         it != file_lines.end() && it->line <= last_line; ++it) {
+        lines->append(it->line);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void BreakpointModel::get_addresses_in_range(uint64_t lo, uint64_t hi, QVector<uint64_t>* addresses) const {
+    addresses->resize(0);
+
+    for (auto it = std::lower_bound(m_address_breakpoints.begin(), m_address_breakpoints.end(), lo, address_less);
+         it != m_address_breakpoints.end() && it->address <= hi; ++it) {
+        addresses->append(it->address);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+QVector<BreakpointModel::FileLineBreakpoint> BreakpointModel::get_file_line_breakpoints() const {
+    QVector<FileLineBreakpoint> breakpoints;
+
+    for (auto& file : m_files) {
+        breakpoints += file.lines;
+    }
+
+    return breakpoints;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void BreakpointModel::get_changes_since(uint64_t version, QVector<IBackendRequests::BreakpointChange>* changes) const {
+    changes->resize(0);
+
+    if (version >= m_version) {
+        return;
+    }
+
+    // Removes goes first so a breakpoint removed and added again on the same location ends up correct in backends
+    // that looks up breakpoints by location
+
+    for (auto& bp : m_removed) {
+        if (bp.removed_version > version && bp.added_version <= version) {
+            IBackendRequests::BreakpointChange change = {
+                IBackendRequests::BreakpointChange::Remove,
+                bp.id,
+                bp.filename,
+                bp.line,
+                bp.address,
+                QString(),
+                0,
+                bp.watch,
+                bp.size,
+            };
+            changes->append(change);
+        }
+    }
+
+    for (auto& file : m_files) {
+        for (auto& bp : file.lines) {
+            if (bp.changed_version > version) {
+                auto action = bp.added_version > version ? IBackendRequests::BreakpointChange::Add
+                                                         : IBackendRequests::BreakpointChange::Modify;
+                IBackendRequests::BreakpointChange change = {
+                    action, bp.id, bp.filename, bp.line, 0, bp.condition, bp.hit_count, 0, 0,
+                };
+                changes->append(change);
+            }
+        }
+    }
+
     for (auto& bp : m_address_breakpoints) {
-        if (bp == address) {
-            return true;
+        if (bp.changed_version > version) {
+            auto action = bp.added_version > version ? IBackendRequests::BreakpointChange::Add
+                                                     : IBackendRequests::BreakpointChange::Modify;
+            IBackendRequests::BreakpointChange change = {
+                action, bp.id, QString(), 0, bp.address, bp.condition, bp.hit_count, 0, 0, bp.tracepoint, bp.captures,
+            };
+            changes->append(change);
         }
     }
 
-    return false;
+    for (auto& wp : m_watchpoints) {
+        if (wp.changed_version > version) {
+            auto action = wp.added_version > version ? IBackendRequests::BreakpointChange::Add
+                                                     : IBackendRequests::BreakpointChange::Modify;
+            IBackendRequests::BreakpointChange change = {
+                action, wp.id, QString(), 0, wp.address, wp.condition, wp.hit_count, uint8_t(wp.type), wp.size,
+            };
+            changes->append(change);
+        }
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-bool BreakpointModel::toggle_address_breakpoint(uint64_t address) {
-    for (int i = 0, count = m_address_breakpoints.count(); i < count; ++i) {
-        if (m_address_breakpoints[i] == address) {
-            m_address_breakpoints.remove(i);
-            return false;
+void BreakpointModel::trim_history(uint64_t version) {
+    QVector<RemovedBreakpoint> removed;
+
+    for (auto& bp : m_removed) {
+        if (bp.removed_version > version) {
+            removed.append(bp);
         }
     }
 
-    m_address_breakpoints.append(address);
-
-    return true;
+    m_removed = removed;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
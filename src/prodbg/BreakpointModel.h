@@ -1,6 +1,12 @@
 #pragma once
 
+#include <stdint.h>
+#include <QtCore/QHash>
+#include <QtCore/QObject>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
 #include <QtCore/QVector>
+#include "Backend/IBackendRequests.h"
 
 namespace prodbg {
 
@@ -8,30 +14,147 @@ namespace prodbg {
 // TODO: We likely want to separate breakpoints into more types.
 // Right now this is source code and disassembly but we want to support breakpoint for hw events as well.
 // This should likley be a model. Temp for now
+//
+// The lookups are called for every visible line when painting margins so breakpoints are indexed: filenames are
+// interned to ids with a sorted line list per file and address breakpoints are kept sorted by address. Lookups are
+// binary searches and the views can fetch all breakpoints for the visible range with one call.
+//
+// Every edit bumps the version of the model. Each breakpoint has a stable id and remembers the version it was added
+// and last changed in (removed ones are kept as tombstones) so a backend session can ask for everything that changed
+// since the version it last synced with and get one batch back.
+
+class BreakpointModel : public QObject {
+    Q_OBJECT
 
-class BreakpointModel {
    public:
+    explicit BreakpointModel(QObject* parent = nullptr);
+
+    // condition is an expression (see ExpressionEngine) that is compiled and evaluated by the backend. The target
+    // only stops if the condition is true and it has been true at least hit_count times (0 = always stop)
+
     struct FileLineBreakpoint {
         QString filename;
         int line;
+        QString condition;
+        uint32_t hit_count;
+        uint32_t id;
+        uint64_t added_version;
+        uint64_t changed_version;
     };
 
+    // Tracepoints are address breakpoints that never stops the target, each hit records the captures in the trace
+    // buffer of the backend instead (see IBackendRequests::BreakpointChange)
+
     struct AddressBreakpoint {
         uint64_t address;
+        QString condition;
+        uint32_t hit_count;
+        uint32_t id;
+        uint64_t added_version;
+        uint64_t changed_version;
+        bool tracepoint;
+        QStringList captures;
+    };
+
+    // Values matches PDWatchType
+    enum WatchType {
+        WatchRead = 1,
+        WatchWrite = 2,
+        WatchAccess = 3,
+    };
+
+    // Data watchpoint on [address, address + size). Stops when the memory is accessed as given by type
+    struct Watchpoint {
+        uint64_t address;
+        uint32_t size;
+        WatchType type;
+        QString condition;
+        uint32_t hit_count;
+        uint32_t id;
+        uint64_t added_version;
+        uint64_t changed_version;
     };
 
-    bool has_breakpoint_file_line(const QString& filename, int line);
-    bool has_breakpoint_address(uint64_t address);
+    bool has_breakpoint_file_line(const QString& filename, int line) const;
+    bool has_breakpoint_address(uint64_t address) const;
 
     bool toggle_file_line_breakpoint(const QString& filename, int line);
     bool toggle_address_breakpoint(uint64_t address);
 
-    const QVector<FileLineBreakpoint>& get_file_line_breakpoints() { return m_file_line_breakpoints; }
-    const QVector<uint64_t>& get_address_breakpoints() { return m_address_breakpoints; }
+    // Only one breakpoint per address so setting a tracepoint where there is a breakpoint turns it into a tracepoint
+    // (keeping its id)
+    void set_address_tracepoint(uint64_t address, const QStringList& captures, const QString& condition = QString());
+    // Removes the breakpoint or tracepoint at the address. Returns false if there is none
+    bool remove_address_breakpoint(uint64_t address);
+    bool has_tracepoint(uint64_t address) const;
+
+    // Only one watchpoint per start address. Setting a watchpoint on an address that already has one replaces it.
+    void set_watchpoint(uint64_t address, uint32_t size, WatchType type, const QString& condition = QString(),
+                        uint32_t hit_count = 0);
+    bool remove_watchpoint(uint64_t address);
+    bool has_watchpoint(uint64_t address) const;
+
+    // Returns false if there is no breakpoint at the location
+    bool set_file_line_condition(const QString& filename, int line, const QString& condition, uint32_t hit_count);
+    bool set_address_condition(uint64_t address, const QString& condition, uint32_t hit_count);
+
+    // Interned id for a filename or -1 if no breakpoint has ever been set in the file. Ids stays valid for the
+    // lifetime of the model so views can look them up once when the file is loaded.
+    int find_file_id(const QString& filename) const;
+    bool has_breakpoint_file_line(int file_id, int line) const;
+
+    // Range queries (inclusive) for painting. The output is sorted and cleared before being filled in.
+    void get_lines_in_range(int file_id, int first_line, int last_line, QVector<int>* lines) const;
+    void get_addresses_in_range(uint64_t lo, uint64_t hi, QVector<uint64_t>* addresses) const;
+
+    QVector<FileLineBreakpoint> get_file_line_breakpoints() const;
+    const QVector<AddressBreakpoint>& get_address_breakpoints() const { return m_address_breakpoints; }
+    const QVector<Watchpoint>& get_watchpoints() const { return m_watchpoints; }
+
+    // Current version of the model. Starts at 0 (no breakpoints) and is bumped on every edit
+    uint64_t version() const { return m_version; }
+
+    // All changes after version, removes first. Breakpoints added and removed again in between are left out
+    void get_changes_since(uint64_t version, QVector<IBackendRequests::BreakpointChange>* changes) const;
+
+    // Drops removed breakpoints that all consumers has synced past
+    void trim_history(uint64_t version);
+
+    // Sent after each edit
+    Q_SIGNAL void changed();
 
    private:
-    QVector<FileLineBreakpoint> m_file_line_breakpoints;
-    QVector<uint64_t> m_address_breakpoints;
+    int intern_file(const QString& filename);
+    FileLineBreakpoint* find_file_line(const QString& filename, int line);
+    AddressBreakpoint* find_address(uint64_t address);
+
+    // Breakpoints in one file sorted by line
+    struct FileBreakpoints {
+        QString filename;
+        QVector<FileLineBreakpoint> lines;
+    };
+
+    struct RemovedBreakpoint {
+        uint32_t id;
+        QString filename;
+        int line;
+        uint64_t address;
+        uint8_t watch;
+        uint32_t size;
+        uint64_t added_version;
+        uint64_t removed_version;
+    };
+
+    QHash<QString, int> m_file_ids;
+    QVector<FileBreakpoints> m_files;
+    // Sorted by address
+    QVector<AddressBreakpoint> m_address_breakpoints;
+    // Sorted by address
+    QVector<Watchpoint> m_watchpoints;
+    QVector<RemovedBreakpoint> m_removed;
+
+    uint64_t m_version = 0;
+    uint32_t m_next_id = 1;
 };
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
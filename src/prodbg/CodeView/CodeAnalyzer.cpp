@@ -0,0 +1,719 @@
+#include "CodeAnalyzer.h"
+#include <pd_capstone.h>
+#include <string.h>
+#include <QtCore/QAtomicInt>
+#include <QtCore/QMetaObject>
+#include <QtCore/QRunnable>
+#include <algorithm>
+#include <functional>
+#include "Backend/Service.h"
+#include "Core/SymbolIndex.h"
+#include "DisassemblyEngine.h"
+
+namespace prodbg {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Memory of one read_memory_pages batch split in chunks that are disassembled in parallel. Instructions that start in
+// [begin, end) of a segment belong to it. The bytes before begin are only there for the sweep to line up.
+
+struct CodeAnalysisBatch {
+    struct Segment {
+        uint64_t address;
+        QByteArray data;
+        uint64_t begin;
+        uint64_t end;
+    };
+
+    struct Chunk {
+        int segment;
+        uint64_t start;
+        uint64_t end;
+    };
+
+    PDCapstoneFuncs* capstone = nullptr;
+    int arch = 0;
+    int mode = 0;
+    int min_size = 1;
+
+    QVector<Segment> segments;
+    QVector<Chunk> chunks;
+    QVector<QVector<CodeAnalyzer::Reference>> references;
+    // Number of range bytes in the batch (for progress)
+    uint64_t size = 0;
+    // Identifies the batch when the done callback gets back to the analyzer. The batch itself may have been freed
+    // (and its address reused) by then
+    uint64_t generation = 0;
+
+    // Next chunk to take and the number of workers still running
+    QAtomicInt next_chunk;
+    QAtomicInt remaining;
+    // Called on a pool thread when the last worker is done
+    std::function<void()> done;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// References and functions of a finished analysis. Built on the pool and only read after that
+
+struct CodeAnalysisResult {
+    QVector<CodeAnalyzer::Range> ranges;
+    QVector<uint64_t> entry_points;
+    QVector<CodeAnalyzer::Reference> by_source;
+    QVector<CodeAnalyzer::Reference> by_target;
+    QVector<CodeAnalyzer::Function> functions;
+    // Same as for CodeAnalysisBatch
+    uint64_t generation = 0;
+
+    std::function<void()> done;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static bool source_less(const CodeAnalyzer::Reference& a, const CodeAnalyzer::Reference& b) { return a.from < b.from; }
+
+static bool target_less(const CodeAnalyzer::Reference& a, const CodeAnalyzer::Reference& b) {
+    return a.to < b.to || (a.to == b.to && a.from < b.from);
+}
+
+static bool function_less(const CodeAnalyzer::Function& a, const CodeAnalyzer::Function& b) {
+    return a.start < b.start;
+}
+
+static bool range_less(const CodeAnalyzer::Range& a, const CodeAnalyzer::Range& b) { return a.start < b.start; }
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Runs on a pool thread with its own Capstone instance and disassembles chunks of the batch until all are taken
+
+class CodeAnalysisTask : public QRunnable {
+   public:
+    explicit CodeAnalysisTask(const QSharedPointer<CodeAnalysisBatch>& batch) : m_batch(batch) {}
+
+    void run() override {
+        CodeAnalysisBatch* batch = m_batch.data();
+        csh handle = 0;
+
+        if (batch->capstone->open(cs_arch(batch->arch), cs_mode(batch->mode), &handle) == CS_ERR_OK) {
+            batch->capstone->option(handle, CS_OPT_DETAIL, CS_OPT_ON);
+
+            for (;;) {
+                const int index = batch->next_chunk.fetchAndAddRelaxed(1);
+
+                if (index >= batch->chunks.size()) {
+                    break;
+                }
+
+                analyze_chunk(handle, index);
+            }
+
+            batch->capstone->close(&handle);
+        }
+
+        if (!batch->remaining.deref()) {
+            batch->done();
+        }
+    }
+
+   private:
+    void analyze_chunk(csh handle, int index) {
+        CodeAnalysisBatch* batch = m_batch.data();
+        const CodeAnalysisBatch::Chunk& chunk = batch->chunks.at(index);
+        const CodeAnalysisBatch::Segment& segment = batch->segments.at(chunk.segment);
+        QVector<CodeAnalyzer::Reference>& references = batch->references[index];
+
+        const uint64_t lead = qMin(chunk.start - segment.address, uint64_t(CodeAnalyzer::LeadBytes));
+        const uint64_t min_size = uint64_t(batch->min_size);
+
+        uint64_t address = chunk.start - lead;
+        const uint8_t* code = (const uint8_t*)segment.data.constData() + (address - segment.address);
+        size_t size = size_t(segment.data.size()) - size_t(address - segment.address);
+
+        // disasm_iter decodes into our own instruction so nothing is allocated per instruction
+        cs_detail detail;
+        cs_insn insn;
+        memset(&insn, 0, sizeof(insn));
+        insn.detail = &detail;
+
+        while (address < chunk.end && size > 0) {
+            if (!batch->capstone->disasm_iter(handle, &code, &size, &address, &insn)) {
+                // Bytes that aren't a valid instruction are skipped
+                if (size <= min_size) {
+                    break;
+                }
+
+                code += min_size;
+                size -= min_size;
+                address += min_size;
+                continue;
+            }
+
+            if (insn.address < chunk.start) {
+                continue;
+            }
+
+            uint64_t target = 0;
+            const uint32_t flags = DisassemblyEngine::instruction_flags(batch->arch, &insn, &target);
+
+            if (!(flags & DisassemblyEngine::HasTarget)) {
+                continue;
+            }
+
+            if (flags & DisassemblyEngine::Call) {
+                references.append({insn.address, target, DisassemblyEngine::Call});
+            } else if (flags & DisassemblyEngine::Jump) {
+                references.append({insn.address, target, DisassemblyEngine::Jump});
+            }
+        }
+    }
+
+    QSharedPointer<CodeAnalysisBatch> m_batch;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Sorts the references by target and finds the functions
+
+class CodeIndexTask : public QRunnable {
+   public:
+    explicit CodeIndexTask(const QSharedPointer<CodeAnalysisResult>& result) : m_result(result) {}
+
+    void run() override {
+        CodeAnalysisResult* result = m_result.data();
+        const QVector<CodeAnalyzer::Range>& ranges = result->ranges;
+
+        result->by_target = result->by_source;
+        std::sort(result->by_target.begin(), result->by_target.end(), target_less);
+
+        QVector<uint64_t> starts = result->entry_points;
+
+        for (const CodeAnalyzer::Reference& ref : result->by_target) {
+            if (ref.type == DisassemblyEngine::Call && (starts.isEmpty() || starts.last() != ref.to)) {
+                starts.append(ref.to);
+            }
+        }
+
+        std::sort(starts.begin(), starts.end());
+        starts.erase(std::unique(starts.begin(), starts.end()), starts.end());
+
+        // Functions run until the next function or the end of the range they are in
+
+        int range = 0;
+
+        for (int i = 0; i < starts.size(); ++i) {
+            const uint64_t start = starts.at(i);
+
+            while (range < ranges.size() && ranges.at(range).end <= start) {
+                ++range;
+            }
+
+            if (range == ranges.size()) {
+                break;
+            }
+
+            if (start < ranges.at(range).start) {
+                continue;
+            }
+
+            uint64_t end = ranges.at(range).end;
+
+            if (i + 1 < starts.size()) {
+                end = qMin(end, starts.at(i + 1));
+            }
+
+            result->functions.append({start, end});
+        }
+
+        result->done();
+    }
+
+   private:
+    QSharedPointer<CodeAnalysisResult> m_result;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+CodeAnalyzer::CodeAnalyzer(IBackendRequests* interface, QObject* parent) : QObject(parent), m_interface(interface) {
+    if (interface) {
+        connect(interface, &IBackendRequests::memory_pages_received, this, &CodeAnalyzer::pages_received);
+        connect(interface, &IBackendRequests::session_ended, this, &CodeAnalyzer::session_ended);
+        connect(SymbolIndex::for_interface(interface), &SymbolIndex::symbols_changed, this,
+                &CodeAnalyzer::code_ranges_changed);
+        connect(DisassemblyEngine::for_interface(interface), &DisassemblyEngine::target_changed, this,
+                &CodeAnalyzer::code_ranges_changed);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+CodeAnalyzer::~CodeAnalyzer() {
+    cancel();
+
+    // The tasks reference the batch (not the analyzer) but the done callback posts back to us
+    m_pool.waitForDone();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+CodeAnalyzer* CodeAnalyzer::for_interface(IBackendRequests* interface) {
+    if (!interface) {
+        return nullptr;
+    }
+
+    CodeAnalyzer* analyzer = interface->findChild<CodeAnalyzer*>(QString(), Qt::FindDirectChildrenOnly);
+
+    return analyzer ? analyzer : new CodeAnalyzer(interface, interface);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool CodeAnalyzer::start(const QVector<Range>& ranges, const QVector<uint64_t>& entry_points) {
+    cancel();
+
+    DisassemblyEngine* engine = DisassemblyEngine::for_interface(m_interface);
+
+    if (!engine || !engine->has_target()) {
+        return false;
+    }
+
+    m_arch = engine->arch();
+    m_mode = engine->mode();
+    m_min_size = engine->min_instruction_size();
+    m_max_size = engine->max_instruction_size();
+
+    // Sort and join the ranges so they are swept once and in address order
+
+    QVector<Range> sorted;
+
+    for (const Range& range : ranges) {
+        if (range.end > range.start) {
+            sorted.append(range);
+        }
+    }
+
+    std::sort(sorted.begin(), sorted.end(), range_less);
+
+    m_ranges.clear();
+    m_total = 0;
+
+    for (const Range& range : sorted) {
+        if (!m_ranges.isEmpty() && range.start <= m_ranges.last().end) {
+            m_ranges.last().end = qMax(m_ranges.last().end, range.end);
+        } else {
+            m_ranges.append(range);
+        }
+    }
+
+    for (const Range& range : m_ranges) {
+        m_total += range.end - range.start;
+    }
+
+    m_entry_points = entry_points;
+    m_range = 0;
+    m_next = m_ranges.isEmpty() ? 0 : m_ranges.first().start;
+    m_analyzed = 0;
+    m_tail_range = -1;
+    m_found.clear();
+    m_running = true;
+
+    if (m_ranges.isEmpty()) {
+        build_index();
+        return true;
+    }
+
+    request_pages();
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void CodeAnalyzer::cancel() {
+    if (!m_running) {
+        return;
+    }
+
+    reset();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void CodeAnalyzer::reset() {
+    m_running = false;
+    m_batch.clear();
+    m_ready.clear();
+    m_tail.clear();
+    m_found.clear();
+
+    // Tasks still running keep the batch and index alive. They are ignored when they are done
+    m_scan.reset();
+    m_building.reset();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void CodeAnalyzer::session_ended() {
+    cancel();
+    m_result.reset();
+    m_symbols.reset();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Symbols may be loaded before or after the backend knows the arch of the target so this is called for both. The
+// start is retried on the next change if the arch isn't known yet
+
+void CodeAnalyzer::code_ranges_changed() {
+    SymbolIndex* index = SymbolIndex::for_interface(m_interface);
+    DisassemblyEngine* engine = DisassemblyEngine::for_interface(m_interface);
+
+    if (!index || !engine || !engine->has_target()) {
+        return;
+    }
+
+    QSharedPointer<const SymbolTable> table = index->table();
+
+    if (table == m_symbols || table->code_ranges().isEmpty()) {
+        return;
+    }
+
+    QVector<Range> ranges;
+    QVector<uint64_t> entry_points;
+
+    for (const SymbolTable::Range& range : table->code_ranges()) {
+        ranges.append({range.start, range.end});
+    }
+
+    // Labels (size 0) are as often inside functions as at their start so only sized symbols are used. The ones
+    // outside the ranges (such as data objects) are skipped by the analysis
+
+    for (int i = 0, count = table->size(); i < count; ++i) {
+        const SymbolTable::Symbol symbol = table->at(i);
+
+        if (symbol.size > 0) {
+            entry_points.append(symbol.address);
+        }
+    }
+
+    if (start(ranges, entry_points)) {
+        m_symbols = table;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void CodeAnalyzer::request_pages() {
+    if (!m_running || !m_batch.isEmpty() || !m_ready.isEmpty() || m_range >= m_ranges.size()) {
+        return;
+    }
+
+    const Range& range = m_ranges.at(m_range);
+    const uint64_t first = m_next & ~uint64_t(PageSize - 1);
+    const uint64_t left = range.end - first;
+
+    // Sizes are used instead of end addresses as the range may end at the very end of the address space
+    const uint64_t count = qMin(uint64_t(PagesPerBatch), left / PageSize + (left % PageSize != 0 ? 1 : 0));
+
+    for (uint64_t i = 0; i < count; ++i) {
+        m_batch.append(first + i * PageSize);
+    }
+
+    m_batch_range = m_range;
+
+    if (left <= count * PageSize) {
+        if (++m_range < m_ranges.size()) {
+            m_next = m_ranges.at(m_range).start;
+        }
+    } else {
+        m_next = first + count * PageSize;
+    }
+
+    m_batch_request = m_interface->read_memory_pages(m_batch, PageSize);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void CodeAnalyzer::pages_received(uint64_t request_id, const QVector<IBackendRequests::MemoryPage>& pages, int,
+                                  uint64_t) {
+    // Replies for the MemoryCache (or searchers) and batches of cancelled runs are sent to us as well
+    if (m_batch.isEmpty() || request_id != m_batch_request) {
+        return;
+    }
+
+    m_batch.clear();
+
+    if (m_scan) {
+        m_ready = pages;
+        m_ready_range = m_batch_range;
+    } else {
+        analyze_pages(pages, m_batch_range);
+    }
+
+    // Read the next batch while this one is analyzed
+    request_pages();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void CodeAnalyzer::analyze_pages(const QVector<IBackendRequests::MemoryPage>& pages, int range_index) {
+    const Range& range = m_ranges.at(range_index);
+    QSharedPointer<CodeAnalysisBatch> batch(new CodeAnalysisBatch);
+
+    // Join contiguous readable pages (and the tail of the previous batch) into segments
+
+    CodeAnalysisBatch::Segment current = {0, QByteArray(), 0, 0};
+
+    if (m_tail_range == range_index && !m_tail.isEmpty()) {
+        current = {m_tail_address, m_tail, m_tail_begin, 0};
+    }
+
+    const IBackendRequests::MemoryPage& last = pages.last();
+    const uint64_t batch_start = qMax(range.start, pages.first().address);
+    const uint64_t batch_end = last.address + qMin(uint64_t(PageSize), range.end - last.address);
+
+    for (const IBackendRequests::MemoryPage& page : pages) {
+        uint64_t address = page.address;
+        QByteArray data = page.data;
+
+        // The first page is aligned down so it can start before the range
+        if (address < range.start) {
+            data = data.mid(int(qMin(range.start - address, uint64_t(data.size()))));
+            address = range.start;
+        }
+
+        if (uint64_t(data.size()) > range.end - address) {
+            data.truncate(int(range.end - address));
+        }
+
+        if (!data.isEmpty() && !current.data.isEmpty() && current.address + uint64_t(current.data.size()) == address) {
+            current.data.append(data);
+            continue;
+        }
+
+        if (!current.data.isEmpty()) {
+            current.end = current.address + uint64_t(current.data.size());
+            batch->segments.append(current);
+        }
+
+        current = {address, data, address, 0};
+    }
+
+    // Instructions at the end of the batch may continue into the next one so they are decoded with it
+
+    m_tail.clear();
+    m_tail_range = -1;
+
+    if (!current.data.isEmpty()) {
+        const uint64_t data_end = current.address + uint64_t(current.data.size());
+        current.end = data_end;
+
+        if (data_end == batch_end && batch_end < range.end) {
+            const uint64_t owned_end = qMax(current.begin, data_end - qMin(data_end, uint64_t(m_max_size)));
+            const uint64_t tail_start = owned_end - qMin(owned_end - current.address, uint64_t(LeadBytes));
+
+            m_tail = current.data.mid(int(tail_start - current.address));
+            m_tail_address = tail_start;
+            m_tail_begin = owned_end;
+            m_tail_range = range_index;
+
+            current.end = owned_end;
+        }
+
+        batch->segments.append(current);
+    }
+
+    for (int i = 0; i < batch->segments.size(); ++i) {
+        const CodeAnalysisBatch::Segment& segment = batch->segments.at(i);
+
+        for (uint64_t start = segment.begin; start < segment.end; start += ChunkSize) {
+            batch->chunks.append({i, start, qMin(segment.end, start + uint64_t(ChunkSize))});
+        }
+    }
+
+    batch->capstone = (PDCapstoneFuncs*)Service_get(PDCAPSTONEFUNCS_GLOBAL);
+    batch->arch = m_arch;
+    batch->mode = m_mode;
+    batch->min_size = m_min_size;
+    batch->size = batch_end - batch_start;
+    batch->references.resize(batch->chunks.size());
+    batch->generation = ++m_generation;
+
+    m_scan = batch;
+
+    const int workers = qMin(batch->chunks.size(), qMax(1, m_pool.maxThreadCount()));
+
+    if (workers == 0 || !batch->capstone) {
+        batch_analyzed(batch->generation);
+        return;
+    }
+
+    const uint64_t generation = batch->generation;
+
+    batch->remaining.storeRelease(workers);
+    batch->done = [this, generation]() {
+        QMetaObject::invokeMethod(this, [this, generation]() { batch_analyzed(generation); }, Qt::QueuedConnection);
+    };
+
+    for (int i = 0; i < workers; ++i) {
+        m_pool.start(new CodeAnalysisTask(batch));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void CodeAnalyzer::batch_analyzed(uint64_t generation) {
+    // Batches of cancelled analyses are still analyzed to the end
+    if (!m_scan || m_scan->generation != generation) {
+        return;
+    }
+
+    QSharedPointer<CodeAnalysisBatch> done;
+    done.swap(m_scan);
+
+    // Chunks are in address order and so are the references in each of them
+
+    for (const QVector<Reference>& references : done->references) {
+        m_found += references;
+    }
+
+    m_analyzed += done->size;
+    progress(m_analyzed, m_total);
+
+    if (!m_ready.isEmpty()) {
+        QVector<IBackendRequests::MemoryPage> pages;
+        pages.swap(m_ready);
+        analyze_pages(pages, m_ready_range);
+        request_pages();
+    } else if (m_batch.isEmpty() && m_range >= m_ranges.size()) {
+        build_index();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void CodeAnalyzer::build_index() {
+    QSharedPointer<CodeAnalysisResult> result(new CodeAnalysisResult);
+    const uint64_t generation = ++m_generation;
+
+    result->ranges = m_ranges;
+    result->entry_points = m_entry_points;
+    result->by_source.swap(m_found);
+    result->generation = generation;
+
+    result->done = [this, generation]() {
+        QMetaObject::invokeMethod(this, [this, generation]() { index_built(generation); }, Qt::QueuedConnection);
+    };
+
+    m_building = result;
+    m_pool.start(new CodeIndexTask(result));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void CodeAnalyzer::index_built(uint64_t generation) {
+    if (!m_building || m_building->generation != generation) {
+        return;
+    }
+
+    m_result.swap(m_building);
+    reset();
+
+    DisassemblyEngine* engine = DisassemblyEngine::for_interface(m_interface);
+
+    if (engine && engine->arch() == m_arch && engine->mode() == m_mode) {
+        QVector<uint64_t> starts;
+        starts.reserve(m_result->functions.size());
+
+        for (const Function& function : m_result->functions) {
+            starts.append(function.start);
+        }
+
+        engine->add_entry_points(starts);
+    }
+
+    finished();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+QVector<CodeAnalyzer::Reference> CodeAnalyzer::references_to(uint64_t address) const {
+    if (!m_result) {
+        return QVector<Reference>();
+    }
+
+    const QVector<Reference>& refs = m_result->by_target;
+    const Reference key = {0, address, 0};
+    auto first = std::lower_bound(refs.begin(), refs.end(), key,
+                                  [](const Reference& a, const Reference& b) { return a.to < b.to; });
+    auto last = std::upper_bound(first, refs.end(), key,
+                                 [](const Reference& a, const Reference& b) { return a.to < b.to; });
+
+    return refs.mid(int(first - refs.begin()), int(last - first));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+QVector<CodeAnalyzer::Reference> CodeAnalyzer::references_from(uint64_t start, uint64_t end) const {
+    if (!m_result || end <= start) {
+        return QVector<Reference>();
+    }
+
+    const QVector<Reference>& refs = m_result->by_source;
+    auto first = std::lower_bound(refs.begin(), refs.end(), Reference{start, 0, 0}, source_less);
+    auto last = std::lower_bound(first, refs.end(), Reference{end, 0, 0}, source_less);
+
+    return refs.mid(int(first - refs.begin()), int(last - first));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool CodeAnalyzer::target_of(uint64_t address, uint64_t* target) const {
+    if (!m_result) {
+        return false;
+    }
+
+    const QVector<Reference>& refs = m_result->by_source;
+    auto it = std::lower_bound(refs.begin(), refs.end(), Reference{address, 0, 0}, source_less);
+
+    if (it == refs.end() || it->from != address) {
+        return false;
+    }
+
+    *target = it->to;
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool CodeAnalyzer::function_at(uint64_t address, Function* function) const {
+    if (!m_result) {
+        return false;
+    }
+
+    const QVector<Function>& functions = m_result->functions;
+    auto it = std::upper_bound(functions.begin(), functions.end(), Function{address, 0}, function_less);
+
+    if (it == functions.begin()) {
+        return false;
+    }
+
+    --it;
+
+    if (address >= it->end) {
+        return false;
+    }
+
+    *function = *it;
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const QVector<CodeAnalyzer::Function>& CodeAnalyzer::functions() const {
+    static const QVector<Function> s_none;
+    return m_result ? m_result->functions : s_none;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int CodeAnalyzer::reference_count() const { return m_result ? m_result->by_source.size() : 0; }
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <stdint.h>
+#include <QtCore/QObject>
+#include <QtCore/QPointer>
+#include <QtCore/QSharedPointer>
+#include <QtCore/QThreadPool>
+#include <QtCore/QVector>
+#include "Backend/IBackendRequests.h"
+
+namespace prodbg {
+
+class SymbolTable;
+struct CodeAnalysisBatch;
+struct CodeAnalysisResult;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Finds the calls, jumps and functions in the code of the target in the background.
+//
+// The executable ranges of the target are read with read_memory_pages in batches of 4 MB. Each batch is split in
+// chunks that are disassembled on a thread pool while the next batch is being read. Every worker opens its own
+// Capstone instance and takes chunks until there are none left. Chunks are swept linearly and start decoding LeadBytes
+// before their start so the sweep has lined up with the instructions once it gets there (the same way
+// DisassemblyEngine guesses the code before an address). Instructions that start in the last bytes of a batch are
+// decoded with the next batch so the ones crossing into it are found.
+//
+// Direct jumps and calls are kept as references in two flat arrays, one sorted by source and one by target, so
+// "who calls this" and "where does this go" are binary searches. Functions start at the call targets and entry points
+// inside the ranges and run until the next function or the end of the range. The function starts are added as entry
+// points to the DisassemblyEngine of the session so the code views can go backwards through them without guessing.
+//
+// The backend doesn't report the sections of the target so the ranges (the code sections or hunks of the loaded
+// binary) are given to start. The analyzer starts by itself with the code ranges of the symbol files in the
+// SymbolIndex of the session (and their sized symbols as entry points) once those and the arch of the target are
+// known, and again when either changes. The results of the last finished analysis are kept until a new one has
+// finished.
+
+class CodeAnalyzer : public QObject {
+    Q_OBJECT
+
+   public:
+    enum {
+        // Page size and number of pages in each read_memory_pages request
+        PageSize = 4096,
+        PagesPerBatch = 1024,
+        // Size of the chunks each worker disassembles
+        ChunkSize = 256 * 1024,
+        // Bytes decoded before a chunk so the sweep lines up with the instructions in it
+        LeadBytes = 256,
+    };
+
+    struct Range {
+        uint64_t start;
+        uint64_t end;
+    };
+
+    struct Reference {
+        // Address of the jump/call instruction and where it goes
+        uint64_t from;
+        uint64_t to;
+        // DisassemblyEngine::Jump or DisassemblyEngine::Call
+        uint32_t type;
+    };
+
+    struct Function {
+        uint64_t start;
+        uint64_t end;
+    };
+
+    explicit CodeAnalyzer(IBackendRequests* interface, QObject* parent = nullptr);
+    ~CodeAnalyzer();
+
+    // Analyzer shared by all views for the interface. Created on first use and owned by the interface
+    static CodeAnalyzer* for_interface(IBackendRequests* interface);
+
+    // Analyzes the code in ranges with the arch of the DisassemblyEngine of the session. entry_points (such as the
+    // entry of the binary and exported symbols) are function starts as well. Cancels any analysis in progress. Returns
+    // false if the target arch isn't known yet
+    bool start(const QVector<Range>& ranges, const QVector<uint64_t>& entry_points = QVector<uint64_t>());
+
+    // Stops the analysis in progress. finished isn't sent for it
+    void cancel();
+
+    bool is_running() const { return m_running; }
+
+    // Jumps and calls to address in order of their source
+    QVector<Reference> references_to(uint64_t address) const;
+
+    // Jumps and calls from the instructions in [start, end) in address order
+    QVector<Reference> references_from(uint64_t start, uint64_t end) const;
+
+    // Target of the jump/call at address. Returns false if there is no direct jump/call there
+    bool target_of(uint64_t address, uint64_t* target) const;
+
+    // Function that covers address. Returns false if address isn't in a function
+    bool function_at(uint64_t address, Function* function) const;
+
+    // All functions in address order
+    const QVector<Function>& functions() const;
+
+    int reference_count() const;
+
+    // Sent after each batch with the number of bytes analyzed so far
+    Q_SIGNAL void progress(uint64_t analyzed, uint64_t total);
+
+    // Sent when the ranges have been analyzed and the queries answer from the new results
+    Q_SIGNAL void finished();
+
+   private:
+    Q_SLOT void pages_received(uint64_t request_id, const QVector<IBackendRequests::MemoryPage>& pages,
+                               int address_width, uint64_t epoch);
+    Q_SLOT void session_ended();
+    Q_SLOT void code_ranges_changed();
+
+    void request_pages();
+    void analyze_pages(const QVector<IBackendRequests::MemoryPage>& pages, int range);
+    void batch_analyzed(uint64_t generation);
+    void build_index();
+    void index_built(uint64_t generation);
+    void reset();
+
+    QPointer<IBackendRequests> m_interface;
+    QThreadPool m_pool;
+
+    int m_arch = -1;
+    int m_mode = 0;
+    int m_min_size = 1;
+    int m_max_size = 16;
+
+    bool m_running = false;
+
+    // Symbols the code ranges were last taken from
+    QSharedPointer<const SymbolTable> m_symbols;
+
+    // Sorted ranges that don't overlap, the range and address to read next and the number of bytes in them
+    QVector<Range> m_ranges;
+    QVector<uint64_t> m_entry_points;
+    int m_range = 0;
+    uint64_t m_next = 0;
+    uint64_t m_total = 0;
+    uint64_t m_analyzed = 0;
+
+    // Pages in flight (and the id of their request), the batch being analyzed and a batch that has arrived while the
+    // previous was still running (along with the range they are in)
+    QVector<uint64_t> m_batch;
+    uint64_t m_batch_request = 0;
+    int m_batch_range = 0;
+    QSharedPointer<CodeAnalysisBatch> m_scan;
+    QVector<IBackendRequests::MemoryPage> m_ready;
+    int m_ready_range = 0;
+
+    // End of the last batch that is analyzed with the next one. Instructions from m_tail_begin on belong to it
+    QByteArray m_tail;
+    uint64_t m_tail_address = 0;
+    uint64_t m_tail_begin = 0;
+    int m_tail_range = -1;
+
+    // References found so far in source order
+    QVector<Reference> m_found;
+
+    // Index being built on the pool and the current one
+    QSharedPointer<CodeAnalysisResult> m_building;
+    QSharedPointer<CodeAnalysisResult> m_result;
+
+    // Generation of the last batch or index started. Callbacks from the pool carry it so the ones of cancelled work
+    // are told apart from the current one
+    uint64_t m_generation = 0;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
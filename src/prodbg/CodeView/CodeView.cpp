@@ -223,6 +223,9 @@ void CodeView::lineNumberAreaPaintEvent(QPaintEvent* event) {
 
     int fontHeight = fontMetrics().height() - 2;
 
+    // Resolve the file once so each line is only a binary search in the breakpoint model
+    int fileId = m_breakpoints->find_file_id(m_sourceFile);
+
     while (block.isValid() && top <= event->rect().bottom()) {
         if (block.isVisible() && bottom >= event->rect().top()) {
             QString number = QString::number(blockNumber + 1);
@@ -230,7 +233,7 @@ void CodeView::lineNumberAreaPaintEvent(QPaintEvent* event) {
 
             painter.drawText(0, top, width, height, Qt::AlignRight, number);
 
-            if (m_breakpoints->has_breakpoint_file_line(m_sourceFile, blockNumber + 1)) {
+            if (m_breakpoints->has_breakpoint_file_line(fileId, blockNumber + 1)) {
                 painter.setBrush(Qt::red);
                 painter.drawEllipse(4, top, fontHeight, fontHeight);
             }
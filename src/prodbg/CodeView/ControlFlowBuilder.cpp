@@ -0,0 +1,299 @@
+#include "ControlFlowBuilder.h"
+#include <QtCore/QSet>
+#include <algorithm>
+#include "CodeAnalyzer.h"
+#include "DisassemblyEngine.h"
+#include "MemoryView/MemoryCache.h"
+
+namespace prodbg {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+ControlFlowBuilder::ControlFlowBuilder(IBackendRequests* interface)
+    : QObject(interface),
+      m_interface(interface),
+      m_engine(DisassemblyEngine::for_interface(interface)),
+      m_cache(MemoryCache::for_interface(interface)),
+      m_analyzer(CodeAnalyzer::for_interface(interface)) {
+    if (m_cache) {
+        connect(m_cache, &MemoryCache::pages_updated, this, &ControlFlowBuilder::pages_updated);
+        connect(m_cache, &MemoryCache::memory_written, this, &ControlFlowBuilder::memory_written);
+    }
+
+    if (m_engine) {
+        connect(m_engine, &DisassemblyEngine::target_changed, this, &ControlFlowBuilder::clear);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+ControlFlowBuilder* ControlFlowBuilder::for_interface(IBackendRequests* interface) {
+    if (!interface) {
+        return nullptr;
+    }
+
+    ControlFlowBuilder* builder = interface->findChild<ControlFlowBuilder*>(QString(), Qt::FindDirectChildrenOnly);
+
+    return builder ? builder : new ControlFlowBuilder(interface);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void ControlFlowBuilder::clear() {
+    m_graphs.clear();
+    m_order.clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+QSharedPointer<const ControlFlowGraph> ControlFlowBuilder::graph(uint64_t entry) {
+    if (!m_engine || !m_cache || !m_engine->has_target()) {
+        return QSharedPointer<const ControlFlowGraph>();
+    }
+
+    auto it = m_graphs.find(entry);
+
+    if (it != m_graphs.end()) {
+        QSharedPointer<ControlFlowGraph> cached = it.value();
+        uint64_t hash = 0;
+
+        // The pages are dropped from the memory cache at each stop so they may have to be read again to tell
+        if (!hash_pages(cached->pages, &hash)) {
+            m_waiting = true;
+            return QSharedPointer<const ControlFlowGraph>();
+        }
+
+        if (hash == cached->code_hash) {
+            m_order.removeOne(entry);
+            m_order.append(entry);
+            return cached;
+        }
+    }
+
+    QSharedPointer<ControlFlowGraph> graph(new ControlFlowGraph);
+
+    if (!build(entry, graph.data())) {
+        m_waiting = true;
+        return QSharedPointer<const ControlFlowGraph>();
+    }
+
+    insert(graph);
+
+    return graph;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void ControlFlowBuilder::insert(const QSharedPointer<ControlFlowGraph>& graph) {
+    m_order.removeOne(graph->entry);
+
+    while (m_order.size() >= MaxGraphs) {
+        m_graphs.remove(m_order.takeFirst());
+    }
+
+    m_graphs.insert(graph->entry, graph);
+    m_order.append(graph->entry);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Combined hash of the pages. Pages that aren't cached are requested and false is returned
+
+bool ControlFlowBuilder::hash_pages(const QVector<uint64_t>& pages, uint64_t* hash) {
+    bool complete = true;
+
+    *hash = 14695981039346656037ULL;
+
+    for (uint64_t page : pages) {
+        uint64_t page_hash = 0;
+
+        if (!m_cache->page_hash(page, &page_hash)) {
+            m_cache->read(page, 1, &m_span);
+            complete = false;
+            continue;
+        }
+
+        *hash = (*hash ^ page_hash) * 1099511628211ULL;
+    }
+
+    return complete;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Jumps that leave the function are tail calls
+
+bool ControlFlowBuilder::is_exit(uint64_t entry, uint64_t target, uint64_t end) const {
+    if (target == entry) {
+        return false;
+    }
+
+    if (end != 0 && (target < entry || target >= end)) {
+        return true;
+    }
+
+    CodeAnalyzer::Function function;
+
+    return m_analyzer && m_analyzer->function_at(target, &function) && function.start == target;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Follows the code from entry (both ways of conditional jumps) until each path ends in a return, an unconditional
+// jump or code that has been visited already. Returns false if memory is needed
+
+bool ControlFlowBuilder::build(uint64_t entry, ControlFlowGraph* graph) {
+    QVector<DisassemblyEngine::Instruction> instructions;
+    QSet<uint64_t> visited;
+    QVector<uint64_t> leaders;
+    QVector<uint64_t> work;
+    uint64_t end = 0;
+
+    CodeAnalyzer::Function function;
+
+    if (m_analyzer && m_analyzer->function_at(entry, &function) && function.start == entry) {
+        end = function.end;
+    }
+
+    leaders.append(entry);
+    work.append(entry);
+
+    bool truncated = false;
+
+    while (!work.isEmpty() && !truncated) {
+        uint64_t pc = work.takeLast();
+        bool done = false;
+
+        while (!done) {
+            if (visited.contains(pc)) {
+                break;
+            }
+
+            const bool complete = m_engine->decode(pc, DecodeCount, &m_decoded);
+
+            if (m_decoded.isEmpty()) {
+                if (!complete) {
+                    return false;
+                }
+
+                break;
+            }
+
+            for (const DisassemblyEngine::Instruction& inst : m_decoded) {
+                if (visited.contains(inst.address)) {
+                    leaders.append(inst.address);
+                    done = true;
+                    break;
+                }
+
+                if (instructions.size() >= MaxInstructions) {
+                    truncated = true;
+                    done = true;
+                    break;
+                }
+
+                visited.insert(inst.address);
+                instructions.append(inst);
+
+                const uint32_t flags = inst.flags;
+
+                if (flags & (DisassemblyEngine::Return | DisassemblyEngine::Invalid | DisassemblyEngine::Unreadable)) {
+                    done = true;
+                    break;
+                }
+
+                if (!(flags & DisassemblyEngine::Jump)) {
+                    continue;
+                }
+
+                if ((flags & DisassemblyEngine::HasTarget) && !is_exit(entry, inst.target, end)) {
+                    leaders.append(inst.target);
+                    work.append(inst.target);
+                }
+
+                if (flags & DisassemblyEngine::Unconditional) {
+                    done = true;
+                    break;
+                }
+
+                leaders.append(inst.address + inst.size);
+            }
+
+            if (done) {
+                break;
+            }
+
+            // The decoded instructions all followed each other so go on after them (or wait for memory)
+
+            if (!complete) {
+                return false;
+            }
+
+            pc = m_decoded.last().address + m_decoded.last().size;
+        }
+    }
+
+    graph->build(entry, instructions, leaders);
+    graph->layout();
+    graph->truncated = truncated;
+
+    // Pages the code is in for the code hash (instructions can run into the next page)
+
+    for (const ControlFlowGraph::Block& block : graph->blocks) {
+        const uint64_t first = block.start & ~uint64_t(MemoryCache::PageSize - 1);
+        const uint64_t last = (block.end - 1) & ~uint64_t(MemoryCache::PageSize - 1);
+
+        for (uint64_t page = first;; page += MemoryCache::PageSize) {
+            if (graph->pages.isEmpty() || graph->pages.last() != page) {
+                graph->pages.append(page);
+            }
+
+            if (page == last) {
+                break;
+            }
+        }
+    }
+
+    std::sort(graph->pages.begin(), graph->pages.end());
+    graph->pages.erase(std::unique(graph->pages.begin(), graph->pages.end()), graph->pages.end());
+
+    return hash_pages(graph->pages, &graph->code_hash);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+uint64_t ControlFlowBuilder::function_entry(uint64_t address) const {
+    CodeAnalyzer::Function function;
+
+    if (m_analyzer && m_analyzer->function_at(address, &function)) {
+        return function.start;
+    }
+
+    // The most recently used graph the address is in
+
+    for (int i = m_order.size() - 1; i >= 0; --i) {
+        const QSharedPointer<ControlFlowGraph>& graph = m_graphs.value(m_order.at(i));
+
+        if (graph && graph->block_at(address) >= 0) {
+            return graph->entry;
+        }
+    }
+
+    return address;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void ControlFlowBuilder::pages_updated() {
+    if (m_waiting) {
+        m_waiting = false;
+        graphs_updated();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void ControlFlowBuilder::memory_written(uint64_t, uint64_t) {
+    // Graphs in the written pages get a new code hash and are built again the next time they are asked for
+    graphs_updated();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
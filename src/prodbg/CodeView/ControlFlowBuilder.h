@@ -0,0 +1,88 @@
+#pragma once
+
+#include <stdint.h>
+#include <QtCore/QHash>
+#include <QtCore/QObject>
+#include <QtCore/QPointer>
+#include <QtCore/QSharedPointer>
+#include <QtCore/QVector>
+#include "Backend/IBackendRequests.h"
+#include "ControlFlowGraph.h"
+#include "MemoryView/MemorySpan.h"
+
+namespace prodbg {
+
+class CodeAnalyzer;
+class DisassemblyEngine;
+class MemoryCache;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Builds the control flow graph of functions for the graph views of a session.
+//
+// The code of a function is found by following the jumps from its entry with the DisassemblyEngine of the session
+// (so the instructions come from its cache). Jumps to the start of another function that CodeAnalyzer has found, or
+// out of the function when its bounds are known, are tail calls and are not followed.
+//
+// Graphs are cached by entry address along with the hash of the code pages they were built from (see
+// MemoryCache::page_hash). A cached graph is used as long as the pages hash the same, so following the pc while
+// stepping only builds a graph when the pc goes to another function.
+
+class ControlFlowBuilder : public QObject {
+    Q_OBJECT
+
+   public:
+    enum {
+        // Functions are cut off at this number of instructions
+        MaxInstructions = 20000,
+        // Number of graphs kept
+        MaxGraphs = 32,
+        // Instructions decoded at a time while following the code
+        DecodeCount = 32,
+    };
+
+    explicit ControlFlowBuilder(IBackendRequests* interface);
+
+    // Builder shared by all views for the interface. Created on first use and owned by the interface
+    static ControlFlowBuilder* for_interface(IBackendRequests* interface);
+
+    // Graph of the function at entry. Returns null if memory is needed (graphs_updated is sent when it has arrived)
+    QSharedPointer<const ControlFlowGraph> graph(uint64_t entry);
+
+    // Entry of the function that covers address. This is the function found by CodeAnalyzer if it has analyzed the
+    // code, otherwise a cached graph that has address in it and address itself if there is none
+    uint64_t function_entry(uint64_t address) const;
+
+    // Drops all cached graphs
+    void clear();
+
+    // Sent when memory that a graph was waiting for has arrived or code has changed (views should get their graph
+    // again)
+    Q_SIGNAL void graphs_updated();
+
+   private:
+    Q_SLOT void pages_updated();
+    Q_SLOT void memory_written(uint64_t address, uint64_t size);
+
+    bool build(uint64_t entry, ControlFlowGraph* graph);
+    bool is_exit(uint64_t entry, uint64_t target, uint64_t end) const;
+    bool hash_pages(const QVector<uint64_t>& pages, uint64_t* hash);
+    void insert(const QSharedPointer<ControlFlowGraph>& graph);
+
+    QPointer<IBackendRequests> m_interface;
+    QPointer<DisassemblyEngine> m_engine;
+    QPointer<MemoryCache> m_cache;
+    QPointer<CodeAnalyzer> m_analyzer;
+
+    // Graphs by entry and the entries from least to most recently used
+    QHash<uint64_t, QSharedPointer<ControlFlowGraph>> m_graphs;
+    QVector<uint64_t> m_order;
+
+    // Set when a graph had to wait for memory
+    bool m_waiting = false;
+
+    QVector<DisassemblyEngine::Instruction> m_decoded;
+    MemorySpan m_span;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
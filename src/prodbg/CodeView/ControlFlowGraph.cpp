@@ -0,0 +1,250 @@
+#include "ControlFlowGraph.h"
+#include <QtCore/QPair>
+#include <algorithm>
+
+namespace prodbg {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static bool instruction_less(const ControlFlowGraph::Instruction& a, const ControlFlowGraph::Instruction& b) {
+    return a.address < b.address;
+}
+
+// Instructions after which the next one starts a new block
+static bool ends_block(const ControlFlowGraph::Instruction& inst) {
+    return inst.flags & (DisassemblyEngine::Jump | DisassemblyEngine::Return | DisassemblyEngine::Invalid |
+                         DisassemblyEngine::Unreadable);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void ControlFlowGraph::build(uint64_t entry_address, const QVector<Instruction>& insts, QVector<uint64_t> leaders) {
+    entry = entry_address;
+    entry_block = -1;
+    instructions = insts;
+    blocks.clear();
+    edges.clear();
+
+    std::sort(instructions.begin(), instructions.end(), instruction_less);
+    std::sort(leaders.begin(), leaders.end());
+
+    // A block starts at a leader, after an instruction that ends a block and where the code isn't contiguous
+
+    int leader = 0;
+
+    for (int i = 0; i < instructions.size(); ++i) {
+        const Instruction& inst = instructions.at(i);
+
+        while (leader < leaders.size() && leaders.at(leader) < inst.address) {
+            ++leader;
+        }
+
+        const bool is_leader = leader < leaders.size() && leaders.at(leader) == inst.address;
+
+        if (i == 0 || is_leader || ends_block(instructions.at(i - 1)) || blocks.last().end != inst.address) {
+            blocks.append({inst.address, inst.address, i, 0, 0, 0});
+        }
+
+        Block& block = blocks.last();
+        block.end = inst.address + inst.size;
+        block.count += 1;
+    }
+
+    entry_block = block_at(entry);
+
+    for (int i = 0; i < blocks.size(); ++i) {
+        const Block& block = blocks.at(i);
+        const Instruction& last = instructions.at(block.first + block.count - 1);
+        const uint32_t flags = last.flags;
+
+        if (flags & (DisassemblyEngine::Return | DisassemblyEngine::Invalid | DisassemblyEngine::Unreadable)) {
+            continue;
+        }
+
+        if (!(flags & DisassemblyEngine::Jump)) {
+            add_edge(i, block.end, Fallthrough);
+        } else if (flags & DisassemblyEngine::Unconditional) {
+            if (flags & DisassemblyEngine::HasTarget) {
+                add_edge(i, last.target, Jump);
+            }
+        } else {
+            if (flags & DisassemblyEngine::HasTarget) {
+                add_edge(i, last.target, Taken);
+            }
+
+            add_edge(i, block.end, NotTaken);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Only edges to the start of a block in the function are added. Jumps out of the function are tail calls
+
+void ControlFlowGraph::add_edge(int from, uint64_t to, EdgeType type) {
+    const int block = block_at(to);
+
+    if (block >= 0 && blocks.at(block).start == to) {
+        edges.append({from, block, type, false});
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int ControlFlowGraph::block_at(uint64_t address) const {
+    auto it = std::upper_bound(blocks.begin(), blocks.end(), address,
+                               [](uint64_t a, const Block& block) { return a < block.start; });
+
+    if (it == blocks.begin()) {
+        return -1;
+    }
+
+    --it;
+
+    return address < it->end ? int(it - blocks.begin()) : -1;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void ControlFlowGraph::layout() {
+    const int count = blocks.size();
+
+    layer_count = 0;
+    column_count = 0;
+
+    if (count == 0) {
+        return;
+    }
+
+    // Outgoing edges of each block as ranges in a flat array
+
+    QVector<int> out_start(count + 1, 0);
+    QVector<int> out_edges(edges.size());
+
+    for (const Edge& edge : edges) {
+        out_start[edge.from + 1] += 1;
+    }
+
+    for (int i = 0; i < count; ++i) {
+        out_start[i + 1] += out_start[i];
+    }
+
+    {
+        QVector<int> fill = out_start;
+
+        for (int i = 0; i < edges.size(); ++i) {
+            out_edges[fill[edges.at(i).from]++] = i;
+        }
+    }
+
+    // Depth first from the entry (then from any block not reached) without recursion. Edges to a block that is still
+    // on the stack go back up a loop. Blocks are also collected in post order
+
+    QVector<uint8_t> state(count, 0);
+    QVector<int> post_order;
+    QVector<QPair<int, int>> stack;
+    post_order.reserve(count);
+
+    for (int k = -1; k < count; ++k) {
+        const int root = k < 0 ? entry_block : k;
+
+        if (root < 0 || state.at(root) != 0) {
+            continue;
+        }
+
+        state[root] = 1;
+        stack.append(qMakePair(root, out_start.at(root)));
+
+        while (!stack.isEmpty()) {
+            QPair<int, int>& top = stack.last();
+            const int block = top.first;
+
+            if (top.second == out_start.at(block + 1)) {
+                state[block] = 2;
+                post_order.append(block);
+                stack.removeLast();
+                continue;
+            }
+
+            Edge& edge = edges[out_edges.at(top.second++)];
+
+            if (state.at(edge.to) == 1) {
+                edge.back = true;
+            } else if (state.at(edge.to) == 0) {
+                state[edge.to] = 1;
+                stack.append(qMakePair(edge.to, out_start.at(edge.to)));
+            }
+        }
+    }
+
+    // Longest path from the roots over the forward edges in reverse post order (a topological order of them)
+
+    for (Block& block : blocks) {
+        block.layer = 0;
+    }
+
+    for (int i = post_order.size() - 1; i >= 0; --i) {
+        const int block = post_order.at(i);
+
+        for (int e = out_start.at(block); e < out_start.at(block + 1); ++e) {
+            const Edge& edge = edges.at(out_edges.at(e));
+
+            if (!edge.back) {
+                blocks[edge.to].layer = qMax(blocks.at(edge.to).layer, blocks.at(block).layer + 1);
+            }
+        }
+    }
+
+    for (const Block& block : blocks) {
+        layer_count = qMax(layer_count, block.layer + 1);
+    }
+
+    // Blocks of each layer start in address order and are then sorted by the average column of the blocks above
+    // that go to them
+
+    QVector<QVector<int>> layers(layer_count);
+
+    for (int i = 0; i < count; ++i) {
+        layers[blocks.at(i).layer].append(i);
+    }
+
+    QVector<double> weight(count, 0.0);
+    QVector<int> sources(count, 0);
+
+    for (int layer = 0; layer < layer_count; ++layer) {
+        QVector<int>& row = layers[layer];
+
+        if (layer > 0) {
+            for (int i = 0; i < row.size(); ++i) {
+                const int block = row.at(i);
+
+                // Blocks only reached by back edges keep their place
+                if (sources.at(block) == 0) {
+                    weight[block] = double(i);
+                } else {
+                    weight[block] /= double(sources.at(block));
+                }
+            }
+
+            std::stable_sort(row.begin(), row.end(), [&weight](int a, int b) { return weight.at(a) < weight.at(b); });
+        }
+
+        for (int i = 0; i < row.size(); ++i) {
+            const int block = row.at(i);
+            blocks[block].column = i;
+
+            for (int e = out_start.at(block); e < out_start.at(block + 1); ++e) {
+                const Edge& edge = edges.at(out_edges.at(e));
+
+                if (!edge.back) {
+                    weight[edge.to] += double(i);
+                    sources[edge.to] += 1;
+                }
+            }
+        }
+
+        column_count = qMax(column_count, row.size());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
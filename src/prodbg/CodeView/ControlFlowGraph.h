@@ -0,0 +1,89 @@
+#pragma once
+
+#include <stdint.h>
+#include <QtCore/QVector>
+#include "DisassemblyEngine.h"
+
+namespace prodbg {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Basic blocks and edges of a function laid out in layers for drawing.
+//
+// The instructions of the function are found by ControlFlowBuilder (following the jumps from the entry) and split
+// into blocks with build. A block ends at a jump, return or invalid instruction and a new one starts at each jump
+// target and after each jump. Calls don't end blocks as they return to the next instruction.
+//
+// layout puts each block in a layer (row) below all blocks that jump or fall through to it, except for edges that go
+// back up to a loop header. Blocks in a layer are ordered by the average column of the blocks they come from so
+// edges cross as little as they can with one sweep.
+
+class ControlFlowGraph {
+   public:
+    typedef DisassemblyEngine::Instruction Instruction;
+
+    enum EdgeType {
+        // The block runs into the next one (which is a jump target)
+        Fallthrough,
+        // Conditional jump taken and not taken
+        Taken,
+        NotTaken,
+        // Unconditional jump
+        Jump,
+    };
+
+    struct Block {
+        uint64_t start;
+        // End of the last instruction
+        uint64_t end;
+        // Instructions in the block are instructions[first, first + count)
+        int first;
+        int count;
+        // Row and position in the row of the layout
+        int layer;
+        int column;
+    };
+
+    struct Edge {
+        int from;
+        int to;
+        EdgeType type;
+        // The edge goes back to a block at the same or an earlier layer (a loop)
+        bool back;
+    };
+
+    // Splits the instructions (in any order) in blocks. leaders are addresses where a block has to start (the entry,
+    // jump targets and the instructions after jumps)
+    void build(uint64_t entry, const QVector<Instruction>& instructions, QVector<uint64_t> leaders);
+
+    // Finds the back edges and places the blocks in layers and columns
+    void layout();
+
+    // Index of the block that covers address or -1 if it isn't in the function
+    int block_at(uint64_t address) const;
+
+    uint64_t entry = 0;
+    int entry_block = -1;
+
+    // Hash of the contents of the code pages the function is in (see ControlFlowBuilder) and the pages
+    uint64_t code_hash = 0;
+    QVector<uint64_t> pages;
+
+    // Instructions in address order
+    QVector<Instruction> instructions;
+    // Blocks in address order
+    QVector<Block> blocks;
+    QVector<Edge> edges;
+
+    int layer_count = 0;
+    // Max number of blocks in a layer
+    int column_count = 0;
+
+    // Set if the function was cut off at ControlFlowBuilder::MaxInstructions
+    bool truncated = false;
+
+   private:
+    void add_edge(int from, uint64_t to, EdgeType type);
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
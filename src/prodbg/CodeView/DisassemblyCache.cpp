@@ -0,0 +1,331 @@
+#include "DisassemblyCache.h"
+#include <QtCore/QDataStream>
+#include <QtCore/QFile>
+#include <QtCore/QSaveFile>
+#include <algorithm>
+
+namespace prodbg {
+
+// "PDDC" and the version of the file format
+static const quint32 s_file_magic = 0x50444443;
+static const quint32 s_file_version = 3;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+uint qHash(const DisassemblyCache::Key& key, uint seed) {
+    return uint((key.address >> 12) * 0x9e3779b97f4a7c15ull ^ key.hash) ^ seed;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+DisassemblyCache::Page* DisassemblyCache::find_page(uint64_t address, uint64_t hash) {
+    auto it = m_index.constFind({address, hash});
+
+    if (it == m_index.constEnd()) {
+        return nullptr;
+    }
+
+    Page& page = m_pages[it.value()];
+    page.last_used = ++m_clock;
+
+    return &page;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+DisassemblyCache::Page* DisassemblyCache::add_page(uint64_t address, uint64_t hash) {
+    Page* page = find_page(address, hash);
+
+    if (page) {
+        return page;
+    }
+
+    if (m_index.size() >= MaxPages) {
+        drop_least_used();
+    }
+
+    int slot;
+
+    if (!m_free_slots.isEmpty()) {
+        slot = m_free_slots.takeLast();
+    } else {
+        slot = m_pages.size();
+        m_pages.append(Page());
+    }
+
+    page = &m_pages[slot];
+    page->address = address;
+    page->hash = hash;
+    page->last_used = ++m_clock;
+    page->entries.clear();
+
+    m_index.insert({address, hash}, slot);
+
+    return page;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void DisassemblyCache::remove_slot(int slot) {
+    Page& page = m_pages[slot];
+
+    m_index.remove({page.address, page.hash});
+    page.entries = QHash<uint64_t, Entry>();
+    m_free_slots.append(slot);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Drops the least recently used quarter of the pages at once so this doesn't happen for every new page
+
+void DisassemblyCache::drop_least_used() {
+    QVector<uint64_t> used;
+
+    for (auto it = m_index.constBegin(); it != m_index.constEnd(); ++it) {
+        used.append(m_pages[it.value()].last_used);
+    }
+
+    if (used.isEmpty()) {
+        return;
+    }
+
+    auto limit = used.begin() + used.size() / 4;
+    std::nth_element(used.begin(), limit, used.end());
+    const uint64_t oldest = *limit;
+
+    QVector<int> slots;
+
+    for (auto it = m_index.constBegin(); it != m_index.constEnd(); ++it) {
+        if (m_pages[it.value()].last_used <= oldest) {
+            slots.append(it.value());
+        }
+    }
+
+    for (int slot : slots) {
+        remove_slot(slot);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const DisassemblyCache::Instruction* DisassemblyCache::find(uint64_t address, uint64_t page_hash,
+                                                             const uint64_t* next_hash) {
+    Page* page = find_page(address & ~uint64_t(PageSize - 1), page_hash);
+
+    if (!page) {
+        return nullptr;
+    }
+
+    auto it = page->entries.constFind(address);
+
+    if (it == page->entries.constEnd()) {
+        return nullptr;
+    }
+
+    const Entry& entry = it.value();
+
+    if (entry.uses_next && (!next_hash || *next_hash != entry.next_hash)) {
+        return nullptr;
+    }
+
+    return &entry.inst;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void DisassemblyCache::insert(const Instruction& inst, uint64_t page_hash, const uint64_t* next_hash) {
+    Page* page = add_page(inst.address & ~uint64_t(PageSize - 1), page_hash);
+
+    Entry entry;
+    entry.inst = inst;
+    entry.uses_next = next_hash != nullptr;
+    entry.next_hash = next_hash ? *next_hash : 0;
+
+    page->entries.insert(inst.address, entry);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void DisassemblyCache::remove(uint64_t address, uint64_t size) {
+    const uint64_t first = address & ~uint64_t(PageSize - 1);
+    const uint64_t last = (address + qMax(size, uint64_t(1)) - 1) & ~uint64_t(PageSize - 1);
+    QVector<int> slots;
+
+    for (auto it = m_index.constBegin(); it != m_index.constEnd(); ++it) {
+        if (it.key().address >= first && it.key().address <= last) {
+            slots.append(it.value());
+        }
+    }
+
+    for (int slot : slots) {
+        remove_slot(slot);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void DisassemblyCache::clear() {
+    m_pages.clear();
+    m_free_slots.clear();
+    m_index.clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int DisassemblyCache::instruction_count() const {
+    int count = 0;
+
+    for (auto it = m_index.constBegin(); it != m_index.constEnd(); ++it) {
+        count += m_pages[it.value()].entries.size();
+    }
+
+    return count;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Register sets in a file use the bits of the table saved with it. bits has the bit in this cache for each of them
+
+static RegisterSet remap_registers(const RegisterSet& registers, const QVector<int>& bits) {
+    RegisterSet remapped;
+
+    for (int bit = 0; bit < bits.size(); ++bit) {
+        if (registers.contains(bit) && bits.at(bit) >= 0) {
+            remapped.insert(bits.at(bit));
+        }
+    }
+
+    return remapped;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool DisassemblyCache::save(const QString& filename, int arch, int mode) const {
+    QSaveFile file(filename);
+
+    if (!file.open(QIODevice::WriteOnly)) {
+        return false;
+    }
+
+    QDataStream stream(&file);
+
+    stream << s_file_magic << s_file_version << qint32(arch) << qint32(mode) << m_registers.ids()
+           << quint32(m_index.size());
+
+    for (auto it = m_index.constBegin(); it != m_index.constEnd(); ++it) {
+        const Page& page = m_pages[it.value()];
+
+        stream << quint64(page.address) << quint64(page.hash) << quint32(page.entries.size());
+
+        for (auto e = page.entries.constBegin(); e != page.entries.constEnd(); ++e) {
+            const Entry& entry = e.value();
+            const Instruction& inst = entry.inst;
+
+            stream << quint64(inst.address) << quint64(inst.target) << quint32(inst.size) << quint32(inst.flags)
+                   << inst.bytes << inst.mnemonic << inst.operands << entry.uses_next << quint64(entry.next_hash)
+                   << quint64(inst.read_registers.bits[0]) << quint64(inst.read_registers.bits[1])
+                   << quint64(inst.write_registers.bits[0]) << quint64(inst.write_registers.bits[1]);
+        }
+    }
+
+    return stream.status() == QDataStream::Ok && file.commit();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool DisassemblyCache::load(const QString& filename, int arch, int mode) {
+    QFile file(filename);
+
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    QDataStream stream(&file);
+    quint32 magic = 0;
+    quint32 version = 0;
+    qint32 file_arch = 0;
+    qint32 file_mode = 0;
+    quint32 page_count = 0;
+    QVector<quint16> register_ids;
+
+    stream >> magic >> version >> file_arch >> file_mode;
+
+    if (stream.status() != QDataStream::Ok || magic != s_file_magic || version != s_file_version) {
+        return false;
+    }
+
+    stream >> register_ids >> page_count;
+
+    if (stream.status() != QDataStream::Ok || file_arch != arch || file_mode != mode ||
+        register_ids.size() > RegisterSet::MaxRegisters) {
+        return false;
+    }
+
+    // Read everything before touching the cache so a truncated file doesn't leave half of it behind
+
+    QVector<Page> pages;
+
+    for (quint32 i = 0; i < page_count && i < quint32(MaxPages) && stream.status() == QDataStream::Ok; ++i) {
+        Page page;
+        quint64 address = 0;
+        quint64 hash = 0;
+        quint32 count = 0;
+
+        stream >> address >> hash >> count;
+
+        page.address = address;
+        page.hash = hash;
+
+        for (quint32 k = 0; k < count && stream.status() == QDataStream::Ok; ++k) {
+            Entry entry;
+            quint64 inst_address = 0;
+            quint64 target = 0;
+            quint32 size = 0;
+            quint32 flags = 0;
+            quint64 next_hash = 0;
+            quint64 registers[4] = {};
+
+            stream >> inst_address >> target >> size >> flags >> entry.inst.bytes >> entry.inst.mnemonic >>
+                entry.inst.operands >> entry.uses_next >> next_hash >> registers[0] >> registers[1] >> registers[2] >>
+                registers[3];
+
+            entry.inst.address = inst_address;
+            entry.inst.target = target;
+            entry.inst.size = size;
+            entry.inst.flags = flags;
+            entry.next_hash = next_hash;
+            entry.inst.read_registers.bits[0] = registers[0];
+            entry.inst.read_registers.bits[1] = registers[1];
+            entry.inst.write_registers.bits[0] = registers[2];
+            entry.inst.write_registers.bits[1] = registers[3];
+
+            page.entries.insert(entry.inst.address, entry);
+        }
+
+        pages.append(page);
+    }
+
+    if (stream.status() != QDataStream::Ok) {
+        return false;
+    }
+
+    QVector<int> register_bits;
+
+    for (quint16 id : register_ids) {
+        register_bits.append(m_registers.bit(id));
+    }
+
+    for (const Page& loaded : pages) {
+        Page* page = add_page(loaded.address, loaded.hash);
+
+        for (auto it = loaded.entries.constBegin(); it != loaded.entries.constEnd(); ++it) {
+            Entry entry = it.value();
+            entry.inst.read_registers = remap_registers(entry.inst.read_registers, register_bits);
+            entry.inst.write_registers = remap_registers(entry.inst.write_registers, register_bits);
+            page->entries.insert(it.key(), entry);
+        }
+    }
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
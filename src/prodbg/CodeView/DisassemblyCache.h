@@ -0,0 +1,96 @@
+#pragma once
+
+#include <stdint.h>
+#include <QtCore/QHash>
+#include <QtCore/QString>
+#include <QtCore/QVector>
+#include "DisassemblyEngine.h"
+
+namespace prodbg {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Decoded instructions kept by code page. A page is keyed by its address and the hash of its contents (see
+// MemoryCache::page_hash) so the instructions of a page that is read again at a later stop are found as long as the
+// code bytes are the same, while a page that has changed simply misses. Banked memory and overlays that have
+// different code at the same address get one entry for each version.
+//
+// Instructions that depend on bytes in the next page (they continue into it or were decoded as invalid because it
+// cut them short) also store the hash of the next page and only match while that is the same as well.
+//
+// The cache can be saved to a file and loaded in a later session so the code of a binary that is loaded at the same
+// address (such as non PIE programs and most targets without an OS) doesn't have to be decoded again.
+
+class DisassemblyCache {
+   public:
+    typedef DisassemblyEngine::Instruction Instruction;
+
+    enum {
+        PageSize = 4096,
+        // Max number of pages kept before the least recently used ones are dropped
+        MaxPages = 4096,
+    };
+
+    // Instruction at address if it was decoded while its page had page_hash as contents. next_hash is the hash of the
+    // next page or null if that page isn't cached
+    const Instruction* find(uint64_t address, uint64_t page_hash, const uint64_t* next_hash);
+
+    // Adds an instruction decoded from the page with page_hash. next_hash is the hash of the next page if the
+    // instruction depends on bytes in it and null otherwise
+    void insert(const Instruction& inst, uint64_t page_hash, const uint64_t* next_hash);
+
+    // Drops all versions of the pages in [address, address + size)
+    void remove(uint64_t address, uint64_t size);
+
+    void clear();
+
+    int page_count() const { return m_index.size(); }
+    int instruction_count() const;
+
+    // Bits of the register sets of the instructions. The table isn't cleared with the instructions as copies of them
+    // may still be around (it only needs clearing when the arch changes)
+    RegisterTable* registers() { return &m_registers; }
+    const RegisterTable* registers() const { return &m_registers; }
+
+    // Saves all pages along with the arch and mode they were decoded with. load leaves the cache as it is and returns
+    // false if the file can't be read or is for another arch/mode. Loaded pages are added to the ones in the cache.
+    bool save(const QString& filename, int arch, int mode) const;
+    bool load(const QString& filename, int arch, int mode);
+
+   private:
+    struct Entry {
+        Instruction inst;
+        // Hash of the next page if the instruction depends on it
+        bool uses_next;
+        uint64_t next_hash;
+    };
+
+    struct Page {
+        uint64_t address;
+        uint64_t hash;
+        uint64_t last_used;
+        QHash<uint64_t, Entry> entries;
+    };
+
+    struct Key {
+        uint64_t address;
+        uint64_t hash;
+
+        bool operator==(const Key& other) const { return address == other.address && hash == other.hash; }
+    };
+
+    friend uint qHash(const Key& key, uint seed);
+
+    Page* find_page(uint64_t address, uint64_t hash);
+    Page* add_page(uint64_t address, uint64_t hash);
+    void remove_slot(int slot);
+    void drop_least_used();
+
+    QVector<Page> m_pages;
+    QVector<int> m_free_slots;
+    QHash<Key, int> m_index;
+    RegisterTable m_registers;
+    uint64_t m_clock = 0;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
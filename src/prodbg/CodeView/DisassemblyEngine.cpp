@@ -0,0 +1,953 @@
+#include "DisassemblyEngine.h"
+#include <pd_capstone.h>
+#include <QtCore/QDir>
+#include <QtCore/QSettings>
+#include <QtCore/QStandardPaths>
+#include "Backend/Service.h"
+#include "DisassemblyCache.h"
+#include "InstructionIndex.h"
+#include "MemoryView/MemoryCache.h"
+
+namespace prodbg {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct InstructionSizes {
+    int arch;
+    int min_size;
+    int max_size;
+};
+
+// Thumb, microMIPS and compressed RISC-V have 2 byte instructions as well (see instruction_sizes)
+
+static const InstructionSizes s_instruction_sizes[] = {
+    {CS_ARCH_ARM, 4, 4},     {CS_ARCH_ARM64, 4, 4}, {CS_ARCH_MIPS, 4, 4},    {CS_ARCH_X86, 1, 15},
+    {CS_ARCH_PPC, 4, 4},     {CS_ARCH_SPARC, 4, 4}, {CS_ARCH_SYSZ, 2, 6},    {CS_ARCH_XCORE, 2, 4},
+    {CS_ARCH_M68K, 2, 22},   {CS_ARCH_M680X, 1, 6}, {CS_ARCH_MOS65XX, 1, 4}, {CS_ARCH_RISCV, 4, 4},
+};
+
+static void instruction_sizes(int arch, int mode, int* min_size, int* max_size) {
+    *min_size = 1;
+    *max_size = 16;
+
+    for (const InstructionSizes& sizes : s_instruction_sizes) {
+        if (sizes.arch == arch) {
+            *min_size = sizes.min_size;
+            *max_size = sizes.max_size;
+            break;
+        }
+    }
+
+    if ((arch == CS_ARCH_ARM && (mode & CS_MODE_THUMB)) || (arch == CS_ARCH_MIPS && (mode & CS_MODE_MICRO)) ||
+        (arch == CS_ARCH_RISCV && (mode & CS_MODE_RISCVC))) {
+        *min_size = 2;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+DisassemblyEngine::DisassemblyEngine(IBackendRequests* interface)
+    : QObject(interface),
+      m_interface(interface),
+      m_cache(MemoryCache::for_interface(interface)),
+      m_capstone((PDCapstoneFuncs*)Service_get(PDCAPSTONEFUNCS_GLOBAL)),
+      m_code(new DisassemblyCache),
+      m_index(new InstructionIndex) {
+    QSettings settings(QStringLiteral("TBL"), QStringLiteral("ProDBG"));
+
+    if (settings.value(QStringLiteral("Disassembly/persistentCache"), false).toBool()) {
+        m_cache_directory =
+            QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + QStringLiteral("/Disassembly");
+    }
+
+    if (m_cache) {
+        connect(m_cache, &MemoryCache::pages_updated, this, &DisassemblyEngine::pages_updated);
+        connect(m_cache, &MemoryCache::memory_written, this, &DisassemblyEngine::memory_written);
+    }
+
+    if (interface) {
+        connect(interface, &IBackendRequests::target_info_received, this, &DisassemblyEngine::target_info_received);
+        connect(interface, &IBackendRequests::program_counter_changed, this,
+                &DisassemblyEngine::program_counter_changed);
+        connect(interface, &IBackendRequests::session_ended, this, &DisassemblyEngine::session_ended);
+        interface->request_target_info();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+DisassemblyEngine::~DisassemblyEngine() {
+    save_cache();
+    close();
+    delete m_code;
+    delete m_index;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+DisassemblyEngine* DisassemblyEngine::for_interface(IBackendRequests* interface) {
+    if (!interface) {
+        return nullptr;
+    }
+
+    DisassemblyEngine* engine = interface->findChild<DisassemblyEngine*>(QString(), Qt::FindDirectChildrenOnly);
+
+    return engine ? engine : new DisassemblyEngine(interface);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void DisassemblyEngine::close() {
+    if (m_handle && m_capstone) {
+        csh handle = m_handle;
+        m_capstone->close(&handle);
+    }
+
+    m_handle = 0;
+    m_code->clear();
+    m_code->registers()->clear();
+    m_index->clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool DisassemblyEngine::set_target(int arch, int mode, int address_width) {
+    m_manual_target = true;
+    return open_target(arch, mode, address_width);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool DisassemblyEngine::open_target(int arch, int mode, int address_width) {
+    if (!m_capstone) {
+        return false;
+    }
+
+    if (m_handle && arch == m_arch && mode == m_mode) {
+        m_address_width = address_width;
+        return true;
+    }
+
+    csh handle = 0;
+
+    if (m_capstone->open(cs_arch(arch), cs_mode(mode), &handle) != CS_ERR_OK) {
+        return false;
+    }
+
+    // Details are needed to find jumps/calls and their targets
+    m_capstone->option(handle, CS_OPT_DETAIL, CS_OPT_ON);
+
+    close();
+
+    m_handle = handle;
+    m_arch = arch;
+    m_mode = mode;
+    m_address_width = address_width;
+
+    instruction_sizes(arch, mode, &m_min_size, &m_max_size);
+    m_index->set_max_instruction_size(m_max_size);
+
+    target_changed();
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int DisassemblyEngine::address_width() const {
+    if (m_address_width > 0) {
+        return m_address_width;
+    }
+
+    return m_cache ? m_cache->address_width() : 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void DisassemblyEngine::invalidate() {
+    m_code->clear();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void DisassemblyEngine::set_cache_directory(const QString& path) {
+    m_cache_directory = path;
+
+    if (!m_cache_directory.isEmpty() && m_handle && !m_build_id.isEmpty()) {
+        m_code->load(cache_filename(), m_arch, m_mode);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+QString DisassemblyEngine::cache_filename() const {
+    QString name;
+
+    // The build id comes from the backend so only characters that are safe in a filename are used
+
+    for (QChar c : m_build_id) {
+        if (c.isLetterOrNumber() || c == QLatin1Char('-') || c == QLatin1Char('_')) {
+            name += c;
+        }
+    }
+
+    if (name.isEmpty()) {
+        return QString();
+    }
+
+    return m_cache_directory + QLatin1Char('/') + name + QStringLiteral(".cache");
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool DisassemblyEngine::save_cache() const {
+    const QString filename = cache_filename();
+
+    if (m_cache_directory.isEmpty() || filename.isEmpty() || !m_handle || m_code->page_count() == 0) {
+        return false;
+    }
+
+    QDir().mkpath(m_cache_directory);
+
+    return m_code->save(filename, m_arch, m_mode);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void DisassemblyEngine::set_build_id(const QString& build_id) {
+    if (build_id == m_build_id) {
+        return;
+    }
+
+    // Code of the previous binary is saved before its id is replaced
+
+    save_cache();
+
+    m_build_id = build_id;
+
+    if (!m_cache_directory.isEmpty() && m_handle && !m_build_id.isEmpty()) {
+        m_code->load(cache_filename(), m_arch, m_mode);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const DisassemblyEngine::Instruction* DisassemblyEngine::find_cached(uint64_t address) {
+    const uint64_t next_page = (address & ~uint64_t(MemoryCache::PageSize - 1)) + MemoryCache::PageSize;
+    uint64_t hash = 0;
+    uint64_t next_hash = 0;
+
+    if (!m_cache->page_hash(address, &hash)) {
+        return nullptr;
+    }
+
+    const bool has_next = m_cache->page_hash(next_page, &next_hash);
+
+    return m_code->find(address, hash, has_next ? &next_hash : nullptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Only instructions decoded from cached pages are kept (with the hash of those pages). Unreadable memory is cheap to
+// make again and may be readable at the next stop.
+
+void DisassemblyEngine::insert(const Instruction& inst) {
+    const uint64_t page_end = (inst.address & ~uint64_t(MemoryCache::PageSize - 1)) + MemoryCache::PageSize;
+    uint64_t hash = 0;
+    uint64_t next_hash = 0;
+
+    if ((inst.flags & Unreadable) || !m_cache->page_hash(inst.address, &hash)) {
+        return;
+    }
+
+    // Bytes are invalid when no instruction of up to max size could be decoded from them, so they depend on all of
+    // those bytes
+
+    const uint64_t used = (inst.flags & Invalid) ? uint64_t(m_max_size) : uint64_t(inst.size);
+
+    if (page_end == 0 || inst.address + used <= page_end) {
+        m_code->insert(inst, hash, nullptr);
+    } else if (m_cache->page_hash(page_end, &next_hash)) {
+        m_code->insert(inst, hash, &next_hash);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool DisassemblyEngine::decode(uint64_t address, int count, QVector<Instruction>* out) {
+    return decode_from(address, count, out, m_handle && m_cache && known_start(address));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Instructions decoded from a known start are added to the instruction index (see record) until memory that isn't
+// readable is reached
+
+bool DisassemblyEngine::decode_from(uint64_t address, int count, QVector<Instruction>* out, bool trusted) {
+    out->resize(0);
+
+    if (!m_handle || !m_cache) {
+        return false;
+    }
+
+    uint64_t pc = address;
+
+    while (out->size() < count) {
+        const Instruction* cached = find_cached(pc);
+
+        // Instructions cached before register access was turned on are decoded again
+
+        if (cached && (m_register_users == 0 || (cached->flags & HasRegisters))) {
+            out->append(*cached);
+            trusted = trusted && record(*cached);
+            pc += cached->size;
+            continue;
+        }
+
+        // Read enough bytes for the remaining instructions
+
+        const int remaining = count - out->size();
+        const uint64_t size = qMin(uint64_t(remaining) * uint64_t(m_max_size), uint64_t(MemoryCache::PageSize));
+        const bool complete = m_cache->read(pc, size, &m_span);
+
+        uint32_t readable = uint32_t(m_span.size());
+
+        for (const MemorySpan::Run& run : m_span.runs) {
+            if (!(run.flags & IBackendRequests::Readable)) {
+                readable = run.offset;
+                break;
+            }
+        }
+
+        cs_insn* insns = nullptr;
+        size_t decoded = 0;
+
+        if (readable > 0) {
+            decoded = m_capstone->disasm(m_handle, m_span.bytes(), readable, pc, size_t(remaining), &insns);
+        }
+
+        for (size_t i = 0; i < decoded; ++i) {
+            const cs_insn& insn = insns[i];
+
+            Instruction inst;
+            inst.address = insn.address;
+            inst.target = 0;
+            inst.size = insn.size;
+            inst.bytes = QByteArray((const char*)insn.bytes, insn.size);
+            inst.mnemonic = QString::fromLatin1(insn.mnemonic);
+            inst.operands = QString::fromLatin1(insn.op_str);
+            inst.flags = instruction_flags(m_arch, &insn, &inst.target);
+
+            if (m_register_users > 0) {
+                read_register_access(&insn, &inst);
+            }
+
+            insert(inst);
+            out->append(inst);
+            trusted = trusted && record(inst);
+
+            pc += insn.size;
+        }
+
+        if (insns) {
+            m_capstone->free(insns, decoded);
+        }
+
+        if (int(decoded) == remaining) {
+            break;
+        }
+
+        // Capstone stopped early. Either the read was cut short and there is more to decode, the bytes at pc aren't a
+        // valid instruction or the instruction continues into memory that isn't readable (or not cached yet)
+
+        const uint32_t offset = uint32_t(pc - m_span.address);
+        const uint32_t left = readable - offset;
+
+        if (left < uint32_t(m_max_size) && readable == uint32_t(m_span.size()) && decoded > 0) {
+            continue;
+        }
+
+        if (left < uint32_t(m_max_size) && !complete) {
+            m_waiting = true;
+            return false;
+        }
+
+        Instruction inst;
+        inst.address = pc;
+        inst.target = 0;
+
+        if (left > 0) {
+            inst.size = qMin(left, uint32_t(m_min_size));
+            inst.bytes = QByteArray((const char*)m_span.bytes() + offset, int(inst.size));
+            inst.mnemonic = QStringLiteral(".byte");
+            inst.flags = Invalid;
+
+            for (int i = 0; i < inst.bytes.size(); ++i) {
+                if (i > 0) {
+                    inst.operands += QStringLiteral(", ");
+                }
+
+                inst.operands += QStringLiteral("0x%1").arg(uint8_t(inst.bytes[i]), 2, 16, QLatin1Char('0'));
+            }
+        } else {
+            inst.size = uint32_t(m_min_size);
+            inst.mnemonic = QStringLiteral("??");
+            inst.flags = Unreadable;
+        }
+
+        if (m_register_users > 0) {
+            inst.flags |= HasRegisters;
+        }
+
+        insert(inst);
+        out->append(inst);
+        trusted = trusted && record(inst);
+
+        pc += inst.size;
+    }
+
+    return out->size() == count;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// The instruction was decoded with details so this is only the regs_access call. Archs that Capstone can't tell the
+// registers of get empty sets
+
+void DisassemblyEngine::read_register_access(const void* insn, Instruction* inst) {
+    cs_regs read_ids;
+    cs_regs write_ids;
+    uint8_t read_count = 0;
+    uint8_t write_count = 0;
+
+    inst->flags |= HasRegisters;
+
+    if (m_capstone->regs_access(m_handle, (const cs_insn*)insn, read_ids, &read_count, write_ids, &write_count) !=
+        CS_ERR_OK) {
+        return;
+    }
+
+    RegisterTable* table = m_code->registers();
+
+    for (uint8_t i = 0; i < read_count; ++i) {
+        const int bit = table->bit(read_ids[i]);
+
+        if (bit >= 0) {
+            inst->read_registers.insert(bit);
+        }
+    }
+
+    for (uint8_t i = 0; i < write_count; ++i) {
+        const int bit = table->bit(write_ids[i]);
+
+        if (bit >= 0) {
+            inst->write_registers.insert(bit);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void DisassemblyEngine::set_register_access(bool enabled) {
+    m_register_users = qMax(0, m_register_users + (enabled ? 1 : -1));
+
+    if (enabled && m_register_users == 1) {
+        instructions_updated();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+QStringList DisassemblyEngine::register_names(const RegisterSet& registers) const {
+    const RegisterTable* table = m_code->registers();
+    QStringList names;
+
+    for (int bit = 0; bit < table->size(); ++bit) {
+        if (!registers.contains(bit)) {
+            continue;
+        }
+
+        const char* name = m_handle ? m_capstone->reg_name(m_handle, table->id(bit)) : nullptr;
+        names.append(name ? QString::fromLatin1(name) : QStringLiteral("r%1").arg(table->id(bit)));
+    }
+
+    return names;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Adds an instruction that follows a known start to the index along with the target of its branch. Returns false if
+// the sweep can't go on from it
+
+bool DisassemblyEngine::record(const Instruction& inst) {
+    uint64_t hash = 0;
+
+    if ((inst.flags & Unreadable) || !m_cache->page_hash(inst.address, &hash)) {
+        return false;
+    }
+
+    m_index->add(inst.address, inst.size, hash);
+
+    if ((inst.flags & HasTarget) && (inst.flags & (Jump | Call))) {
+        m_index->add_entry(inst.target);
+    }
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool DisassemblyEngine::known_start(uint64_t address) const {
+    uint64_t hash = 0;
+
+    if (m_index->is_entry(address)) {
+        return true;
+    }
+
+    return m_cache->page_hash(address, &hash) && m_index->size_at(address, hash) != 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Start of the known instruction that ends at address
+
+bool DisassemblyEngine::known_previous(uint64_t address, uint64_t* start) const {
+    for (uint64_t size = uint64_t(m_min_size); size <= uint64_t(m_max_size) && size <= address;
+         size += uint64_t(m_min_size)) {
+        const uint64_t candidate = address - size;
+        uint64_t hash = 0;
+
+        if (m_cache->page_hash(candidate, &hash) && m_index->size_at(candidate, hash) == size) {
+            *start = candidate;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Moves start back over up to count known instructions and returns how many it moved
+
+int DisassemblyEngine::walk_back(uint64_t* start, int count) const {
+    int known = 0;
+
+    while (known < count && known_previous(*start, start)) {
+        ++known;
+    }
+
+    return known;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Continues the sweep of the closest entry before address until it has reached address. Returns false if memory is
+// needed
+
+bool DisassemblyEngine::sweep_to(uint64_t address) {
+    uint64_t entry = 0;
+    uint64_t pc = 0;
+
+    if (address == 0 || !m_index->entry_before(address - 1, &entry, &pc) || address - entry > MaxSweepBytes) {
+        return true;
+    }
+
+    while (pc < address) {
+        const uint64_t left = (address - pc + uint64_t(m_max_size) - 1) / uint64_t(m_max_size);
+        const bool complete = decode_from(pc, int(qMin(left, uint64_t(256))), &m_sweep, true);
+
+        if (m_sweep.isEmpty()) {
+            return complete;
+        }
+
+        const Instruction& last = m_sweep.last();
+
+        // Memory that isn't readable ends the sweep for now (it's tried again the next time)
+        if (last.flags & Unreadable) {
+            return true;
+        }
+
+        pc = last.address + last.size;
+        m_index->set_swept_to(entry, pc);
+
+        if (!complete) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Up to count instructions that end at address when there are no known boundaries. This decodes forwards from a bit
+// further back and tries each start within one max instruction size until the instructions line up with address.
+// The first few instructions of a sweep that starts in the middle of an instruction are wrong but the decoding falls
+// in line with the real instructions after a few of them.
+
+bool DisassemblyEngine::guess_before(uint64_t address, int count, QVector<Instruction>* out) {
+    const uint64_t min_size = uint64_t(m_min_size);
+    const uint64_t max_size = uint64_t(m_max_size);
+
+    out->resize(0);
+
+    if (min_size == max_size) {
+        const uint64_t rows = qMin(uint64_t(count), address / min_size);
+        return decode_from(address - rows * min_size, int(rows), out, false);
+    }
+
+    const uint64_t span = qMin(address, uint64_t(count + ResyncInstructions) * max_size);
+
+    for (uint64_t offset = 0; offset < max_size && offset < span; offset += min_size) {
+        out->resize(0);
+
+        for (uint64_t pc = address - span + offset; pc < address;) {
+            // Never more instructions than fits in what is left so decoding doesn't run far past address
+            const int left = int(qMin(uint64_t(64), (address - pc + max_size - 1) / max_size));
+
+            if (!decode_from(pc, left, &m_sweep, false)) {
+                return false;
+            }
+
+            for (const Instruction& inst : m_sweep) {
+                if (inst.address >= address) {
+                    break;
+                }
+
+                out->append(inst);
+            }
+
+            pc = m_sweep.last().address + m_sweep.last().size;
+        }
+
+        if (!out->isEmpty() && out->last().address + out->last().size == address) {
+            break;
+        }
+    }
+
+    // If no start lined up the instruction that overlaps address is dropped and there is a gap before it
+
+    while (!out->isEmpty() && out->last().address + out->last().size > address) {
+        out->removeLast();
+    }
+
+    if (out->size() > count) {
+        *out = out->mid(out->size() - count);
+    }
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool DisassemblyEngine::decode_before(uint64_t address, int count, QVector<Instruction>* out) {
+    out->resize(0);
+
+    if (!m_handle || !m_cache) {
+        return false;
+    }
+
+    uint64_t start = address;
+    int known = walk_back(&start, count);
+
+    if (known < count && start > 0) {
+        if (!sweep_to(start)) {
+            return false;
+        }
+
+        known += walk_back(&start, count - known);
+    }
+
+    QVector<Instruction> guessed;
+
+    if (known < count && start > 0 && !guess_before(start, count - known, &guessed)) {
+        return false;
+    }
+
+    if (!decode_from(start, known, out, true)) {
+        return false;
+    }
+
+    if (!guessed.isEmpty()) {
+        *out = guessed + *out;
+    }
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+uint64_t DisassemblyEngine::instruction_start(uint64_t address) const {
+    const uint64_t min_size = uint64_t(m_min_size);
+    const uint64_t aligned = address - address % min_size;
+
+    if (m_cache) {
+        for (uint64_t back = 0; back < uint64_t(m_max_size) && back <= aligned; back += min_size) {
+            const uint64_t candidate = aligned - back;
+            uint64_t hash = 0;
+
+            if (m_cache->page_hash(candidate, &hash) && m_index->size_at(candidate, hash) > back) {
+                return candidate;
+            }
+        }
+    }
+
+    return aligned;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void DisassemblyEngine::add_entry_points(const QVector<uint64_t>& addresses) {
+    for (uint64_t address : addresses) {
+        m_index->add_entry(address);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+uint32_t DisassemblyEngine::instruction_flags(int arch, const void* data, uint64_t* target) {
+    const cs_insn* insn = (const cs_insn*)data;
+    uint32_t flags = 0;
+
+    if (!insn->detail) {
+        return 0;
+    }
+
+    for (int i = 0; i < insn->detail->groups_count; ++i) {
+        const int group = insn->detail->groups[i];
+
+        if (group == CS_GRP_JUMP) {
+            flags |= Jump;
+        } else if (group == CS_GRP_CALL) {
+            flags |= Call;
+        } else if (group == CS_GRP_RET || group == CS_GRP_IRET) {
+            flags |= Return;
+        } else if (group == CS_GRP_INT) {
+            flags |= Interrupt;
+        }
+    }
+
+    // Capstone has no call group for 68k so subroutine calls are only in the jump group
+    if (arch == CS_ARCH_M68K && (insn->id == M68K_INS_JSR || insn->id == M68K_INS_BSR)) {
+        flags = (flags & ~uint32_t(Jump)) | Call;
+    }
+
+    if ((flags & Jump) && is_unconditional(arch, insn)) {
+        flags |= Unconditional;
+    }
+
+    if ((flags & (Jump | Call)) && branch_target(arch, insn, target)) {
+        flags |= HasTarget;
+    }
+
+    return flags;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Finds the target of direct jumps/calls. Most archs have it as the (last) immediate operand but 68k and 65xx have the
+// displacement for relative branches
+
+bool DisassemblyEngine::branch_target(int arch, const void* data, uint64_t* target) {
+    const cs_insn* insn = (const cs_insn*)data;
+    const cs_detail* detail = insn->detail;
+    bool found = false;
+
+    switch (arch) {
+        case CS_ARCH_X86: {
+            for (int i = 0; i < detail->x86.op_count; ++i) {
+                if (detail->x86.operands[i].type == X86_OP_IMM) {
+                    *target = uint64_t(detail->x86.operands[i].imm);
+                    found = true;
+                }
+            }
+            break;
+        }
+
+        case CS_ARCH_ARM: {
+            for (int i = 0; i < detail->arm.op_count; ++i) {
+                if (detail->arm.operands[i].type == ARM_OP_IMM) {
+                    *target = uint32_t(detail->arm.operands[i].imm);
+                    found = true;
+                }
+            }
+            break;
+        }
+
+        case CS_ARCH_ARM64: {
+            for (int i = 0; i < detail->arm64.op_count; ++i) {
+                if (detail->arm64.operands[i].type == ARM64_OP_IMM) {
+                    *target = uint64_t(detail->arm64.operands[i].imm);
+                    found = true;
+                }
+            }
+            break;
+        }
+
+        case CS_ARCH_MIPS: {
+            for (int i = 0; i < detail->mips.op_count; ++i) {
+                if (detail->mips.operands[i].type == MIPS_OP_IMM) {
+                    *target = uint64_t(detail->mips.operands[i].imm);
+                    found = true;
+                }
+            }
+            break;
+        }
+
+        case CS_ARCH_PPC: {
+            for (int i = 0; i < detail->ppc.op_count; ++i) {
+                if (detail->ppc.operands[i].type == PPC_OP_IMM) {
+                    *target = uint64_t(detail->ppc.operands[i].imm);
+                    found = true;
+                }
+            }
+            break;
+        }
+
+        case CS_ARCH_RISCV: {
+            for (int i = 0; i < detail->riscv.op_count; ++i) {
+                if (detail->riscv.operands[i].type == RISCV_OP_IMM) {
+                    *target = uint64_t(detail->riscv.operands[i].imm);
+                    found = true;
+                }
+            }
+            break;
+        }
+
+        case CS_ARCH_M68K: {
+            for (int i = 0; i < detail->m68k.op_count; ++i) {
+                const cs_m68k_op& op = detail->m68k.operands[i];
+
+                if (op.type == M68K_OP_BR_DISP) {
+                    *target = uint32_t(insn->address + 2 + int64_t(op.br_disp.disp));
+                    found = true;
+                } else if (op.address_mode == M68K_AM_ABSOLUTE_DATA_LONG) {
+                    *target = uint32_t(op.imm);
+                    found = true;
+                } else if (op.address_mode == M68K_AM_ABSOLUTE_DATA_SHORT) {
+                    *target = uint32_t(int16_t(op.imm));
+                    found = true;
+                }
+            }
+            break;
+        }
+
+        case CS_ARCH_MOS65XX: {
+            const cs_mos65xx& mos = detail->mos65xx;
+
+            if (mos.op_count == 0 || mos.operands[mos.op_count - 1].type != MOS65XX_OP_MEM) {
+                break;
+            }
+
+            const uint32_t value = mos.operands[mos.op_count - 1].mem;
+
+            if (mos.am == MOS65XX_AM_REL || mos.am == MOS65XX_AM_ZP_REL) {
+                const int32_t disp = insn->size == 3 && mos.am == MOS65XX_AM_REL ? int16_t(value) : int8_t(value);
+                *target = (insn->address + insn->size + disp) & 0xffff;
+                found = true;
+            } else if (mos.am == MOS65XX_AM_ABS || mos.am == MOS65XX_AM_ABS_LONG) {
+                *target = value;
+                found = true;
+            }
+            break;
+        }
+
+        default: break;
+    }
+
+    return found;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Capstone only has a jump group so jumps that always go to their target are found by id (and condition code on the
+// archs where any branch can be conditional). Jumps that aren't known are treated as conditional.
+
+bool DisassemblyEngine::is_unconditional(int arch, const void* data) {
+    const cs_insn* insn = (const cs_insn*)data;
+    const cs_detail* detail = insn->detail;
+
+    switch (arch) {
+        case CS_ARCH_X86:
+            return insn->id == X86_INS_JMP || insn->id == X86_INS_LJMP;
+
+        case CS_ARCH_ARM:
+            return (insn->id == ARM_INS_B || insn->id == ARM_INS_BX) &&
+                   (detail->arm.cc == ARM_CC_AL || detail->arm.cc == ARM_CC_INVALID);
+
+        case CS_ARCH_ARM64:
+            if (insn->id == ARM64_INS_BR) {
+                return true;
+            }
+
+            return insn->id == ARM64_INS_B && (detail->arm64.cc == ARM64_CC_AL || detail->arm64.cc == ARM64_CC_INVALID);
+
+        case CS_ARCH_MIPS:
+            return insn->id == MIPS_INS_J || insn->id == MIPS_INS_JR || insn->id == MIPS_INS_B;
+
+        case CS_ARCH_PPC:
+            return insn->id == PPC_INS_B || insn->id == PPC_INS_BA || insn->id == PPC_INS_BCTR;
+
+        case CS_ARCH_RISCV:
+            // j and jr are jal/jalr that don't save the return address
+            if (insn->id == RISCV_INS_C_J || insn->id == RISCV_INS_C_JR) {
+                return true;
+            }
+
+            return (insn->id == RISCV_INS_JAL || insn->id == RISCV_INS_JALR) && detail->riscv.op_count > 0 &&
+                   detail->riscv.operands[0].type == RISCV_OP_REG && detail->riscv.operands[0].reg == RISCV_REG_ZERO;
+
+        case CS_ARCH_M68K:
+            return insn->id == M68K_INS_BRA || insn->id == M68K_INS_JMP;
+
+        case CS_ARCH_MOS65XX:
+            return insn->id == MOS65XX_INS_JMP || insn->id == MOS65XX_INS_BRA;
+
+        default:
+            return false;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void DisassemblyEngine::target_info_received(const IBackendRequests::TargetInfo& info) {
+    if (!m_manual_target && !open_target(info.arch, info.mode, info.address_width)) {
+        return;
+    }
+
+    set_build_id(info.build_id);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void DisassemblyEngine::program_counter_changed(const IBackendRequests::ProgramCounterChange& pc) {
+    m_index->add_entry(pc.pc);
+
+    // Backends may not know the target until it has been loaded so keep asking until they do
+    if (!m_handle && m_interface) {
+        m_interface->request_target_info();
+        return;
+    }
+
+    // Code may have been changed while the target was running. The memory cache has dropped its pages so views decode
+    // again from the memory of this stop (instructions are still found in the cache if the pages are the same)
+    instructions_updated();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void DisassemblyEngine::pages_updated() {
+    if (m_waiting) {
+        m_waiting = false;
+        instructions_updated();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void DisassemblyEngine::memory_written(uint64_t address, uint64_t size) {
+    // The hash of the written pages has changed so the old entries would never be found again anyway
+    m_code->remove(address, size);
+    m_index->remove(address, size);
+    instructions_updated();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void DisassemblyEngine::session_ended() {
+    save_cache();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
@@ -0,0 +1,213 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <QtCore/QByteArray>
+#include <QtCore/QObject>
+#include <QtCore/QPointer>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+#include <QtCore/QVector>
+#include "Backend/IBackendRequests.h"
+#include "MemoryView/MemorySpan.h"
+#include "RegisterSet.h"
+
+struct PDCapstoneFuncs;
+
+namespace prodbg {
+
+class DisassemblyCache;
+class InstructionIndex;
+class MemoryCache;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Disassembles target code on the host with the Capstone service shared by all code views of a session.
+//
+// The backend only declares the architecture of the target (see IBackendRequests::request_target_info) and serves
+// memory. Code bytes are read from the MemoryCache of the session so pages are shared with the memory views and only
+// fetched once. If some of the bytes aren't cached yet decode returns what it could decode before them and
+// instructions_updated is sent when the pages have arrived.
+//
+// Decoded instructions are kept in a DisassemblyCache by address and the hash of the code page they are in, so they
+// are reused by all views and at later stops for as long as the code bytes stay the same. Pages written with
+// MemoryCache::write are dropped right away. If a cache directory is set (see set_cache_directory) the cache is saved
+// per build id of the binary when the session ends and loaded again when the backend reports the same build id.
+//
+// Instruction boundaries found by decoding from known starts are kept in an InstructionIndex so decode_before can go
+// backwards on ISAs with variable instruction sizes.
+
+class DisassemblyEngine : public QObject {
+    Q_OBJECT
+
+   public:
+    enum InstructionFlags {
+        Jump = 1 << 0,
+        Call = 1 << 1,
+        Return = 1 << 2,
+        Interrupt = 1 << 3,
+        // target is the address of a direct jump, call or branch
+        HasTarget = 1 << 4,
+        // The bytes couldn't be decoded (shown as data)
+        Invalid = 1 << 5,
+        // The memory isn't readable on the target
+        Unreadable = 1 << 6,
+        // Jump that never falls through to the next instruction
+        Unconditional = 1 << 7,
+        // read_registers and write_registers have been filled in (see set_register_access)
+        HasRegisters = 1 << 8,
+    };
+
+    struct Instruction {
+        uint64_t address;
+        uint64_t target;
+        // Number of bytes the instruction covers. bytes is empty for Unreadable instructions
+        uint32_t size;
+        QByteArray bytes;
+        QString mnemonic;
+        QString operands;
+        uint32_t flags;
+        // Registers the instruction reads and writes, implicit ones (such as flags and the stack pointer) included.
+        // The bits are from the register table of the DisassemblyCache (see register_names)
+        RegisterSet read_registers;
+        RegisterSet write_registers;
+    };
+
+    explicit DisassemblyEngine(IBackendRequests* interface);
+    ~DisassemblyEngine();
+
+    // Engine shared by all views for the interface. Created on first use and owned by the interface
+    static DisassemblyEngine* for_interface(IBackendRequests* interface);
+
+    // Sets the Capstone arch and mode to decode with. This is normally declared by the backend but can be set by hand
+    // for backends that don't. Returns false if the Capstone service doesn't support it.
+    bool set_target(int arch, int mode, int address_width = 0);
+
+    bool has_target() const { return m_handle != 0; }
+    int arch() const { return m_arch; }
+    int mode() const { return m_mode; }
+
+    // Number of bytes used for an address on the target (from the backend or the memory cache, 0 if not known)
+    int address_width() const;
+
+    // Smallest and largest instruction size for the arch. All instructions are aligned to the smallest one
+    int min_instruction_size() const { return m_min_size; }
+    int max_instruction_size() const { return m_max_size; }
+
+    // Decodes count instructions starting at address into out. Returns true if all of them could be decoded. If bytes
+    // needed aren't cached yet out has the instructions before them, the pages are requested and
+    // instructions_updated is sent once they have arrived. Memory that isn't readable on the target is returned as
+    // Unreadable instructions of min_instruction_size bytes.
+    bool decode(uint64_t address, int count, QVector<Instruction>* out);
+
+    // Decodes the count instructions right before address (the last one ends at address) into out in address order.
+    // Boundaries come from the instruction index, sweeping from the closest entry point before address if needed.
+    // Where none are known the instructions are found by decoding from further back until they line up with address,
+    // which is right for most code. out has fewer instructions at the start of memory. Returns false if memory is
+    // needed (instructions_updated is sent when it has arrived).
+    bool decode_before(uint64_t address, int count, QVector<Instruction>* out);
+
+    // Start of the known instruction that covers address, or address aligned to the min instruction size if there is
+    // none
+    uint64_t instruction_start(uint64_t address) const;
+
+    // Adds known instruction starts such as symbols and function starts. The pc and the targets of branches are added
+    // as they are found
+    void add_entry_points(const QVector<uint64_t>& addresses);
+
+    InstructionIndex* index() const { return m_index; }
+
+    // Views that show which registers instructions use turn this on while they need it. It costs a regs_access call
+    // for each decoded instruction so it's only on while some view has it on. Cached instructions without registers
+    // are decoded again (and instructions_updated is sent when it's turned on)
+    void set_register_access(bool enabled);
+    bool register_access() const { return m_register_users > 0; }
+
+    // Capstone names of the registers in a set from an instruction decoded by the engine
+    QStringList register_names(const RegisterSet& registers) const;
+
+    // Drops all decoded instructions
+    void invalidate();
+
+    // Directory the decoded instructions are saved in (one file per build id). Empty disables saving. The default is
+    // the Disassembly directory in the cache location if the "Disassembly/persistentCache" setting is on.
+    void set_cache_directory(const QString& path);
+    QString cache_directory() const { return m_cache_directory; }
+
+    // Writes the decoded instructions to the cache directory (if set and the backend has reported a build id)
+    bool save_cache() const;
+
+    DisassemblyCache* cache() const { return m_code; }
+
+    // Flags (and the target of direct branches) of a cs_insn decoded with details for arch. Doesn't use the engine so
+    // it can be called from other threads
+    static uint32_t instruction_flags(int arch, const void* insn, uint64_t* target);
+
+    // Sent when the target arch has been set (or changed)
+    Q_SIGNAL void target_changed();
+
+    // Sent when memory that decode was waiting for has arrived, the target has stopped or memory has been written
+    // (views should decode again)
+    Q_SIGNAL void instructions_updated();
+
+   private:
+    enum {
+        // Max distance from an entry point that is swept to find the instructions before an address
+        MaxSweepBytes = 64 * 1024,
+        // Extra instructions decoded before the wanted ones when guessing instructions before an address
+        ResyncInstructions = 8,
+    };
+
+    Q_SLOT void target_info_received(const IBackendRequests::TargetInfo& info);
+    Q_SLOT void program_counter_changed(const IBackendRequests::ProgramCounterChange& pc);
+    Q_SLOT void pages_updated();
+    Q_SLOT void memory_written(uint64_t address, uint64_t size);
+    Q_SLOT void session_ended();
+
+    bool open_target(int arch, int mode, int address_width);
+    void close();
+    void set_build_id(const QString& build_id);
+    QString cache_filename() const;
+    const Instruction* find_cached(uint64_t address);
+    void insert(const Instruction& inst);
+    bool decode_from(uint64_t address, int count, QVector<Instruction>* out, bool trusted);
+    bool record(const Instruction& inst);
+    void read_register_access(const void* insn, Instruction* inst);
+    bool known_start(uint64_t address) const;
+    bool known_previous(uint64_t address, uint64_t* start) const;
+    int walk_back(uint64_t* start, int count) const;
+    bool sweep_to(uint64_t address);
+    bool guess_before(uint64_t address, int count, QVector<Instruction>* out);
+    static bool branch_target(int arch, const void* insn, uint64_t* target);
+    static bool is_unconditional(int arch, const void* insn);
+
+    QPointer<IBackendRequests> m_interface;
+    MemoryCache* m_cache = nullptr;
+    PDCapstoneFuncs* m_capstone = nullptr;
+
+    // csh of the open Capstone instance (0 if none)
+    size_t m_handle = 0;
+    int m_arch = -1;
+    int m_mode = 0;
+    int m_address_width = 0;
+    int m_min_size = 1;
+    int m_max_size = 16;
+
+    // True if the target was set by hand so the backend isn't asked about it
+    bool m_manual_target = false;
+
+    // Set when decode had to wait for memory
+    bool m_waiting = false;
+
+    // Number of views that have turned on register access
+    int m_register_users = 0;
+
+    DisassemblyCache* m_code = nullptr;
+    InstructionIndex* m_index = nullptr;
+    QVector<Instruction> m_sweep;
+    QString m_cache_directory;
+    QString m_build_id;
+    MemorySpan m_span;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
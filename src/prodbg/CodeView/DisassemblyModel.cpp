@@ -0,0 +1,202 @@
+#include "DisassemblyModel.h"
+
+namespace prodbg {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+DisassemblyModel::DisassemblyModel(QObject* parent) : QObject(parent) {}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void DisassemblyModel::set_engine(DisassemblyEngine* engine) {
+    if (m_engine) {
+        disconnect(m_engine, nullptr, this, nullptr);
+    }
+
+    m_engine = engine;
+    m_rows.resize(0);
+
+    if (m_engine) {
+        connect(m_engine, &DisassemblyEngine::instructions_updated, this, &DisassemblyModel::instructions_updated);
+        connect(m_engine, &DisassemblyEngine::target_changed, this, &DisassemblyModel::instructions_updated);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void DisassemblyModel::set_anchor(uint64_t address) {
+    m_anchor = address;
+    m_rows.resize(0);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void DisassemblyModel::reset() {
+    m_rows.resize(0);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void DisassemblyModel::instructions_updated() {
+    reset();
+    rows_changed();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Last address on the target
+
+uint64_t DisassemblyModel::address_mask() const {
+    const int width = m_engine ? m_engine->address_width() : 0;
+
+    if (width <= 0 || width >= 8) {
+        return ~uint64_t(0);
+    }
+
+    return (uint64_t(1) << (width * 8)) - 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const DisassemblyModel::Instruction* DisassemblyModel::row(int index) const {
+    const int i = m_anchor_row + index;
+
+    if (m_rows.isEmpty() || i < 0 || i >= m_rows.size()) {
+        return nullptr;
+    }
+
+    return &m_rows.at(i);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool DisassemblyModel::fetch(int first, int count) {
+    if (!m_engine || !m_engine->has_target() || count <= 0) {
+        return false;
+    }
+
+    count = qMin(count, int(MaxRows));
+
+    bool complete = true;
+
+    if (m_rows.isEmpty()) {
+        complete = m_engine->decode(m_anchor, qMax(first + count, 1), &m_decoded);
+        m_anchor_row = 0;
+        append_decoded(m_anchor);
+
+        if (m_rows.isEmpty()) {
+            return false;
+        }
+    }
+
+    const int after = first + count - (m_rows.size() - m_anchor_row);
+
+    if (after > 0 && !fetch_after(after)) {
+        complete = false;
+    }
+
+    const int before = -first - m_anchor_row;
+
+    if (before > 0 && !fetch_before(before)) {
+        complete = false;
+    }
+
+    trim(first, count);
+
+    return complete;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool DisassemblyModel::fetch_after(int count) {
+    const Instruction& last = m_rows.last();
+    const uint64_t next = last.address + last.size;
+
+    // The last row is at the end of the address space
+    if (next < last.address || next > address_mask()) {
+        return true;
+    }
+
+    const bool complete = m_engine->decode(next, count, &m_decoded);
+    append_decoded(next);
+
+    return complete;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Adds the decoded instructions that were decoded from start to the rows. Decoding doesn't stop at the end of the
+// address space so the ones that have wrapped around are skipped
+
+void DisassemblyModel::append_decoded(uint64_t start) {
+    const uint64_t mask = address_mask();
+
+    for (const Instruction& inst : m_decoded) {
+        if (inst.address < start || inst.address > mask) {
+            break;
+        }
+
+        m_rows.append(inst);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool DisassemblyModel::fetch_before(int count) {
+    const uint64_t first = m_rows.first().address;
+
+    if (first == 0) {
+        return true;
+    }
+
+    QVector<Instruction> rows;
+    const bool complete = m_engine->decode_before(first, count, &rows);
+
+    m_anchor_row += rows.size();
+    rows += m_rows;
+    m_rows.swap(rows);
+
+    return complete;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int DisassemblyModel::move(int count) {
+    if (count == 0) {
+        return 0;
+    }
+
+    if (count > 0) {
+        fetch(0, count + 1);
+    } else {
+        fetch(count, 1 - count);
+    }
+
+    if (m_rows.isEmpty() || m_anchor_row < 0 || m_anchor_row >= m_rows.size()) {
+        return 0;
+    }
+
+    const int moved = qBound(0, m_anchor_row + count, m_rows.size() - 1) - m_anchor_row;
+
+    m_anchor_row += moved;
+    m_anchor = m_rows[m_anchor_row].address;
+
+    return moved;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Keeps MaxRows rows centered on the rows that were fetched last
+
+void DisassemblyModel::trim(int first, int count) {
+    if (m_rows.size() <= MaxRows) {
+        return;
+    }
+
+    const int margin = (MaxRows - count) / 2;
+    const int end = qMin(m_rows.size(), qMax(0, m_anchor_row + first - margin) + int(MaxRows));
+    const int start = qMax(0, end - int(MaxRows));
+
+    m_rows = m_rows.mid(start, end - start);
+    m_anchor_row -= start;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
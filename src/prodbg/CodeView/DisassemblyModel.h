@@ -0,0 +1,82 @@
+#pragma once
+
+#include <stdint.h>
+#include <QtCore/QObject>
+#include <QtCore/QPointer>
+#include <QtCore/QVector>
+#include "DisassemblyEngine.h"
+
+namespace prodbg {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Rows of instructions around an anchor address for the code views.
+//
+// Rows are numbered relative to the anchor (row 0 is the instruction at the anchor and negative rows are before it)
+// so a view only ever asks for the rows it shows and nothing depends on how much code has been decoded. The model
+// keeps a window of at most MaxRows decoded rows that follows the anchor around. Rows are decoded on demand by fetch
+// with the DisassemblyEngine of the session (which keeps the decoded instructions) so moving back to code that has
+// been shown before is only a cache lookup. Rows above the window come from DisassemblyEngine::decode_before so they
+// line up with the instruction boundaries known by all views.
+//
+// The window is dropped when the engine has new instructions (memory has arrived, the target has stopped or memory
+// was written) and rows_changed is sent so views fetch again.
+
+class DisassemblyModel : public QObject {
+    Q_OBJECT
+
+   public:
+    typedef DisassemblyEngine::Instruction Instruction;
+
+    enum {
+        // Max number of decoded rows kept around the anchor
+        MaxRows = 1024,
+    };
+
+    explicit DisassemblyModel(QObject* parent = nullptr);
+
+    void set_engine(DisassemblyEngine* engine);
+    DisassemblyEngine* engine() const { return m_engine; }
+
+    // Moves the anchor to address (which is expected to be the start of an instruction) and drops the window
+    void set_anchor(uint64_t address);
+    uint64_t anchor() const { return m_anchor; }
+
+    // Decodes the rows [first, first + count) if they aren't in the window already. Returns false if some of them
+    // are waiting for memory (rows_changed is sent when it has arrived). Rows past the ends of the address space
+    // don't exist and are not waited for.
+    bool fetch(int first, int count);
+
+    // Row relative to the anchor or null if it hasn't been fetched
+    const Instruction* row(int index) const;
+
+    // Moves the anchor by count rows (negative moves up). Rows are fetched as needed and the return value is the
+    // number of rows actually moved, which is less than count if the rows are still being fetched
+    int move(int count);
+
+    // Drops the window (the anchor stays) so rows are decoded again on the next fetch
+    void reset();
+
+    // Sent when rows that were fetched before may have changed
+    Q_SIGNAL void rows_changed();
+
+   private:
+    Q_SLOT void instructions_updated();
+
+    bool fetch_before(int count);
+    bool fetch_after(int count);
+    void append_decoded(uint64_t start);
+    uint64_t address_mask() const;
+    void trim(int first, int count);
+
+    QPointer<DisassemblyEngine> m_engine;
+    uint64_t m_anchor = 0;
+
+    // Decoded rows in address order and the index of the anchor row in them (only valid if m_rows isn't empty)
+    QVector<Instruction> m_rows;
+    int m_anchor_row = 0;
+
+    QVector<Instruction> m_decoded;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
@@ -1,322 +1,905 @@
 #include "DisassemblyView.h"
+#include "BreakpointModel.h"
+#include "CodeAnalyzer.h"
+#include "Core/ScrollPrefetcher.h"
+#include "Core/SymbolIndex.h"
+#include "DisassemblyEngine.h"
+#include "DisassemblyModel.h"
+#include "MemoryView/GlyphAtlas.h"
+#include "MemoryView/MemoryCache.h"
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QPointer>
+#include <QtGui/QMouseEvent>
+#include <QtGui/QPaintEvent>
 #include <QtGui/QPainter>
-#include <QtGui/QTextBlock>
+#include <QtWidgets/QAction>
 #include <QtWidgets/QApplication>
-#include "BreakpointModel.h"
-#include <inttypes.h>
+#include <QtWidgets/QMenu>
+#include <QtWidgets/QScrollBar>
 
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <algorithm>
 
 namespace prodbg {
 
-#if 0
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static const char s_HexTable[] = "0123456789abcdef";
+
+enum {
+    // Chars left of the address for the breakpoint and pc markers
+    kGutterChars = 3,
+    // Max number of instruction bytes shown (longer instructions end with a '+')
+    kMaxBytesShown = 8,
+    // Width of the mnemonic column
+    kMnemonicChars = 8,
+    // Steps of the scroll bar over the whole address space
+    kScrollBarBits = 16,
+    // Number of locations goBack can return to
+    kMaxHistory = 64,
+};
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-// TODO: This is currently duplicated in CodeView/Disassembly view. Fix!
+// Rows are painted straight from the model. Each visible row is formatted into a line of fixed width chars when it's
+// painted and drawn with the glyph atlas, so the cost of a repaint only depends on the number of visible rows. Line
+// scrolling moves the pixels with QWidget::scroll so only the new rows are drawn.
 
-class AddressArea : public QWidget {
+class DisassemblyViewPrivate {
    public:
-    AddressArea(DisassemblyView* view) : QWidget(view), m_disassemblyView(view) {}
+    QPointer<IBackendRequests> m_Interface;
+    QPointer<DisassemblyEngine> m_Engine;
+    QPointer<MemoryCache> m_Cache;
+    QPointer<BreakpointModel> m_Breakpoints;
+    QPointer<CodeAnalyzer> m_Analyzer;
+    QPointer<SymbolIndex> m_Symbols;
+
+    // Symbols used for the repaint in progress
+    QSharedPointer<const SymbolTable> m_SymbolTable;
+
+    DisassemblyModel* m_Model = nullptr;
+    QScrollBar* m_ScrollBar = nullptr;
+
+    uint64_t m_Pc = 0;
+    bool m_HasPc = false;
+    uint64_t m_Selected = 0;
+    bool m_HasSelection = false;
+
+    int m_WheelSpeedRows = 3;
+    // Wheel movement that hasn't added up to a whole row yet
+    int m_WheelPixels = 0;
+    // Rows left to scroll that were waiting for memory when the scroll was done
+    int m_PendingRows = 0;
+
+    // Top of the view before each navigation (for goBack)
+    QVector<uint64_t> m_History;
+
+    // Function whose callers goToNextCaller steps through and the caller it went to last
+    uint64_t m_CallerTarget = 0;
+    uint64_t m_LastCaller = 0;
+    int m_CallerIndex = -1;
+
+    // Register use of the current instruction is highlighted (see setHighlightRegisters)
+    bool m_HighlightRegisters = false;
+    uint64_t m_FocusAddress = 0;
+    RegisterSet m_FocusReads;
+    RegisterSet m_FocusWrites;
+    QByteArray m_RegisterNote;
+    QVector<DisassemblyEngine::Instruction> m_Focus;
+
+    // Fetches code ahead of the viewport in the scroll direction
+    ScrollPrefetcher m_prefetcher{MemoryCache::PageSize, 8};
+    QElapsedTimer m_scrollTimer;
+
+    GlyphAtlas m_Glyphs;
+    int m_CharWidth = 1;
+    int m_RowHeight = 1;
+    int m_Rows = 0;
+
+    // Top and the range of addresses on screen at the last repaint
+    bool m_Painted = false;
+    uint64_t m_PaintedTop = 0;
+    uint64_t m_PaintedStart = 0;
+    uint64_t m_PaintedEnd = 0;
+
+    QByteArray m_Line;
+    QVector<uint64_t> m_BreakpointAddresses;
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int addressWidth() const {
+        const int width = m_Engine ? m_Engine->address_width() : 0;
+        return width > 0 ? width : 8;
+    }
+
+    int bytesShown() const {
+        return std::min(m_Engine ? m_Engine->max_instruction_size() : 4, int(kMaxBytesShown));
+    }
 
-    QSize sizeHint() const { return QSize(m_disassemblyView->lineNumberAreaWidth(), 0); }
+    // Area the rows are painted in (everything except the scroll bar)
+    QRect textRect(QWidget* widget) const {
+        return QRect(0, 0, std::max(0, widget->width() - m_ScrollBar->width()), widget->height());
+    }
 
-   protected:
-    void paintEvent(QPaintEvent* event) { m_disassemblyView->lineNumberAreaPaintEvent(event); }
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-   private:
-    DisassemblyView* m_disassemblyView;
-};
+    void updateLayout(QWidget* widget) {
+        m_Glyphs.update(widget->font(), widget->palette().color(QPalette::WindowText), widget->devicePixelRatioF());
 
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        m_CharWidth = std::max(1, m_Glyphs.char_width());
+        m_RowHeight = std::max(1, m_Glyphs.row_height());
+        m_Rows = (widget->height() + m_RowHeight - 1) / m_RowHeight;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // The scroll bar maps to the whole address space with the top bits of the address
+
+    int scrollShift() const { return std::max(0, addressWidth() * 8 - int(kScrollBarBits)); }
+
+    void syncScrollBar() {
+        const int shift = scrollShift();
+        const uint64_t last = addressWidth() >= 8 ? ~uint64_t(0) : (uint64_t(1) << (addressWidth() * 8)) - 1;
+
+        m_ScrollBar->setRange(0, int(last >> shift));
+        m_ScrollBar->setValue(int(m_Model->anchor() >> shift));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void jumpTo(uint64_t address) {
+        m_Model->set_anchor(address);
+        m_PendingRows = 0;
+        m_prefetcher.reset(address);
+        syncScrollBar();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Scrolls by rowCount rows. Rows that are still being fetched are scrolled when they arrive. If the rows are on
+    // screen already the ones that stay visible are moved instead of being painted again
+
+    void scrollRows(QWidget* widget, int rowCount) {
+        const bool moveRows = m_Painted && m_PaintedTop == m_Model->anchor();
+        const int moved = m_Model->move(rowCount);
+
+        m_PendingRows = rowCount - moved;
+
+        if (moved == 0) {
+            return;
+        }
+
+        m_prefetcher.scrolled(m_Model->anchor(), m_scrollTimer.elapsed());
+        syncScrollBar();
+
+        if (moveRows && abs(moved) < m_Rows) {
+            widget->scroll(0, -moved * m_RowHeight, textRect(widget));
+            m_PaintedTop = m_Model->anchor();
+        } else {
+            widget->update();
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Shows address with a few rows of the code before it unless it was on screen already
+
+    void showAddress(QWidget* widget, uint64_t address) {
+        if (m_Painted && address >= m_PaintedStart && address < m_PaintedEnd) {
+            widget->update();
+            return;
+        }
+
+        jumpTo(address);
+
+        const int context = -(m_Rows / 4);
+        m_PendingRows = context - m_Model->move(context);
+
+        syncScrollBar();
+        widget->update();
+    }
+
+    void showPc(QWidget* widget) { showAddress(widget, m_Pc); }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Selects address and shows it. Where the view was is kept so goBack can return to it
+
+    void navigateTo(QWidget* widget, uint64_t address) {
+        if (m_History.size() >= kMaxHistory) {
+            m_History.removeFirst();
+        }
+
+        m_History.append(m_Model->anchor());
+        m_Selected = address;
+        m_HasSelection = true;
+        showAddress(widget, address);
+    }
+
+    // Instruction the navigation actions start from
+    uint64_t currentAddress() const {
+        if (m_HasSelection) {
+            return m_Selected;
+        }
+
+        return m_HasPc ? m_Pc : m_Model->anchor();
+    }
+
+    // Target of the jump/call at address from the code analysis or by decoding it
+    bool branchTarget(uint64_t address, uint64_t* target) {
+        if (m_Analyzer && m_Analyzer->target_of(address, target)) {
+            return true;
+        }
+
+        if (!m_Engine) {
+            return false;
+        }
+
+        QVector<DisassemblyEngine::Instruction> insts;
+
+        if (!m_Engine->decode(address, 1, &insts) || !(insts.first().flags & DisassemblyEngine::HasTarget)) {
+            return false;
+        }
+
+        *target = insts.first().target;
+
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void formatRow(const DisassemblyEngine::Instruction& inst) {
+        const int width = addressWidth();
+        const int bytesShown = this->bytesShown();
+        const QByteArray mnemonic = inst.mnemonic.toLatin1();
+        const QByteArray operands = inst.operands.toLatin1();
+
+        m_Line.resize(0);
+        m_Line.append(kGutterChars, ' ');
+
+        for (int i = width * 2 - 1; i >= 0; --i) {
+            m_Line.append(s_HexTable[(inst.address >> (i * 4)) & 0xf]);
+        }
+
+        m_Line.append("  ");
+
+        const int byteCount = std::min(inst.bytes.size(), bytesShown);
+
+        for (int i = 0; i < byteCount; ++i) {
+            m_Line.append(s_HexTable[uint8_t(inst.bytes[i]) >> 4]);
+            m_Line.append(s_HexTable[uint8_t(inst.bytes[i]) & 0xf]);
+        }
+
+        m_Line.append(inst.bytes.size() > bytesShown ? '+' : ' ');
+        m_Line.append((bytesShown - byteCount) * 2 + 1, ' ');
+
+        m_Line.append(mnemonic);
+        m_Line.append(std::max(1, kMnemonicChars - mnemonic.size()), ' ');
+        m_Line.append(operands);
+
+        appendSymbols(inst);
+
+        if (!m_RegisterNote.isEmpty() && inst.address == m_FocusAddress) {
+            m_Line.append(m_RegisterNote);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Jump and call targets get the symbol they go to ("jsr $1234 <main+0x10>"). Rows where a symbol starts and the
+    // pc row get a comment with the symbol they are in
+
+    void appendSymbols(const DisassemblyEngine::Instruction& inst) {
+        if (!m_SymbolTable || m_SymbolTable->size() == 0) {
+            return;
+        }
+
+        if (inst.flags & DisassemblyEngine::HasTarget) {
+            const int start = m_Line.size();
+            m_Line.append(" <");
+
+            if (m_SymbolTable->describe(inst.target, &m_Line)) {
+                m_Line.append('>');
+            } else {
+                m_Line.resize(start);
+            }
+        }
+
+        const int index = m_SymbolTable->lookup(inst.address);
+
+        if (index < 0 || (m_SymbolTable->at(index).address != inst.address && !(m_HasPc && inst.address == m_Pc))) {
+            return;
+        }
+
+        m_Line.append("  ; ");
+        m_SymbolTable->describe(inst.address, &m_Line);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Registers of the current instruction for highlighting register use. It's decoded on its own so rows scrolled
+    // into view are highlighted the same way while the instruction is off screen
+
+    void updateRegisterFocus() {
+        m_RegisterNote.resize(0);
+
+        if (!m_HighlightRegisters || !m_Engine || !(m_HasSelection || m_HasPc) ||
+            !m_Engine->decode(currentAddress(), 1, &m_Focus) ||
+            !(m_Focus.first().flags & DisassemblyEngine::HasRegisters)) {
+            m_FocusReads = RegisterSet();
+            m_FocusWrites = RegisterSet();
+            return;
+        }
+
+        const DisassemblyEngine::Instruction& focus = m_Focus.first();
+        const QStringList reads = m_Engine->register_names(focus.read_registers);
+        const QStringList writes = m_Engine->register_names(focus.write_registers);
+
+        m_FocusAddress = focus.address;
+        m_FocusReads = focus.read_registers;
+        m_FocusWrites = focus.write_registers;
+
+        if (!reads.isEmpty()) {
+            m_RegisterNote += "  ; reads " + reads.join(QStringLiteral(", ")).toLatin1();
+        }
+
+        if (!writes.isEmpty()) {
+            m_RegisterNote += m_RegisterNote.isEmpty() ? "  ; writes " : "; writes ";
+            m_RegisterNote += writes.join(QStringLiteral(", ")).toLatin1();
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Rows from one page above to one page below the view are fetched so page and line scrolling is ready
+
+    void fetch() {
+        m_Model->fetch(-m_Rows, m_Rows * 3);
+
+        const DisassemblyEngine::Instruction* first = m_Model->row(0);
+
+        m_Painted = true;
+        m_PaintedTop = m_Model->anchor();
+        m_PaintedStart = first ? first->address : m_Model->anchor();
+        m_PaintedEnd = m_PaintedStart;
+
+        for (int row = m_Rows - 1; row >= 0; --row) {
+            if (const DisassemblyEngine::Instruction* last = m_Model->row(row)) {
+                m_PaintedEnd = last->address + last->size;
+                break;
+            }
+        }
+
+        uint64_t prefetchStart = 0;
+        uint64_t prefetchSize = 0;
+
+        if (m_Cache && m_PaintedEnd > m_PaintedStart &&
+            m_prefetcher.prefetch_range(m_PaintedStart, m_PaintedEnd - m_PaintedStart, m_scrollTimer.elapsed(),
+                                        &prefetchStart, &prefetchSize)) {
+            m_Cache->prefetch(prefetchStart, prefetchSize);
+        }
+
+        m_BreakpointAddresses.resize(0);
+
+        if (m_Breakpoints && m_PaintedEnd > m_PaintedStart) {
+            m_Breakpoints->get_addresses_in_range(m_PaintedStart, m_PaintedEnd - 1, &m_BreakpointAddresses);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void paintEvent(QWidget* widget, QPaintEvent* ev) {
+        const QPalette& palette = QApplication::palette();
+        const QColor baseColor = palette.base().color();
+        QColor pcColor = palette.highlight().color();
+        QColor selectedColor = palette.alternateBase().color();
+        QColor writesReadColor = QColor(0, 160, 0);
+        QColor readsWrittenColor = QColor(220, 120, 0);
+        pcColor.setAlpha(96);
+        writesReadColor.setAlpha(48);
+        readsWrittenColor.setAlpha(48);
+
+        updateLayout(widget);
+        fetch();
+        updateRegisterFocus();
+
+        if (m_Symbols) {
+            m_SymbolTable = m_Symbols->table();
+        }
+
+        QPainter painter(widget);
+        painter.setRenderHint(QPainter::Antialiasing);
+
+        const QRect area = textRect(widget);
+        const int gutterWidth = kGutterChars * m_CharWidth;
+
+        for (const QRect& dirty : ev->region()) {
+            const QRect rect = dirty.intersected(area);
+
+            if (rect.isEmpty()) {
+                continue;
+            }
+
+            painter.fillRect(rect, baseColor);
+
+            const int firstRow = std::max(0, rect.top() / m_RowHeight);
+            const int lastRow = std::min(m_Rows - 1, rect.bottom() / m_RowHeight);
+            const int firstColumn = std::max(0, rect.left() / m_CharWidth);
+            const int lastColumn = rect.right() / m_CharWidth;
+
+            for (int row = firstRow; row <= lastRow; ++row) {
+                const DisassemblyEngine::Instruction* inst = m_Model->row(row);
+
+                if (!inst) {
+                    continue;
+                }
+
+                const int y = row * m_RowHeight;
+                const bool isPc = m_HasPc && inst->address == m_Pc;
+
+                if (isPc) {
+                    painter.fillRect(rect.left(), y, rect.width(), m_RowHeight, pcColor);
+                } else if (m_HasSelection && inst->address == m_Selected) {
+                    painter.fillRect(rect.left(), y, rect.width(), m_RowHeight, selectedColor);
+                } else if (inst->write_registers.intersects(m_FocusReads)) {
+                    painter.fillRect(rect.left(), y, rect.width(), m_RowHeight, writesReadColor);
+                } else if (inst->read_registers.intersects(m_FocusWrites)) {
+                    painter.fillRect(rect.left(), y, rect.width(), m_RowHeight, readsWrittenColor);
+                }
+
+                if (rect.left() < gutterWidth) {
+                    paintMarkers(&painter, *inst, y, isPc);
+                }
+
+                formatRow(*inst);
+
+                if (firstColumn < m_Line.size()) {
+                    const int count = std::min(lastColumn + 1, m_Line.size()) - firstColumn;
+                    m_Glyphs.draw(&painter, firstColumn * m_CharWidth, y, m_Line.constData() + firstColumn, count);
+                }
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-DisassemblyView::DisassemblyView(QWidget* parent) : QPlainTextEdit(parent), m_addressArea(nullptr) {
-    setReadOnly(true);
-    setTextInteractionFlags(Qt::TextSelectableByMouse | Qt::TextSelectableByKeyboard);
-    setLineWrapMode(QPlainTextEdit::NoWrap);
+    void paintMarkers(QPainter* painter, const DisassemblyEngine::Instruction& inst, int y, bool isPc) const {
+        const int size = std::min(m_CharWidth, m_RowHeight) - 2;
+        const int top = y + (m_RowHeight - size) / 2;
 
-    m_addressArea = new AddressArea(this);
+        if (std::binary_search(m_BreakpointAddresses.begin(), m_BreakpointAddresses.end(), inst.address)) {
+            painter->setPen(Qt::NoPen);
+            painter->setBrush(QColor(Qt::red));
+            painter->drawEllipse(1, top, size, size);
+        }
+
+        if (isPc) {
+            const int x = m_CharWidth + 1;
+            const QPoint arrow[3] = {QPoint(x, top), QPoint(x + size, top + size / 2), QPoint(x, top + size)};
+
+            painter->setPen(Qt::NoPen);
+            painter->setBrush(QColor(Qt::yellow));
+            painter->drawPolygon(arrow, 3);
+        }
+    }
+};
 
-    updateAddressAreaWidth(0);
-    highlightCurrentLine();
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+DisassemblyView::DisassemblyView(QWidget* parent) : Base(parent), m_Private(new DisassemblyViewPrivate) {
+    // Can be any fixed with font.
 #ifdef _WIN32
     QFont font(QStringLiteral("Courier"), 11);
 #else
     QFont font(QStringLiteral("Courier"), 13);
 #endif
 
-    connect(this, &QPlainTextEdit::blockCountChanged, this, &DisassemblyView::updateAddressAreaWidth);
-    connect(this, &QPlainTextEdit::updateRequest, this, &DisassemblyView::updateAddressArea);
-    connect(this, &QPlainTextEdit::cursorPositionChanged, this, &DisassemblyView::highlightCurrentLine);
-
+    font.setFixedPitch(true);
     setFont(font);
-}
 
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    setFocusPolicy(Qt::StrongFocus);
 
-DisassemblyView::~DisassemblyView() {}
+    // All of the widget is painted from the model so Qt doesn't need to clear the background first
+    setAttribute(Qt::WA_OpaquePaintEvent);
 
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    m_Private->m_scrollTimer.start();
 
-void DisassemblyView::updateAddressAreaWidth(int) {
-    setViewportMargins(lineNumberAreaWidth(), 0, 0, 0);
-}
+    m_Private->m_Model = new DisassemblyModel(this);
+    connect(m_Private->m_Model, &DisassemblyModel::rows_changed, this, &DisassemblyView::rowsChanged);
 
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    m_Private->m_ScrollBar = new QScrollBar(Qt::Vertical, this);
+    m_Private->m_ScrollBar->setSingleStep(1);
+    m_Private->m_ScrollBar->setPageStep(16);
+    m_Private->syncScrollBar();
+    connect(m_Private->m_ScrollBar, &QScrollBar::actionTriggered, this, &DisassemblyView::scrollBarAction);
 
-void DisassemblyView::updateAddressArea(const QRect& rect, int dy) {
-    if (dy) {
-        m_addressArea->scroll(0, dy);
-    } else {
-        m_addressArea->update(0, rect.y(), m_addressArea->width(), rect.height());
+    {
+        QAction* nextPageAction = new QAction(QStringLiteral("Next Page"), this);
+        nextPageAction->setShortcut(QKeySequence::MoveToNextPage);
+        nextPageAction->setShortcutContext(Qt::WidgetShortcut);
+        this->addAction(nextPageAction);
+        connect(nextPageAction, &QAction::triggered, this, &DisassemblyView::displayNextPage);
     }
 
-    if (rect.contains(viewport()->rect())) {
-        updateAddressAreaWidth(0);
+    {
+        QAction* prevPageAction = new QAction(QStringLiteral("Previous Page"), this);
+        prevPageAction->setShortcut(QKeySequence::MoveToPreviousPage);
+        prevPageAction->setShortcutContext(Qt::WidgetShortcut);
+        this->addAction(prevPageAction);
+        connect(prevPageAction, &QAction::triggered, this, &DisassemblyView::displayPrevPage);
     }
-}
 
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    {
+        QAction* nextLineAction = new QAction(QStringLiteral("Next Line"), this);
+        nextLineAction->setShortcut(QKeySequence::MoveToNextLine);
+        nextLineAction->setShortcutContext(Qt::WidgetShortcut);
+        this->addAction(nextLineAction);
+        connect(nextLineAction, &QAction::triggered, this, &DisassemblyView::displayNextLine);
+    }
 
-void DisassemblyView::highlightCurrentLine() {
-    QList<QTextEdit::ExtraSelection> extraSelections;
+    {
+        QAction* prevLineAction = new QAction(QStringLiteral("Previous Line"), this);
+        prevLineAction->setShortcut(QKeySequence::MoveToPreviousLine);
+        prevLineAction->setShortcutContext(Qt::WidgetShortcut);
+        this->addAction(prevLineAction);
+        connect(prevLineAction, &QAction::triggered, this, &DisassemblyView::displayPrevLine);
+    }
 
-    QTextEdit::ExtraSelection selection;
-    QTextCursor cursor = textCursor();
+    {
+        QAction* breakpointAction = new QAction(QStringLiteral("Toggle Breakpoint"), this);
+        breakpointAction->setShortcut(QKeySequence(Qt::Key_F9));
+        breakpointAction->setShortcutContext(Qt::WidgetShortcut);
+        this->addAction(breakpointAction);
+        connect(breakpointAction, &QAction::triggered, this, &DisassemblyView::toggleBreakpoint);
+    }
 
-    QString text = cursor.selectedText();
+    {
+        QAction* targetAction = new QAction(QStringLiteral("Go to Target"), this);
+        targetAction->setShortcut(QKeySequence(Qt::Key_Return));
+        targetAction->setShortcutContext(Qt::WidgetShortcut);
+        this->addAction(targetAction);
+        connect(targetAction, &QAction::triggered, this, &DisassemblyView::goToTarget);
+    }
 
-    QString string = cursor.block().text();
+    {
+        QAction* callerAction = new QAction(QStringLiteral("Go to Next Caller"), this);
+        callerAction->setShortcut(QKeySequence(Qt::Key_X));
+        callerAction->setShortcutContext(Qt::WidgetShortcut);
+        this->addAction(callerAction);
+        connect(callerAction, &QAction::triggered, this, &DisassemblyView::goToNextCaller);
+    }
 
-    QColor lineColor = QApplication::palette().highlight().color();
+    {
+        QAction* backAction = new QAction(QStringLiteral("Go Back"), this);
+        backAction->setShortcut(QKeySequence(Qt::Key_Backspace));
+        backAction->setShortcutContext(Qt::WidgetShortcut);
+        this->addAction(backAction);
+        connect(backAction, &QAction::triggered, this, &DisassemblyView::goBack);
+    }
 
-    selection.format.setBackground(lineColor);
-    selection.format.setProperty(QTextFormat::FullWidthSelection, true);
-    selection.cursor = cursor;
-    selection.cursor.clearSelection();
-    extraSelections.append(selection);
+    {
+        QAction* graphAction = new QAction(QStringLiteral("Open Function Graph"), this);
+        graphAction->setShortcut(QKeySequence(Qt::Key_G));
+        graphAction->setShortcutContext(Qt::WidgetShortcut);
+        this->addAction(graphAction);
+        connect(graphAction, &QAction::triggered, this,
+                [this]() { functionGraphRequested(m_Private->currentAddress()); });
+    }
 
-    setExtraSelections(extraSelections);
+    {
+        QAction* registersAction = new QAction(QStringLiteral("Highlight Register Use"), this);
+        registersAction->setCheckable(true);
+        this->addAction(registersAction);
+        connect(registersAction, &QAction::toggled, this, &DisassemblyView::setHighlightRegisters);
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-// TODO: Make this a bit more configurable and less hard-coded
 
-int DisassemblyView::lineNumberAreaWidth() {
-    // 20 + to give rom for breakpoint marker
+DisassemblyView::~DisassemblyView() {
+    setHighlightRegisters(false);
+    delete m_Private;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    int space = 20 + 3 + fontMetrics().horizontalAdvance(QLatin1Char('9')) * m_addressWidth * 2;
+void DisassemblyView::set_backend_interface(IBackendRequests* interface) {
+    if (m_Private->m_Interface) {
+        disconnect(m_Private->m_Interface, nullptr, this, nullptr);
+    }
 
-    return space;
+    if (m_Private->m_Symbols) {
+        disconnect(m_Private->m_Symbols, nullptr, this, nullptr);
+    }
+
+    // Register access is turned on in the engine of the session the view shows
+
+    if (m_Private->m_HighlightRegisters && m_Private->m_Engine) {
+        m_Private->m_Engine->set_register_access(false);
+    }
+
+    m_Private->m_Interface = interface;
+    m_Private->m_Engine = DisassemblyEngine::for_interface(interface);
+
+    if (m_Private->m_HighlightRegisters && m_Private->m_Engine) {
+        m_Private->m_Engine->set_register_access(true);
+    }
+
+    m_Private->m_Cache = MemoryCache::for_interface(interface);
+    m_Private->m_Analyzer = CodeAnalyzer::for_interface(interface);
+    m_Private->m_Symbols = SymbolIndex::for_interface(interface);
+    m_Private->m_SymbolTable.reset();
+    m_Private->m_Model->set_engine(m_Private->m_Engine);
+    m_Private->m_HasPc = false;
+    m_Private->m_Painted = false;
+    m_Private->m_History.clear();
+    m_Private->m_CallerIndex = -1;
+
+    if (interface) {
+        connect(interface, &IBackendRequests::program_counter_changed, this, &DisassemblyView::programCounterChanged);
+        connect(m_Private->m_Symbols, &SymbolIndex::symbols_changed, this, [this]() { update(); });
+    }
+
+    m_Private->syncScrollBar();
+    update();
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void DisassemblyView::resizeEvent(QResizeEvent* e) {
-    QPlainTextEdit::resizeEvent(e);
+void DisassemblyView::setBreakpointModel(BreakpointModel* breakpoints) {
+    if (m_Private->m_Breakpoints) {
+        disconnect(m_Private->m_Breakpoints, nullptr, this, nullptr);
+    }
+
+    m_Private->m_Breakpoints = breakpoints;
 
-    QRect cr = contentsRect();
-    m_addressArea->setGeometry(QRect(cr.left(), cr.top(), lineNumberAreaWidth(), cr.height()));
+    if (breakpoints) {
+        connect(breakpoints, &BreakpointModel::changed, this, [this]() { update(); });
+    }
+
+    update();
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void DisassemblyView::lineNumberAreaPaintEvent(QPaintEvent* event) {
-    QPalette pal = QApplication::palette();
+DisassemblyModel* DisassemblyView::model() const { return m_Private->m_Model; }
 
-#ifdef _WIN32
-    QFont font(QStringLiteral("Courier"), 11);
-#else
-    QFont font(QStringLiteral("Courier"), 13);
-#endif
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    QPainter painter(m_addressArea);
-    painter.fillRect(event->rect(), pal.alternateBase());
+void DisassemblyView::programCounterChanged(const IBackendRequests::ProgramCounterChange& pc) { updatePc(pc.pc); }
 
-    QTextBlock block = firstVisibleBlock();
-    int blockNumber = block.blockNumber();
-    int top = (int)blockBoundingGeometry(block).translated(contentOffset()).top();
-    int bottom = top + (int)blockBoundingRect(block).height();
-    int width = m_addressArea->width();
-    int height = fontMetrics().height();
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    const int addressCount = m_disassemblyAdresses.count();
+void DisassemblyView::updatePc(uint64_t pc) {
+    m_Private->m_Pc = pc;
+    m_Private->m_HasPc = true;
+    m_Private->showPc(this);
+}
 
-    int fontHeight = fontMetrics().height() - 2;
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    while (block.isValid() && top <= event->rect().bottom()) {
-        if (block.isVisible() && bottom >= event->rect().top()) {
-            QString number = QString::number(blockNumber + 1);
-            painter.setPen(pal.text().color());
+void DisassemblyView::toggleBreakpoint() {
+    if (!m_Private->m_Breakpoints) {
+        return;
+    }
 
-            if (blockNumber >= addressCount) {
-                return;
-            }
+    if (m_Private->m_HasSelection) {
+        m_Private->m_Breakpoints->toggle_address_breakpoint(m_Private->m_Selected);
+    } else if (m_Private->m_HasPc) {
+        m_Private->m_Breakpoints->toggle_address_breakpoint(m_Private->m_Pc);
+    }
+}
 
-            uint64_t address = m_disassemblyAdresses[blockNumber].address;
-            const QString& addressText = m_disassemblyAdresses[blockNumber].addressText;
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            painter.drawText(0, top, width, height, Qt::AlignRight, addressText);
+void DisassemblyView::setHighlightRegisters(bool highlight) {
+    if (highlight == m_Private->m_HighlightRegisters) {
+        return;
+    }
 
-            if (m_breakpoints->has_breakpoint_address(address)) {
-                painter.setBrush(Qt::red);
-                painter.drawEllipse(4, top, fontHeight, fontHeight);
-            }
+    m_Private->m_HighlightRegisters = highlight;
 
-            // Draw ugly arrow!
+    // Turning it on makes the engine send instructions_updated so the rows are decoded again with their registers
+    if (m_Private->m_Engine) {
+        m_Private->m_Engine->set_register_access(highlight);
+    }
 
-            if (m_disassemblyAdresses[blockNumber].address == m_currentPc) {
-                float scale = fontHeight / 2.0f;
-                float pos_x = 10.0f;
-                float pos_y = top + scale;
+    update();
+}
 
-                const QPointF points[7] = {
-                    QPointF((0.0f * scale) + pos_x, (-0.5f * scale) + pos_y),
-                    QPointF((0.5f * scale) + pos_x, (-0.5f * scale) + pos_y),
-                    QPointF((0.5f * scale) + pos_x, (-1.0f * scale) + pos_y),
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                    QPointF((1.0f * scale) + pos_x, (0.0f * scale) + pos_y),
+bool DisassemblyView::highlightRegisters() const { return m_Private->m_HighlightRegisters; }
 
-                    QPointF((0.5f * scale) + pos_x, (1.0f * scale) + pos_y),
-                    QPointF((0.5f * scale) + pos_x, (0.5f * scale) + pos_y),
-                    QPointF((0.0f * scale) + pos_x, (0.5f * scale) + pos_y),
-                };
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                painter.setPen(Qt::yellow);
-                painter.setBrush(Qt::yellow);
-                painter.drawConvexPolygon(points, 7);
-            }
-        }
+void DisassemblyView::goToTarget() {
+    uint64_t target = 0;
 
-        block = block.next();
-        top = bottom;
-        bottom = top + (int)blockBoundingRect(block).height();
-        ++blockNumber;
+    if (m_Private->branchTarget(m_Private->currentAddress(), &target)) {
+        m_Private->navigateTo(this, target);
     }
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Steps through the callers of the function the current instruction is in. Pressing it again on the caller it went to
+// goes on to the next one
 
-void DisassemblyView::endDisassembly(QVector<IBackendRequests::AssemblyInstruction>* instructions, int addressWidth) {
-    if (instructions->count() == 0) {
+void DisassemblyView::goToNextCaller() {
+    if (!m_Private->m_Analyzer) {
         return;
     }
 
-    QString addressText;
+    const uint64_t address = m_Private->currentAddress();
 
-    m_disassemblyText.resize(0);
-    m_disassemblyAdresses.resize(0);
+    if (m_Private->m_CallerIndex < 0 || address != m_Private->m_LastCaller) {
+        CodeAnalyzer::Function function;
 
-    m_disassemblyStart = instructions->at(0).address;
-    m_addressWidth = addressWidth;
+        const bool inFunction = m_Private->m_Analyzer->function_at(address, &function);
+        m_Private->m_CallerTarget = inFunction ? function.start : address;
+        m_Private->m_CallerIndex = -1;
+    }
 
-    for (auto& inst : *instructions) {
-        switch (addressWidth) {
-            case 2:
-                addressText.asprintf("%04X", (uint16_t)inst.address);
-                break;
-            case 4:
-                addressText.asprintf("%08X", (uint32_t)inst.address);
-                break;
-            default:
-                addressText.asprintf("%" PRIu64 "X", inst.address);
-                break;
-        }
+    const QVector<CodeAnalyzer::Reference> callers = m_Private->m_Analyzer->references_to(m_Private->m_CallerTarget);
 
-        m_disassemblyText.append(inst.text);
-        m_disassemblyText.append(QLatin1Char('\n'));
-        m_disassemblyAdresses.append({inst.address, addressText});
+    if (callers.isEmpty()) {
+        return;
     }
 
-    m_disassemblyEnd = instructions->at(instructions->count() - 1).address;
+    m_Private->m_CallerIndex = (m_Private->m_CallerIndex + 1) % callers.size();
+    m_Private->m_LastCaller = callers.at(m_Private->m_CallerIndex).from;
+    m_Private->navigateTo(this, m_Private->m_LastCaller);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void DisassemblyView::goBack() {
+    if (m_Private->m_History.isEmpty()) {
+        return;
+    }
 
-    setPlainText(m_disassemblyText);
-    updateDisassemblyCursor();
+    m_Private->m_HasSelection = false;
+    m_Private->m_CallerIndex = -1;
+    m_Private->jumpTo(m_Private->m_History.takeLast());
+    update();
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Rows that were fetched before may be different so everything is painted again. Scrolling that was waiting for
+// memory continues from here
 
-void DisassemblyView::updatePc(uint64_t pc) {
-    m_currentPc = pc;
-
-    // check if pc is with the disassembly range and search for the current line
-    // to set
-
-    if ((pc >= m_disassemblyStart && pc <= m_disassemblyEnd) && m_disassemblyEnd != 0) {
-        updateDisassemblyCursor();
-    } else {
-        // QSize size = frameSize();
-        int fontHeight = fontMetrics().height();
-        int linesInView = (height() / fontHeight) - 1;
-        if (linesInView <= 0) {
-            linesInView = 1;
-        }
+void DisassemblyView::rowsChanged() {
+    m_Private->m_Painted = false;
 
-        if ((int)pc >= linesInView) {
-            pc -= linesInView;
-        }
+    if (m_Private->m_PendingRows != 0) {
+        const int pending = m_Private->m_PendingRows;
+        m_Private->m_PendingRows = pending - m_Private->m_Model->move(pending);
+        m_Private->syncScrollBar();
+    }
 
-        // mask out the lower bits of start offset so we have a 4 byte even
-        // address to disassemble from
-        pc &= (uint64_t)(~3);
+    update();
+}
 
-        if (m_interface) {
-            m_interface->beginDisassembly(pc, linesInView * 2, &m_recvInstructions);
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Steps of the scroll bar scroll by rows while dragging it moves through the whole address space
+
+void DisassemblyView::scrollBarAction(int action) {
+    QScrollBar* scrollBar = m_Private->m_ScrollBar;
+
+    switch (action) {
+        case QAbstractSlider::SliderSingleStepAdd:
+            displayNextLine();
+            break;
+        case QAbstractSlider::SliderSingleStepSub:
+            displayPrevLine();
+            break;
+        case QAbstractSlider::SliderPageStepAdd:
+            displayNextPage();
+            break;
+        case QAbstractSlider::SliderPageStepSub:
+            displayPrevPage();
+            break;
+        case QAbstractSlider::SliderMove: {
+            DisassemblyEngine* engine = m_Private->m_Engine;
+            const uint64_t address = uint64_t(scrollBar->sliderPosition()) << m_Private->scrollShift();
+
+            m_Private->m_Model->set_anchor(engine ? engine->instruction_start(address) : address);
+            m_Private->m_PendingRows = 0;
+            m_Private->m_prefetcher.reset(m_Private->m_Model->anchor());
+            update();
+            return;
         }
+        default:
+            return;
     }
+
+    scrollBar->setSliderPosition(int(m_Private->m_Model->anchor() >> m_Private->scrollShift()));
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void DisassemblyView::updateDisassemblyCursor() {
-    for (int i = 0, count = m_disassemblyAdresses.count(); i < count; ++i) {
-        if (m_disassemblyAdresses[i].address != m_currentPc) {
-            continue;
-        }
+void DisassemblyView::paintEvent(QPaintEvent* ev) { m_Private->paintEvent(this, ev); }
 
-        setLine(i + 1);
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        return;
-    }
+void DisassemblyView::resizeEvent(QResizeEvent* ev) {
+    Base::resizeEvent(ev);
+
+    const int scrollBarWidth = m_Private->m_ScrollBar->sizeHint().width();
+    m_Private->m_ScrollBar->setGeometry(width() - scrollBarWidth, 0, scrollBarWidth, height());
+    m_Private->m_Painted = false;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Wheel and touchpad movement is added up and scrolled by whole rows
 
-void DisassemblyView::toggleBreakpoint() {
-    QTextCursor cursor = textCursor();
-    int index = cursor.block().blockNumber();
+void DisassemblyView::wheelEvent(QWheelEvent* ev) {
+    const int rowHeight = m_Private->m_RowHeight;
+    int pixels = ev->pixelDelta().y();
+
+    if (pixels == 0) {
+        pixels = ev->angleDelta().y() * m_Private->m_WheelSpeedRows * rowHeight / 120;
+    }
 
-    bool added = m_breakpoints->toggle_address_breakpoint(m_disassemblyAdresses[index].address);
+    m_Private->m_WheelPixels -= pixels;
 
-    if (added) {
-        m_interface->beginAddAddressBreakpoint(m_disassemblyAdresses[index].address);
-    } else {
-        m_interface->beginRemoveAddressBreakpoint(m_disassemblyAdresses[index].address);
+    const int rows = m_Private->m_WheelPixels / rowHeight;
+    m_Private->m_WheelPixels -= rows * rowHeight;
+
+    if (rows != 0) {
+        m_Private->scrollRows(this, rows);
     }
 
-    m_addressArea->repaint();
+    ev->accept();
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Clicking a row selects it and clicking in the gutter toggles the breakpoint on it
+
+void DisassemblyView::mousePressEvent(QMouseEvent* ev) {
+    const DisassemblyEngine::Instruction* inst = m_Private->m_Model->row(ev->pos().y() / m_Private->m_RowHeight);
+
+    if (!inst) {
+        return;
+    }
+
+    m_Private->m_Selected = inst->address;
+    m_Private->m_HasSelection = true;
+
+    if (ev->button() == Qt::LeftButton && ev->pos().x() < kGutterChars * m_Private->m_CharWidth) {
+        toggleBreakpoint();
+    }
 
-void DisassemblyView::setLine(int line) {
-    const QTextBlock& block = document()->findBlockByNumber(line - 1);
-    QTextCursor cursor(block);
-    cursor.movePosition(QTextCursor::Right, QTextCursor::MoveAnchor, 0);
-    setTextCursor(cursor);
-    centerCursor();
-    setFocus();
+    update();
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void DisassemblyView::set_backend_interface(IBackendRequests* interface) {
-    m_interface = interface;
-    connect(m_interface, &IBackendRequests::endDisassembly, this, &DisassemblyView::endDisassembly);
+void DisassemblyView::contextMenuEvent(QContextMenuEvent* ev) {
+    QMenu contextMenu;
+    contextMenu.addActions(actions());
+    contextMenu.exec(mapToGlobal(ev->pos()));
 }
 
-#endif
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void DisassemblyView::displayNextPage() { m_Private->scrollRows(this, std::max(1, m_Private->m_Rows - 1)); }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void DisassemblyView::displayPrevPage() { m_Private->scrollRows(this, -std::max(1, m_Private->m_Rows - 1)); }
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void DisassemblyView::displayNextLine() { m_Private->scrollRows(this, 1); }
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void DisassemblyView::displayPrevLine() { m_Private->scrollRows(this, -1); }
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void DisassemblyView::setAddress(uint64_t address) {
+    m_Private->jumpTo(address);
+    update();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+uint64_t DisassemblyView::address() const { return m_Private->m_Model->anchor(); }
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }  // namespace prodbg
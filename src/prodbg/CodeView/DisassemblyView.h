@@ -1,83 +1,79 @@
 #pragma once
 
 #include <stdint.h>
-#include <QtCore/QPointer>
-#include <QtCore/QString>
-#include <QtWidgets/QPlainTextEdit>
+#include <QtWidgets/QWidget>
 #include "Backend/IBackendRequests.h"
 
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-class QPaintEvent;
-class QResizeEvent;
-class QSize;
-class QWidget;
-class QThread;
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
 namespace prodbg {
 
-class AddressArea;
 class BreakpointModel;
+class DisassemblyModel;
+class DisassemblyViewPrivate;
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Disassembly of the target that can be scrolled through the whole address space.
+//
+// Only the visible rows are painted and they are taken from a DisassemblyModel that decodes the rows around the top
+// of the view on demand, so painting and scrolling cost the same no matter how much code has been decoded. The
+// scroll bar maps to the whole address space while wheel and keys scroll by instructions.
 
-class DisassemblyView : public QPlainTextEdit {
+class DisassemblyView : public QWidget {
     Q_OBJECT
+    using Base = QWidget;
 
    public:
-    DisassemblyView(QWidget* parent = 0);
+    explicit DisassemblyView(QWidget* parent = nullptr);
     virtual ~DisassemblyView();
 
-    void updatePc(uint64_t pc);
-
-    void toggleBreakpoint();
-    int lineNumberAreaWidth();
-    void lineNumberAreaPaintEvent(QPaintEvent* event);
     void set_backend_interface(IBackendRequests* interface);
     void setBreakpointModel(BreakpointModel* breakpoints);
 
-    //Q_SLOT void endDisassembly(QVector<IBackendRequests::AssemblyInstruction>* instructions, int addressWidth);
+    // Marks pc as the current location of the target and scrolls to it unless it's visible already
+    void updatePc(uint64_t pc);
 
-   private:
-    //Q_SLOT void updateAddressAreaWidth(int newBlockCount);
-    //Q_SLOT void highlightCurrentLine();
-    //Q_SLOT void updateAddressArea(const QRect& rect, int dy);
+    // Toggles the breakpoint at the selected instruction (or the pc if nothing is selected)
+    void toggleBreakpoint();
 
-    void resizeEvent(QResizeEvent* event);
-    void updateDisassemblyCursor();
-    void setLine(int line);
+    // Navigation from the selected instruction (or the pc if nothing is selected). Callers come from the CodeAnalyzer
+    // of the session so they are only found once it has analyzed the code
+    Q_SLOT void goToTarget();
+    Q_SLOT void goToNextCaller();
+    Q_SLOT void goBack();
 
-    QWidget* m_addressArea;
-    QPointer<IBackendRequests> m_interface;
-    BreakpointModel* m_breakpoints;
+    // Sent by "Open Function Graph" with the selected instruction (or the pc if nothing is selected)
+    Q_SIGNAL void functionGraphRequested(uint64_t address);
 
-    struct AddressData {
-        uint64_t address;
-        QString addressText;
-    };
+    // Highlights the rows that write registers the selected instruction (or the pc if nothing is selected) reads and
+    // the rows that read registers it writes. The registers it uses are listed after it
+    void setHighlightRegisters(bool highlight);
+    bool highlightRegisters() const;
 
-    uint64_t m_disassemblyStart = 0;
-    uint64_t m_disassemblyEnd = 0;
-    uint64_t m_currentPc = 0;
-    int m_addressWidth = 0;
+    // Address of the instruction on the top row
+    void setAddress(uint64_t address);
+    uint64_t address() const;
 
-    QString m_disassemblyText;
+    DisassemblyModel* model() const;
 
-    // Currenty range of disassembly addresses
-    QVector<AddressData> m_disassemblyAdresses;
+   protected:
+    void paintEvent(QPaintEvent* ev) override;
+    void resizeEvent(QResizeEvent* ev) override;
+    void wheelEvent(QWheelEvent* ev) override;
+    void mousePressEvent(QMouseEvent* ev) override;
+    void contextMenuEvent(QContextMenuEvent* ev) override;
 
-    // Temp vector for recving data from backend
-    QVector<IBackendRequests::AssemblyInstruction> m_recvInstructions;
-};
+   public:
+    Q_SLOT void displayNextPage();
+    Q_SLOT void displayPrevPage();
+    Q_SLOT void displayNextLine();
+    Q_SLOT void displayPrevLine();
 
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+   private:
+    Q_SLOT void rowsChanged();
+    Q_SLOT void scrollBarAction(int action);
+    Q_SLOT void programCounterChanged(const IBackendRequests::ProgramCounterChange& pc);
 
-inline void DisassemblyView::setBreakpointModel(BreakpointModel* breakpoints) {
-    m_breakpoints = breakpoints;
-}
+    DisassemblyViewPrivate* m_Private;
+};
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
 }  // namespace prodbg
@@ -0,0 +1,644 @@
+#include "FunctionGraphView.h"
+#include "ControlFlowBuilder.h"
+#include "DisassemblyEngine.h"
+#include "MemoryView/GlyphAtlas.h"
+
+#include <QtCore/QPointer>
+#include <QtCore/QSettings>
+#include <QtCore/QSharedPointer>
+#include <QtGui/QMouseEvent>
+#include <QtGui/QPainter>
+#include <QtWidgets/QAction>
+#include <QtWidgets/QApplication>
+#include <QtWidgets/QMenu>
+#include <QtWidgets/QScrollBar>
+
+#include <algorithm>
+
+namespace prodbg {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static const char s_HexTable[] = "0123456789abcdef";
+
+enum {
+    // Width of the mnemonic column
+    kMnemonicChars = 8,
+    // Space inside blocks, between blocks in a layer and between layers (in pixels)
+    kBlockPadding = 4,
+    kBlockSpacing = 24,
+    kLayerSpacing = 40,
+    // Space kept around the graph
+    kMargin = 16,
+    kArrowSize = 6,
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Blocks are placed in pixels from the layers and columns of the graph. Each layer is as high as its highest block
+// and is centered on the widest layer. Only the blocks that intersect the viewport are painted.
+
+class FunctionGraphViewPrivate {
+   public:
+    QPointer<IBackendRequests> m_Interface;
+    QPointer<ControlFlowBuilder> m_Builder;
+    QPointer<DisassemblyEngine> m_Engine;
+
+    QSharedPointer<const ControlFlowGraph> m_Graph;
+    uint64_t m_Entry = 0;
+    bool m_HasEntry = false;
+
+    uint64_t m_Pc = 0;
+    bool m_HasPc = false;
+    bool m_FollowPc = true;
+    bool m_Highlight = true;
+    // Block with the pc that was last scrolled into view
+    int m_ShownBlock = -1;
+
+    GlyphAtlas m_Glyphs;
+    int m_CharWidth = 1;
+    int m_RowHeight = 1;
+
+    // Position of each block and the size of the whole graph
+    QVector<QRect> m_BlockRects;
+    QSize m_GraphSize;
+    bool m_LayoutValid = false;
+
+    // Drag start for panning
+    QPoint m_DragStart;
+    QPoint m_DragScroll;
+
+    QByteArray m_Line;
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int addressWidth() const {
+        const int width = m_Engine ? m_Engine->address_width() : 0;
+        return width > 0 ? width : 8;
+    }
+
+    void formatRow(const DisassemblyEngine::Instruction& inst) {
+        const QByteArray mnemonic = inst.mnemonic.toLatin1();
+
+        m_Line.resize(0);
+
+        for (int i = addressWidth() * 2 - 1; i >= 0; --i) {
+            m_Line.append(s_HexTable[(inst.address >> (i * 4)) & 0xf]);
+        }
+
+        m_Line.append("  ");
+        m_Line.append(mnemonic);
+        m_Line.append(std::max(1, kMnemonicChars - mnemonic.size()), ' ');
+        m_Line.append(inst.operands.toLatin1());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void updateGlyphs(QWidget* widget) {
+        if (m_Glyphs.update(widget->font(), widget->palette().color(QPalette::WindowText),
+                            widget->devicePixelRatioF())) {
+            m_LayoutValid = false;
+        }
+
+        m_CharWidth = std::max(1, m_Glyphs.char_width());
+        m_RowHeight = std::max(1, m_Glyphs.row_height());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void layout() {
+        m_LayoutValid = true;
+        m_BlockRects.clear();
+        m_GraphSize = QSize(0, 0);
+
+        if (!m_Graph) {
+            return;
+        }
+
+        const ControlFlowGraph& graph = *m_Graph;
+        const int fixedChars = addressWidth() * 2 + 2 + kMnemonicChars;
+
+        QVector<int> layerHeights(graph.layer_count, 0);
+        QVector<int> layerWidths(graph.layer_count, 0);
+        QVector<QVector<int>> layers(graph.layer_count);
+
+        m_BlockRects.resize(graph.blocks.size());
+
+        for (int i = 0; i < graph.blocks.size(); ++i) {
+            const ControlFlowGraph::Block& block = graph.blocks.at(i);
+            int chars = 0;
+
+            for (int k = block.first; k < block.first + block.count; ++k) {
+                chars = std::max(chars, fixedChars + graph.instructions.at(k).operands.size());
+            }
+
+            const QSize size(chars * m_CharWidth + kBlockPadding * 2, block.count * m_RowHeight + kBlockPadding * 2);
+            m_BlockRects[i] = QRect(QPoint(0, 0), size);
+
+            layerHeights[block.layer] = std::max(layerHeights.at(block.layer), size.height());
+            layers[block.layer].append(i);
+        }
+
+        int graphWidth = 0;
+
+        for (int layer = 0; layer < layers.size(); ++layer) {
+            QVector<int>& row = layers[layer];
+
+            std::sort(row.begin(), row.end(),
+                      [&graph](int a, int b) { return graph.blocks.at(a).column < graph.blocks.at(b).column; });
+
+            for (int block : row) {
+                layerWidths[layer] += m_BlockRects.at(block).width() + kBlockSpacing;
+            }
+
+            graphWidth = std::max(graphWidth, layerWidths.at(layer));
+        }
+
+        int y = kMargin;
+
+        for (int layer = 0; layer < layers.size(); ++layer) {
+            int x = kMargin + (graphWidth - layerWidths.at(layer)) / 2;
+
+            for (int block : layers.at(layer)) {
+                m_BlockRects[block].moveTo(x, y);
+                x += m_BlockRects.at(block).width() + kBlockSpacing;
+            }
+
+            y += layerHeights.at(layer) + kLayerSpacing;
+        }
+
+        // Back edges are routed right of all blocks
+        m_GraphSize = QSize(graphWidth + kMargin * 2 + kBlockSpacing, y + kMargin);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void syncScrollBars(QAbstractScrollArea* area) {
+        const QSize viewport = area->viewport()->size();
+
+        area->horizontalScrollBar()->setRange(0, std::max(0, m_GraphSize.width() - viewport.width()));
+        area->horizontalScrollBar()->setPageStep(viewport.width());
+        area->horizontalScrollBar()->setSingleStep(m_CharWidth * 4);
+        area->verticalScrollBar()->setRange(0, std::max(0, m_GraphSize.height() - viewport.height()));
+        area->verticalScrollBar()->setPageStep(viewport.height());
+        area->verticalScrollBar()->setSingleStep(m_RowHeight * 4);
+    }
+
+    QPoint scrollOffset(QAbstractScrollArea* area) const {
+        return QPoint(area->horizontalScrollBar()->value(), area->verticalScrollBar()->value());
+    }
+
+    int currentBlock() const {
+        if (!m_Graph || !m_HasPc || !m_Highlight) {
+            return -1;
+        }
+
+        return m_Graph->block_at(m_Pc);
+    }
+
+    // Centers the block with the pc in the view (once for each block the pc enters)
+    void showCurrentBlock(QAbstractScrollArea* area) {
+        const int block = currentBlock();
+
+        if (block < 0 || block == m_ShownBlock || block >= m_BlockRects.size()) {
+            return;
+        }
+
+        m_ShownBlock = block;
+
+        const QRect rect = m_BlockRects.at(block);
+        const QRect visible(scrollOffset(area), area->viewport()->size());
+
+        if (!visible.contains(rect)) {
+            area->horizontalScrollBar()->setValue(rect.center().x() - visible.width() / 2);
+            area->verticalScrollBar()->setValue(rect.center().y() - visible.height() / 2);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void fetchGraph(QAbstractScrollArea* area) {
+        if (!m_Builder || !m_HasEntry) {
+            return;
+        }
+
+        QSharedPointer<const ControlFlowGraph> graph = m_Builder->graph(m_Entry);
+
+        // The graph shown is kept while a new one waits for memory
+        if (!graph || graph == m_Graph) {
+            return;
+        }
+
+        m_Graph = graph;
+        m_ShownBlock = -1;
+        m_LayoutValid = false;
+
+        updateGlyphs(area->viewport());
+        layout();
+        syncScrollBars(area);
+
+        if (currentBlock() >= 0) {
+            showCurrentBlock(area);
+        } else if (m_Graph->entry_block >= 0) {
+            const QRect entry = m_BlockRects.at(m_Graph->entry_block);
+            area->horizontalScrollBar()->setValue(entry.center().x() - area->viewport()->width() / 2);
+            area->verticalScrollBar()->setValue(0);
+        }
+
+        area->viewport()->update();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void paintEdge(QPainter* painter, const ControlFlowGraph::Edge& edge, int index, int count) const {
+        const QRect from = m_BlockRects.at(edge.from);
+        const QRect to = m_BlockRects.at(edge.to);
+
+        QColor color;
+
+        switch (edge.type) {
+            case ControlFlowGraph::Taken:
+                color = QColor(0, 160, 0);
+                break;
+            case ControlFlowGraph::NotTaken:
+                color = QColor(200, 0, 0);
+                break;
+            default:
+                color = QColor(40, 90, 200);
+                break;
+        }
+
+        // Edges leave the block spread over its bottom edge
+        const int startX = from.left() + from.width() * (index + 1) / (count + 1);
+        const int endX = to.center().x();
+        const int belowFrom = from.bottom() + kLayerSpacing / 3;
+        const int aboveTo = to.top() - kLayerSpacing / 3;
+
+        QVector<QPoint> points;
+        points.append(QPoint(startX, from.bottom()));
+        points.append(QPoint(startX, belowFrom));
+
+        if (edge.back) {
+            const int laneX = m_GraphSize.width() - kMargin - kBlockSpacing / 2 + (index % 4) * 3;
+            points.append(QPoint(laneX, belowFrom));
+            points.append(QPoint(laneX, aboveTo));
+            points.append(QPoint(endX, aboveTo));
+        } else {
+            points.append(QPoint(endX, belowFrom));
+        }
+
+        points.append(QPoint(endX, to.top()));
+
+        painter->setPen(QPen(color, edge.back ? 1.5 : 1.0));
+        painter->setBrush(Qt::NoBrush);
+        painter->drawPolyline(points.constData(), points.size());
+
+        const QPoint tip(endX, to.top());
+        const QPoint arrow[3] = {tip, QPoint(endX - kArrowSize / 2, tip.y() - kArrowSize),
+                                 QPoint(endX + kArrowSize / 2, tip.y() - kArrowSize)};
+
+        painter->setPen(Qt::NoPen);
+        painter->setBrush(color);
+        painter->drawPolygon(arrow, 3);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void paintEvent(QAbstractScrollArea* area, QPaintEvent* ev) {
+        const QPalette& palette = QApplication::palette();
+        const QColor baseColor = palette.base().color();
+        const QColor blockColor = palette.alternateBase().color();
+        const QColor frameColor = palette.mid().color();
+        QColor currentColor = palette.highlight().color();
+        QColor pcColor = QColor(Qt::yellow);
+        currentColor.setAlpha(64);
+        pcColor.setAlpha(128);
+
+        updateGlyphs(area->viewport());
+
+        if (!m_LayoutValid) {
+            layout();
+            syncScrollBars(area);
+        }
+
+        QPainter painter(area->viewport());
+        painter.fillRect(ev->rect(), baseColor);
+
+        if (!m_Graph) {
+            return;
+        }
+
+        const ControlFlowGraph& graph = *m_Graph;
+        const QPoint offset = scrollOffset(area);
+        const QRect visible = ev->rect().translated(offset);
+        const int current = currentBlock();
+
+        painter.translate(-offset);
+        painter.setRenderHint(QPainter::Antialiasing);
+
+        // Edges first so the blocks are drawn over them. Edges of a block are spread in the order they were added
+
+        for (int i = 0; i < graph.edges.size(); ++i) {
+            const ControlFlowGraph::Edge& edge = graph.edges.at(i);
+            int index = 0;
+            int count = 0;
+
+            for (int k = i - 1; k >= 0 && graph.edges.at(k).from == edge.from; --k) {
+                ++index;
+            }
+
+            for (int k = i; k < graph.edges.size() && graph.edges.at(k).from == edge.from; ++k) {
+                ++count;
+            }
+
+            const QRect bounds = m_BlockRects.at(edge.from).united(m_BlockRects.at(edge.to));
+
+            if (edge.back || bounds.adjusted(0, 0, 0, kLayerSpacing).intersects(visible)) {
+                paintEdge(&painter, edge, index, index + count);
+            }
+        }
+
+        painter.setRenderHint(QPainter::Antialiasing, false);
+
+        for (int i = 0; i < graph.blocks.size(); ++i) {
+            const QRect rect = m_BlockRects.at(i);
+
+            if (!rect.intersects(visible)) {
+                continue;
+            }
+
+            const ControlFlowGraph::Block& block = graph.blocks.at(i);
+
+            painter.setPen(frameColor);
+            painter.setBrush(i == current ? currentColor : blockColor);
+            painter.drawRect(rect.adjusted(0, 0, -1, -1));
+
+            for (int k = 0; k < block.count; ++k) {
+                const DisassemblyEngine::Instruction& inst = graph.instructions.at(block.first + k);
+                const int y = rect.top() + kBlockPadding + k * m_RowHeight;
+
+                if (y > visible.bottom() || y + m_RowHeight < visible.top()) {
+                    continue;
+                }
+
+                if (m_HasPc && inst.address == m_Pc) {
+                    painter.fillRect(rect.left() + 1, y, rect.width() - 2, m_RowHeight, pcColor);
+                }
+
+                formatRow(inst);
+                m_Glyphs.draw(&painter, rect.left() + kBlockPadding, y, m_Line.constData(), m_Line.size());
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const DisassemblyEngine::Instruction* instructionAt(QAbstractScrollArea* area, const QPoint& pos) const {
+        if (!m_Graph) {
+            return nullptr;
+        }
+
+        const QPoint point = pos + scrollOffset(area);
+
+        for (int i = 0; i < m_BlockRects.size(); ++i) {
+            if (!m_BlockRects.at(i).contains(point)) {
+                continue;
+            }
+
+            const ControlFlowGraph::Block& block = m_Graph->blocks.at(i);
+            const int row = (point.y() - m_BlockRects.at(i).top() - kBlockPadding) / m_RowHeight;
+
+            if (row < 0 || row >= block.count) {
+                return nullptr;
+            }
+
+            return &m_Graph->instructions.at(block.first + row);
+        }
+
+        return nullptr;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+FunctionGraphView::FunctionGraphView(QWidget* parent) : Base(parent), m_Private(new FunctionGraphViewPrivate) {
+    // Can be any fixed with font.
+#ifdef _WIN32
+    QFont font(QStringLiteral("Courier"), 11);
+#else
+    QFont font(QStringLiteral("Courier"), 13);
+#endif
+
+    font.setFixedPitch(true);
+    setFont(font);
+
+    setFocusPolicy(Qt::StrongFocus);
+    viewport()->setAttribute(Qt::WA_OpaquePaintEvent);
+
+    readSettings();
+
+    {
+        QAction* followAction = new QAction(QStringLiteral("Follow PC"), this);
+        followAction->setCheckable(true);
+        followAction->setChecked(m_Private->m_FollowPc);
+        this->addAction(followAction);
+        connect(followAction, &QAction::toggled, this, &FunctionGraphView::setFollowPc);
+    }
+
+    {
+        QAction* highlightAction = new QAction(QStringLiteral("Highlight Current Block"), this);
+        highlightAction->setCheckable(true);
+        highlightAction->setChecked(m_Private->m_Highlight);
+        this->addAction(highlightAction);
+        connect(highlightAction, &QAction::toggled, this, &FunctionGraphView::setHighlightCurrentBlock);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+FunctionGraphView::~FunctionGraphView() {
+    writeSettings();
+    delete m_Private;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void FunctionGraphView::set_backend_interface(IBackendRequests* interface) {
+    if (m_Private->m_Interface) {
+        disconnect(m_Private->m_Interface, nullptr, this, nullptr);
+    }
+
+    if (m_Private->m_Builder) {
+        disconnect(m_Private->m_Builder, nullptr, this, nullptr);
+    }
+
+    m_Private->m_Interface = interface;
+    m_Private->m_Engine = DisassemblyEngine::for_interface(interface);
+    m_Private->m_Builder = ControlFlowBuilder::for_interface(interface);
+    m_Private->m_Graph.reset();
+    m_Private->m_HasEntry = false;
+    m_Private->m_HasPc = false;
+    m_Private->m_LayoutValid = false;
+
+    if (interface) {
+        connect(interface, &IBackendRequests::program_counter_changed, this,
+                &FunctionGraphView::programCounterChanged);
+    }
+
+    if (m_Private->m_Builder) {
+        connect(m_Private->m_Builder, &ControlFlowBuilder::graphs_updated, this, &FunctionGraphView::graphsUpdated);
+    }
+
+    viewport()->update();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void FunctionGraphView::setFunction(uint64_t entry) {
+    m_Private->m_Entry = entry;
+    m_Private->m_HasEntry = true;
+    m_Private->fetchGraph(this);
+    viewport()->update();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+uint64_t FunctionGraphView::function() const { return m_Private->m_Entry; }
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void FunctionGraphView::setFollowPc(bool follow) {
+    m_Private->m_FollowPc = follow;
+
+    if (follow && m_Private->m_HasPc && m_Private->m_Builder) {
+        setFunction(m_Private->m_Builder->function_entry(m_Private->m_Pc));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool FunctionGraphView::followPc() const { return m_Private->m_FollowPc; }
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void FunctionGraphView::setHighlightCurrentBlock(bool highlight) {
+    m_Private->m_Highlight = highlight;
+    m_Private->m_ShownBlock = -1;
+    m_Private->showCurrentBlock(this);
+    viewport()->update();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool FunctionGraphView::highlightCurrentBlock() const { return m_Private->m_Highlight; }
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// The graph for the function is looked up again at each stop. While stepping inside a function this only checks that
+// the code hash is the same
+
+void FunctionGraphView::programCounterChanged(const IBackendRequests::ProgramCounterChange& pc) {
+    m_Private->m_Pc = pc.pc;
+    m_Private->m_HasPc = true;
+
+    if (!m_Private->m_FollowPc || !m_Private->m_Builder) {
+        viewport()->update();
+        return;
+    }
+
+    const bool inGraph = m_Private->m_Graph && m_Private->m_Graph->block_at(pc.pc) >= 0;
+    const uint64_t entry = inGraph ? m_Private->m_Graph->entry : m_Private->m_Builder->function_entry(pc.pc);
+
+    setFunction(entry);
+    m_Private->showCurrentBlock(this);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void FunctionGraphView::graphsUpdated() {
+    m_Private->fetchGraph(this);
+    viewport()->update();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void FunctionGraphView::paintEvent(QPaintEvent* ev) { m_Private->paintEvent(this, ev); }
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void FunctionGraphView::resizeEvent(QResizeEvent* ev) {
+    Base::resizeEvent(ev);
+    m_Private->syncScrollBars(this);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void FunctionGraphView::changeEvent(QEvent* ev) {
+    Base::changeEvent(ev);
+
+    if (ev->type() == QEvent::FontChange) {
+        m_Private->m_LayoutValid = false;
+        viewport()->update();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Dragging moves the graph around
+
+void FunctionGraphView::mousePressEvent(QMouseEvent* ev) {
+    m_Private->m_DragStart = ev->pos();
+    m_Private->m_DragScroll = m_Private->scrollOffset(this);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void FunctionGraphView::mouseMoveEvent(QMouseEvent* ev) {
+    if (!(ev->buttons() & Qt::LeftButton)) {
+        return;
+    }
+
+    const QPoint scroll = m_Private->m_DragScroll - (ev->pos() - m_Private->m_DragStart);
+
+    horizontalScrollBar()->setValue(scroll.x());
+    verticalScrollBar()->setValue(scroll.y());
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Double clicking a call shows the function it calls
+
+void FunctionGraphView::mouseDoubleClickEvent(QMouseEvent* ev) {
+    const DisassemblyEngine::Instruction* inst = m_Private->instructionAt(this, ev->pos());
+
+    if (inst && (inst->flags & DisassemblyEngine::Call) && (inst->flags & DisassemblyEngine::HasTarget)) {
+        setFunction(inst->target);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void FunctionGraphView::contextMenuEvent(QContextMenuEvent* ev) {
+    QMenu contextMenu;
+    contextMenu.addActions(actions());
+    contextMenu.exec(mapToGlobal(ev->pos()));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void FunctionGraphView::readSettings() {
+    QSettings settings(QStringLiteral("TBL"), QStringLiteral("ProDBG"));
+    settings.beginGroup(QStringLiteral("FunctionGraphView"));
+    m_Private->m_FollowPc = settings.value(QStringLiteral("followPc"), true).toBool();
+    m_Private->m_Highlight = settings.value(QStringLiteral("highlightCurrentBlock"), true).toBool();
+    settings.endGroup();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void FunctionGraphView::writeSettings() {
+    QSettings settings(QStringLiteral("TBL"), QStringLiteral("ProDBG"));
+    settings.beginGroup(QStringLiteral("FunctionGraphView"));
+    settings.setValue(QStringLiteral("followPc"), m_Private->m_FollowPc);
+    settings.setValue(QStringLiteral("highlightCurrentBlock"), m_Private->m_Highlight);
+    settings.endGroup();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <stdint.h>
+#include <QtWidgets/QAbstractScrollArea>
+#include "Backend/IBackendRequests.h"
+
+namespace prodbg {
+
+class FunctionGraphViewPrivate;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Control flow graph of a function with the basic blocks drawn in layers (see ControlFlowGraph).
+//
+// Graphs come from the ControlFlowBuilder of the session. When following the pc the view shows the function the pc
+// is in at each stop and, if "highlight current block" is on, highlights the block with the pc and scrolls it into
+// view. As graphs are cached by code hash, stepping inside a function only looks up the block. Double clicking a call
+// shows the function it calls.
+
+class FunctionGraphView : public QAbstractScrollArea {
+    Q_OBJECT
+    using Base = QAbstractScrollArea;
+
+   public:
+    explicit FunctionGraphView(QWidget* parent = nullptr);
+    virtual ~FunctionGraphView();
+
+    void set_backend_interface(IBackendRequests* interface);
+
+    // Shows the graph of the function at entry
+    void setFunction(uint64_t entry);
+    uint64_t function() const;
+
+    void setFollowPc(bool follow);
+    bool followPc() const;
+
+    void setHighlightCurrentBlock(bool highlight);
+    bool highlightCurrentBlock() const;
+
+   protected:
+    void paintEvent(QPaintEvent* ev) override;
+    void resizeEvent(QResizeEvent* ev) override;
+    void changeEvent(QEvent* ev) override;
+    void mousePressEvent(QMouseEvent* ev) override;
+    void mouseMoveEvent(QMouseEvent* ev) override;
+    void mouseDoubleClickEvent(QMouseEvent* ev) override;
+    void contextMenuEvent(QContextMenuEvent* ev) override;
+
+   private:
+    Q_SLOT void graphsUpdated();
+    Q_SLOT void programCounterChanged(const IBackendRequests::ProgramCounterChange& pc);
+
+    void readSettings();
+    void writeSettings();
+
+    FunctionGraphViewPrivate* m_Private;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
@@ -0,0 +1,160 @@
+#include "InstructionIndex.h"
+
+namespace prodbg {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void InstructionIndex::add_entry(uint64_t address) {
+    if (!m_entries.contains(address)) {
+        m_entries.insert(address, address);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool InstructionIndex::entry_before(uint64_t address, uint64_t* entry, uint64_t* swept_to) const {
+    auto it = m_entries.upperBound(address);
+
+    if (it == m_entries.constBegin()) {
+        return false;
+    }
+
+    --it;
+
+    *entry = it.key();
+    *swept_to = it.value();
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void InstructionIndex::set_swept_to(uint64_t entry, uint64_t address) {
+    auto it = m_entries.find(entry);
+
+    if (it != m_entries.end()) {
+        it.value() = address;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Page for address with the given contents. A page that was recorded with other contents is started over
+
+InstructionIndex::Page* InstructionIndex::page(uint64_t address, uint64_t hash) {
+    const uint64_t page_address = address & ~uint64_t(PageSize - 1);
+    auto it = m_pages.find(page_address);
+
+    if (it != m_pages.end()) {
+        if (it.value().hash != hash) {
+            it.value().hash = hash;
+            it.value().sizes.fill(0);
+            rewind_sweeps(page_address);
+        }
+
+        return &it.value();
+    }
+
+    if (m_pages.size() >= MaxPages) {
+        m_pages.clear();
+        rewind_sweeps(0);
+    }
+
+    Page& page = m_pages[page_address];
+    page.hash = hash;
+    page.sizes = QByteArray(PageSize, 0);
+
+    return &page;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void InstructionIndex::clear_start(uint64_t address) {
+    auto it = m_pages.find(address & ~uint64_t(PageSize - 1));
+
+    if (it != m_pages.end()) {
+        it.value().sizes[int(address & (PageSize - 1))] = 0;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Sweeps that have gone past address start over from their entry
+
+void InstructionIndex::rewind_sweeps(uint64_t address) {
+    for (auto it = m_entries.begin(); it != m_entries.end(); ++it) {
+        if (it.value() > address) {
+            it.value() = it.key();
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool InstructionIndex::add(uint64_t address, uint32_t size, uint64_t page_hash) {
+    if (size == 0 || size > 255) {
+        return false;
+    }
+
+    Page* target = page(address, page_hash);
+    const int offset = int(address & (PageSize - 1));
+
+    if (uint8_t(target->sizes[offset]) == size) {
+        return false;
+    }
+
+    // Starts inside the new instruction and earlier instructions that run into it were out of line
+
+    for (uint32_t i = 1; i < size; ++i) {
+        clear_start(address + i);
+    }
+
+    for (uint64_t i = 1; i < uint64_t(m_max_size) && i <= address; ++i) {
+        auto it = m_pages.constFind((address - i) & ~uint64_t(PageSize - 1));
+
+        if (it != m_pages.constEnd() && uint8_t(it.value().sizes[int((address - i) & (PageSize - 1))]) > i) {
+            clear_start(address - i);
+        }
+    }
+
+    target->sizes[offset] = char(size);
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+uint32_t InstructionIndex::size_at(uint64_t address, uint64_t page_hash) const {
+    auto it = m_pages.constFind(address & ~uint64_t(PageSize - 1));
+
+    if (it == m_pages.constEnd() || it.value().hash != page_hash) {
+        return 0;
+    }
+
+    return uint8_t(it.value().sizes[int(address & (PageSize - 1))]);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void InstructionIndex::remove(uint64_t address, uint64_t size) {
+    const uint64_t first = address & ~uint64_t(PageSize - 1);
+    const uint64_t last = (address + qMax(size, uint64_t(1)) - 1) & ~uint64_t(PageSize - 1);
+
+    for (auto it = m_pages.begin(); it != m_pages.end();) {
+        if (it.key() >= first && it.key() <= last) {
+            it = m_pages.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    rewind_sweeps(first);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void InstructionIndex::clear() {
+    m_pages.clear();
+    rewind_sweeps(0);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
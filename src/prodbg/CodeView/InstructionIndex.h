@@ -0,0 +1,75 @@
+#pragma once
+
+#include <stdint.h>
+#include <QtCore/QByteArray>
+#include <QtCore/QHash>
+#include <QtCore/QMap>
+
+namespace prodbg {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Known instruction boundaries of the target code.
+//
+// Code can only be decoded forwards so on ISAs with variable instruction sizes the instruction before an address
+// can't be found by decoding from somewhere before it. The index records the size of each instruction that was
+// decoded from a known start, which makes it possible to walk backwards from any address that has been reached that
+// way.
+//
+// Known starts are entry points (symbols, function starts, the pc and branch targets) and every instruction that
+// follows one in a linear sweep. Each entry remembers how far it has been swept so sweeps continue where they stopped
+// as more code is needed. Sizes are kept per code page along with the hash of the page contents (see
+// MemoryCache::page_hash) so boundaries of code that has changed are never used.
+
+class InstructionIndex {
+   public:
+    enum {
+        PageSize = 4096,
+        // Max number of pages kept before all of them are dropped and swept again
+        MaxPages = 4096,
+    };
+
+    void set_max_instruction_size(int size) { m_max_size = size; }
+
+    // Address that is known to be the start of an instruction
+    void add_entry(uint64_t address);
+    bool is_entry(uint64_t address) const { return m_entries.contains(address); }
+    int entry_count() const { return m_entries.size(); }
+
+    // Closest entry at or before address and the address its sweep has reached. Returns false if there is none
+    bool entry_before(uint64_t address, uint64_t* entry, uint64_t* swept_to) const;
+    void set_swept_to(uint64_t entry, uint64_t address);
+
+    // Records an instruction decoded from the page with page_hash. Instructions that overlap it are removed as they
+    // came from a sweep that was out of line. Returns false if it was known already
+    bool add(uint64_t address, uint32_t size, uint64_t page_hash);
+
+    // Size of the instruction that starts at address in the page with page_hash or 0 if it isn't a known start
+    uint32_t size_at(uint64_t address, uint64_t page_hash) const;
+
+    // Drops the boundaries in [address, address + size) and rewinds the sweeps that went through them
+    void remove(uint64_t address, uint64_t size);
+
+    // Drops all boundaries (such as when the arch has changed). Entries are kept and swept again
+    void clear();
+
+    int page_count() const { return m_pages.size(); }
+
+   private:
+    struct Page {
+        uint64_t hash;
+        // Size of the instruction at each offset (0 if no known instruction starts there)
+        QByteArray sizes;
+    };
+
+    Page* page(uint64_t address, uint64_t hash);
+    void clear_start(uint64_t address);
+    void rewind_sweeps(uint64_t address);
+
+    QHash<uint64_t, Page> m_pages;
+    // Entry address -> end of the last instruction its sweep has recorded
+    QMap<uint64_t, uint64_t> m_entries;
+    int m_max_size = 16;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
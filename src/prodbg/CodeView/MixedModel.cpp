@@ -0,0 +1,402 @@
+#include "MixedModel.h"
+#include <QtCore/QFile>
+#include <limits.h>
+#include <string.h>
+#include <algorithm>
+#include "Core/LineTableStore.h"
+
+namespace prodbg {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+MixedModel::MixedModel(QObject* parent) : QObject(parent) {}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MixedModel::set_engine(DisassemblyEngine* engine) {
+    if (m_engine) {
+        disconnect(m_engine, nullptr, this, nullptr);
+    }
+
+    m_engine = engine;
+    m_rows.resize(0);
+
+    if (m_engine) {
+        connect(m_engine, &DisassemblyEngine::instructions_updated, this, &MixedModel::instructions_updated);
+        connect(m_engine, &DisassemblyEngine::target_changed, this, &MixedModel::instructions_updated);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MixedModel::set_line_tables(LineTableStore* line_tables) {
+    if (m_line_tables) {
+        disconnect(m_line_tables, nullptr, this, nullptr);
+    }
+
+    m_line_tables = line_tables;
+
+    if (m_line_tables) {
+        connect(m_line_tables, &LineTableStore::lines_changed, this, &MixedModel::lines_changed);
+    }
+
+    update_table();
+    m_rows.resize(0);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool MixedModel::set_file(const QString& path) {
+    QFile file(path);
+    const bool loaded = file.open(QIODevice::ReadOnly);
+
+    m_file = path;
+    m_source = loaded ? file.readAll() : QByteArray();
+
+    // Each line starts after the line break of the one before it. A file that doesn't end with a line break gets the
+    // end of the file added as the end of its last line
+
+    const char* data = m_source.constData();
+    const int size = m_source.size();
+
+    m_line_starts.resize(0);
+    m_line_starts.append(0);
+
+    for (const char* p = data; (p = (const char*)memchr(p, '\n', size_t(data + size - p))) != nullptr;) {
+        ++p;
+        m_line_starts.append(int(p - data));
+    }
+
+    if (m_line_starts.last() != size) {
+        m_line_starts.append(size);
+    }
+
+    update_table();
+    set_anchor(1);
+
+    return loaded;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const char* MixedModel::source_line(int line, int* length) const {
+    *length = 0;
+
+    if (line < 1 || line >= m_line_starts.size()) {
+        return nullptr;
+    }
+
+    const int start = m_line_starts.at(line - 1);
+    int end = m_line_starts.at(line);
+
+    while (end > start && (m_source.at(end - 1) == '\n' || m_source.at(end - 1) == '\r')) {
+        --end;
+    }
+
+    *length = end - start;
+
+    return m_source.constData() + start;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool MixedModel::has_code(int line) const {
+    return std::binary_search(m_code_lines.begin(), m_code_lines.end(), line);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int MixedModel::next_code_line(int line) const {
+    auto it = std::lower_bound(m_code_lines.begin(), m_code_lines.end(), line);
+    return it != m_code_lines.end() ? *it : -1;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool MixedModel::location_of(uint64_t address, QString* file, int* line) const {
+    LineTable::Location location;
+
+    if (!m_table || !m_table->location(address, &location)) {
+        return false;
+    }
+
+    // The path of the file shown is kept as it was given so callers can compare it with file()
+    *file = location.file == m_file_id ? m_file : m_table->file(location.file);
+    *line = location.line;
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool MixedModel::index_of(int line, uint64_t address, int* index) {
+    const bool complete = build_line(line);
+
+    *index = 0;
+
+    for (const Row& row : m_line) {
+        if (row.index > 0 && address >= row.inst.address && address - row.inst.address < row.inst.size) {
+            *index = row.index;
+            break;
+        }
+    }
+
+    return complete;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MixedModel::set_anchor(int line, int index) {
+    m_anchor_line = qBound(1, line, qMax(1, m_line_count));
+    m_anchor_index = qMax(0, index);
+    m_rows.resize(0);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MixedModel::reset() {
+    m_rows.resize(0);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MixedModel::instructions_updated() {
+    reset();
+    rows_changed();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MixedModel::lines_changed() {
+    update_table();
+    reset();
+    rows_changed();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// The file is looked up once per table and the lines with code are kept so the view can mark them without going
+// through the table for each row
+
+void MixedModel::update_table() {
+    m_table = m_line_tables ? m_line_tables->table() : QSharedPointer<const LineTable>();
+    m_file_id = m_table && !m_file.isEmpty() ? m_table->find_file(m_file) : -1;
+    m_code_lines.resize(0);
+
+    if (m_file_id >= 0) {
+        m_table->lines(m_file_id, &m_code_lines);
+    }
+
+    m_line_count = m_line_starts.isEmpty() ? 0 : m_line_starts.size() - 1;
+
+    if (!m_code_lines.isEmpty()) {
+        m_line_count = qMax(m_line_count, m_code_lines.last());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Builds the rows of line into m_line. The ranges are decoded a few instructions at a time, never more than can start
+// in what is left of the range, so the memory after a range isn't read just to be thrown away. Returns false if some
+// of the instructions are waiting for memory
+
+bool MixedModel::build_line(int line) {
+    m_line.resize(0);
+    m_line.append(Row{line, 0, Instruction()});
+
+    if (m_file_id < 0 || !m_engine || !m_engine->has_target() || !has_code(line)) {
+        return true;
+    }
+
+    m_ranges.resize(0);
+    m_table->ranges(m_file_id, line, &m_ranges);
+
+    const uint64_t max_size = uint64_t(qMax(1, m_engine->max_instruction_size()));
+    bool complete = true;
+
+    for (const LineTable::Range& range : m_ranges) {
+        uint64_t address = range.start;
+
+        while (address < range.end && m_line.size() <= MaxLineInstructions) {
+            const uint64_t left = (range.end - address + max_size - 1) / max_size;
+            const int count = int(qMin(left, uint64_t(MaxLineInstructions + 1 - m_line.size())));
+
+            if (!m_engine->decode(address, count, &m_decoded)) {
+                complete = false;
+            }
+
+            const uint64_t start = address;
+
+            for (const Instruction& inst : m_decoded) {
+                if (inst.address < start || inst.address >= range.end) {
+                    break;
+                }
+
+                m_line.append(Row{line, m_line.size(), inst});
+                address = inst.address + inst.size;
+            }
+
+            // Waiting for memory or at the end of the address space
+            if (address <= start || m_decoded.size() < count) {
+                break;
+            }
+        }
+    }
+
+    return complete;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const MixedModel::Row* MixedModel::row(int index) const {
+    const int i = m_anchor_row + index;
+
+    if (m_rows.isEmpty() || i < 0 || i >= m_rows.size()) {
+        return nullptr;
+    }
+
+    return &m_rows.at(i);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool MixedModel::fetch(int first, int count) {
+    if (m_line_count == 0 || count <= 0) {
+        return false;
+    }
+
+    count = qMin(count, int(MaxRows));
+
+    bool complete = true;
+
+    if (m_rows.isEmpty()) {
+        m_anchor_line = qBound(1, m_anchor_line, m_line_count);
+        complete = build_line(m_anchor_line);
+
+        // The line may have fewer rows than when the anchor was set (memory that was readable no longer is)
+        m_rows = m_line;
+        m_anchor_row = qMin(m_anchor_index, m_rows.size() - 1);
+        m_anchor_index = m_rows.at(m_anchor_row).index;
+    }
+
+    const int after = first + count - (m_rows.size() - m_anchor_row);
+
+    if (after > 0 && !fetch_after(after)) {
+        complete = false;
+    }
+
+    const int before = -first - m_anchor_row;
+
+    if (before > 0 && !fetch_before(before)) {
+        complete = false;
+    }
+
+    trim(first, count);
+
+    return complete;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// The window can end in the middle of a line (after a trim) so the last line is built again for the rows after it
+
+bool MixedModel::fetch_after(int count) {
+    int line = m_rows.last().line;
+    int after = m_rows.last().index;
+    bool complete = true;
+
+    while (count > 0 && line <= m_line_count) {
+        if (!build_line(line)) {
+            complete = false;
+        }
+
+        for (const Row& row : m_line) {
+            if (row.index > after) {
+                m_rows.append(row);
+                --count;
+            }
+        }
+
+        ++line;
+        after = -1;
+    }
+
+    return complete;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool MixedModel::fetch_before(int count) {
+    int line = m_rows.first().line;
+    int before = m_rows.first().index;
+    bool complete = true;
+
+    QVector<Row> rows;
+
+    while (count > 0) {
+        if (before == 0) {
+            if (--line < 1) {
+                break;
+            }
+
+            before = INT_MAX;
+        }
+
+        if (!build_line(line)) {
+            complete = false;
+        }
+
+        const int end = qMin(before, m_line.size());
+        rows = m_line.mid(0, end) + rows;
+        count -= end;
+        before = 0;
+    }
+
+    m_anchor_row += rows.size();
+    rows += m_rows;
+    m_rows.swap(rows);
+
+    return complete;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int MixedModel::move(int count) {
+    if (count == 0) {
+        return 0;
+    }
+
+    if (count > 0) {
+        fetch(0, count + 1);
+    } else {
+        fetch(count, 1 - count);
+    }
+
+    if (m_rows.isEmpty() || m_anchor_row < 0 || m_anchor_row >= m_rows.size()) {
+        return 0;
+    }
+
+    const int moved = qBound(0, m_anchor_row + count, m_rows.size() - 1) - m_anchor_row;
+
+    m_anchor_row += moved;
+    m_anchor_line = m_rows.at(m_anchor_row).line;
+    m_anchor_index = m_rows.at(m_anchor_row).index;
+
+    return moved;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Keeps MaxRows rows centered on the rows that were fetched last
+
+void MixedModel::trim(int first, int count) {
+    if (m_rows.size() <= MaxRows) {
+        return;
+    }
+
+    const int margin = (MaxRows - count) / 2;
+    const int end = qMin(m_rows.size(), qMax(0, m_anchor_row + first - margin) + int(MaxRows));
+    const int start = qMax(0, end - int(MaxRows));
+
+    m_rows = m_rows.mid(start, end - start);
+    m_anchor_row -= start;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
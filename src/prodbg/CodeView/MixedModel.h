@@ -0,0 +1,145 @@
+#pragma once
+
+#include <stdint.h>
+#include <QtCore/QByteArray>
+#include <QtCore/QObject>
+#include <QtCore/QPointer>
+#include <QtCore/QSharedPointer>
+#include <QtCore/QString>
+#include <QtCore/QVector>
+#include "Core/LineTable.h"
+#include "DisassemblyEngine.h"
+
+namespace prodbg {
+
+class LineTableStore;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Rows of a source file with the instructions of each line after it, for the mixed source/disassembly view.
+//
+// The instructions of a line are the address ranges the line table has for it (optimized code can have many of them)
+// decoded with the DisassemblyEngine of the session, so lines are mapped with a lookup in the LineTableStore and code
+// that has been shown before comes from the disassembly cache.
+//
+// Like DisassemblyModel rows are numbered relative to an anchor, which here is a source line and a row within it
+// (0 is the source line itself and n its n-th instruction). Only a window of at most MaxRows rows around the anchor
+// is built, a line at a time, so the cost of scrolling doesn't depend on the size of the file or how much code it
+// has. The window is dropped when the engine has new instructions or a new line table arrives and rows_changed is sent
+// so views fetch again.
+
+class MixedModel : public QObject {
+    Q_OBJECT
+
+   public:
+    typedef DisassemblyEngine::Instruction Instruction;
+
+    enum {
+        // Max number of rows kept around the anchor
+        MaxRows = 1024,
+        // Max number of instructions shown for one line (a bad line table can map a line to a whole section)
+        MaxLineInstructions = 512,
+    };
+
+    struct Row {
+        // 1-based line of the file the row belongs to
+        int line;
+        // 0 for the source line and n for the n-th instruction of it
+        int index;
+        // The instruction (only valid if index > 0)
+        Instruction inst;
+    };
+
+    explicit MixedModel(QObject* parent = nullptr);
+
+    void set_engine(DisassemblyEngine* engine);
+    DisassemblyEngine* engine() const { return m_engine; }
+
+    void set_line_tables(LineTableStore* line_tables);
+
+    // Loads the source file to show and moves the anchor to its first line. The path is looked up in the line table
+    // the same way as for breakpoints (see LineTable::find_file). Returns false if the file can't be read, in which
+    // case the lines that have code are still shown without their text
+    bool set_file(const QString& path);
+    const QString& file() const { return m_file; }
+
+    // Number of lines (the lines of the file or the last line with code if that is further down)
+    int line_count() const { return m_line_count; }
+
+    // Text of a line without the line break. Returns null (and 0 in length) if the file doesn't have the line
+    const char* source_line(int line, int* length) const;
+
+    // True if the line table has code for the line
+    bool has_code(int line) const;
+
+    // First line at or after line that has code (where a breakpoint on it ends up). -1 if there is none
+    int next_code_line(int line) const;
+
+    // File and line of the code at address in the current line table (file() if it's in the file shown). Returns
+    // false if there is none
+    bool location_of(uint64_t address, QString* file, int* line) const;
+
+    // Row within line of the instruction that covers address or 0 if it isn't one of the instructions of the line.
+    // Returns false if they are waiting for memory
+    bool index_of(int line, uint64_t address, int* index);
+
+    // Moves the anchor to the row at index of line and drops the window
+    void set_anchor(int line, int index = 0);
+    int anchor_line() const { return m_anchor_line; }
+    int anchor_index() const { return m_anchor_index; }
+
+    // Builds the rows [first, first + count) if they aren't in the window already. Returns false if some of them are
+    // waiting for memory (rows_changed is sent when it has arrived).
+    bool fetch(int first, int count);
+
+    // Row relative to the anchor or null if it hasn't been fetched
+    const Row* row(int index) const;
+
+    // Moves the anchor by count rows (negative moves up) and returns the number of rows actually moved, which is less
+    // than count at the ends of the file
+    int move(int count);
+
+    // Drops the window (the anchor stays) so rows are built again on the next fetch
+    void reset();
+
+    // Sent when rows that were fetched before may have changed
+    Q_SIGNAL void rows_changed();
+
+   private:
+    Q_SLOT void instructions_updated();
+    Q_SLOT void lines_changed();
+
+    void update_table();
+    bool build_line(int line);
+    bool fetch_after(int count);
+    bool fetch_before(int count);
+    void trim(int first, int count);
+
+    QPointer<DisassemblyEngine> m_engine;
+    QPointer<LineTableStore> m_line_tables;
+    QSharedPointer<const LineTable> m_table;
+
+    QString m_file;
+    // Id of the file in m_table (-1 if it has no code) and its lines that have code in increasing order
+    int m_file_id = -1;
+    QVector<int> m_code_lines;
+
+    // Contents of the file and the offset of each line in it (with the end of the file last)
+    QByteArray m_source;
+    QVector<int> m_line_starts;
+    int m_line_count = 0;
+
+    int m_anchor_line = 1;
+    int m_anchor_index = 0;
+
+    // Rows in file order and the index of the anchor row in them (only valid if m_rows isn't empty)
+    QVector<Row> m_rows;
+    int m_anchor_row = 0;
+
+    // Rows of the line built last by build_line
+    QVector<Row> m_line;
+    QVector<LineTable::Range> m_ranges;
+    QVector<Instruction> m_decoded;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
@@ -0,0 +1,759 @@
+#include "MixedView.h"
+#include "BreakpointModel.h"
+#include "Core/LineTableStore.h"
+#include "Core/SymbolIndex.h"
+#include "DisassemblyEngine.h"
+#include "MemoryView/GlyphAtlas.h"
+#include "MixedModel.h"
+
+#include <QtCore/QPointer>
+#include <QtGui/QMouseEvent>
+#include <QtGui/QPaintEvent>
+#include <QtGui/QPainter>
+#include <QtWidgets/QAction>
+#include <QtWidgets/QApplication>
+#include <QtWidgets/QMenu>
+#include <QtWidgets/QScrollBar>
+
+#include <stdlib.h>
+#include <algorithm>
+
+namespace prodbg {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static const char s_HexTable[] = "0123456789abcdef";
+
+enum {
+    // Chars left of the line numbers for the breakpoint and pc markers
+    kGutterChars = 3,
+    // Min width of the line numbers
+    kMinNumberChars = 4,
+    // Width of the mnemonic column
+    kMnemonicChars = 8,
+    // Tab stops in the source
+    kTabChars = 4,
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Painting works like in DisassemblyView: each visible row is formatted into a line of fixed width chars and drawn
+// with a glyph atlas (a dimmed one for the instructions) and line scrolling moves the pixels of the rows that stay
+// visible.
+
+class MixedViewPrivate {
+   public:
+    QPointer<IBackendRequests> m_Interface;
+    QPointer<DisassemblyEngine> m_Engine;
+    QPointer<BreakpointModel> m_Breakpoints;
+    QPointer<SymbolIndex> m_Symbols;
+
+    // Symbols used for the repaint in progress
+    QSharedPointer<const SymbolTable> m_SymbolTable;
+
+    MixedModel* m_Model = nullptr;
+    QScrollBar* m_ScrollBar = nullptr;
+
+    uint64_t m_Pc = 0;
+    bool m_HasPc = false;
+    // Line of the pc in the file shown (0 if it's somewhere else)
+    int m_PcLine = 0;
+    // The pc was shown before the code of its line was decoded so it's shown again once it has been
+    bool m_PcPending = false;
+
+    bool m_HasSelection = false;
+    int m_SelectedLine = 0;
+    int m_SelectedIndex = 0;
+    uint64_t m_SelectedAddress = 0;
+
+    int m_WheelSpeedRows = 3;
+    // Wheel movement that hasn't added up to a whole row yet
+    int m_WheelPixels = 0;
+
+    GlyphAtlas m_SourceGlyphs;
+    GlyphAtlas m_CodeGlyphs;
+    int m_CharWidth = 1;
+    int m_RowHeight = 1;
+    int m_Rows = 0;
+
+    // Anchor of the model at the last repaint
+    bool m_Painted = false;
+    int m_PaintedLine = 0;
+    int m_PaintedIndex = 0;
+
+    QByteArray m_Line;
+    QVector<int> m_BreakpointLines;
+    QVector<uint64_t> m_BreakpointAddresses;
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int addressWidth() const {
+        const int width = m_Engine ? m_Engine->address_width() : 0;
+        return width > 0 ? width : 8;
+    }
+
+    int numberChars() const {
+        int chars = 1;
+
+        for (int count = m_Model->line_count(); count >= 10; count /= 10) {
+            ++chars;
+        }
+
+        return std::max(chars, int(kMinNumberChars));
+    }
+
+    // Area the rows are painted in (everything except the scroll bar)
+    QRect textRect(QWidget* widget) const {
+        return QRect(0, 0, std::max(0, widget->width() - m_ScrollBar->width()), widget->height());
+    }
+
+    bool anchorPainted() const {
+        return m_Painted && m_PaintedLine == m_Model->anchor_line() && m_PaintedIndex == m_Model->anchor_index();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void updateLayout(QWidget* widget) {
+        const QPalette& palette = widget->palette();
+        const qreal ratio = widget->devicePixelRatioF();
+
+        m_SourceGlyphs.update(widget->font(), palette.color(QPalette::WindowText), ratio);
+        m_CodeGlyphs.update(widget->font(), palette.color(QPalette::Disabled, QPalette::WindowText), ratio);
+
+        m_CharWidth = std::max(1, m_SourceGlyphs.char_width());
+        m_RowHeight = std::max(1, m_SourceGlyphs.row_height());
+        m_Rows = (widget->height() + m_RowHeight - 1) / m_RowHeight;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // The scroll bar goes over the lines of the file
+
+    void syncScrollBar() {
+        m_ScrollBar->setRange(1, std::max(1, m_Model->line_count()));
+        m_ScrollBar->setPageStep(std::max(1, m_Rows));
+        m_ScrollBar->setValue(m_Model->anchor_line());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Scrolls by rowCount rows. If the rows are on screen already the ones that stay visible are moved instead of
+    // being painted again
+
+    void scrollRows(QWidget* widget, int rowCount) {
+        const bool moveRows = anchorPainted();
+        const int moved = m_Model->move(rowCount);
+
+        if (moved == 0) {
+            return;
+        }
+
+        syncScrollBar();
+
+        if (moveRows && abs(moved) < m_Rows) {
+            widget->scroll(0, -moved * m_RowHeight, textRect(widget));
+            m_PaintedLine = m_Model->anchor_line();
+            m_PaintedIndex = m_Model->anchor_index();
+        } else {
+            widget->update();
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Shows row index of line with a few rows before it
+
+    void showRow(QWidget* widget, int line, int index) {
+        m_Model->set_anchor(line, index);
+        m_Model->move(-(m_Rows / 4));
+        syncScrollBar();
+        widget->update();
+    }
+
+    void showFile(const QString& file) {
+        if (file != m_Model->file()) {
+            m_Model->set_file(file);
+            m_Painted = false;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Shows the line of the pc (switching to its file if needed) unless the pc row is visible already, so stepping
+    // within the rows on screen doesn't move them. Returns false if the line tables don't have the pc
+
+    bool showPc(QWidget* widget) {
+        QString file;
+        int line = 0;
+
+        m_PcPending = false;
+
+        if (!m_Model->location_of(m_Pc, &file, &line)) {
+            m_PcLine = 0;
+            widget->update();
+            return false;
+        }
+
+        showFile(file);
+        m_PcLine = line;
+
+        if (pcVisible()) {
+            widget->update();
+            return true;
+        }
+
+        int index = 0;
+        m_PcPending = !m_Model->index_of(line, m_Pc, &index);
+        showRow(widget, line, index);
+
+        return true;
+    }
+
+    bool pcVisible() {
+        m_Model->fetch(0, m_Rows);
+
+        for (int row = 0; row < m_Rows; ++row) {
+            const MixedModel::Row* r = m_Model->row(row);
+
+            if (r && r->index > 0 && r->inst.address == m_Pc) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Rows from one page above to one page below the view are fetched so page and line scrolling is ready. The
+    // breakpoints are looked up once for the lines and addresses on screen
+
+    void fetch() {
+        m_Model->fetch(-m_Rows, m_Rows * 3);
+
+        m_Painted = true;
+        m_PaintedLine = m_Model->anchor_line();
+        m_PaintedIndex = m_Model->anchor_index();
+
+        m_BreakpointLines.resize(0);
+        m_BreakpointAddresses.resize(0);
+
+        if (!m_Breakpoints) {
+            return;
+        }
+
+        int firstLine = 0;
+        int lastLine = 0;
+        uint64_t low = ~uint64_t(0);
+        uint64_t high = 0;
+
+        for (int row = 0; row < m_Rows; ++row) {
+            const MixedModel::Row* r = m_Model->row(row);
+
+            if (!r) {
+                break;
+            }
+
+            firstLine = firstLine ? firstLine : r->line;
+            lastLine = r->line;
+
+            if (r->index > 0) {
+                low = std::min(low, r->inst.address);
+                high = std::max(high, r->inst.address);
+            }
+        }
+
+        // The breakpoint model has the lines the way the source view uses them (0-based)
+        if (firstLine > 0) {
+            const int fileId = m_Breakpoints->find_file_id(m_Model->file());
+            m_Breakpoints->get_lines_in_range(fileId, firstLine - 1, lastLine - 1, &m_BreakpointLines);
+        }
+
+        if (low <= high) {
+            m_Breakpoints->get_addresses_in_range(low, high, &m_BreakpointAddresses);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Source lines are shown as Latin-1 with tabs expanded. Other chars (and each UTF-8 sequence) are shown as '?' so
+    // the columns still line up
+
+    void formatSource(int line) {
+        const int numberChars = this->numberChars();
+
+        m_Line.resize(0);
+        m_Line.append(kGutterChars, ' ');
+
+        const int numberStart = m_Line.size();
+        m_Line.append(numberChars, ' ');
+
+        for (int i = numberStart + numberChars - 1, value = line; i >= numberStart && value > 0; --i, value /= 10) {
+            m_Line[i] = char('0' + value % 10);
+        }
+
+        m_Line.append("  ");
+
+        int length = 0;
+        const char* text = m_Model->source_line(line, &length);
+        const int textStart = m_Line.size();
+
+        for (int i = 0; i < length; ++i) {
+            const uint8_t c = uint8_t(text[i]);
+
+            if (c == '\t') {
+                m_Line.append(kTabChars - (m_Line.size() - textStart) % kTabChars, ' ');
+            } else if (c >= 0x80 && c < 0xc0) {
+                continue;
+            } else if (c < ' ' || c >= 0x7f) {
+                m_Line.append('?');
+            } else {
+                m_Line.append(char(c));
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Instructions are indented past the line numbers. Jump and call targets get the symbol they go to
+
+    void formatInstruction(const DisassemblyEngine::Instruction& inst) {
+        const int width = addressWidth();
+        const QByteArray mnemonic = inst.mnemonic.toLatin1();
+
+        m_Line.resize(0);
+        m_Line.append(kGutterChars + numberChars() + 2, ' ');
+
+        for (int i = width * 2 - 1; i >= 0; --i) {
+            m_Line.append(s_HexTable[(inst.address >> (i * 4)) & 0xf]);
+        }
+
+        m_Line.append("  ");
+        m_Line.append(mnemonic);
+        m_Line.append(std::max(1, kMnemonicChars - mnemonic.size()), ' ');
+        m_Line.append(inst.operands.toLatin1());
+
+        if (m_SymbolTable && (inst.flags & DisassemblyEngine::HasTarget)) {
+            const int start = m_Line.size();
+            m_Line.append(" <");
+
+            if (m_SymbolTable->describe(inst.target, &m_Line)) {
+                m_Line.append('>');
+            } else {
+                m_Line.resize(start);
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void paintEvent(QWidget* widget, QPaintEvent* ev) {
+        const QPalette& palette = QApplication::palette();
+        const QColor baseColor = palette.base().color();
+        const QColor selectedColor = palette.alternateBase().color();
+        QColor pcColor = palette.highlight().color();
+        QColor pcLineColor = pcColor;
+        pcColor.setAlpha(96);
+        pcLineColor.setAlpha(40);
+
+        updateLayout(widget);
+        fetch();
+
+        if (m_Symbols) {
+            m_SymbolTable = m_Symbols->table();
+        }
+
+        QPainter painter(widget);
+        painter.setRenderHint(QPainter::Antialiasing);
+
+        const QRect area = textRect(widget);
+        const int gutterWidth = kGutterChars * m_CharWidth;
+
+        for (const QRect& dirty : ev->region()) {
+            const QRect rect = dirty.intersected(area);
+
+            if (rect.isEmpty()) {
+                continue;
+            }
+
+            painter.fillRect(rect, baseColor);
+
+            const int firstRow = std::max(0, rect.top() / m_RowHeight);
+            const int lastRow = std::min(m_Rows - 1, rect.bottom() / m_RowHeight);
+            const int firstColumn = std::max(0, rect.left() / m_CharWidth);
+            const int lastColumn = rect.right() / m_CharWidth;
+
+            for (int index = firstRow; index <= lastRow; ++index) {
+                const MixedModel::Row* row = m_Model->row(index);
+
+                if (!row) {
+                    continue;
+                }
+
+                const int y = index * m_RowHeight;
+                const bool isCode = row->index > 0;
+                const bool isPc = m_HasPc && isCode && row->inst.address == m_Pc;
+
+                if (isPc) {
+                    painter.fillRect(rect.left(), y, rect.width(), m_RowHeight, pcColor);
+                } else if (m_HasSelection && row->line == m_SelectedLine && row->index == m_SelectedIndex) {
+                    painter.fillRect(rect.left(), y, rect.width(), m_RowHeight, selectedColor);
+                } else if (!isCode && row->line == m_PcLine) {
+                    painter.fillRect(rect.left(), y, rect.width(), m_RowHeight, pcLineColor);
+                }
+
+                if (rect.left() < gutterWidth) {
+                    paintMarkers(&painter, *row, y, isPc);
+                }
+
+                if (isCode) {
+                    formatInstruction(row->inst);
+                } else {
+                    formatSource(row->line);
+                }
+
+                if (firstColumn < m_Line.size()) {
+                    const GlyphAtlas& glyphs = isCode ? m_CodeGlyphs : m_SourceGlyphs;
+                    const int count = std::min(lastColumn + 1, m_Line.size()) - firstColumn;
+                    glyphs.draw(&painter, firstColumn * m_CharWidth, y, m_Line.constData() + firstColumn, count);
+                }
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Source lines get their breakpoint (or a small mark if the line has code a breakpoint can go on) and
+    // instructions their address breakpoint and the pc arrow
+
+    void paintMarkers(QPainter* painter, const MixedModel::Row& row, int y, bool isPc) const {
+        const int size = std::min(m_CharWidth, m_RowHeight) - 2;
+        const int top = y + (m_RowHeight - size) / 2;
+
+        painter->setPen(Qt::NoPen);
+
+        if (row.index == 0) {
+            if (std::binary_search(m_BreakpointLines.begin(), m_BreakpointLines.end(), row.line - 1)) {
+                painter->setBrush(QColor(Qt::red));
+                painter->drawEllipse(1, top, size, size);
+            } else if (m_Model->has_code(row.line)) {
+                const int mark = std::max(2, size / 3);
+                painter->setBrush(QColor(Qt::gray));
+                painter->drawEllipse(1 + (size - mark) / 2, top + (size - mark) / 2, mark, mark);
+            }
+
+            return;
+        }
+
+        if (std::binary_search(m_BreakpointAddresses.begin(), m_BreakpointAddresses.end(), row.inst.address)) {
+            painter->setBrush(QColor(Qt::red));
+            painter->drawEllipse(1, top, size, size);
+        }
+
+        if (isPc) {
+            const int x = m_CharWidth + 1;
+            const QPoint arrow[3] = {QPoint(x, top), QPoint(x + size, top + size / 2), QPoint(x, top + size)};
+
+            painter->setBrush(QColor(Qt::yellow));
+            painter->drawPolygon(arrow, 3);
+        }
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+MixedView::MixedView(QWidget* parent) : Base(parent), m_Private(new MixedViewPrivate) {
+    // Can be any fixed with font.
+#ifdef _WIN32
+    QFont font(QStringLiteral("Courier"), 11);
+#else
+    QFont font(QStringLiteral("Courier"), 13);
+#endif
+
+    font.setFixedPitch(true);
+    setFont(font);
+
+    setFocusPolicy(Qt::StrongFocus);
+
+    // All of the widget is painted from the model so Qt doesn't need to clear the background first
+    setAttribute(Qt::WA_OpaquePaintEvent);
+
+    m_Private->m_Model = new MixedModel(this);
+    connect(m_Private->m_Model, &MixedModel::rows_changed, this, &MixedView::rowsChanged);
+
+    m_Private->m_ScrollBar = new QScrollBar(Qt::Vertical, this);
+    m_Private->m_ScrollBar->setSingleStep(1);
+    m_Private->syncScrollBar();
+    connect(m_Private->m_ScrollBar, &QScrollBar::actionTriggered, this, &MixedView::scrollBarAction);
+
+    {
+        QAction* nextPageAction = new QAction(QStringLiteral("Next Page"), this);
+        nextPageAction->setShortcut(QKeySequence::MoveToNextPage);
+        nextPageAction->setShortcutContext(Qt::WidgetShortcut);
+        this->addAction(nextPageAction);
+        connect(nextPageAction, &QAction::triggered, this, &MixedView::displayNextPage);
+    }
+
+    {
+        QAction* prevPageAction = new QAction(QStringLiteral("Previous Page"), this);
+        prevPageAction->setShortcut(QKeySequence::MoveToPreviousPage);
+        prevPageAction->setShortcutContext(Qt::WidgetShortcut);
+        this->addAction(prevPageAction);
+        connect(prevPageAction, &QAction::triggered, this, &MixedView::displayPrevPage);
+    }
+
+    {
+        QAction* nextLineAction = new QAction(QStringLiteral("Next Line"), this);
+        nextLineAction->setShortcut(QKeySequence::MoveToNextLine);
+        nextLineAction->setShortcutContext(Qt::WidgetShortcut);
+        this->addAction(nextLineAction);
+        connect(nextLineAction, &QAction::triggered, this, &MixedView::displayNextLine);
+    }
+
+    {
+        QAction* prevLineAction = new QAction(QStringLiteral("Previous Line"), this);
+        prevLineAction->setShortcut(QKeySequence::MoveToPreviousLine);
+        prevLineAction->setShortcutContext(Qt::WidgetShortcut);
+        this->addAction(prevLineAction);
+        connect(prevLineAction, &QAction::triggered, this, &MixedView::displayPrevLine);
+    }
+
+    {
+        QAction* breakpointAction = new QAction(QStringLiteral("Toggle Breakpoint"), this);
+        breakpointAction->setShortcut(QKeySequence(Qt::Key_F9));
+        breakpointAction->setShortcutContext(Qt::WidgetShortcut);
+        this->addAction(breakpointAction);
+        connect(breakpointAction, &QAction::triggered, this, &MixedView::toggleBreakpoint);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+MixedView::~MixedView() {
+    delete m_Private;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MixedView::set_backend_interface(IBackendRequests* interface) {
+    if (m_Private->m_Interface) {
+        disconnect(m_Private->m_Interface, nullptr, this, nullptr);
+    }
+
+    if (m_Private->m_Symbols) {
+        disconnect(m_Private->m_Symbols, nullptr, this, nullptr);
+    }
+
+    m_Private->m_Interface = interface;
+    m_Private->m_Engine = DisassemblyEngine::for_interface(interface);
+    m_Private->m_Symbols = SymbolIndex::for_interface(interface);
+    m_Private->m_SymbolTable.reset();
+    m_Private->m_Model->set_engine(m_Private->m_Engine);
+    m_Private->m_Model->set_line_tables(LineTableStore::for_interface(interface));
+    m_Private->m_HasPc = false;
+    m_Private->m_PcLine = 0;
+    m_Private->m_PcPending = false;
+    m_Private->m_Painted = false;
+
+    if (interface) {
+        connect(interface, &IBackendRequests::program_counter_changed, this, &MixedView::programCounterChanged);
+        connect(m_Private->m_Symbols, &SymbolIndex::symbols_changed, this, [this]() { update(); });
+    }
+
+    m_Private->syncScrollBar();
+    update();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MixedView::setBreakpointModel(BreakpointModel* breakpoints) {
+    if (m_Private->m_Breakpoints) {
+        disconnect(m_Private->m_Breakpoints, nullptr, this, nullptr);
+    }
+
+    m_Private->m_Breakpoints = breakpoints;
+
+    if (breakpoints) {
+        connect(breakpoints, &BreakpointModel::changed, this, [this]() { update(); });
+    }
+
+    update();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+MixedModel* MixedView::model() const { return m_Private->m_Model; }
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Backends without line tables still send the file and line of the pc, which is shown without the pc row
+
+void MixedView::programCounterChanged(const IBackendRequests::ProgramCounterChange& pc) {
+    m_Private->m_Pc = pc.pc;
+    m_Private->m_HasPc = true;
+
+    if (!m_Private->showPc(this) && !pc.filename.isEmpty() && pc.line > 0) {
+        showFileLine(pc.filename, pc.line);
+        m_Private->m_PcLine = pc.line;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MixedView::updatePc(uint64_t pc) {
+    m_Private->m_Pc = pc;
+    m_Private->m_HasPc = true;
+    m_Private->showPc(this);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MixedView::showFileLine(const QString& file, int line) {
+    m_Private->showFile(file);
+    m_Private->showRow(this, line, 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Breakpoints on source lines without code go to the next line that has code, as that's where the backend would put
+// them
+
+void MixedView::toggleBreakpoint() {
+    BreakpointModel* breakpoints = m_Private->m_Breakpoints;
+
+    if (!breakpoints) {
+        return;
+    }
+
+    if (m_Private->m_HasSelection && m_Private->m_SelectedIndex == 0) {
+        const int codeLine = m_Private->m_Model->next_code_line(m_Private->m_SelectedLine);
+        const int line = codeLine > 0 ? codeLine : m_Private->m_SelectedLine;
+
+        breakpoints->toggle_file_line_breakpoint(m_Private->m_Model->file(), line - 1);
+    } else if (m_Private->m_HasSelection) {
+        breakpoints->toggle_address_breakpoint(m_Private->m_SelectedAddress);
+    } else if (m_Private->m_HasPc) {
+        breakpoints->toggle_address_breakpoint(m_Private->m_Pc);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Rows that were fetched before may be different so everything is painted again. A pc that was shown before its
+// code had been decoded is shown again now that the row for it exists
+
+void MixedView::rowsChanged() {
+    m_Private->m_Painted = false;
+
+    if (m_Private->m_PcPending && m_Private->m_HasPc) {
+        m_Private->showPc(this);
+        return;
+    }
+
+    m_Private->syncScrollBar();
+    update();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Steps of the scroll bar scroll by rows while dragging it moves through the lines of the file
+
+void MixedView::scrollBarAction(int action) {
+    QScrollBar* scrollBar = m_Private->m_ScrollBar;
+
+    switch (action) {
+        case QAbstractSlider::SliderSingleStepAdd:
+            displayNextLine();
+            break;
+        case QAbstractSlider::SliderSingleStepSub:
+            displayPrevLine();
+            break;
+        case QAbstractSlider::SliderPageStepAdd:
+            displayNextPage();
+            break;
+        case QAbstractSlider::SliderPageStepSub:
+            displayPrevPage();
+            break;
+        case QAbstractSlider::SliderMove:
+            m_Private->m_Model->set_anchor(scrollBar->sliderPosition());
+            update();
+            return;
+        default:
+            return;
+    }
+
+    scrollBar->setSliderPosition(m_Private->m_Model->anchor_line());
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MixedView::paintEvent(QPaintEvent* ev) { m_Private->paintEvent(this, ev); }
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MixedView::resizeEvent(QResizeEvent* ev) {
+    Base::resizeEvent(ev);
+
+    const int scrollBarWidth = m_Private->m_ScrollBar->sizeHint().width();
+    m_Private->m_ScrollBar->setGeometry(width() - scrollBarWidth, 0, scrollBarWidth, height());
+    m_Private->m_Painted = false;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Wheel and touchpad movement is added up and scrolled by whole rows
+
+void MixedView::wheelEvent(QWheelEvent* ev) {
+    const int rowHeight = m_Private->m_RowHeight;
+    int pixels = ev->pixelDelta().y();
+
+    if (pixels == 0) {
+        pixels = ev->angleDelta().y() * m_Private->m_WheelSpeedRows * rowHeight / 120;
+    }
+
+    m_Private->m_WheelPixels -= pixels;
+
+    const int rows = m_Private->m_WheelPixels / rowHeight;
+    m_Private->m_WheelPixels -= rows * rowHeight;
+
+    if (rows != 0) {
+        m_Private->scrollRows(this, rows);
+    }
+
+    ev->accept();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Clicking a row selects it and clicking in the gutter toggles the breakpoint on it
+
+void MixedView::mousePressEvent(QMouseEvent* ev) {
+    const MixedModel::Row* row = m_Private->m_Model->row(ev->pos().y() / m_Private->m_RowHeight);
+
+    if (!row) {
+        return;
+    }
+
+    m_Private->m_HasSelection = true;
+    m_Private->m_SelectedLine = row->line;
+    m_Private->m_SelectedIndex = row->index;
+    m_Private->m_SelectedAddress = row->index > 0 ? row->inst.address : 0;
+
+    if (ev->button() == Qt::LeftButton && ev->pos().x() < kGutterChars * m_Private->m_CharWidth) {
+        toggleBreakpoint();
+    }
+
+    update();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MixedView::contextMenuEvent(QContextMenuEvent* ev) {
+    QMenu contextMenu;
+    contextMenu.addActions(actions());
+    contextMenu.exec(mapToGlobal(ev->pos()));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MixedView::displayNextPage() { m_Private->scrollRows(this, std::max(1, m_Private->m_Rows - 1)); }
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MixedView::displayPrevPage() { m_Private->scrollRows(this, -std::max(1, m_Private->m_Rows - 1)); }
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MixedView::displayNextLine() { m_Private->scrollRows(this, 1); }
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MixedView::displayPrevLine() { m_Private->scrollRows(this, -1); }
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
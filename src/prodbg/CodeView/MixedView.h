@@ -0,0 +1,66 @@
+#pragma once
+
+#include <stdint.h>
+#include <QtWidgets/QWidget>
+#include "Backend/IBackendRequests.h"
+
+namespace prodbg {
+
+class BreakpointModel;
+class MixedModel;
+class MixedViewPrivate;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Source file with the disassembly of each line interleaved after it.
+//
+// Rows come from a MixedModel which maps lines to code with the line tables of the session and decodes it with the
+// disassembly engine, and only the visible rows are painted (the same way as DisassemblyView). The view follows the
+// pc into the file and line it's in, so stepping through optimized code shows the line together with the instruction
+// that is about to run. The scroll bar goes over the lines of the file while wheel and keys scroll by rows.
+
+class MixedView : public QWidget {
+    Q_OBJECT
+    using Base = QWidget;
+
+   public:
+    explicit MixedView(QWidget* parent = nullptr);
+    virtual ~MixedView();
+
+    void set_backend_interface(IBackendRequests* interface);
+    void setBreakpointModel(BreakpointModel* breakpoints);
+
+    // Marks pc as the current location of the target and shows the line it's in unless it's visible already
+    void updatePc(uint64_t pc);
+
+    // Shows line (1-based) of file
+    void showFileLine(const QString& file, int line);
+
+    // Toggles the breakpoint at the selected row (or the pc if nothing is selected). Source lines get a file/line
+    // breakpoint and instructions an address breakpoint
+    void toggleBreakpoint();
+
+    MixedModel* model() const;
+
+   protected:
+    void paintEvent(QPaintEvent* ev) override;
+    void resizeEvent(QResizeEvent* ev) override;
+    void wheelEvent(QWheelEvent* ev) override;
+    void mousePressEvent(QMouseEvent* ev) override;
+    void contextMenuEvent(QContextMenuEvent* ev) override;
+
+   public:
+    Q_SLOT void displayNextPage();
+    Q_SLOT void displayPrevPage();
+    Q_SLOT void displayNextLine();
+    Q_SLOT void displayPrevLine();
+
+   private:
+    Q_SLOT void rowsChanged();
+    Q_SLOT void scrollBarAction(int action);
+    Q_SLOT void programCounterChanged(const IBackendRequests::ProgramCounterChange& pc);
+
+    MixedViewPrivate* m_Private;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <stdint.h>
+#include <QtCore/QVector>
+
+namespace prodbg {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Registers an instruction reads or writes as a bitmask.
+//
+// Capstone register ids go up to a few hundred on some archs while an instruction only touches a handful of them and
+// a program a few dozen, so instead of one bit per id the bits are handed out by a RegisterTable in the order the
+// registers are first seen. The bits of a set only mean something together with the table that made it.
+
+struct RegisterSet {
+    enum {
+        MaxRegisters = 128,
+    };
+
+    uint64_t bits[MaxRegisters / 64] = {};
+
+    bool is_empty() const { return (bits[0] | bits[1]) == 0; }
+    bool contains(int bit) const { return (bits[bit >> 6] >> (bit & 63)) & 1; }
+    void insert(int bit) { bits[bit >> 6] |= uint64_t(1) << (bit & 63); }
+    bool intersects(const RegisterSet& other) const {
+        return ((bits[0] & other.bits[0]) | (bits[1] & other.bits[1])) != 0;
+    }
+
+    RegisterSet& operator|=(const RegisterSet& other) {
+        bits[0] |= other.bits[0];
+        bits[1] |= other.bits[1];
+        return *this;
+    }
+
+    bool operator==(const RegisterSet& other) const {
+        return bits[0] == other.bits[0] && bits[1] == other.bits[1];
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Bits of the Capstone register ids seen so far. Registers seen after all MaxRegisters bits are used are left out of
+// the sets (no real program gets there).
+
+class RegisterTable {
+   public:
+    // Bit of the register id (assigned on first use). Returns -1 if the table is full
+    int bit(uint16_t id) {
+        if (id < m_bits.size() && m_bits.at(id) >= 0) {
+            return m_bits.at(id);
+        }
+
+        if (m_ids.size() >= RegisterSet::MaxRegisters) {
+            return -1;
+        }
+
+        if (id >= m_bits.size()) {
+            m_bits.insert(m_bits.size(), id + 1 - m_bits.size(), int16_t(-1));
+        }
+
+        m_bits[id] = int16_t(m_ids.size());
+        m_ids.append(id);
+
+        return m_bits.at(id);
+    }
+
+    // Register id of a bit
+    uint16_t id(int bit) const { return m_ids.at(bit); }
+
+    // Register ids in bit order
+    const QVector<uint16_t>& ids() const { return m_ids; }
+    int size() const { return m_ids.size(); }
+
+    void clear() {
+        m_ids.clear();
+        m_bits.clear();
+    }
+
+   private:
+    QVector<uint16_t> m_ids;
+    QVector<int16_t> m_bits;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
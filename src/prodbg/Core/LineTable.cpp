@@ -0,0 +1,244 @@
+#include "LineTable.h"
+#include <algorithm>
+#include <numeric>
+
+namespace prodbg {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void LineTable::add_unit(const QString& name, const QStringList& files, const Row* rows, int count) {
+    // Files are shared between units (headers) so they get the same id in all of them
+
+    QVector<int> ids;
+    ids.reserve(files.size());
+
+    for (const QString& path : files) {
+        int id = m_file_ids.value(path, -1);
+
+        if (id < 0) {
+            id = m_files.size();
+            m_file_ids.insert(path, id);
+            m_files.append(path);
+        }
+
+        ids.append(id);
+    }
+
+    Unit unit = {name, UINT64_MAX, 0};
+
+    for (int i = 0; i < count; ++i) {
+        const Row& row = rows[i];
+
+        if (row.line != 0 && row.file >= uint32_t(ids.size())) {
+            continue;
+        }
+
+        m_addresses.append(row.address);
+        m_row_files.append(row.line != 0 ? ids.at(int(row.file)) : -1);
+        m_lines.append(row.line);
+
+        unit.start = std::min(unit.start, row.address);
+        unit.end = std::max(unit.end, row.address);
+    }
+
+    if (unit.start <= unit.end) {
+        m_units.append(unit);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void LineTable::finish() {
+    const int count = m_addresses.size();
+    QVector<int> order(count);
+    std::iota(order.begin(), order.end(), 0);
+
+    // Units come in any order. Within a unit the order of rows at the same address matters (see below) so the sort is
+    // stable
+
+    std::stable_sort(order.begin(), order.end(),
+                     [this](int a, int b) { return m_addresses.at(a) < m_addresses.at(b); });
+
+    QVector<uint64_t> addresses;
+    QVector<int> files;
+    QVector<uint32_t> lines;
+    addresses.reserve(count);
+    files.reserve(count);
+    lines.reserve(count);
+
+    for (int i = 0; i < count;) {
+        // Of the rows at one address the last one with a line is used. The others cover no code, and a sequence
+        // ending where the next one starts doesn't hide its first row
+
+        const uint64_t address = m_addresses.at(order.at(i));
+        int pick = order.at(i);
+
+        for (; i < count && m_addresses.at(order.at(i)) == address; ++i) {
+            if (m_lines.at(order.at(i)) != 0 || m_lines.at(pick) == 0) {
+                pick = order.at(i);
+            }
+        }
+
+        const int file = m_row_files.at(pick);
+        const uint32_t line = m_lines.at(pick);
+
+        // Rows that continue the line of the row before them don't change anything
+        if (!lines.isEmpty() && lines.last() == line && files.last() == file) {
+            continue;
+        }
+
+        addresses.append(address);
+        files.append(file);
+        lines.append(line);
+    }
+
+    m_addresses.swap(addresses);
+    m_row_files.swap(files);
+    m_lines.swap(lines);
+
+    std::sort(m_units.begin(), m_units.end(), [](const Unit& a, const Unit& b) { return a.start < b.start; });
+
+    // Line index. The rows are already in address order so a stable sort by file and line gives the address order
+    // within each line
+
+    m_by_line.resize(0);
+    m_by_line.reserve(m_addresses.size());
+
+    for (int i = 0, rows = m_addresses.size(); i < rows; ++i) {
+        if (m_lines.at(i) != 0) {
+            m_by_line.append(i);
+        }
+    }
+
+    std::stable_sort(m_by_line.begin(), m_by_line.end(), [this](int a, int b) {
+        if (m_row_files.at(a) != m_row_files.at(b)) {
+            return m_row_files.at(a) < m_row_files.at(b);
+        }
+
+        return m_lines.at(a) < m_lines.at(b);
+    });
+
+    m_file_rows.fill(0, m_files.size() + 1);
+
+    for (int index : m_by_line) {
+        m_file_rows[m_row_files.at(index) + 1]++;
+    }
+
+    for (int i = 0, files_count = m_files.size(); i < files_count; ++i) {
+        m_file_rows[i + 1] += m_file_rows.at(i);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int LineTable::find_file(const QString& path) const {
+    auto it = m_file_ids.constFind(path);
+
+    if (it != m_file_ids.constEnd()) {
+        return it.value();
+    }
+
+    QString wanted = path;
+    wanted.replace(QLatin1Char('\\'), QLatin1Char('/'));
+
+    for (int i = 0, count = m_files.size(); i < count; ++i) {
+        QString name = m_files.at(i);
+        name.replace(QLatin1Char('\\'), QLatin1Char('/'));
+
+        const QString& longer = name.size() > wanted.size() ? name : wanted;
+        const QString& shorter = name.size() > wanted.size() ? wanted : name;
+
+        // The shorter path has to match whole directories at the end of the longer one
+        if (longer.endsWith(shorter) &&
+            (longer.size() == shorter.size() || longer.at(longer.size() - shorter.size() - 1) == QLatin1Char('/'))) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool LineTable::location(uint64_t address, Location* out) const {
+    auto it = std::upper_bound(m_addresses.begin(), m_addresses.end(), address);
+
+    if (it == m_addresses.begin()) {
+        return false;
+    }
+
+    const int index = int(it - m_addresses.begin()) - 1;
+
+    if (m_lines.at(index) == 0) {
+        return false;
+    }
+
+    out->file = m_row_files.at(index);
+    out->line = int(m_lines.at(index));
+    out->start = m_addresses.at(index);
+    out->end = index + 1 < m_addresses.size() ? m_addresses.at(index + 1) : UINT64_MAX;
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int LineTable::ranges(int file, int line, QVector<Range>* out) const {
+    if (file < 0 || file >= m_files.size()) {
+        return 0;
+    }
+
+    auto it = std::lower_bound(m_by_line.begin() + file_begin(file), m_by_line.begin() + file_end(file), line,
+                               [this](int index, int value) { return int(m_lines.at(index)) < value; });
+    const auto end = m_by_line.begin() + file_end(file);
+
+    int added = 0;
+
+    for (; it != end && int(m_lines.at(*it)) == line; ++it) {
+        const int index = *it;
+        const uint64_t start = m_addresses.at(index);
+        const uint64_t stop = index + 1 < m_addresses.size() ? m_addresses.at(index + 1) : UINT64_MAX;
+
+        if (added > 0 && out->last().end == start) {
+            out->last().end = stop;
+            continue;
+        }
+
+        out->append({start, stop});
+        ++added;
+    }
+
+    return added;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int LineTable::next_line(int file, int line) const {
+    if (file < 0 || file >= m_files.size()) {
+        return -1;
+    }
+
+    auto it = std::lower_bound(m_by_line.begin() + file_begin(file), m_by_line.begin() + file_end(file), line,
+                               [this](int index, int value) { return int(m_lines.at(index)) < value; });
+
+    return it != m_by_line.begin() + file_end(file) ? int(m_lines.at(*it)) : -1;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void LineTable::lines(int file, QVector<int>* out) const {
+    if (file < 0 || file >= m_files.size()) {
+        return;
+    }
+
+    for (int i = file_begin(file), end = file_end(file); i < end; ++i) {
+        const int line = int(m_lines.at(m_by_line.at(i)));
+
+        if (out->isEmpty() || out->last() != line) {
+            out->append(line);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
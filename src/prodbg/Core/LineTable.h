@@ -0,0 +1,103 @@
+#pragma once
+
+#include <stdint.h>
+#include <QtCore/QHash>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+#include <QtCore/QVector>
+
+namespace prodbg {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Mapping between addresses and source lines for all compile units of the target.
+//
+// The rows of the units (as sent by the backend, see pd_line_table.h) are kept sorted by address in flat arrays, so
+// the line of an address is a binary search. A second array has the row indices sorted by file, line and address with
+// the start of each file in it, so the code of a line is a binary search within its file.
+//
+// Units are added and then finish is called once, after which the table doesn't change. Tables are shared between
+// threads as QSharedPointer<const LineTable> (see LineTableStore).
+
+class LineTable {
+   public:
+    struct Row {
+        uint64_t address;
+        // Index into the files of the unit the row was added with
+        uint32_t file;
+        // 0 ends a sequence of code
+        uint32_t line;
+    };
+
+    struct Unit {
+        QString name;
+        // Range of addresses the rows of the unit cover
+        uint64_t start;
+        uint64_t end;
+    };
+
+    struct Location {
+        int file;
+        int line;
+        // Addresses covered by the row
+        uint64_t start;
+        uint64_t end;
+    };
+
+    struct Range {
+        uint64_t start;
+        uint64_t end;
+    };
+
+    // Adds the rows of a compile unit. Rows are in address order and refer to files by their index in files
+    void add_unit(const QString& name, const QStringList& files, const Row* rows, int count);
+
+    // Sorts the rows and builds the line index. Must be called before any lookups
+    void finish();
+
+    bool is_empty() const { return m_addresses.isEmpty(); }
+    int row_count() const { return m_addresses.size(); }
+
+    int unit_count() const { return m_units.size(); }
+    const Unit& unit(int index) const { return m_units.at(index); }
+
+    int file_count() const { return m_files.size(); }
+    const QString& file(int id) const { return m_files.at(id); }
+
+    // Id of the file at path. Paths the backend sent may not be spelled the same way as the ones the UI has (relative
+    // to the build directory and such) so if there is no exact match a file with the same name where one path ends
+    // with the other is used. -1 if there is none
+    int find_file(const QString& path) const;
+
+    // File and line of the code at address. Returns false if address isn't in any row
+    bool location(uint64_t address, Location* out) const;
+
+    // Address ranges of the code generated for line in address order. Rows next to each other are joined. Optimized
+    // code can have many ranges for a line. Returns the number of ranges added to out
+    int ranges(int file, int line, QVector<Range>* out) const;
+
+    // First line at or after line in file that has code (where a breakpoint on line ends up). -1 if there is none
+    int next_line(int file, int line) const;
+
+    // Lines of file that have code in increasing order (for breakpoint margins)
+    void lines(int file, QVector<int>* out) const;
+
+   private:
+    int file_begin(int file) const { return m_file_rows.at(file); }
+    int file_end(int file) const { return m_file_rows.at(file + 1); }
+
+    QStringList m_files;
+    QHash<QString, int> m_file_ids;
+    QVector<Unit> m_units;
+
+    // Rows in address order
+    QVector<uint64_t> m_addresses;
+    QVector<int> m_row_files;
+    QVector<uint32_t> m_lines;
+
+    // Rows with a line, sorted by file, line and address. The rows of file n start at m_file_rows[n]
+    QVector<int> m_by_line;
+    QVector<int> m_file_rows;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
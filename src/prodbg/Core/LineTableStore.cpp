@@ -0,0 +1,95 @@
+#include "LineTableStore.h"
+
+namespace prodbg {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+LineTableStore::LineTableStore(IBackendRequests* interface, QObject* parent)
+    : QObject(parent), m_interface(interface), m_table(new LineTable) {
+    if (!interface) {
+        return;
+    }
+
+    connect(interface, &IBackendRequests::line_table_received, this, &LineTableStore::table_received);
+    connect(interface, &IBackendRequests::program_counter_changed, this, &LineTableStore::program_counter_changed);
+    connect(interface, &IBackendRequests::session_ended, this, &LineTableStore::session_ended);
+
+    interface->request_line_table();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+LineTableStore* LineTableStore::for_interface(IBackendRequests* interface) {
+    if (!interface) {
+        return nullptr;
+    }
+
+    LineTableStore* store = interface->findChild<LineTableStore*>(QString(), Qt::FindDirectChildrenOnly);
+
+    return store ? store : new LineTableStore(interface, interface);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool LineTableStore::line_of(uint64_t address, QString* file, int* line) const {
+    LineTable::Location location;
+
+    if (!m_table->location(address, &location)) {
+        return false;
+    }
+
+    *file = m_table->file(location.file);
+    *line = location.line;
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool LineTableStore::address_of(const QString& file, int line, uint64_t* address) const {
+    const int id = m_table->find_file(file);
+    const int code_line = m_table->next_line(id, line);
+
+    QVector<LineTable::Range> ranges;
+
+    if (code_line < 0 || m_table->ranges(id, code_line, &ranges) == 0) {
+        return false;
+    }
+
+    *address = ranges.first().start;
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void LineTableStore::table_received(const QSharedPointer<const LineTable>& table) {
+    m_table = table;
+    lines_changed();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void LineTableStore::program_counter_changed() {
+    if (m_requested_at_stop || !m_interface) {
+        return;
+    }
+
+    m_requested_at_stop = true;
+    m_interface->request_line_table();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void LineTableStore::session_ended() {
+    m_requested_at_stop = false;
+
+    if (m_table->is_empty()) {
+        return;
+    }
+
+    m_table.reset(new LineTable);
+    lines_changed();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <stdint.h>
+#include <QtCore/QObject>
+#include <QtCore/QPointer>
+#include <QtCore/QSharedPointer>
+#include "Backend/IBackendRequests.h"
+#include "LineTable.h"
+
+namespace prodbg {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Line tables of the target shared by all views of a session.
+//
+// The backend sends the line tables of all compile units in one reply (see pd_line_table.h) which is sorted and
+// indexed on the session thread. The store asks for them when it's created and once more at the first stop, as
+// position independent code only gets its final addresses when the process has been started. After that mapping the
+// pc to a line, finding the code of a line for breakpoints and mixed source/disassembly are lookups in the table
+// without asking the backend.
+
+class LineTableStore : public QObject {
+    Q_OBJECT
+
+   public:
+    explicit LineTableStore(IBackendRequests* interface, QObject* parent = nullptr);
+
+    // Store shared by all views for the interface. Created on first use and owned by the interface
+    static LineTableStore* for_interface(IBackendRequests* interface);
+
+    // Current line tables. Never null (empty until the backend has replied)
+    QSharedPointer<const LineTable> table() const { return m_table; }
+
+    // File and line of the code at address. Returns false if there is no line information for it
+    bool line_of(uint64_t address, QString* file, int* line) const;
+
+    // First address of the code of line (or of the first line after it with code, which is where a breakpoint on it
+    // ends up). Returns false if the file isn't known or has no code from line on
+    bool address_of(const QString& file, int line, uint64_t* address) const;
+
+    // Sent when a new table has arrived (or the old one was dropped at the end of the session)
+    Q_SIGNAL void lines_changed();
+
+   private:
+    Q_SLOT void table_received(const QSharedPointer<const LineTable>& table);
+    Q_SLOT void program_counter_changed();
+    Q_SLOT void session_ended();
+
+    QPointer<IBackendRequests> m_interface;
+    QSharedPointer<const LineTable> m_table;
+    bool m_requested_at_stop = false;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
@@ -0,0 +1,391 @@
+#include "MemorySearch.h"
+#include <string.h>
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PD_SEARCH_SSE2 1
+#include <emmintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(PD_SEARCH_SSE2) && (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define PD_SEARCH_AVX2 1
+#include <immintrin.h>
+#endif
+
+namespace prodbg {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void append_value(QByteArray* bytes, uint64_t value, int size, bool big_endian) {
+    for (int i = 0; i < size; ++i) {
+        int shift = big_endian ? (size - 1 - i) * 8 : i * 8;
+        bytes->append(char((value >> shift) & 0xff));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static int hex_value(QChar c) {
+    ushort u = c.unicode();
+
+    if (u >= '0' && u <= '9') {
+        return u - '0';
+    } else if (u >= 'a' && u <= 'f') {
+        return u - 'a' + 10;
+    } else if (u >= 'A' && u <= 'F') {
+        return u - 'A' + 10;
+    }
+
+    return -1;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static bool parse_hex(const QString& query, SearchPattern* pattern, QString* error) {
+    QString digits = query;
+    digits.remove(QLatin1Char(' '));
+
+    if (digits.startsWith(QStringLiteral("0x"))) {
+        digits.remove(0, 2);
+    }
+
+    if (digits.isEmpty() || (digits.size() & 1)) {
+        *error = QStringLiteral("Hex patterns need two digits (or ?) per byte");
+        return false;
+    }
+
+    for (int i = 0; i < digits.size(); i += 2) {
+        uint8_t byte = 0;
+        uint8_t mask = 0;
+
+        for (int n = 0; n < 2; ++n) {
+            QChar c = digits.at(i + n);
+            int shift = n == 0 ? 4 : 0;
+
+            if (c == QLatin1Char('?')) {
+                continue;
+            }
+
+            int value = hex_value(c);
+
+            if (value < 0) {
+                *error = QStringLiteral("Invalid hex digit '%1'").arg(c);
+                return false;
+            }
+
+            byte |= uint8_t(value << shift);
+            mask |= uint8_t(0xf << shift);
+        }
+
+        pattern->bytes.append(char(byte));
+        pattern->mask.append(char(mask));
+    }
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static bool parse_string(const QString& text, bool utf16, bool big_endian, SearchPattern* pattern, QString* error) {
+    if (text.isEmpty()) {
+        *error = QStringLiteral("Empty string");
+        return false;
+    }
+
+    if (utf16) {
+        for (QChar c : text) {
+            append_value(&pattern->bytes, c.unicode(), 2, big_endian);
+        }
+
+        pattern->alignment = 2;
+    } else {
+        QByteArray latin1 = text.toLatin1();
+        pattern->bytes = latin1;
+    }
+
+    pattern->mask.fill(char(0xff), pattern->bytes.size());
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static bool parse_number(const QString& type, const QString& text, bool big_endian, SearchPattern* pattern,
+                         QString* error) {
+    const QChar kind = type.at(0);
+    bool ok = false;
+    int bits = type.mid(1).toInt(&ok);
+
+    if (!ok || (kind == QLatin1Char('f') ? (bits != 32 && bits != 64)
+                                         : (bits != 8 && bits != 16 && bits != 32 && bits != 64))) {
+        *error = QStringLiteral("Unknown type '%1'").arg(type);
+        return false;
+    }
+
+    const int size = bits / 8;
+    uint64_t value = 0;
+
+    if (kind == QLatin1Char('f')) {
+        double number = text.toDouble(&ok);
+
+        if (size == 4) {
+            float f = float(number);
+            uint32_t i = 0;
+            memcpy(&i, &f, sizeof(i));
+            value = i;
+        } else {
+            memcpy(&value, &number, sizeof(value));
+        }
+    } else if (kind == QLatin1Char('s') || kind == QLatin1Char('i')) {
+        value = uint64_t(text.toLongLong(&ok, 0));
+    } else {
+        value = text.toULongLong(&ok, 0);
+    }
+
+    if (!ok) {
+        *error = QStringLiteral("Invalid value '%1'").arg(text);
+        return false;
+    }
+
+    append_value(&pattern->bytes, value, size, big_endian);
+    pattern->mask.fill(char(0xff), size);
+    pattern->alignment = uint32_t(size);
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool SearchPattern_parse(const QString& query, bool big_endian, SearchPattern* pattern, QString* error) {
+    const QString text = query.trimmed();
+
+    *pattern = SearchPattern();
+
+    if (text.isEmpty()) {
+        *error = QStringLiteral("Nothing to search for");
+        return false;
+    }
+
+    if (text.size() >= 2 && text.startsWith(QLatin1Char('"')) && text.endsWith(QLatin1Char('"'))) {
+        return parse_string(text.mid(1, text.size() - 2), false, big_endian, pattern, error);
+    }
+
+    if (text.size() >= 3 && text.startsWith(QStringLiteral("u\"")) && text.endsWith(QLatin1Char('"'))) {
+        return parse_string(text.mid(2, text.size() - 3), true, big_endian, pattern, error);
+    }
+
+    int colon = text.indexOf(QLatin1Char(':'));
+
+    if (colon > 0) {
+        return parse_number(text.left(colon).toLower(), text.mid(colon + 1).trimmed(), big_endian, pattern, error);
+    }
+
+    return parse_hex(text, pattern, error);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static inline bool match_at(const uint8_t* data, const uint8_t* bytes, const uint8_t* mask, int size, bool exact) {
+    if (exact) {
+        return memcmp(data, bytes, size_t(size)) == 0;
+    }
+
+    for (int i = 0; i < size; ++i) {
+        if ((data[i] ^ bytes[i]) & mask[i]) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct ScanState {
+    const uint8_t* data;
+    const uint8_t* bytes;
+    const uint8_t* mask;
+    uint64_t address;
+    int size;
+    int anchor;
+    uint32_t alignment;
+    bool exact;
+    QVector<uint64_t>* hits;
+    int max_hits;
+    int count;
+};
+
+// Checks the candidate with the anchor byte at position. Returns false when max_hits has been reached
+static inline bool check_candidate(ScanState& state, size_t position) {
+    size_t start = position - size_t(state.anchor);
+    uint64_t address = state.address + start;
+
+    if ((address % state.alignment) != 0 ||
+        !match_at(state.data + start, state.bytes, state.mask, state.size, state.exact)) {
+        return true;
+    }
+
+    state.hits->append(address);
+
+    return ++state.count < state.max_hits;
+}
+
+// Scans anchor positions [first, last) one byte at a time. Returns false when max_hits has been reached
+static bool scan_scalar(ScanState& state, size_t first, size_t last) {
+    const uint8_t value = state.bytes[state.anchor];
+
+    while (first < last) {
+        const uint8_t* found = (const uint8_t*)memchr(state.data + first, value, last - first);
+
+        if (!found) {
+            return true;
+        }
+
+        first = size_t(found - state.data);
+
+        if (!check_candidate(state, first)) {
+            return false;
+        }
+
+        ++first;
+    }
+
+    return true;
+}
+
+#if defined(PD_SEARCH_SSE2)
+
+// Index of the lowest set bit in a (non-zero) compare mask
+
+static inline unsigned lowest_bit(uint32_t bits) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, bits);
+    return unsigned(index);
+#else
+    return unsigned(__builtin_ctz(bits));
+#endif
+}
+
+static bool scan_sse2(ScanState& state, size_t first, size_t last) {
+    const __m128i value = _mm_set1_epi8(char(state.bytes[state.anchor]));
+    size_t i = first;
+
+    for (; i + 16 <= last; i += 16) {
+        __m128i block = _mm_loadu_si128((const __m128i*)(state.data + i));
+        unsigned bits = unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(block, value)));
+
+        while (bits) {
+            unsigned bit = lowest_bit(bits);
+
+            if (!check_candidate(state, i + bit)) {
+                return false;
+            }
+
+            bits &= bits - 1;
+        }
+    }
+
+    return scan_scalar(state, i, last);
+}
+
+#endif
+
+#if defined(PD_SEARCH_AVX2)
+
+__attribute__((target("avx2"))) static bool scan_avx2(ScanState& state, size_t first, size_t last) {
+    const __m256i value = _mm256_set1_epi8(char(state.bytes[state.anchor]));
+    size_t i = first;
+
+    for (; i + 32 <= last; i += 32) {
+        __m256i block = _mm256_loadu_si256((const __m256i*)(state.data + i));
+        uint32_t bits = uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, value)));
+
+        while (bits) {
+            unsigned bit = lowest_bit(bits);
+
+            if (!check_candidate(state, i + bit)) {
+                return false;
+            }
+
+            bits &= bits - 1;
+        }
+    }
+
+    return scan_scalar(state, i, last);
+}
+
+#endif
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int MemorySearch_scan(const SearchPattern& pattern, const uint8_t* data, size_t size, uint64_t address,
+                      size_t scan_size, QVector<uint64_t>* hits, int max_hits) {
+    if (!pattern.is_valid() || max_hits <= 0 || size < size_t(pattern.size())) {
+        return 0;
+    }
+
+    ScanState state;
+    state.data = data;
+    state.bytes = (const uint8_t*)pattern.bytes.constData();
+    state.mask = (const uint8_t*)pattern.mask.constData();
+    state.address = address;
+    state.size = pattern.size();
+    state.anchor = -1;
+    state.alignment = pattern.alignment ? pattern.alignment : 1;
+    state.exact = true;
+    state.hits = hits;
+    state.max_hits = max_hits;
+    state.count = 0;
+
+    for (int i = 0; i < state.size; ++i) {
+        if (state.mask[i] != 0xff) {
+            state.exact = false;
+        } else if (state.anchor < 0) {
+            state.anchor = i;
+        }
+    }
+
+    // Starts of matches that fit in the data and are inside the scan range
+    const size_t starts = std::min(scan_size, size - size_t(state.size) + 1);
+
+    if (state.anchor < 0) {
+        // No byte has to match exactly (such as "?? ?f") so every position is a candidate
+        state.anchor = 0;
+
+        for (size_t start = 0; start < starts; ++start) {
+            if (!check_candidate(state, start)) {
+                break;
+            }
+        }
+
+        return state.count;
+    }
+
+    const size_t first = size_t(state.anchor);
+    const size_t last = first + starts;
+
+#if defined(PD_SEARCH_AVX2)
+    static const bool has_avx2 = __builtin_cpu_supports("avx2");
+
+    if (has_avx2) {
+        scan_avx2(state, first, last);
+        return state.count;
+    }
+#endif
+
+#if defined(PD_SEARCH_SSE2)
+    scan_sse2(state, first, last);
+#else
+    scan_scalar(state, first, last);
+#endif
+
+    return state.count;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
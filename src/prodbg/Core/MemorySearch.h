@@ -0,0 +1,48 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <QtCore/QByteArray>
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+namespace prodbg {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Pattern to search target memory for. Only the bits set in mask are compared so a 0 mask byte is a wildcard. Matches
+// are only reported at addresses that are a multiple of alignment.
+
+struct SearchPattern {
+    QByteArray bytes;
+    QByteArray mask;
+    uint32_t alignment = 1;
+
+    int size() const { return bytes.size(); }
+    bool is_valid() const { return !bytes.isEmpty() && bytes.size() == mask.size(); }
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Parses a search query into a pattern. Returns false and sets error if the query isn't valid. Supported queries are
+//
+//   de ad ?? ef       Hex bytes with ?? (or ? for a single nibble) as wildcards. Spaces are optional
+//   "text"            ASCII string
+//   u"text"           UTF-16 string
+//   u32:1234          Integer of 8, 16, 32 or 64 bits (u or s prefix, decimal or 0x hex value). Aligned to its size
+//   f32:1.5           32 or 64-bit float. Aligned to its size
+//
+// big_endian selects the byte order of integers, floats and UTF-16 strings.
+
+bool SearchPattern_parse(const QString& query, bool big_endian, SearchPattern* pattern, QString* error);
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Scans size bytes of memory at address for the pattern and appends the addresses of matches that start within the
+// first scan_size bytes (the data after that is only there so matches crossing the end of the chunk are found) to
+// hits. Stops after max_hits matches. Returns the number of matches found.
+//
+// Candidates are found by comparing the first byte of the pattern that has to match exactly with SSE2/AVX2 (16/32
+// bytes at a time) and only those are compared with the whole pattern.
+
+int MemorySearch_scan(const SearchPattern& pattern, const uint8_t* data, size_t size, uint64_t address,
+                      size_t scan_size, QVector<uint64_t>* hits, int max_hits);
+
+}  // namespace prodbg
@@ -0,0 +1,100 @@
+#include "ScrollPrefetcher.h"
+#include <math.h>
+
+namespace prodbg {
+
+// Scrolls further apart than this are treated as a new scroll so the velocity starts over
+static const int64_t s_idle_time = 250;
+
+// Weight of the latest scroll step in the smoothed velocity
+static const double s_smoothing = 0.5;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+ScrollPrefetcher::ScrollPrefetcher(uint64_t block_size, int max_blocks)
+    : m_block_size(block_size ? block_size : 1), m_max_blocks(max_blocks > 0 ? max_blocks : 1) {
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void ScrollPrefetcher::set_block_size(uint64_t size) {
+    m_block_size = size ? size : 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void ScrollPrefetcher::set_max_blocks(int count) {
+    m_max_blocks = count > 0 ? count : 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void ScrollPrefetcher::scrolled(uint64_t position, int64_t time) {
+    if (position == m_position) {
+        return;
+    }
+
+    double delta = position > m_position ? double(position - m_position) : -double(m_position - position);
+    int64_t elapsed = time - m_time;
+
+    if (m_direction == 0 || elapsed > s_idle_time) {
+        // First step after being idle. Assume the same step will follow within the idle time
+        m_velocity = delta / double(s_idle_time);
+    } else {
+        double velocity = delta / double(elapsed > 0 ? elapsed : 1);
+        m_velocity = m_velocity * (1.0 - s_smoothing) + velocity * s_smoothing;
+    }
+
+    m_direction = delta > 0.0 ? 1 : -1;
+    m_position = position;
+    m_time = time;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void ScrollPrefetcher::reset(uint64_t position) {
+    m_position = position;
+    m_time = 0;
+    m_velocity = 0.0;
+    m_direction = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool ScrollPrefetcher::prefetch_range(uint64_t view_start, uint64_t view_size, int64_t time, uint64_t* start,
+                                      uint64_t* size) const {
+    if (m_direction == 0) {
+        return false;
+    }
+
+    int blocks = 1;
+
+    if (time - m_time <= s_idle_time) {
+        double distance = fabs(m_velocity) * double(m_lookahead_ms);
+        double count = ceil(distance / double(m_block_size));
+        blocks = count < 1.0 ? 1 : (count > double(m_max_blocks) ? m_max_blocks : int(count));
+    }
+
+    uint64_t range = uint64_t(blocks) * m_block_size;
+
+    if (m_direction > 0) {
+        uint64_t view_end = view_start + view_size;
+        // Start at the block after the one the viewport ends in
+        *start = ((view_end + m_block_size - 1) / m_block_size) * m_block_size;
+        *size = range;
+    } else {
+        uint64_t first = (view_start / m_block_size) * m_block_size;
+
+        if (first == 0) {
+            return false;
+        }
+
+        *start = first > range ? first - range : 0;
+        *size = first - *start;
+    }
+
+    return *size > 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
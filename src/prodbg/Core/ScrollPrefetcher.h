@@ -0,0 +1,52 @@
+#pragma once
+
+#include <stdint.h>
+
+namespace prodbg {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Decides what to fetch ahead of a scrolling view.
+//
+// The view reports its top position (in bytes, instructions or whatever unit it fetches in) each time it scrolls
+// and the prefetcher keeps a smoothed scroll velocity. The range to prefetch is placed next to the viewport in the
+// scroll direction and is sized to cover what will scroll into view during the lookahead time (which should be a few
+// round trips to the backend) rounded up to whole blocks. The size is bounded by a budget of blocks so fast scrolling
+// never fetches more than the caches can hold.
+//
+// When the view hasn't scrolled for a while only one block is prefetched in the last direction.
+
+class ScrollPrefetcher {
+   public:
+    ScrollPrefetcher(uint64_t block_size = 4096, int max_blocks = 16);
+
+    void set_block_size(uint64_t size);
+    void set_max_blocks(int count);
+    void set_lookahead_ms(int ms) { m_lookahead_ms = ms; }
+
+    // time is a monotonic time in ms (such as QElapsedTimer::elapsed)
+    void scrolled(uint64_t position, int64_t time);
+
+    // Moves to a new position without scrolling (jump to address etc). Nothing is prefetched until the next scroll.
+    void reset(uint64_t position);
+
+    // Range to prefetch (block aligned) for a viewport of view_size units starting at view_start. Returns false if
+    // there is nothing to prefetch (the view hasn't scrolled yet)
+    bool prefetch_range(uint64_t view_start, uint64_t view_size, int64_t time, uint64_t* start,
+                        uint64_t* size) const;
+
+    // Units per ms, negative when scrolling towards lower addresses
+    double velocity() const { return m_velocity; }
+
+   private:
+    uint64_t m_block_size;
+    int m_max_blocks;
+    int m_lookahead_ms = 100;
+
+    uint64_t m_position = 0;
+    int64_t m_time = 0;
+    double m_velocity = 0.0;
+    int m_direction = 0;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
@@ -0,0 +1,690 @@
+#include "SymbolFile.h"
+#include <string.h>
+#include <QtCore/QFile>
+#include "SymbolTable.h"
+
+namespace prodbg {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+enum {
+    ElfClass32 = 1,
+    ElfClass64 = 2,
+    ElfDataBigEndian = 2,
+    ElfTypeDynamic = 3,
+    ElfMachineArm = 40,
+    ElfSectionSymtab = 2,
+    ElfSectionNobits = 8,
+    ElfSectionDynsym = 11,
+    ElfSectionAlloc = 2,
+    ElfSectionExecute = 4,
+    ElfSymbolUndefined = 0,
+    ElfSymbolAbsolute = 0xfff1,
+};
+
+enum {
+    HunkUnit = 0x3e7,
+    HunkName = 0x3e8,
+    HunkCode = 0x3e9,
+    HunkData = 0x3ea,
+    HunkBss = 0x3eb,
+    HunkReloc32 = 0x3ec,
+    HunkReloc16 = 0x3ed,
+    HunkReloc8 = 0x3ee,
+    HunkExt = 0x3ef,
+    HunkSymbol = 0x3f0,
+    HunkDebug = 0x3f1,
+    HunkEnd = 0x3f2,
+    HunkHeader = 0x3f3,
+    HunkOverlay = 0x3f5,
+    HunkBreak = 0x3f6,
+    HunkDrel32 = 0x3f7,
+    HunkDrel16 = 0x3f8,
+    HunkDrel8 = 0x3f9,
+    HunkLib = 0x3fa,
+    HunkIndex = 0x3fb,
+    HunkReloc32Short = 0x3fc,
+    HunkRelReloc32 = 0x3fd,
+    HunkAbsReloc16 = 0x3fe,
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Bounds checked reads of file data in either byte order. Reads past the end return 0 and set failed
+
+struct FileReader {
+    const uint8_t* data;
+    size_t size;
+    bool big_endian;
+    bool failed = false;
+
+    uint64_t read(size_t offset, int bytes) {
+        if (offset > size || size - offset < size_t(bytes)) {
+            failed = true;
+            return 0;
+        }
+
+        uint64_t value = 0;
+
+        for (int i = 0; i < bytes; ++i) {
+            const uint64_t byte = data[offset + (big_endian ? i : bytes - 1 - i)];
+            value = (value << 8) | byte;
+        }
+
+        return value;
+    }
+
+    uint16_t u16(size_t offset) { return uint16_t(read(offset, 2)); }
+    uint32_t u32(size_t offset) { return uint32_t(read(offset, 4)); }
+    uint64_t u64(size_t offset) { return read(offset, 8); }
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+SymbolFileFormat SymbolFile_detect(const uint8_t* data, size_t size) {
+    if (size >= 4 && memcmp(data, "\x7f" "ELF", 4) == 0) {
+        return SymbolFileFormat_Elf;
+    }
+
+    // Executables start with HUNK_HEADER and object files with HUNK_UNIT
+
+    if (size >= 4) {
+        const uint32_t first =
+            (uint32_t(data[0]) << 24) | (uint32_t(data[1]) << 16) | (uint32_t(data[2]) << 8) | data[3];
+
+        if (first == HunkHeader || first == HunkUnit) {
+            return SymbolFileFormat_AmigaHunk;
+        }
+    }
+
+    // Label files are text with at least one label line near the start
+
+    const char* text = (const char*)data;
+    const char* end = text + (size < 4096 ? size : 4096);
+
+    if (memchr(text, 0, size_t(end - text))) {
+        return SymbolFileFormat_Unknown;
+    }
+
+    while (text < end) {
+        while (text < end && (*text == ' ' || *text == '\t')) {
+            ++text;
+        }
+
+        if ((end - text > 3 && memcmp(text, "al ", 3) == 0) || (end - text > 7 && memcmp(text, ".label ", 7) == 0)) {
+            return SymbolFileFormat_ViceLabels;
+        }
+
+        const char* line_end = (const char*)memchr(text, '\n', size_t(end - text));
+        text = line_end ? line_end + 1 : end;
+    }
+
+    return SymbolFileFormat_Unknown;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool SymbolFile_is_position_independent(const QString& path) {
+    QFile file(path);
+    uint8_t header[18];
+
+    if (!file.open(QIODevice::ReadOnly) || file.read((char*)header, sizeof(header)) != qint64(sizeof(header))) {
+        return false;
+    }
+
+    if (memcmp(header, "\x7f" "ELF", 4) != 0) {
+        return false;
+    }
+
+    FileReader reader{header, sizeof(header), header[5] == ElfDataBigEndian};
+
+    return reader.u16(16) == ElfTypeDynamic;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void add_elf_symbols(FileReader& file, bool is64, uint64_t bias, bool is_arm, size_t symbols,
+                            uint64_t symbols_size, size_t strings, uint64_t strings_size, SymbolTable* table) {
+    const size_t entry_size = is64 ? 24 : 16;
+
+    if (strings > file.size || strings_size > file.size - strings || symbols > file.size ||
+        symbols_size > file.size - symbols) {
+        file.failed = true;
+        return;
+    }
+
+    const char* string_data = (const char*)file.data + strings;
+
+    for (uint64_t offset = entry_size; offset + entry_size <= symbols_size; offset += entry_size) {
+        const size_t entry = symbols + size_t(offset);
+        const uint32_t name = file.u32(entry);
+        uint64_t value;
+        uint64_t size;
+        uint8_t info;
+        uint16_t section;
+
+        if (is64) {
+            info = file.data[entry + 4];
+            section = file.u16(entry + 6);
+            value = file.u64(entry + 8);
+            size = file.u64(entry + 16);
+        } else {
+            value = file.u32(entry + 4);
+            size = file.u32(entry + 8);
+            info = file.data[entry + 12];
+            section = file.u16(entry + 14);
+        }
+
+        // Untyped (labels), object, function and indirect function symbols that are defined in the file
+
+        const int type = info & 0xf;
+
+        if ((type != 0 && type != 1 && type != 2 && type != 10) || section == ElfSymbolUndefined ||
+            name >= strings_size) {
+            continue;
+        }
+
+        const char* text = string_data + name;
+        const size_t length = strnlen(text, size_t(strings_size - name));
+
+        // ARM mapping symbols ($a, $t, $d and $x) mark code and data, they aren't names
+        if (length == 0 || text[0] == '$') {
+            continue;
+        }
+
+        // Thumb functions have bit 0 set
+        if (is_arm && type == 2) {
+            value &= ~uint64_t(1);
+        }
+
+        if (section != ElfSymbolAbsolute) {
+            value += bias;
+        }
+
+        table->add(value, uint32_t(qMin(size, uint64_t(UINT32_MAX))), text, int(length));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool SymbolFile_read_elf(const uint8_t* data, size_t size, uint64_t bias, SymbolTable* table, QString* error) {
+    if (SymbolFile_detect(data, size) != SymbolFileFormat_Elf || size < 52) {
+        *error = QStringLiteral("Not an ELF file");
+        return false;
+    }
+
+    const bool is64 = data[4] == ElfClass64;
+
+    if (!is64 && data[4] != ElfClass32) {
+        *error = QStringLiteral("Unknown ELF class %1").arg(data[4]);
+        return false;
+    }
+
+    FileReader file{data, size, data[5] == ElfDataBigEndian};
+
+    const bool is_arm = file.u16(18) == ElfMachineArm;
+    const uint64_t section_offset = is64 ? file.u64(0x28) : file.u32(0x20);
+    const uint16_t section_size = file.u16(is64 ? 0x3a : 0x2e);
+    const uint16_t section_count = file.u16(is64 ? 0x3c : 0x30);
+
+    if (section_size < (is64 ? 64 : 40) || section_offset > size) {
+        *error = QStringLiteral("Invalid ELF section headers");
+        return false;
+    }
+
+    for (uint16_t i = 0; i < section_count && !file.failed; ++i) {
+        const size_t header = size_t(section_offset) + size_t(i) * section_size;
+        const uint32_t type = file.u32(header + 4);
+        const uint64_t flags = is64 ? file.u64(header + 8) : file.u32(header + 8);
+
+        // Sections that are loaded and executable are the code ranges of the file
+
+        if (type != ElfSectionNobits && (flags & ElfSectionAlloc) && (flags & ElfSectionExecute)) {
+            const uint64_t address = (is64 ? file.u64(header + 0x10) : file.u32(header + 0x0c)) + bias;
+            const uint64_t bytes = is64 ? file.u64(header + 0x20) : file.u32(header + 0x14);
+            table->add_code_range(address, address + bytes);
+        }
+
+        if (type != ElfSectionSymtab && type != ElfSectionDynsym) {
+            continue;
+        }
+
+        const uint64_t offset = is64 ? file.u64(header + 0x18) : file.u32(header + 0x10);
+        const uint64_t bytes = is64 ? file.u64(header + 0x20) : file.u32(header + 0x14);
+        const uint32_t link = file.u32(header + (is64 ? 0x28 : 0x18));
+
+        if (link >= section_count) {
+            file.failed = true;
+            break;
+        }
+
+        // Symbols refer to their names in the string table of the section link
+
+        const size_t strings_header = size_t(section_offset) + size_t(link) * section_size;
+        const uint64_t strings = is64 ? file.u64(strings_header + 0x18) : file.u32(strings_header + 0x10);
+        const uint64_t strings_size = is64 ? file.u64(strings_header + 0x20) : file.u32(strings_header + 0x14);
+
+        if (!file.failed) {
+            add_elf_symbols(file, is64, bias, is_arm, size_t(offset), bytes, size_t(strings), strings_size, table);
+        }
+    }
+
+    if (file.failed) {
+        *error = QStringLiteral("ELF file is truncated or corrupt");
+        return false;
+    }
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// The hunk file is a stream of big endian longs. Names are stored as a count of longs followed by the name padded
+// with zeros
+
+struct HunkReader {
+    FileReader file;
+    size_t offset = 0;
+
+    bool at_end() const { return offset + 4 > file.size || file.failed; }
+    uint32_t next() {
+        const uint32_t value = file.u32(offset);
+        offset += 4;
+        return value;
+    }
+
+    void skip_longs(uint64_t count) {
+        if (count > (file.size - qMin(offset, file.size)) / 4) {
+            file.failed = true;
+            offset = file.size;
+            return;
+        }
+
+        offset += size_t(count) * 4;
+    }
+
+    // Name of count longs
+    QByteArray name(uint32_t count) {
+        const size_t start = offset;
+        skip_longs(count);
+
+        if (file.failed) {
+            return QByteArray();
+        }
+
+        const char* text = (const char*)file.data + start;
+        return QByteArray(text, int(strnlen(text, size_t(count) * 4)));
+    }
+
+    // Relocation tables of HUNK_RELOC32 and the like: count, hunk and count offsets until a zero count
+    void skip_relocs(bool short_format) {
+        const int bytes = short_format ? 2 : 4;
+
+        while (!file.failed) {
+            const uint32_t count = uint32_t(file.read(offset, bytes));
+            offset += size_t(bytes);
+
+            if (count == 0) {
+                break;
+            }
+
+            offset += size_t(bytes);
+
+            if (uint64_t(count) * uint64_t(bytes) > file.size - qMin(offset, file.size)) {
+                file.failed = true;
+                break;
+            }
+
+            offset += size_t(count) * size_t(bytes);
+        }
+
+        // Short tables are padded to a long
+        offset = (offset + 3) & ~size_t(3);
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool SymbolFile_read_amiga_hunks(const uint8_t* data, size_t size, const QVector<uint64_t>& hunk_addresses,
+                                 SymbolTable* table, QString* error) {
+    HunkReader reader{FileReader{data, size, true}};
+    QVector<uint64_t> hunk_sizes;
+
+    const uint32_t first = reader.next();
+
+    if (first == HunkHeader) {
+        // Resident library names (always none in practice), then the hunk table
+
+        for (uint32_t count = reader.next(); count != 0 && !reader.at_end(); count = reader.next()) {
+            reader.skip_longs(count);
+        }
+
+        reader.next();
+        const uint32_t first_hunk = reader.next();
+        const uint32_t last_hunk = reader.next();
+
+        if (last_hunk < first_hunk || last_hunk - first_hunk >= 0x10000) {
+            *error = QStringLiteral("Invalid hunk table");
+            return false;
+        }
+
+        for (uint32_t i = first_hunk; i <= last_hunk && !reader.at_end(); ++i) {
+            const uint32_t value = reader.next();
+
+            // Both memory flags set means the memory attributes follow in a long of their own
+            if ((value & 0xc0000000) == 0xc0000000) {
+                reader.next();
+            }
+
+            hunk_sizes.append(uint64_t(value & 0x3fffffff) * 4);
+        }
+    } else if (first == HunkUnit) {
+        reader.offset = 0;
+    } else {
+        *error = QStringLiteral("Not an Amiga hunk file");
+        return false;
+    }
+
+    // Where each hunk is. Missing addresses follow the previous hunk
+
+    QVector<uint64_t> bases;
+    int hunk = 0;
+
+    auto base_of = [&](int index) -> uint64_t {
+        while (bases.size() <= index) {
+            const int i = bases.size();
+
+            if (i < hunk_addresses.size()) {
+                bases.append(hunk_addresses.at(i));
+            } else {
+                const uint64_t previous_size = i > 0 && i - 1 < hunk_sizes.size() ? hunk_sizes.at(i - 1) : 0;
+                bases.append(i > 0 ? bases.at(i - 1) + previous_size : 0);
+            }
+        }
+
+        return bases.at(index);
+    };
+
+    while (!reader.at_end()) {
+        const uint32_t type = reader.next() & 0x3fffffff;
+
+        switch (type) {
+            case HunkUnit:
+            case HunkName:
+            case HunkDebug:
+                reader.skip_longs(reader.next());
+                break;
+
+            case HunkCode:
+            case HunkData: {
+                const uint32_t longs = reader.next() & 0x3fffffff;
+
+                // Object files have no header so the sizes come from the hunks
+                if (hunk >= hunk_sizes.size()) {
+                    hunk_sizes.append(uint64_t(longs) * 4);
+                }
+
+                if (type == HunkCode) {
+                    table->add_code_range(base_of(hunk), base_of(hunk) + uint64_t(longs) * 4);
+                }
+
+                reader.skip_longs(longs);
+                break;
+            }
+
+            case HunkBss: {
+                const uint32_t longs = reader.next() & 0x3fffffff;
+
+                if (hunk >= hunk_sizes.size()) {
+                    hunk_sizes.append(uint64_t(longs) * 4);
+                }
+
+                break;
+            }
+
+            case HunkReloc32:
+            case HunkReloc16:
+            case HunkReloc8:
+            case HunkDrel16:
+            case HunkDrel8:
+                reader.skip_relocs(false);
+                break;
+
+            // HUNK_DREL32 in executables is read as the short format by the OS loader
+            case HunkDrel32:
+            case HunkReloc32Short:
+            case HunkRelReloc32:
+            case HunkAbsReloc16:
+                reader.skip_relocs(first == HunkHeader || type != HunkDrel32);
+                break;
+
+            case HunkSymbol:
+                for (uint32_t count = reader.next(); count != 0 && !reader.at_end(); count = reader.next()) {
+                    const QByteArray name = reader.name(count);
+                    const uint32_t value = reader.next();
+                    table->add(base_of(hunk) + value, 0, name);
+                }
+                break;
+
+            case HunkExt:
+                for (uint32_t header = reader.next(); header != 0 && !reader.at_end(); header = reader.next()) {
+                    const uint32_t ext_type = header >> 24;
+                    const QByteArray name = reader.name(header & 0xffffff);
+
+                    if (ext_type == 1 || ext_type == 3) {
+                        // Definitions relative to the hunk
+                        table->add(base_of(hunk) + reader.next(), 0, name);
+                    } else if (ext_type == 2) {
+                        // Absolute definitions
+                        table->add(reader.next(), 0, name);
+                    } else if (ext_type == 130 || ext_type == 137) {
+                        // Common symbols have a size before the references
+                        reader.next();
+                        reader.skip_longs(reader.next());
+                    } else if (ext_type >= 128) {
+                        reader.skip_longs(reader.next());
+                    } else {
+                        reader.next();
+                    }
+                }
+                break;
+
+            case HunkEnd:
+                ++hunk;
+                break;
+
+            case HunkOverlay:
+            case HunkBreak:
+            case HunkLib:
+            case HunkIndex:
+                // Overlays and link libraries aren't loaded as one program. What has been read so far is kept
+                return true;
+
+            default:
+                *error = QStringLiteral("Unknown hunk type 0x%1").arg(type, 0, 16);
+                return false;
+        }
+    }
+
+    if (reader.file.failed) {
+        *error = QStringLiteral("Hunk file is truncated");
+        return false;
+    }
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Numbers in label files are hex with a $ or 0x prefix, or with none in the VICE format
+
+static bool parse_number(const char* text, const char* end, bool hex, uint64_t* value) {
+    if (end - text > 1 && text[0] == '$') {
+        text += 1;
+        hex = true;
+    } else if (end - text > 2 && text[0] == '0' && (text[1] == 'x' || text[1] == 'X')) {
+        text += 2;
+        hex = true;
+    }
+
+    if (text == end) {
+        return false;
+    }
+
+    uint64_t result = 0;
+
+    for (; text < end; ++text) {
+        const char c = *text;
+        int digit;
+
+        if (c >= '0' && c <= '9') {
+            digit = c - '0';
+        } else if (hex && c >= 'a' && c <= 'f') {
+            digit = c - 'a' + 10;
+        } else if (hex && c >= 'A' && c <= 'F') {
+            digit = c - 'A' + 10;
+        } else {
+            return false;
+        }
+
+        result = result * (hex ? 16 : 10) + uint64_t(digit);
+    }
+
+    *value = result;
+    return true;
+}
+
+static const char* skip_spaces(const char* text, const char* end) {
+    while (text < end && (*text == ' ' || *text == '\t')) {
+        ++text;
+    }
+
+    return text;
+}
+
+static const char* token_end(const char* text, const char* end) {
+    while (text < end && *text != ' ' && *text != '\t' && *text != '=') {
+        ++text;
+    }
+
+    return text;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool SymbolFile_read_vice_labels(const char* text, size_t size, SymbolTable* table, QString* error) {
+    const char* end = text + size;
+    int labels = 0;
+    int lines = 0;
+
+    while (text < end) {
+        const char* line_end = (const char*)memchr(text, '\n', size_t(end - text));
+        line_end = line_end ? line_end : end;
+
+        const char* next = line_end < end ? line_end + 1 : end;
+
+        while (line_end > text && (line_end[-1] == '\r' || line_end[-1] == ' ' || line_end[-1] == '\t')) {
+            --line_end;
+        }
+
+        const char* p = skip_spaces(text, line_end);
+        uint64_t value = 0;
+
+        ++lines;
+
+        if (line_end - p > 3 && memcmp(p, "al ", 3) == 0) {
+            // al C:080e .start (the memory space prefix is optional)
+            p = skip_spaces(p + 3, line_end);
+
+            if (line_end - p > 2 && p[1] == ':') {
+                p += 2;
+            }
+
+            const char* number_end = token_end(p, line_end);
+            const char* name = skip_spaces(number_end, line_end);
+
+            if (name < line_end && *name == '.') {
+                ++name;
+            }
+
+            if (parse_number(p, number_end, true, &value) && name < line_end) {
+                table->add(value, 0, name, int(token_end(name, line_end) - name));
+                ++labels;
+            }
+        } else if (line_end - p > 7 && memcmp(p, ".label ", 7) == 0) {
+            // .label start=$80e
+            const char* name = skip_spaces(p + 7, line_end);
+            const char* name_end = token_end(name, line_end);
+            const char* number = skip_spaces(name_end, line_end);
+
+            if (number < line_end && *number == '=') {
+                number = skip_spaces(number + 1, line_end);
+
+                if (parse_number(number, token_end(number, line_end), false, &value)) {
+                    table->add(value, 0, name, int(name_end - name));
+                    ++labels;
+                }
+            }
+        }
+
+        text = next;
+    }
+
+    if (labels == 0 && lines > 0) {
+        *error = QStringLiteral("No labels found");
+        return false;
+    }
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// The file is mapped rather than read as debug builds can have hundreds of MB of ELF that only a small part of (the
+// symbol and string tables) is looked at
+
+bool SymbolFile_load(const QString& path, uint64_t base, SymbolTable* table, QString* error) {
+    QFile file(path);
+
+    if (!file.open(QIODevice::ReadOnly)) {
+        *error = file.errorString();
+        return false;
+    }
+
+    const qint64 size = file.size();
+
+    if (size == 0) {
+        *error = QStringLiteral("File is empty");
+        return false;
+    }
+
+    const uint8_t* data = file.map(0, size);
+
+    if (!data) {
+        *error = file.errorString();
+        return false;
+    }
+
+    bool result = false;
+
+    switch (SymbolFile_detect(data, size_t(size))) {
+        case SymbolFileFormat_Elf:
+            result = SymbolFile_read_elf(data, size_t(size), base, table, error);
+            break;
+        case SymbolFileFormat_AmigaHunk: {
+            QVector<uint64_t> hunk_addresses;
+            hunk_addresses.append(base);
+            result = SymbolFile_read_amiga_hunks(data, size_t(size), hunk_addresses, table, error);
+            break;
+        }
+        case SymbolFileFormat_ViceLabels:
+            result = SymbolFile_read_vice_labels((const char*)data, size_t(size), table, error);
+            break;
+        default:
+            *error = QStringLiteral("Unknown symbol file format");
+            break;
+    }
+
+    file.unmap((uchar*)data);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
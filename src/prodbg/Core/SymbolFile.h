@@ -0,0 +1,50 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+namespace prodbg {
+
+class SymbolTable;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Readers for the symbol files of the targets ProDBG debugs. They add symbols to a table and return false with an
+// error if the data isn't valid. Symbols read before the error was found are left in the table.
+
+enum SymbolFileFormat {
+    SymbolFileFormat_Unknown,
+    SymbolFileFormat_Elf,
+    SymbolFileFormat_AmigaHunk,
+    SymbolFileFormat_ViceLabels,
+};
+
+// Format of a file from its first bytes. Text files are label files if one of their first lines is a VICE or
+// KickAssembler label
+SymbolFileFormat SymbolFile_detect(const uint8_t* data, size_t size);
+
+// True for ELF files that are position independent (ET_DYN, PIE executables and shared objects) so their symbols
+// need the load address added. False for anything else or if the file can't be read
+bool SymbolFile_is_position_independent(const QString& path);
+
+// Function, object and untyped symbols of the symtab and dynsym sections of a 32 or 64-bit ELF file of either byte
+// order, and its executable sections as code ranges. bias is added to all addresses that aren't absolute (the load
+// address of PIE executables and shared objects)
+bool SymbolFile_read_elf(const uint8_t* data, size_t size, uint64_t bias, SymbolTable* table, QString* error);
+
+// HUNK_SYMBOL (and HUNK_EXT definitions) of an Amiga executable or object file, and its code hunks as code ranges.
+// Symbols are offsets into their hunk so hunk_addresses has the address each hunk was loaded to (the segment list of
+// the process). Hunks past the end of it are placed right after the previous one, starting at 0
+bool SymbolFile_read_amiga_hunks(const uint8_t* data, size_t size, const QVector<uint64_t>& hunk_addresses,
+                                 SymbolTable* table, QString* error);
+
+// Label files in the VICE monitor format ("al C:080e .start") and the KickAssembler .sym format
+// (".label start=$80e"). Other lines are skipped
+bool SymbolFile_read_vice_labels(const char* text, size_t size, SymbolTable* table, QString* error);
+
+// Maps the file and reads it with the reader for its format. base is the ELF bias or the address of the first hunk
+bool SymbolFile_load(const QString& path, uint64_t base, SymbolTable* table, QString* error);
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
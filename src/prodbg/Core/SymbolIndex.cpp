@@ -0,0 +1,259 @@
+#include "SymbolIndex.h"
+#include <QtCore/QMetaObject>
+#include <QtCore/QMutexLocker>
+#include <QtCore/QRunnable>
+#include "SymbolFile.h"
+
+namespace prodbg {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Reads a symbol file on the pool and merges it with the table of the load before it
+
+class SymbolLoadTask : public QRunnable {
+   public:
+    SymbolLoadTask(SymbolIndex* index, const QString& path, uint64_t base, uint64_t generation)
+        : m_index(index), m_path(path), m_base(base), m_generation(generation) {}
+
+    void run() override {
+        SymbolTable loaded;
+        QString error;
+
+        if (!SymbolFile_load(m_path, m_base, &loaded, &error)) {
+            post(QSharedPointer<const SymbolTable>(), error);
+            return;
+        }
+
+        QSharedPointer<SymbolTable> table(new SymbolTable);
+
+        {
+            QMutexLocker lock(&m_index->m_mutex);
+
+            if (m_index->m_generation != m_generation) {
+                return;
+            }
+
+            *table = *m_index->m_latest;
+        }
+
+        table->add(loaded);
+        table->finish();
+
+        {
+            QMutexLocker lock(&m_index->m_mutex);
+
+            if (m_index->m_generation != m_generation) {
+                return;
+            }
+
+            m_index->m_latest = table;
+        }
+
+        post(table, QString());
+    }
+
+   private:
+    void post(const QSharedPointer<const SymbolTable>& table, const QString& error) {
+        SymbolIndex* index = m_index;
+        const uint64_t generation = m_generation;
+        const QString path = m_path;
+
+        QMetaObject::invokeMethod(index, [index, generation, path, table, error]() {
+            index->loaded(generation, path, table, error);
+        }, Qt::QueuedConnection);
+    }
+
+    SymbolIndex* m_index;
+    QString m_path;
+    uint64_t m_base;
+    uint64_t m_generation;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+SymbolIndex::SymbolIndex(IBackendRequests* interface, QObject* parent)
+    : QObject(parent), m_interface(interface), m_table(new SymbolTable), m_latest(m_table) {
+    m_pool.setMaxThreadCount(1);
+
+    if (interface) {
+        connect(interface, &IBackendRequests::session_ended, this, &SymbolIndex::clear);
+        connect(interface, &IBackendRequests::target_info_received, this, &SymbolIndex::target_info_received);
+        connect(interface, &IBackendRequests::program_counter_changed, this, &SymbolIndex::program_counter_changed);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+SymbolIndex::~SymbolIndex() {
+    // The tasks reference the index
+    m_pool.clear();
+    m_pool.waitForDone();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+SymbolIndex* SymbolIndex::for_interface(IBackendRequests* interface) {
+    if (!interface) {
+        return nullptr;
+    }
+
+    SymbolIndex* index = interface->findChild<SymbolIndex*>(QString(), Qt::FindDirectChildrenOnly);
+
+    return index ? index : new SymbolIndex(interface, interface);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void SymbolIndex::load(const QString& path, uint64_t base) {
+    if (base == 0 && SymbolFile_is_position_independent(path)) {
+        if (!m_has_load_bias) {
+            m_deferred.append(path);
+
+            if (m_interface) {
+                m_interface->request_target_info();
+            }
+
+            return;
+        }
+
+        base = m_load_bias;
+    }
+
+    start(path, base);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void SymbolIndex::start(const QString& path, uint64_t base) {
+    uint64_t generation = 0;
+
+    {
+        QMutexLocker lock(&m_mutex);
+        generation = m_generation;
+    }
+
+    m_pool.start(new SymbolLoadTask(this, path, base, generation));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void SymbolIndex::clear() {
+    QSharedPointer<const SymbolTable> empty(new SymbolTable);
+
+    {
+        QMutexLocker lock(&m_mutex);
+        ++m_generation;
+        m_latest = empty;
+    }
+
+    m_pool.clear();
+
+    const bool changed = m_table->size() != 0;
+
+    m_table = empty;
+    m_files.clear();
+    m_deferred.clear();
+    m_has_load_bias = false;
+    m_load_bias = 0;
+
+    if (changed) {
+        if (m_interface) {
+            m_interface->set_symbols(QSharedPointer<const SymbolTable>());
+        }
+
+        symbols_changed();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void SymbolIndex::loaded(uint64_t generation, const QString& path, const QSharedPointer<const SymbolTable>& table,
+                         const QString& error) {
+    {
+        QMutexLocker lock(&m_mutex);
+
+        if (generation != m_generation) {
+            return;
+        }
+    }
+
+    if (!table) {
+        load_failed(path, error);
+        return;
+    }
+
+    m_table = table;
+    m_files.append(path);
+
+    if (m_interface) {
+        m_interface->set_symbols(m_table);
+    }
+
+    symbols_changed();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void SymbolIndex::target_info_received(const IBackendRequests::TargetInfo& info) {
+    if (!info.has_load_bias) {
+        return;
+    }
+
+    m_has_load_bias = true;
+    m_load_bias = info.load_bias;
+
+    const QStringList deferred = m_deferred;
+    m_deferred.clear();
+
+    for (const QString& path : deferred) {
+        start(path, m_load_bias);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// The backend can't tell the load bias before the process has been started so it's asked again at each stop
+
+void SymbolIndex::program_counter_changed() {
+    if (!m_deferred.isEmpty() && m_interface) {
+        m_interface->request_target_info();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+QString SymbolIndex::describe(uint64_t address) const {
+    QByteArray text;
+    m_table->describe(address, &text);
+    return QString::fromUtf8(text);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+QStringList SymbolIndex::complete(const QString& prefix, int max) const {
+    QVector<int> found;
+    m_table->complete(prefix.toUtf8(), max, &found);
+
+    QStringList names;
+    names.reserve(found.size());
+
+    for (int index : found) {
+        names.append(QString::fromUtf8(m_table->at(index).name));
+    }
+
+    return names;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool SymbolIndex::address_of(const QString& name, uint64_t* address) const {
+    const int index = m_table->find(name.toUtf8());
+
+    if (index < 0) {
+        return false;
+    }
+
+    *address = m_table->at(index).address;
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
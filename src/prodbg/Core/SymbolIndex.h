@@ -0,0 +1,90 @@
+#pragma once
+
+#include <stdint.h>
+#include <QtCore/QByteArray>
+#include <QtCore/QMutex>
+#include <QtCore/QObject>
+#include <QtCore/QPointer>
+#include <QtCore/QSharedPointer>
+#include <QtCore/QStringList>
+#include <QtCore/QThreadPool>
+#include "Backend/IBackendRequests.h"
+#include "SymbolTable.h"
+
+namespace prodbg {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Symbols of the target shared by all views of a session.
+//
+// Symbol files (ELF executables and shared objects, Amiga hunk executables and VICE/KickAssembler label files) are
+// read on a thread pool and merged with the symbols loaded before into a new table, which replaces the current one
+// when it's done. Tables never change once built so views can keep the one they got from table() for as long as they
+// like (such as over a paint) and the backend session gets the same table for resolving names in expressions.
+
+class SymbolIndex : public QObject {
+    Q_OBJECT
+
+   public:
+    explicit SymbolIndex(IBackendRequests* interface, QObject* parent = nullptr);
+    ~SymbolIndex();
+
+    // Index shared by all views for the interface. Created on first use and owned by the interface
+    static SymbolIndex* for_interface(IBackendRequests* interface);
+
+    // Reads the symbols of the file at path and adds them to the index. base is the load address of position
+    // independent ELF files or the address of the first hunk of Amiga executables. Position independent files loaded
+    // with base 0 are relocated with the load bias of the executable from the backend and wait until it's known.
+    // Sends symbols_changed or load_failed when done
+    void load(const QString& path, uint64_t base = 0);
+
+    // Drops all symbols (and any load in progress)
+    void clear();
+
+    // Current symbols. Never null
+    QSharedPointer<const SymbolTable> table() const { return m_table; }
+
+    // Files the symbols were loaded from
+    const QStringList& files() const { return m_files; }
+
+    // "name" or "name+0x12" for address or an empty string if no symbol covers it
+    QString describe(uint64_t address) const;
+
+    // Names starting with prefix (for completing expressions), up to max of them in name order
+    QStringList complete(const QString& prefix, int max = 50) const;
+
+    // Address of the symbol called name. Returns false if there is none
+    bool address_of(const QString& name, uint64_t* address) const;
+
+    Q_SIGNAL void symbols_changed();
+    Q_SIGNAL void load_failed(const QString& path, const QString& error);
+
+   private:
+    friend class SymbolLoadTask;
+
+    void loaded(uint64_t generation, const QString& path, const QSharedPointer<const SymbolTable>& table,
+                const QString& error);
+    void start(const QString& path, uint64_t base);
+    void target_info_received(const IBackendRequests::TargetInfo& info);
+    void program_counter_changed();
+
+    QPointer<IBackendRequests> m_interface;
+    // Runs one load at a time so each one merges with the table of the load before it
+    QThreadPool m_pool;
+
+    QSharedPointer<const SymbolTable> m_table;
+    QStringList m_files;
+
+    // Position independent files waiting for the load bias, which the backend only knows once the process runs
+    QStringList m_deferred;
+    bool m_has_load_bias = false;
+    uint64_t m_load_bias = 0;
+
+    // Table of the last load that finished on the pool (ahead of m_table until it has been posted back) and the
+    // generation, which clear bumps so loads started before it are dropped
+    QMutex m_mutex;
+    QSharedPointer<const SymbolTable> m_latest;
+    uint64_t m_generation = 0;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
@@ -0,0 +1,202 @@
+#include "SymbolTable.h"
+#include <string.h>
+#include <algorithm>
+#include <numeric>
+
+namespace prodbg {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static const char s_hex_table[] = "0123456789abcdef";
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void SymbolTable::add(uint64_t address, uint32_t size, const char* name, int length) {
+    if (length <= 0) {
+        return;
+    }
+
+    m_addresses.append(address);
+    m_sizes.append(size);
+    m_names.append(uint32_t(m_pool.size()));
+    m_pool.append(name, length);
+    m_pool.append('\0');
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void SymbolTable::add_code_range(uint64_t start, uint64_t end) {
+    if (end > start) {
+        m_code_ranges.append(Range{start, end});
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void SymbolTable::add(const SymbolTable& other) {
+    const uint32_t base = uint32_t(m_pool.size());
+
+    m_addresses += other.m_addresses;
+    m_sizes += other.m_sizes;
+    m_pool += other.m_pool;
+    m_code_ranges += other.m_code_ranges;
+
+    for (uint32_t offset : other.m_names) {
+        m_names.append(base + offset);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Symbols are sorted through an index array and then moved into place. The pool is left as it is as names are only
+// referred to by offset
+
+void SymbolTable::finish() {
+    const int count = m_addresses.size();
+    QVector<int> order(count);
+    std::iota(order.begin(), order.end(), 0);
+
+    // Address order with the largest symbol first where several share an address (so lookup finds it first)
+
+    std::sort(order.begin(), order.end(), [this](int a, int b) {
+        if (m_addresses.at(a) != m_addresses.at(b)) {
+            return m_addresses.at(a) < m_addresses.at(b);
+        }
+
+        if (m_sizes.at(a) != m_sizes.at(b)) {
+            return m_sizes.at(a) > m_sizes.at(b);
+        }
+
+        return strcmp(name(a), name(b)) < 0;
+    });
+
+    QVector<uint64_t> addresses;
+    QVector<uint32_t> sizes;
+    QVector<uint32_t> names;
+    addresses.reserve(count);
+    sizes.reserve(count);
+    names.reserve(count);
+
+    for (int i = 0; i < count; ++i) {
+        const int index = order.at(i);
+
+        // Symtab and dynsym (or several files) often have the same symbols. They end up next to each other
+
+        const bool duplicate = i > 0 && m_addresses.at(order.at(i - 1)) == m_addresses.at(index) &&
+                               m_sizes.at(order.at(i - 1)) == m_sizes.at(index) &&
+                               strcmp(name(order.at(i - 1)), name(index)) == 0;
+
+        if (!duplicate) {
+            addresses.append(m_addresses.at(index));
+            sizes.append(m_sizes.at(index));
+            names.append(m_names.at(index));
+        }
+    }
+
+    m_addresses.swap(addresses);
+    m_sizes.swap(sizes);
+    m_names.swap(names);
+
+    m_by_name.resize(m_addresses.size());
+    std::iota(m_by_name.begin(), m_by_name.end(), 0);
+    std::sort(m_by_name.begin(), m_by_name.end(), [this](int a, int b) { return strcmp(name(a), name(b)) < 0; });
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+SymbolTable::Symbol SymbolTable::at(int index) const {
+    return {m_addresses.at(index), m_sizes.at(index), name(index)};
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int SymbolTable::lookup(uint64_t address) const {
+    auto it = std::upper_bound(m_addresses.begin(), m_addresses.end(), address);
+
+    if (it == m_addresses.begin()) {
+        return -1;
+    }
+
+    int index = int(it - m_addresses.begin()) - 1;
+
+    while (index > 0 && m_addresses.at(index - 1) == m_addresses.at(index)) {
+        --index;
+    }
+
+    const uint32_t size = m_sizes.at(index);
+
+    if (size != 0 && address - m_addresses.at(index) >= size) {
+        return -1;
+    }
+
+    return index;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int SymbolTable::find(const QByteArray& name) const {
+    const char* wanted = name.constData();
+
+    auto it = std::lower_bound(m_by_name.begin(), m_by_name.end(), wanted,
+                               [this](int index, const char* n) { return strcmp(this->name(index), n) < 0; });
+
+    if (it == m_by_name.end() || strcmp(this->name(*it), wanted) != 0) {
+        return -1;
+    }
+
+    return *it;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int SymbolTable::complete(const QByteArray& prefix, int max, QVector<int>* out) const {
+    const char* wanted = prefix.constData();
+    const size_t length = size_t(prefix.size());
+
+    auto it = std::lower_bound(m_by_name.begin(), m_by_name.end(), wanted,
+                               [this](int index, const char* n) { return strcmp(name(index), n) < 0; });
+
+    int found = 0;
+
+    for (; it != m_by_name.end() && found < max && strncmp(name(*it), wanted, length) == 0; ++it) {
+        out->append(*it);
+        ++found;
+    }
+
+    return found;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool SymbolTable::describe(uint64_t address, QByteArray* out) const {
+    const int index = lookup(address);
+
+    if (index < 0) {
+        return false;
+    }
+
+    out->append(name(index));
+
+    uint64_t offset = address - m_addresses.at(index);
+
+    if (offset == 0) {
+        return true;
+    }
+
+    char digits[16];
+    int count = 0;
+
+    for (; offset != 0; offset >>= 4) {
+        digits[count++] = s_hex_table[offset & 0xf];
+    }
+
+    out->append("+0x");
+
+    while (count > 0) {
+        out->append(digits[--count]);
+    }
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
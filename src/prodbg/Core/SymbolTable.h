@@ -0,0 +1,84 @@
+#pragma once
+
+#include <stdint.h>
+#include <QtCore/QByteArray>
+#include <QtCore/QVector>
+
+namespace prodbg {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Symbols of the target sorted by address for finding the symbol an address is in.
+//
+// Addresses are kept in an array of their own (so a lookup is a binary search over 8 byte values) with the sizes and
+// the offsets of the names in a pool of zero terminated strings next to them. A second array has the symbols in name
+// order for looking up names and completing prefixes. With a million symbols a lookup is about 20 compares, so
+// annotating a screen of instructions takes microseconds.
+//
+// Symbols are added and then finish is called once, after which the table doesn't change. Tables are shared between
+// threads as QSharedPointer<const SymbolTable> (see SymbolIndex).
+
+class SymbolTable {
+   public:
+    struct Symbol {
+        uint64_t address;
+        // 0 if not known (such as labels)
+        uint32_t size;
+        const char* name;
+    };
+
+    struct Range {
+        uint64_t start;
+        uint64_t end;
+    };
+
+    // Adds a symbol. Empty names are skipped
+    void add(uint64_t address, uint32_t size, const char* name, int length);
+    void add(uint64_t address, uint32_t size, const QByteArray& name) {
+        add(address, size, name.constData(), name.size());
+    }
+
+    // Adds [start, end) to the code ranges (the executable sections or code hunks of the symbol files)
+    void add_code_range(uint64_t start, uint64_t end);
+
+    // Adds all symbols and code ranges of another table
+    void add(const SymbolTable& other);
+
+    // Sorts the symbols and drops duplicates (same name, address and size). Must be called before any lookups
+    void finish();
+
+    int size() const { return m_addresses.size(); }
+    Symbol at(int index) const;
+
+    // Index of the symbol address is in. This is the closest symbol at or before address, which has to cover address
+    // if its size is known. Of several symbols at the same address the largest one is used. -1 if there is none
+    int lookup(uint64_t address) const;
+
+    // Index of the symbol called name (-1 if there is none)
+    int find(const QByteArray& name) const;
+
+    // Indices of up to max symbols whose names start with prefix, in name order. Returns the number found
+    int complete(const QByteArray& prefix, int max, QVector<int>* out) const;
+
+    // Appends "name" or "name+0x12" for address to out. Returns false (and appends nothing) if no symbol covers it
+    bool describe(uint64_t address, QByteArray* out) const;
+
+    // Code ranges in the order they were added. They may overlap if the same file was loaded twice
+    const QVector<Range>& code_ranges() const { return m_code_ranges; }
+
+   private:
+    const char* name(int index) const { return m_pool.constData() + m_names.at(index); }
+
+    QVector<uint64_t> m_addresses;
+    QVector<uint32_t> m_sizes;
+    // Offsets of the names in m_pool
+    QVector<uint32_t> m_names;
+    QByteArray m_pool;
+
+    // Symbol indices in name order
+    QVector<int> m_by_name;
+
+    QVector<Range> m_code_ranges;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
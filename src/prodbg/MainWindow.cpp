@@ -1,17 +1,26 @@
 #include "MainWindow.h"
+#include "CodeView/CodeAnalyzer.h"
 #include "CodeView/CodeView.h"
+#include "CodeView/ControlFlowBuilder.h"
+#include "CodeView/DisassemblyView.h"
+#include "CodeView/FunctionGraphView.h"
+#include "CodeView/MixedView.h"
 #include "RecentExecutables.h"
 
 #include "AmigaUAE/AmigaUAE.h"
 #include "Backend/BackendRequests.h"
 #include "Backend/BackendSession.h"
+#include "Backend/SessionPool.h"
 #include "BreakpointModel.h"
 #include "CodeViews.h"
 #include "Config/AmigaUAEConfig.h"
+#include "Core/LineTableStore.h"
 #include "Core/PluginHandler.h"
+#include "Core/SymbolIndex.h"
 #include "MemoryView/MemoryView.h"
 #include "PluginUI/PluginUI_internal.h"
 //#include "RegisterView/RegisterView.h"
+#include "View.h"
 #include "ViewHandler.h"
 #include "toolwindowmanager/ToolWindowManager.h"
 
@@ -26,7 +35,9 @@
 #include <QtCore/QTimer>
 #include <QtWidgets/QDockWidget>
 #include <QtWidgets/QFileDialog>
+#include <QtWidgets/QInputDialog>
 #include <QtWidgets/QMainWindow>
+#include <QtWidgets/QPlainTextEdit>
 #include "SourceCodeWidget.h"
 #include "edbee/texteditorwidget.h"
 /*
@@ -46,7 +57,7 @@ MainWindow::MainWindow()
     : m_memory_view(new MemoryView(this)),
       // m_registerView(new RegisterView(this)),
       m_statusbar(new QStatusBar(this)),
-      m_backend(nullptr)
+      m_session_pool(new SessionPool(this))
 //, m_currentSession(nullptr)
 //, m_amigaUae(nullptr)
 {
@@ -54,6 +65,15 @@ MainWindow::MainWindow()
     qRegisterMetaType<uint32_t>("uint32_t");
     qRegisterMetaType<uint64_t>("uint64_t");
     qRegisterMetaType<IBackendRequests::ProgramCounterChange>("IBackendRequests::ProgramCounterChange");
+    qRegisterMetaType<QVector<IBackendRequests::ExpressionResult>>("QVector<IBackendRequests::ExpressionResult>");
+    qRegisterMetaType<QVector<IBackendRequests::TraceRecord>>("QVector<IBackendRequests::TraceRecord>");
+    qRegisterMetaType<QVector<IBackendRequests::BreakpointChange>>("QVector<IBackendRequests::BreakpointChange>");
+    qRegisterMetaType<QVector<uint32_t>>("QVector<uint32_t>");
+    qRegisterMetaType<QVector<uint64_t>>("QVector<uint64_t>");
+    qRegisterMetaType<QVector<IBackendRequests::MemoryPage>>("QVector<IBackendRequests::MemoryPage>");
+    qRegisterMetaType<IBackendRequests::TargetInfo>("IBackendRequests::TargetInfo");
+    qRegisterMetaType<QSharedPointer<const SymbolTable>>("QSharedPointer<const SymbolTable>");
+    qRegisterMetaType<QSharedPointer<const LineTable>>("QSharedPointer<const LineTable>");
 
     m_view_handler = new ViewHandler(this);
 
@@ -69,7 +89,9 @@ MainWindow::MainWindow()
 
     m_ui.setupUi(this);
 
-    m_breakpoints = new BreakpointModel;
+    m_breakpoints = new BreakpointModel(this);
+
+    connect(m_breakpoints, &BreakpointModel::changed, this, &MainWindow::breakpoints_changed);
 
     // m_codeViews = new CodeViews(m_breakpoints, this);
     // m_codeViews->openFile(QStringLiteral("src/prodbg/main.cpp"), true);
@@ -143,6 +165,79 @@ MainWindow::MainWindow()
         // addDockWidget(Qt::BottomDockWidgetArea, dock);
     }
 
+    // Disassembly of the current session. The dock can be reopened from Debug > Views
+
+    {
+        m_disassembly_view = new DisassemblyView(this);
+        m_disassembly_view->setBreakpointModel(m_breakpoints);
+
+        QDockWidget* dock = new QDockWidget(QStringLiteral("Disassembly"), this);
+        dock->setAllowedAreas(Qt::AllDockWidgetAreas);
+        dock->setObjectName(QStringLiteral("DisassemblyDock"));
+        dock->setWidget(m_disassembly_view);
+        addDockWidget(Qt::RightDockWidgetArea, dock);
+        m_ui.menuViews->addAction(dock->toggleViewAction());
+    }
+
+    // Source of the current location with the disassembly of each line interleaved. Hidden until opened from
+    // Debug > Views
+
+    {
+        m_mixed_view = new MixedView(this);
+        m_mixed_view->setBreakpointModel(m_breakpoints);
+
+        QDockWidget* dock = new QDockWidget(QStringLiteral("Source + Disassembly"), this);
+        dock->setAllowedAreas(Qt::AllDockWidgetAreas);
+        dock->setObjectName(QStringLiteral("MixedViewDock"));
+        dock->setWidget(m_mixed_view);
+        addDockWidget(Qt::RightDockWidgetArea, dock);
+        m_ui.menuViews->addAction(dock->toggleViewAction());
+        dock->hide();
+    }
+
+    // Control flow graph of a function, opened from the disassembly view
+
+    {
+        m_function_graph_view = new FunctionGraphView(this);
+
+        QDockWidget* dock = new QDockWidget(QStringLiteral("Function Graph"), this);
+        dock->setAllowedAreas(Qt::AllDockWidgetAreas);
+        dock->setObjectName(QStringLiteral("FunctionGraphDock"));
+        dock->setWidget(m_function_graph_view);
+        addDockWidget(Qt::RightDockWidgetArea, dock);
+        m_ui.menuViews->addAction(dock->toggleViewAction());
+        dock->hide();
+
+        connect(m_disassembly_view, &DisassemblyView::functionGraphRequested, this, [this, dock](uint64_t address) {
+            ControlFlowBuilder* builder = ControlFlowBuilder::for_interface(current_requests());
+
+            if (!builder) {
+                return;
+            }
+
+            m_function_graph_view->setFunction(builder->function_entry(address));
+            dock->show();
+            dock->raise();
+        });
+    }
+
+    // Tracepoint log. Hidden until the first records arrive
+
+    {
+        m_trace_log = new QPlainTextEdit(this);
+        m_trace_log->setReadOnly(true);
+        m_trace_log->setLineWrapMode(QPlainTextEdit::NoWrap);
+        m_trace_log->setMaximumBlockCount(10000);
+        m_trace_log->setFont(font);
+
+        QDockWidget* dock = new QDockWidget(QStringLiteral("Trace Log"), this);
+        dock->setAllowedAreas(Qt::AllDockWidgetAreas);
+        dock->setObjectName(QStringLiteral("TraceLogDock"));
+        dock->setWidget(m_trace_log);
+        addDockWidget(Qt::BottomDockWidgetArea, dock);
+        dock->hide();
+    }
+
     m_statusbar->showMessage(tr("Ready."));
 
     setStatusBar(m_statusbar);
@@ -160,13 +255,17 @@ MainWindow::MainWindow()
 MainWindow::~MainWindow() {
     delete m_recent_executables;
 
-    close_current_backend();
+    m_session_pool->close_all();
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 void MainWindow::init_actions() {
        connect(m_ui.debug_executable, &QAction::triggered, this, &MainWindow::open_debug_executable);
+       connect(m_ui.open_core_dump, &QAction::triggered, this, &MainWindow::open_core_dump);
+       connect(m_ui.add_tracepoint, &QAction::triggered, this, &MainWindow::add_tracepoint);
+       connect(m_ui.remove_tracepoint, &QAction::triggered, this, &MainWindow::remove_tracepoint);
+       connect(m_ui.fetch_trace_data, &QAction::triggered, this, &MainWindow::fetch_trace_data);
 
     /*
        connect(m_ui.actionStart, &QAction::triggered, this, &MainWindow::startDebug);
@@ -208,24 +307,30 @@ void MainWindow::init_recent_file_actions() {
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 void MainWindow::open_debug_executable() {
-    close_current_backend();
-
     // hard-coded for now to skip dialog
 
     QString path = QStringLiteral("t2-output/linux-gcc-debug-default/crashing_native");
 
-    BackendSession* backend = BackendSession::create_backend_session(QStringLiteral("LLDB"));
+    // Each executable gets a session of its own so already running targets are kept alive
 
-    if (!backend) {
+    int session_id = create_session(QStringLiteral("LLDB"));
+
+    if (session_id == -1) {
         printf("Unable to create LLDBBackend backend\n");
         return;
     }
 
-    setup_backend(backend);
-
     // Request starting a file for debugging. target_reply will get a status back if it's possible
     // to start the file or not and the debugging can procedde after that
-    m_backend_requests->file_target_request(path);
+    m_session_pool->requests(session_id)->file_target_request(path);
+
+    // The symbols of the executable are read in the background for the views of the session (position independent
+    // executables once the backend knows where it was loaded) and the line tables are asked for once the backend has
+    // loaded it. The code in the executable sections is analyzed as soon as both the symbols and the arch of the
+    // target are known
+    SymbolIndex::for_interface(m_session_pool->requests(session_id))->load(path);
+    LineTableStore::for_interface(m_session_pool->requests(session_id));
+    CodeAnalyzer::for_interface(m_session_pool->requests(session_id));
 
     // m_backendRequests->sendCustomString(m_amigaUae->m_setFileId, m_amigaUae->m_fileToRun);
     // m_backendRequests->sendCustomString(m_amigaUae->m_setHddPathId, m_amigaUae->m_dh0Path);
@@ -272,24 +377,17 @@ void MainWindow::show_prefs() {
 void MainWindow::start() {
     printf("MainWindow::start\n");
 
-    // const QVector<BreakpointModel::FileLineBreakpoint>& fileLineBreakpoints =
-    // m_breakpoints->get_file_line_breakpoints(); const QVector<uint64_t>& addressBreakpoints =
-    // m_breakpoints->get_address_breakpoints();
+    BackendRequests* requests = current_requests();
 
-    // add the breakpoints before we start
+    if (!requests) {
+        return;
+    }
 
-    /*
-       for (auto& bp : fileLineBreakpoints) {
-       m_backendRequests->beginAddFileLineBreakpoint(bp.filename, bp.line);
-       }
-
-       for (auto& bp : addressBreakpoints) {
-       m_backendRequests->beginAddAddressBreakpoint(bp);
-       }
-     */
+    // send all breakpoints (with their conditions) in one batch before we start
+    sync_breakpoints(m_current_session);
 
     // signal the backend thread to start
-    start_backend();
+    start_session(m_current_session);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -391,6 +489,92 @@ void MainWindow::internal_start_amiga_exe() {
 
 #endif
 
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Core files and raw memory dumps are opened in a session of their own with the core dump backend
+
+void MainWindow::open_core_dump() {
+    QString path = QFileDialog::getOpenFileName(this, QStringLiteral("Open Core Dump..."));
+
+    if (path.isEmpty()) {
+        return;
+    }
+
+    int session_id = create_session(QStringLiteral("Core Dump Backend"));
+
+    if (session_id == -1) {
+        qDebug() << "Unable to create Core Dump Backend";
+        return;
+    }
+
+    m_session_pool->requests(session_id)->file_target_request(path);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Tracepoints are given as "address: capture, capture" such as "0x1000: a0, u32[a0]". The target doesn't stop at
+// them so the records are collected in the backend until they are fetched. They are kept in the breakpoint model so
+// they are synced to all sessions like any other breakpoint.
+
+void MainWindow::add_tracepoint() {
+    bool ok = false;
+    const QString text = QInputDialog::getText(this, QStringLiteral("Add Tracepoint"),
+                                               QStringLiteral("Address: values to capture"), QLineEdit::Normal,
+                                               QString(), &ok);
+
+    if (!ok || text.trimmed().isEmpty()) {
+        return;
+    }
+
+    const int split = text.indexOf(QLatin1Char(':'));
+    const QString address_text = (split == -1 ? text : text.left(split)).trimmed();
+    const uint64_t address = address_text.toULongLong(&ok, 0);
+
+    if (!ok) {
+        status_update(QStringLiteral("Invalid tracepoint address '%1'").arg(address_text));
+        return;
+    }
+
+    QStringList captures;
+
+    if (split != -1) {
+        for (const QString& capture : text.mid(split + 1).split(QLatin1Char(','), QString::SkipEmptyParts)) {
+            captures.append(capture.trimmed());
+        }
+    }
+
+    m_breakpoints->set_address_tracepoint(address, captures);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MainWindow::remove_tracepoint() {
+    bool ok = false;
+    const QString text = QInputDialog::getText(this, QStringLiteral("Remove Tracepoint"), QStringLiteral("Address"),
+                                               QLineEdit::Normal, QString(), &ok);
+
+    if (!ok || text.trimmed().isEmpty()) {
+        return;
+    }
+
+    const uint64_t address = text.trimmed().toULongLong(&ok, 0);
+
+    if (!ok || !m_breakpoints->has_tracepoint(address)) {
+        status_update(QStringLiteral("No tracepoint at '%1'").arg(text.trimmed()));
+        return;
+    }
+
+    m_breakpoints->remove_address_breakpoint(address);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MainWindow::fetch_trace_data() {
+    BackendRequests* requests = current_requests();
+
+    if (requests) {
+        requests->fetch_trace_data();
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 void MainWindow::process_ended(int) {
@@ -399,12 +583,62 @@ void MainWindow::process_ended(int) {
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void MainWindow::setup_backend_connections() {
-    connect(this, &MainWindow::start_backend, m_backend, &BackendSession::start);
-    //connect(this, &MainWindow::target_reply, m_backend, &BackendSession::target_reply);
+int MainWindow::create_session(const QString& backend_name) {
+    int session_id = m_session_pool->create_session(backend_name);
 
-    connect(m_backend, &BackendSession::target_reply, this, &MainWindow::target_reply);
+    if (session_id == -1) {
+        return -1;
+    }
+
+    BackendSession* session = m_session_pool->session(session_id);
+
+    // Replies are tagged with the session id as multiple sessions may be waiting for a target at the same time
+
+    connect(session, &BackendSession::target_reply, this, [this, session_id](bool status, const QString& error_message) {
+        target_reply(session_id, status, error_message);
+    });
+
+    connect(m_session_pool->requests(session_id), &IBackendRequests::breakpoints_acknowledged, this,
+            [session_id](const QVector<uint32_t>&, const QVector<uint32_t>& rejected) {
+                for (uint32_t id : rejected) {
+                    qDebug() << "Session" << session_id << "was unable to set breakpoint" << id;
+                }
+            });
+
+    // Conditions are compiled when breakpoints are synced so a malformed one is only found there
+    connect(m_session_pool->requests(session_id), &IBackendRequests::breakpoint_condition_error, this,
+            [this](const QString& condition, const QString& error) {
+                status_update(QStringLiteral("Breakpoint condition '%1': %2").arg(condition, error));
+            });
+
+    connect(m_session_pool->requests(session_id), &IBackendRequests::trace_data_received, this,
+            [this, session_id](const QVector<IBackendRequests::TraceRecord>& records, uint64_t dropped) {
+                const QHash<uint64_t, QStringList> tracepoints = m_tracepoint_captures.value(session_id);
+
+                if (dropped > 0) {
+                    m_trace_log->appendPlainText(QStringLiteral("(%1 records dropped)").arg(dropped));
+                }
+
+                for (const IBackendRequests::TraceRecord& record : records) {
+                    const QStringList captures = tracepoints.value(record.address);
+                    QString line = QStringLiteral("0x%1:").arg(record.address, 0, 16);
+
+                    for (int i = 0, count = record.values.size(); i < count; ++i) {
+                        const QString name = i < captures.size() ? captures[i] : QString::number(i);
 
+                        if (record.error_mask & (1u << i)) {
+                            line += QStringLiteral(" %1=?").arg(name);
+                        } else {
+                            line += QStringLiteral(" %1=0x%2").arg(name).arg(record.values[i], 0, 16);
+                        }
+                    }
+
+                    m_trace_log->appendPlainText(line);
+                }
+
+                m_trace_log->parentWidget()->show();
+                status_update(QStringLiteral("Fetched %1 trace records").arg(records.size()));
+            });
 
     /*
        connect(this, &MainWindow::stepInBackend, m_backend, &BackendSession::stepIn);
@@ -414,22 +648,133 @@ void MainWindow::setup_backend_connections() {
        connect(m_backend, &BackendSession::statusUpdate, this, &MainWindow::statusUpdate);
      */
 
-    connect(m_backend_thread, &QThread::finished, m_backend, &BackendSession::thread_finished);
+    return session_id;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MainWindow::start_session(int session_id) {
+    BackendSession* session = m_session_pool->session(session_id);
+
+    if (!session) {
+        return;
+    }
+
+    // The session lives on one of the pool workers so the call is queued to that thread
+    QMetaObject::invokeMethod(session, "start", Qt::QueuedConnection);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void MainWindow::target_reply(bool status, const QString& error_message) {
-    // Got ok from backend! we are ready to got so start it, otherwise show the error and close the current backend
+void MainWindow::set_current_session(int session_id) {
+    disconnect(m_source_view_connection);
+
+    m_current_session = session_id;
+
+    BackendRequests* requests = current_requests();
+
+    if (requests) {
+        m_source_view_connection = connect(requests, &IBackendRequests::program_counter_changed, m_source_view,
+                                           &SourceCodeWidget::program_counter_changed);
+    }
+
+    m_source_view->set_line_table_store(LineTableStore::for_interface(requests));
+    m_disassembly_view->set_backend_interface(requests);
+    m_function_graph_view->set_backend_interface(requests);
+    m_mixed_view->set_backend_interface(requests);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MainWindow::bind_view(View* view, int session_id) {
+    view->set_backend_interface(m_session_pool->requests(session_id));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BackendRequests* MainWindow::current_requests() const {
+    return m_session_pool->requests(m_current_session);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Sends everything that changed in the breakpoint model since the last sync of the session as one batch
+
+void MainWindow::sync_breakpoints(int session_id) {
+    BackendRequests* requests = m_session_pool->requests(session_id);
+
+    if (!requests) {
+        return;
+    }
+
+    QVector<IBackendRequests::BreakpointChange> changes;
+    m_breakpoints->get_changes_since(m_breakpoint_versions.value(session_id, 0), &changes);
+
+    if (!changes.isEmpty()) {
+        requests->sync_breakpoints(changes);
+    }
+
+    // The trace log labels the records with the captures this session was given for the address
+
+    QHash<uint64_t, QStringList>& tracepoints = m_tracepoint_captures[session_id];
+
+    for (const IBackendRequests::BreakpointChange& change : changes) {
+        if (change.action == IBackendRequests::BreakpointChange::Remove || !change.tracepoint) {
+            tracepoints.remove(change.address);
+        } else {
+            tracepoints.insert(change.address, change.captures);
+        }
+    }
+
+    m_breakpoint_versions.insert(session_id, m_breakpoints->version());
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MainWindow::breakpoints_changed() {
+    // Several edits in a row (such as loading a project) are collected and sent once the event loop gets back here
+
+    if (m_breakpoint_sync_pending) {
+        return;
+    }
+
+    m_breakpoint_sync_pending = true;
+
+    QTimer::singleShot(0, this, [this]() {
+        m_breakpoint_sync_pending = false;
+
+        QVector<int> ids = m_session_pool->session_ids();
+        uint64_t oldest = m_breakpoints->version();
+
+        for (int id : ids) {
+            sync_breakpoints(id);
+            oldest = qMin(oldest, m_breakpoint_versions.value(id, 0));
+        }
+
+        // Closed sessions doesn't need to be synced anymore
+        for (int id : m_breakpoint_versions.keys()) {
+            if (!ids.contains(id)) {
+                m_breakpoint_versions.remove(id);
+                m_tracepoint_captures.remove(id);
+            }
+        }
+
+        m_breakpoints->trim_history(oldest);
+    });
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MainWindow::target_reply(int session_id, bool status, const QString& error_message) {
+    // Got ok from backend! we are ready to got so start it, otherwise show the error and close the session
     if (status) {
-        // printf starting the backend!
-        start_backend();
+        // Breakpoints set before the target was loaded are sent in one batch ahead of the start
+        sync_breakpoints(session_id);
+        start_session(session_id);
 
         // Hook-up the views to the backend
-        connect(m_backend_requests, &IBackendRequests::program_counter_changed, m_source_view, &SourceCodeWidget::program_counter_changed);
-
+        set_current_session(session_id);
     } else {
-        close_current_backend();
+        m_session_pool->close_session(session_id);
         qDebug() << "MainWindow::target_reply " << status << " " << error_message;
     }
 }
@@ -437,26 +782,23 @@ void MainWindow::target_reply(bool status, const QString& error_message) {
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 void MainWindow::start_dummy_backend() {
-    BackendSession* backend = BackendSession::create_backend_session(QStringLiteral("Dummy Backend"));
+    int session_id = create_session(QStringLiteral("Dummy Backend"));
 
-    if (!backend) {
+    if (session_id == -1) {
         qDebug() << "Unable to create Dummy Backend";
         return;
     }
 
-    setup_backend(backend);
+    set_current_session(session_id);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 void MainWindow::close_current_backend() {
-    if (m_backend_thread) {
-        m_backend_thread->quit();
-        m_backend_thread->wait();
-    }
+    // Only the current session is closed, other targets keeps running
 
-    delete m_backend_thread;
-    delete m_backend_requests;
+    disconnect(m_source_view_connection);
+    m_session_pool->close_session(m_current_session);
 
     /*
     if (m_register_view) {
@@ -468,9 +810,8 @@ void MainWindow::close_current_backend() {
     // m_codeViews->set_backend_interface(nullptr);
     // m_memoryView->set_backend_interface(nullptr);
 
-    m_backend = nullptr;
-    m_backend_thread = nullptr;
-    m_backend_requests = nullptr;
+    QVector<int> ids = m_session_pool->session_ids();
+    set_current_session(ids.isEmpty() ? -1 : ids.last());
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -502,25 +843,6 @@ void MainWindow::startAmigaUAEBackend() {
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void MainWindow::setup_backend(BackendSession* backend) {
-    m_backend = backend;
-
-    m_backend_thread = new QThread;
-
-    m_backend->moveToThread(m_backend_thread);
-    m_backend_requests = new BackendRequests(m_backend);
-
-    // m_registerView->set_backend_interface(m_backendRequests);
-    // m_codeViews->set_backend_interface(m_backendRequests);
-    //m_memory_view->set_backend_interface(m_backend_requests);
-
-    m_backend_thread->start();
-
-    setup_backend_connections();
-}
-
-///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
 void MainWindow::stop_internal() {
     stop_backend();
     close_current_backend();
@@ -565,7 +887,7 @@ void MainWindow::toggle_breakpoint() {
 void MainWindow::new_memory_view() {
 /*
     MemoryView* mv = new MemoryView(this);
-    mv->set_backend_interface(m_backendRequests);
+    bind_view(mv, m_current_session);
     QDockWidget* dock = new QDockWidget(QStringLiteral("MemoryView"), this);
     dock->setAllowedAreas(Qt::AllDockWidgetAreas);
     dock->setObjectName(QStringLiteral("MemoryViewDock"));
@@ -581,7 +903,7 @@ void MainWindow::new_memory_view() {
 Q_SLOT void MainWindow::new_register_view() {
     /*
     //RegisterView* rg = new RegisterView(this);
-    rg->set_backend_interface(m_backendRequests);
+    bind_view(rg, m_current_session);
     QDockWidget* dock = new QDockWidget(QStringLiteral("RegisteView"), this);
     dock->setAllowedAreas(Qt::AllDockWidgetAreas);
     dock->setObjectName(QStringLiteral("RegisteViewDock"));
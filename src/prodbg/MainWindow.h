@@ -1,9 +1,11 @@
 #pragma once
 
+#include <QtCore/QHash>
 #include <QtWidgets/QMainWindow>
 #include "api/include/pd_ui.h"
 #include "ui_MainWindow.h"
 
+class QPlainTextEdit;
 class QStatusBar;
 class QThread;
 class QPluginLoader;
@@ -12,11 +14,16 @@ namespace prodbg {
 
 class Session;
 class CodeView;
+class DisassemblyView;
+class FunctionGraphView;
 class MemoryView;
+class MixedView;
 class AmigaUAE;
 class BackendSession;
 // class RegisterView;
 class BackendRequests;
+class SessionPool;
+class View;
 class BreakpointModel;
 class CodeViews;
 class RecentExecutables;
@@ -47,19 +54,23 @@ private:
     Q_SLOT void toggle_breakpoint();
     Q_SLOT void open_recent_exe();
     Q_SLOT void open_debug_executable();
+    Q_SLOT void open_core_dump();
+    Q_SLOT void add_tracepoint();
+    Q_SLOT void remove_tracepoint();
+    Q_SLOT void fetch_trace_data();
 
     Q_SLOT void new_memory_view();
     Q_SLOT void new_register_view();
 
     Q_SIGNAL void break_cont_backend();
-    Q_SIGNAL void start_backend();
     Q_SIGNAL void stop_backend();
     Q_SIGNAL void step_in_backend();
     Q_SIGNAL void step_over_backend();
 
-    Q_SLOT void target_reply(bool status, const QString& error_message);
+    Q_SLOT void target_reply(int session_id, bool status, const QString& error_message);
 
     Q_SLOT void show_prefs();
+    Q_SLOT void breakpoints_changed();
 
 private:
     // Current supported backends (hard-coded for now)
@@ -75,8 +86,12 @@ private:
     void start_dummy_backend();
     void close_current_backend();
     void start_amiga_uae_backend();
-    void setup_backend_connections();
-    void setup_backend(BackendSession* backend);
+    int create_session(const QString& backend_name);
+    void start_session(int session_id);
+    void set_current_session(int session_id);
+    void bind_view(View* view, int session_id);
+    BackendRequests* current_requests() const;
+    void sync_breakpoints(int session_id);
 
     void init_recent_file_actions();
     void stop_internal();
@@ -104,17 +119,31 @@ private:
 
     // Hardcoded views for now.
     MemoryView* m_memory_view = nullptr;
+    DisassemblyView* m_disassembly_view = nullptr;
+    FunctionGraphView* m_function_graph_view = nullptr;
+    MixedView* m_mixed_view = nullptr;
     QStatusBar* m_statusbar = nullptr;
     BreakpointModel* m_breakpoints = nullptr;
 
+    // Records pulled with fetch_trace_data are appended to the log with the capture expressions as labels. The
+    // captures are per session (and address) as sessions are synced with the breakpoint model at different times
+    QPlainTextEdit* m_trace_log = nullptr;
+    QHash<int, QHash<uint64_t, QStringList>> m_tracepoint_captures;
+
     Ui_MainWindow m_ui;
     Backend m_current_backend = Dummy;
 
     CodeViews* m_code_views = nullptr;
 
-    BackendRequests* m_backend_requests = nullptr;
-    BackendSession* m_backend = nullptr;
-    QThread* m_backend_thread = nullptr;
+    // All running sessions. The current session is the one driven by the main window actions and the source view
+    SessionPool* m_session_pool = nullptr;
+    int m_current_session = -1;
+    QMetaObject::Connection m_source_view_connection;
+
+    // Version of the breakpoint model each session has been synced with. Edits are batched and sent once per event
+    // loop iteration.
+    QHash<int, uint64_t> m_breakpoint_versions;
+    bool m_breakpoint_sync_pending = false;
 };
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,62 @@
+#include "GlyphAtlas.h"
+#include <QtCore/QtMath>
+#include <QtGui/QFontMetrics>
+#include <QtGui/QPainter>
+
+namespace prodbg {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool GlyphAtlas::update(const QFont& font, const QColor& color, qreal device_pixel_ratio) {
+    QString key = font.key();
+
+    if (!m_pixmap.isNull() && key == m_font_key && color.rgba() == m_color &&
+        device_pixel_ratio == m_device_pixel_ratio) {
+        return false;
+    }
+
+    QFontMetrics metrics(font);
+
+    m_font_key = key;
+    m_color = color.rgba();
+    m_device_pixel_ratio = device_pixel_ratio;
+    m_char_width = metrics.horizontalAdvance(QLatin1Char('W'));
+    m_row_height = metrics.height();
+
+    const int count = LastChar - FirstChar + 1;
+
+    m_pixmap = QPixmap(qCeil(m_char_width * count * device_pixel_ratio), qCeil(m_row_height * device_pixel_ratio));
+    m_pixmap.setDevicePixelRatio(device_pixel_ratio);
+    m_pixmap.fill(Qt::transparent);
+
+    QPainter painter(&m_pixmap);
+    painter.setFont(font);
+    painter.setPen(color);
+
+    for (int i = 0; i < count; ++i) {
+        painter.drawText(i * m_char_width, metrics.ascent(), QString(QLatin1Char(char(FirstChar + i))));
+    }
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void GlyphAtlas::draw(QPainter* painter, int x, int y, const char* text, int count) const {
+    const qreal cell_width = m_char_width * m_device_pixel_ratio;
+    const qreal cell_height = m_row_height * m_device_pixel_ratio;
+
+    for (int i = 0; i < count; ++i, x += m_char_width) {
+        int c = uint8_t(text[i]);
+
+        if (c <= FirstChar || c > LastChar) {
+            continue;
+        }
+
+        QRectF source((c - FirstChar) * cell_width, 0.0, cell_width, cell_height);
+        painter->drawPixmap(QPointF(x, y), m_pixmap, source);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <QtGui/QColor>
+#include <QtGui/QFont>
+#include <QtGui/QPixmap>
+
+class QPainter;
+
+namespace prodbg {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Pre-rendered glyphs of a monospace font for views that draw a fixed grid of characters (such as the memory view).
+//
+// The printable ASCII range is rendered once into a pixmap with one cell per character and text is drawn by copying
+// cells from it. This skips the text shaping and layout QPainter::drawText does for every call, which dominates the
+// paint time of views that redraw thousands of short strings. The atlas is rebuilt when the font, color or device
+// pixel ratio changes.
+
+class GlyphAtlas {
+   public:
+    // Returns true if the atlas had to be rebuilt
+    bool update(const QFont& font, const QColor& color, qreal device_pixel_ratio);
+
+    int char_width() const { return m_char_width; }
+    int row_height() const { return m_row_height; }
+
+    // Draws count chars starting at x, y (top left of the first cell). Chars outside the printable range and spaces
+    // are skipped (the background is expected to be cleared already)
+    void draw(QPainter* painter, int x, int y, const char* text, int count) const;
+
+   private:
+    enum {
+        FirstChar = 32,
+        LastChar = 126,
+    };
+
+    QPixmap m_pixmap;
+    QString m_font_key;
+    QRgb m_color = 0;
+    qreal m_device_pixel_ratio = 0.0;
+    int m_char_width = 0;
+    int m_row_height = 0;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
@@ -0,0 +1,481 @@
+#include "MemoryCache.h"
+#include <string.h>
+#include <algorithm>
+#include "MemoryDiff.h"
+
+namespace prodbg {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+MemoryCache::MemoryCache(IBackendRequests* interface) : QObject(interface), m_interface(interface) {
+    if (interface) {
+        connect(interface, &IBackendRequests::memory_pages_received, this, &MemoryCache::pages_received);
+        connect(interface, &IBackendRequests::program_counter_changed, this, &MemoryCache::program_counter_changed);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+MemoryCache* MemoryCache::for_interface(IBackendRequests* interface) {
+    if (!interface) {
+        return nullptr;
+    }
+
+    MemoryCache* cache = interface->findChild<MemoryCache*>(QString(), Qt::FindDirectChildrenOnly);
+
+    return cache ? cache : new MemoryCache(interface);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool MemoryCache::read(uint64_t address, uint64_t count, MemorySpan* span) {
+    const uint16_t flags = IBackendRequests::Readable | IBackendRequests::Writable;
+
+    span->reset(address, uint32_t(count));
+
+    uint8_t* out = (uint8_t*)span->data.data();
+    uint64_t end = address + count;
+    uint64_t page_address = address & ~uint64_t(PageSize - 1);
+
+    bool complete = true;
+
+    m_missing.resize(0);
+
+    for (; page_address < end; page_address += PageSize) {
+        uint64_t start = qMax(page_address, address);
+        uint64_t stop = qMin(page_address + PageSize, end);
+        uint32_t out_offset = uint32_t(start - address);
+        auto it = m_page_index.constFind(page_address);
+
+        if (it == m_page_index.constEnd()) {
+            memset(out + out_offset, 0, size_t(stop - start));
+            span->add_run(out_offset, 0);
+            complete = false;
+
+            // A page being prefetched is now needed for real so the prefetch isn't the only request in flight any more
+            if (!m_pending.contains(page_address)) {
+                m_missing.append(page_address);
+            } else {
+                m_prefetching.remove(page_address);
+            }
+        } else {
+            int slot = it.value();
+            const Page& page = m_pages[slot];
+
+            // Pages can be short (or empty) if only part of them could be read
+            uint64_t readable_stop = qMin(stop, page_address + uint64_t(page.data.size()));
+
+            if (readable_stop > start) {
+                memcpy(out + out_offset, page.data.constData() + (start - page_address), size_t(readable_stop - start));
+
+                if (page.changed.isEmpty()) {
+                    span->add_run(out_offset, flags);
+                } else {
+                    span->add_changed_runs(out_offset, (const uint8_t*)page.changed.constData(),
+                                           size_t(start - page_address), size_t(readable_stop - page_address), flags);
+                }
+            } else {
+                readable_stop = start;
+            }
+
+            if (readable_stop < stop) {
+                memset(out + (readable_stop - address), 0, size_t(stop - readable_stop));
+                span->add_run(uint32_t(readable_stop - address), 0);
+            }
+
+            unlink(slot);
+            link_front(slot);
+        }
+
+        // Wrapped around the end of the address space
+        if (page_address + PageSize < page_address) {
+            break;
+        }
+    }
+
+    if (m_missing.isEmpty()) {
+        return complete;
+    }
+
+    for (uint64_t missing : m_missing) {
+        m_pending.insert(missing);
+    }
+
+    if (m_interface) {
+        m_requests.insert(m_interface->read_memory_pages(m_missing, PageSize));
+    }
+
+    return false;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MemoryCache::prefetch(uint64_t address, uint64_t count) {
+    uint64_t end = address + count;
+    int budget = qMin(m_prefetch_budget, m_max_pages / 4);
+
+    m_prefetch_queue.resize(0);
+
+    for (uint64_t page = address & ~uint64_t(PageSize - 1); page < end; page += PageSize) {
+        if (m_prefetch_queue.size() + m_prefetching.size() >= budget) {
+            break;
+        }
+
+        if (!m_page_index.contains(page) && !m_pending.contains(page)) {
+            m_prefetch_queue.append(page);
+        }
+
+        if (page + PageSize < page) {
+            break;
+        }
+    }
+
+    send_prefetch();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MemoryCache::send_prefetch() {
+    // Pages read by views has priority so wait for those to arrive first
+
+    if (m_prefetch_queue.isEmpty() || m_pending.size() > m_prefetching.size() || !m_interface) {
+        return;
+    }
+
+    for (uint64_t page : m_prefetch_queue) {
+        m_pending.insert(page);
+        m_prefetching.insert(page);
+    }
+
+    m_requests.insert(m_interface->read_memory_pages(m_prefetch_queue, PageSize));
+    m_prefetch_queue.resize(0);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool MemoryCache::page_hash(uint64_t address, uint64_t* hash) const {
+    auto it = m_page_index.constFind(address & ~uint64_t(PageSize - 1));
+
+    if (it == m_page_index.constEnd()) {
+        return false;
+    }
+
+    *hash = m_pages[it.value()].hash;
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MemoryCache::write(uint64_t address, const QByteArray& data) {
+    const uint64_t end = address + uint64_t(data.size());
+
+    if (data.isEmpty()) {
+        return;
+    }
+
+    for (uint64_t page_address = address & ~uint64_t(PageSize - 1); page_address < end; page_address += PageSize) {
+        auto it = m_page_index.constFind(page_address);
+
+        if (m_pending.remove(page_address)) {
+            m_prefetching.remove(page_address);
+            m_stale.insert(page_address);
+        }
+
+        if (it != m_page_index.constEnd()) {
+            Page& page = m_pages[it.value()];
+            const uint64_t start = qMax(page_address, address);
+            const uint64_t stop = qMin(page_address + uint64_t(page.data.size()), end);
+
+            if (stop > start) {
+                memcpy(page.data.data() + (start - page_address), data.constData() + (start - address),
+                       size_t(stop - start));
+                page.hash = MemoryDiff_hash((const uint8_t*)page.data.constData(), size_t(page.data.size()));
+                update_changed(page);
+            }
+        }
+
+        if (page_address + PageSize < page_address) {
+            break;
+        }
+    }
+
+    if (m_interface) {
+        m_interface->write_memory(address, data);
+    }
+
+    memory_written(address, uint64_t(data.size()));
+    pages_updated();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MemoryCache::set_prefetch_budget(int pages) {
+    m_prefetch_budget = qMax(0, pages);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool MemoryCache::find_next_changed(uint64_t address, uint64_t* found) const {
+    QVector<uint64_t> pages;
+
+    for (const Page& page : m_pages) {
+        if (!page.changed.isEmpty() && m_page_index.contains(page.address)) {
+            pages.append(page.address);
+        }
+    }
+
+    if (pages.isEmpty()) {
+        return false;
+    }
+
+    std::sort(pages.begin(), pages.end());
+
+    const uint64_t first_page = address & ~uint64_t(PageSize - 1);
+
+    // Search the pages from the one address is in and then wrap around to the ones before it
+
+    auto start = std::lower_bound(pages.begin(), pages.end(), first_page);
+    int count = pages.size();
+    int first = int(start - pages.begin());
+
+    for (int i = 0; i <= count; ++i) {
+        uint64_t page_address = pages[(first + i) % count];
+        const Page& page = m_pages[m_page_index.value(page_address)];
+        size_t offset = 0;
+
+        // Only the page address is in gets searched twice (after address and then before it when wrapping)
+
+        if (i == 0 && page_address == first_page) {
+            offset = size_t(address - page_address);
+        } else if (i == count && page_address != first_page) {
+            break;
+        }
+
+        int64_t index = MemoryDiff_find_next((const uint8_t*)page.changed.constData(), size_t(page.data.size()),
+                                             i == count ? 0 : offset);
+
+        if (index >= 0) {
+            *found = page_address + uint64_t(index);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MemoryCache::set_max_pages(int count) {
+    m_max_pages = qMax(1, count);
+
+    while (m_page_index.size() > m_max_pages) {
+        int slot = m_tail;
+        m_page_index.remove(m_pages[slot].address);
+        m_pages[slot].data = QByteArray();
+        m_pages[slot].changed = QByteArray();
+        unlink(slot);
+        m_free_slots.append(slot);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MemoryCache::invalidate() {
+    clear_pages();
+
+    // Pages in flight were read before the invalidation so their replies are dropped. They are requested again the
+    // next time they are read.
+
+    m_stale += m_pending;
+    m_pending.clear();
+    m_prefetching.clear();
+    m_prefetch_queue.resize(0);
+
+    pages_updated();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MemoryCache::program_counter_changed(const IBackendRequests::ProgramCounterChange&) {
+    invalidate();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MemoryCache::pages_received(uint64_t request_id, const QVector<IBackendRequests::MemoryPage>& pages,
+                                 int address_width, uint64_t epoch) {
+    bool updated = false;
+
+    if (!m_requests.remove(request_id)) {
+        return;
+    }
+
+    // Memory read in a newer epoch means the target has been running so everything cached is stale
+
+    if (epoch > m_epoch) {
+        clear_pages();
+        m_epoch = epoch;
+    }
+
+    if (address_width > 0) {
+        m_address_width = address_width;
+    }
+
+    for (const IBackendRequests::MemoryPage& page : pages) {
+        if (m_stale.remove(page.address)) {
+            continue;
+        }
+
+        if (!m_pending.remove(page.address)) {
+            continue;
+        }
+
+        // Prefetched pages goes into the cache without a repaint as nobody is looking at them yet
+
+        if (!m_prefetching.remove(page.address)) {
+            updated = true;
+        }
+
+        insert_page(page.address, page.data);
+    }
+
+    if (updated) {
+        pages_updated();
+    }
+
+    send_prefetch();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MemoryCache::clear_pages() {
+    // Keep the data for comparing with the next stop. QByteArray is shared so this doesn't copy anything. The
+    // previous copies are bounded by the cache size as well (dropping arbitrary ones when there are too many)
+
+    for (const Page& page : m_pages) {
+        if (m_page_index.contains(page.address) && !page.data.isEmpty()) {
+            m_previous.insert(page.address, page.data);
+        }
+    }
+
+    while (m_previous.size() > m_max_pages) {
+        m_previous.erase(m_previous.begin());
+    }
+
+    m_pages.resize(0);
+    m_free_slots.resize(0);
+    m_page_index.clear();
+    m_head = -1;
+    m_tail = -1;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MemoryCache::insert_page(uint64_t address, const QByteArray& data) {
+    int slot = m_page_index.value(address, -1);
+
+    if (slot != -1) {
+        m_pages[slot].data = data;
+        m_pages[slot].hash = MemoryDiff_hash((const uint8_t*)data.constData(), size_t(data.size()));
+        update_changed(m_pages[slot]);
+        unlink(slot);
+        link_front(slot);
+        return;
+    }
+
+    // Reuse the least recently used page when the cache is full
+
+    if (m_page_index.size() >= m_max_pages) {
+        slot = m_tail;
+        m_page_index.remove(m_pages[slot].address);
+        unlink(slot);
+    } else if (!m_free_slots.isEmpty()) {
+        slot = m_free_slots.takeLast();
+    } else {
+        slot = m_pages.size();
+        m_pages.append(Page());
+    }
+
+    Page& page = m_pages[slot];
+    page.address = address;
+    page.data = data;
+    page.hash = MemoryDiff_hash((const uint8_t*)data.constData(), size_t(data.size()));
+    update_changed(page);
+
+    m_page_index.insert(address, slot);
+    link_front(slot);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MemoryCache::update_changed(Page& page) {
+    auto it = m_previous.constFind(page.address);
+
+    page.changed = QByteArray();
+
+    if (it == m_previous.constEnd() || page.data.isEmpty()) {
+        return;
+    }
+
+    const QByteArray& previous = it.value();
+    int size = page.data.size();
+
+    QByteArray mask((size + 7) / 8, 0);
+    bool changed = false;
+
+    // Bytes that weren't readable before are treated as changed
+
+    if (previous.size() < size) {
+        memset(mask.data(), 0xff, size_t(mask.size()));
+        size = previous.size() & ~7;
+        changed = true;
+    }
+
+    changed |= MemoryDiff_changed_mask((const uint8_t*)page.data.constData(), (const uint8_t*)previous.constData(),
+                                       size_t(size), (uint8_t*)mask.data());
+
+    if (changed) {
+        page.changed = mask;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MemoryCache::unlink(int slot) {
+    Page& page = m_pages[slot];
+
+    if (page.prev != -1) {
+        m_pages[page.prev].next = page.next;
+    } else {
+        m_head = page.next;
+    }
+
+    if (page.next != -1) {
+        m_pages[page.next].prev = page.prev;
+    } else {
+        m_tail = page.prev;
+    }
+
+    page.prev = -1;
+    page.next = -1;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MemoryCache::link_front(int slot) {
+    Page& page = m_pages[slot];
+
+    page.prev = -1;
+    page.next = m_head;
+
+    if (m_head != -1) {
+        m_pages[m_head].prev = slot;
+    } else {
+        m_tail = slot;
+    }
+
+    m_head = slot;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <stdint.h>
+#include <QtCore/QHash>
+#include <QtCore/QObject>
+#include <QtCore/QPointer>
+#include <QtCore/QSet>
+#include <QtCore/QVector>
+#include "Backend/IBackendRequests.h"
+#include "MemorySpan.h"
+
+namespace prodbg {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Page cache of target memory shared by all memory views of a session.
+//
+// Memory is fetched in fixed 4 KB pages that are kept in LRU order up to a max number of pages. Views read the
+// visible range from the cache and only the pages that are missing are requested (all in one round trip) from the
+// backend. The view is told to repaint with pages_updated once they have arrived. Scrolling thus only hits the
+// backend once for each new page instead of for every scroll step.
+//
+// All pages are dropped when the target stops at a new location or when pages read in a newer stop epoch arrive (the
+// target has been running). Replies that were in flight when the pages were dropped are ignored.
+//
+// The data of dropped pages is kept as the previous copy of the page. When the page is read again it's compared with
+// the previous copy and the bytes that differ get the Changed flag so views can show what changed between stops.
+
+class MemoryCache : public QObject {
+    Q_OBJECT
+
+   public:
+    enum {
+        PageSize = 4096,
+        DefaultMaxPages = 1024,
+    };
+
+    explicit MemoryCache(IBackendRequests* interface);
+
+    // Cache shared by all views for the interface. Created on first use and owned by the interface
+    static MemoryCache* for_interface(IBackendRequests* interface);
+
+    // Copies count bytes from address into span with the MemoryAddressFlags (including Changed) as runs. Bytes that
+    // aren't cached yet are zero with no flags set and are requested from the backend. Returns true if the whole range
+    // was in the cache.
+    bool read(uint64_t address, uint64_t count, MemorySpan* span);
+
+    // Low priority request for pages that are likely to be read soon (see ScrollPrefetcher). Replaces any earlier
+    // prefetch that hasn't been sent yet. The request is only sent when no pages read by views are in flight and is
+    // limited to the prefetch budget so it never pushes out more than a quarter of the cache.
+    void prefetch(uint64_t address, uint64_t count);
+
+    bool has_page(uint64_t address) const { return m_page_index.contains(address & ~uint64_t(PageSize - 1)); }
+
+    // Hash of the contents of the cached page that address is in (see MemoryDiff_hash). Pages with the same hash has
+    // the same bytes (and the same readable size). Returns false if the page isn't cached.
+    bool page_hash(uint64_t address, uint64_t* hash) const;
+
+    // Writes data to target memory at address. Cached pages are updated right away (bytes that aren't readable stay
+    // that way) and memory_written is sent. Pages that are in flight are read again as the reply may be older than
+    // the write.
+    void write(uint64_t address, const QByteArray& data);
+
+    // Number of bytes used for an address on the target (as reported by the backend, 0 if not known yet)
+    int address_width() const { return m_address_width; }
+
+    // Finds the first changed byte in the cached pages at or after address. Wraps around to the start if there is
+    // none after it. Returns false if no cached byte has changed.
+    bool find_next_changed(uint64_t address, uint64_t* found) const;
+
+    void set_max_pages(int count);
+    void set_prefetch_budget(int pages);
+    int page_count() const { return m_page_index.size(); }
+
+    // Drops all cached pages. Pages that are in flight are ignored when they arrive
+    void invalidate();
+
+    // Sent when new pages has arrived
+    Q_SIGNAL void pages_updated();
+
+    // Sent when write has changed [address, address + size)
+    Q_SIGNAL void memory_written(uint64_t address, uint64_t size);
+
+   private:
+    Q_SLOT void pages_received(uint64_t request_id, const QVector<IBackendRequests::MemoryPage>& pages,
+                               int address_width, uint64_t epoch);
+    Q_SLOT void program_counter_changed(const IBackendRequests::ProgramCounterChange& pc);
+
+    void send_prefetch();
+    void clear_pages();
+    void insert_page(uint64_t address, const QByteArray& data);
+    void unlink(int slot);
+    void link_front(int slot);
+
+    struct Page {
+        uint64_t address;
+        QByteArray data;
+        // One bit per byte (LSB first) set if it differs from the previous copy. Empty if nothing changed
+        QByteArray changed;
+        uint64_t hash;
+        // LRU list (slot indices, -1 = none)
+        int prev;
+        int next;
+    };
+
+    // Compares the page with its previous copy and updates the changed mask
+    void update_changed(Page& page);
+
+    QPointer<IBackendRequests> m_interface;
+
+    QVector<Page> m_pages;
+    QVector<int> m_free_slots;
+    QHash<uint64_t, int> m_page_index;
+    // Most and least recently used page
+    int m_head = -1;
+    int m_tail = -1;
+    int m_max_pages = DefaultMaxPages;
+
+    // Pages requested from the backend and pages that were in flight when the cache was invalidated (the first reply
+    // for those is dropped)
+    QSet<uint64_t> m_pending;
+    QSet<uint64_t> m_stale;
+    QVector<uint64_t> m_missing;
+    // Ids of the read_memory_pages requests in flight. Replies to other users of the interface are skipped
+    QSet<uint64_t> m_requests;
+
+    // Data of pages from earlier stops that changed bytes are compared against
+    QHash<uint64_t, QByteArray> m_previous;
+
+    // Pages in flight that were requested by prefetch (subset of m_pending) and pages waiting to be prefetched
+    QSet<uint64_t> m_prefetching;
+    QVector<uint64_t> m_prefetch_queue;
+    int m_prefetch_budget = DefaultMaxPages / 4;
+
+    // Latest stop epoch pages has been received in
+    uint64_t m_epoch = 0;
+    int m_address_width = 0;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
@@ -0,0 +1,175 @@
+#include "MemoryDiff.h"
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PD_MEMDIFF_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(PD_MEMDIFF_SSE2) && (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define PD_MEMDIFF_AVX2 1
+#include <immintrin.h>
+#endif
+
+namespace prodbg {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Handles the bytes from start to size one at a time. start has to be a multiple of 8.
+
+static bool changed_mask_tail(const uint8_t* a, const uint8_t* b, size_t start, size_t size, uint8_t* mask) {
+    bool changed = false;
+
+    memset(mask + start / 8, 0, (size - start + 7) / 8);
+
+    for (size_t i = start; i < size; ++i) {
+        if (a[i] != b[i]) {
+            mask[i >> 3] |= uint8_t(1 << (i & 7));
+            changed = true;
+        }
+    }
+
+    return changed;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static bool changed_mask_scalar(const uint8_t* a, const uint8_t* b, size_t size, uint8_t* mask) {
+    uint64_t any = 0;
+    size_t i = 0;
+
+    // Compare 8 bytes at a time and only look at the single bytes of words that differ
+
+    for (; i + 8 <= size; i += 8) {
+        uint64_t wa, wb;
+        uint8_t bits = 0;
+
+        memcpy(&wa, a + i, 8);
+        memcpy(&wb, b + i, 8);
+
+        uint64_t diff = wa ^ wb;
+
+        if (diff) {
+            for (int j = 0; j < 8; ++j) {
+                bits |= uint8_t((a[i + j] != b[i + j]) << j);
+            }
+        }
+
+        mask[i >> 3] = bits;
+        any |= diff;
+    }
+
+    return changed_mask_tail(a, b, i, size, mask) || any != 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(PD_MEMDIFF_SSE2)
+
+static bool changed_mask_sse2(const uint8_t* a, const uint8_t* b, size_t size, uint8_t* mask) {
+    unsigned int any = 0;
+    size_t i = 0;
+
+    for (; i + 16 <= size; i += 16) {
+        __m128i va = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i vb = _mm_loadu_si128((const __m128i*)(b + i));
+        unsigned int bits = ~unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(va, vb))) & 0xffff;
+
+        mask[(i >> 3) + 0] = uint8_t(bits);
+        mask[(i >> 3) + 1] = uint8_t(bits >> 8);
+        any |= bits;
+    }
+
+    // The last up to 15 bytes still get one 8 byte compare
+
+    return changed_mask_scalar(a + i, b + i, size - i, mask + (i >> 3)) || any != 0;
+}
+
+#endif
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(PD_MEMDIFF_AVX2)
+
+__attribute__((target("avx2"))) static bool changed_mask_avx2(const uint8_t* a, const uint8_t* b, size_t size,
+                                                             uint8_t* mask) {
+    uint32_t any = 0;
+    size_t i = 0;
+
+    for (; i + 32 <= size; i += 32) {
+        __m256i va = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i vb = _mm256_loadu_si256((const __m256i*)(b + i));
+        uint32_t bits = ~uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi8(va, vb)));
+
+        memcpy(mask + (i >> 3), &bits, 4);
+        any |= bits;
+    }
+
+    return changed_mask_scalar(a + i, b + i, size - i, mask + (i >> 3)) || any != 0;
+}
+
+#endif
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool MemoryDiff_changed_mask(const uint8_t* a, const uint8_t* b, size_t size, uint8_t* mask) {
+#if defined(PD_MEMDIFF_AVX2)
+    static const bool has_avx2 = __builtin_cpu_supports("avx2");
+
+    if (has_avx2) {
+        return changed_mask_avx2(a, b, size, mask);
+    }
+#endif
+
+#if defined(PD_MEMDIFF_SSE2)
+    return changed_mask_sse2(a, b, size, mask);
+#else
+    return changed_mask_scalar(a, b, size, mask);
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int64_t MemoryDiff_find_next(const uint8_t* mask, size_t size, size_t start) {
+    for (size_t i = start; i < size;) {
+        uint8_t bits = mask[i >> 3] >> (i & 7);
+
+        if (bits == 0) {
+            // Skip the rest of the byte
+            i = (i | 7) + 1;
+            continue;
+        }
+
+        while (!(bits & 1)) {
+            bits >>= 1;
+            ++i;
+        }
+
+        return i < size ? int64_t(i) : -1;
+    }
+
+    return -1;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+uint64_t MemoryDiff_hash(const uint8_t* data, size_t size) {
+    uint64_t hash = 0xcbf29ce484222325ull ^ size;
+    size_t i = 0;
+
+    for (; i + 8 <= size; i += 8) {
+        uint64_t word;
+        memcpy(&word, data + i, sizeof(word));
+        hash = (hash ^ word) * 0x9e3779b97f4a7c15ull;
+        hash ^= hash >> 29;
+    }
+
+    for (; i < size; ++i) {
+        hash = (hash ^ data[i]) * 0x100000001b3ull;
+    }
+
+    return hash;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
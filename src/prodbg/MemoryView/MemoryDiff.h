@@ -0,0 +1,22 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace prodbg {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Compares two blocks of memory and sets bit n (LSB first) in mask if a[n] != b[n]. mask has to hold (size + 7) / 8
+// bytes. Returns true if any byte differs.
+//
+// Uses AVX2 when the cpu supports it (GCC/Clang), SSE2 on x86 and a 64-bit scalar loop elsewhere.
+
+bool MemoryDiff_changed_mask(const uint8_t* a, const uint8_t* b, size_t size, uint8_t* mask);
+
+// Index of the first set bit at or after start in a mask of size bits or -1 if there is none
+int64_t MemoryDiff_find_next(const uint8_t* mask, size_t size, size_t start);
+
+// Fast 64-bit hash of a block of memory (not cryptographic). Used to tell if pages has the same contents
+uint64_t MemoryDiff_hash(const uint8_t* data, size_t size);
+
+}  // namespace prodbg
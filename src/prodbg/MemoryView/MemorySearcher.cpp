@@ -0,0 +1,393 @@
+#include "MemorySearcher.h"
+#include <QtCore/QAtomicInt>
+#include <QtCore/QMetaObject>
+#include <QtCore/QRunnable>
+#include <functional>
+
+namespace prodbg {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Memory of one read_memory_pages batch split in chunks that are scanned in parallel. Each chunk has the pattern size
+// - 1 bytes after it (if there are any) so matches crossing into the next chunk are found.
+
+struct MemorySearchBatch {
+    struct Segment {
+        uint64_t address;
+        QByteArray data;
+    };
+
+    struct Chunk {
+        int segment;
+        int offset;
+        int size;
+        int scan_size;
+    };
+
+    SearchPattern pattern;
+    QVector<Segment> segments;
+    QVector<Chunk> chunks;
+    QVector<QVector<uint64_t>> hits;
+    int max_hits = 0;
+    // End of the batch (for progress)
+    uint64_t end = 0;
+    // Identifies the batch when the done callback gets back to the searcher. The batch itself may have been freed
+    // (and its address reused) by then
+    uint64_t generation = 0;
+
+    QAtomicInt remaining;
+    // Called on a pool thread when the last chunk has been scanned
+    std::function<void()> done;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class MemorySearchTask : public QRunnable {
+   public:
+    MemorySearchTask(const QSharedPointer<MemorySearchBatch>& batch, int index) : m_batch(batch), m_index(index) {}
+
+    void run() override {
+        MemorySearchBatch* batch = m_batch.data();
+        const MemorySearchBatch::Chunk& chunk = batch->chunks.at(m_index);
+        const MemorySearchBatch::Segment& segment = batch->segments.at(chunk.segment);
+
+        MemorySearch_scan(batch->pattern, (const uint8_t*)segment.data.constData() + chunk.offset, size_t(chunk.size),
+                          segment.address + uint64_t(chunk.offset), size_t(chunk.scan_size), &batch->hits[m_index],
+                          batch->max_hits);
+
+        if (!batch->remaining.deref()) {
+            batch->done();
+        }
+    }
+
+   private:
+    QSharedPointer<MemorySearchBatch> m_batch;
+    int m_index;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+MemorySearcher::MemorySearcher(IBackendRequests* interface, QObject* parent) : QObject(parent), m_interface(interface) {
+    if (interface) {
+        connect(interface, &IBackendRequests::memory_search_results, this, &MemorySearcher::search_results);
+        connect(interface, &IBackendRequests::memory_pages_received, this, &MemorySearcher::pages_received);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+MemorySearcher::~MemorySearcher() {
+    cancel();
+
+    // The tasks reference the batch (not the searcher) but the done callback posts back to us
+    m_pool.waitForDone();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MemorySearcher::start(const SearchPattern& pattern, uint64_t start, uint64_t end) {
+    cancel();
+
+    if (!m_interface || !pattern.is_valid() || end <= start) {
+        return;
+    }
+
+    m_pattern = pattern;
+    m_start = start;
+    m_end = end;
+    m_next = start;
+    m_hit_count = 0;
+    m_running = true;
+    m_tail.clear();
+
+    request_backend_chunk();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MemorySearcher::cancel() {
+    if (!m_running) {
+        return;
+    }
+
+    if (m_waiting_results) {
+        m_stale_results.append(m_request_address);
+    }
+
+    reset();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MemorySearcher::reset() {
+    m_running = false;
+    m_waiting_results = false;
+    m_batch.clear();
+    m_ready.clear();
+    m_tail.clear();
+
+    // Tasks still running for the batch keep it alive. batch_scanned ignores it when it's done
+    m_scan.reset();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MemorySearcher::request_backend_chunk() {
+    const uint64_t remaining = m_end - m_next;
+    const uint64_t size = qMin(remaining, uint64_t(BackendChunkSize));
+
+    // Search pattern size - 1 bytes past the chunk so matches crossing into the next chunk are found. Hits in that
+    // part are dropped as the next chunk finds them as well
+    const uint64_t search_size = qMin(remaining, size + uint64_t(m_pattern.size() - 1));
+
+    m_waiting_results = true;
+    m_request_address = m_next;
+    m_request_end = m_next + size;
+
+    m_interface->search_memory(m_next, search_size, m_pattern.bytes, m_pattern.mask, m_pattern.alignment,
+                               uint32_t(MaxHits - m_hit_count));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MemorySearcher::search_results(uint64_t address, const QVector<uint64_t>& hits, uint64_t searched_to,
+                                    bool supported) {
+    if (!m_stale_results.isEmpty() && m_stale_results.first() == address) {
+        m_stale_results.removeFirst();
+        return;
+    }
+
+    if (!m_running || !m_waiting_results || address != m_request_address) {
+        return;
+    }
+
+    m_waiting_results = false;
+
+    if (!supported) {
+        request_pages();
+        return;
+    }
+
+    QVector<uint64_t> chunk_hits;
+    chunk_hits.reserve(hits.size());
+
+    for (uint64_t hit : hits) {
+        if (hit >= address && hit < m_request_end) {
+            chunk_hits.append(hit);
+        }
+    }
+
+    if (!add_hits(chunk_hits)) {
+        return;
+    }
+
+    // The backend stops at its own max hits count so continue from where it got to
+    m_next = (searched_to > address && searched_to < m_request_end) ? searched_to : m_request_end;
+
+    update_progress(m_next);
+
+    if (m_next >= m_end) {
+        finish(false);
+    } else {
+        request_backend_chunk();
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MemorySearcher::request_pages() {
+    if (!m_running || !m_batch.isEmpty() || !m_ready.isEmpty() || m_next >= m_end) {
+        return;
+    }
+
+    uint64_t page = m_next & ~uint64_t(PageSize - 1);
+
+    while (m_batch.size() < PagesPerBatch && page < m_end) {
+        m_batch.append(page);
+        page += PageSize;
+    }
+
+    m_next = qMin(page, m_end);
+
+    m_batch_request = m_interface->read_memory_pages(m_batch, PageSize);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MemorySearcher::pages_received(uint64_t request_id, const QVector<IBackendRequests::MemoryPage>& pages, int,
+                                    uint64_t) {
+    // Replies for the MemoryCache (or other searchers) and batches of cancelled searches are sent to us as well
+    if (m_batch.isEmpty() || request_id != m_batch_request) {
+        return;
+    }
+
+    m_batch.clear();
+
+    if (m_scan) {
+        m_ready = pages;
+    } else {
+        scan_pages(pages);
+    }
+
+    // Read the next batch while this one is scanned
+    request_pages();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MemorySearcher::scan_pages(const QVector<IBackendRequests::MemoryPage>& pages) {
+    QSharedPointer<MemorySearchBatch> batch(new MemorySearchBatch);
+    const int overlap = m_pattern.size() - 1;
+
+    // Join contiguous readable pages (and the tail of the previous batch) into segments
+
+    MemorySearchBatch::Segment current = {m_tail_address, m_tail};
+
+    for (const IBackendRequests::MemoryPage& page : pages) {
+        uint64_t address = page.address;
+        QByteArray data = page.data;
+
+        // The first page is aligned down so it can start before the range
+        if (address < m_start) {
+            data = data.mid(int(qMin(m_start - address, uint64_t(data.size()))));
+            address = m_start;
+        }
+
+        if (uint64_t(data.size()) > m_end - address) {
+            data.truncate(int(m_end - address));
+        }
+
+        if (!data.isEmpty() && current.address + uint64_t(current.data.size()) == address) {
+            current.data.append(data);
+            continue;
+        }
+
+        if (current.data.size() > overlap) {
+            batch->segments.append(current);
+        }
+
+        current.address = address;
+        current.data = data;
+    }
+
+    const IBackendRequests::MemoryPage& last = pages.last();
+    batch->end = qMin(m_end, last.address + uint64_t(PageSize));
+
+    if (current.data.size() > overlap) {
+        batch->segments.append(current);
+    }
+
+    // Keep the end of the batch if it's readable all the way so matches crossing into the next batch are found
+
+    m_tail.clear();
+
+    if (overlap > 0 && current.address + uint64_t(current.data.size()) == batch->end) {
+        const int tail_size = qMin(overlap, current.data.size());
+        m_tail = current.data.right(tail_size);
+        m_tail_address = batch->end - uint64_t(tail_size);
+    }
+
+    for (int i = 0; i < batch->segments.size(); ++i) {
+        const int size = batch->segments[i].data.size();
+
+        for (int offset = 0; offset < size - overlap; offset += ScanChunkSize) {
+            MemorySearchBatch::Chunk chunk;
+            chunk.segment = i;
+            chunk.offset = offset;
+            chunk.scan_size = qMin(int(ScanChunkSize), size - offset);
+            chunk.size = qMin(chunk.scan_size + overlap, size - offset);
+            batch->chunks.append(chunk);
+        }
+    }
+
+    batch->pattern = m_pattern;
+    batch->max_hits = MaxHits - m_hit_count;
+    batch->hits.resize(batch->chunks.size());
+    batch->remaining.storeRelease(batch->chunks.size());
+    batch->generation = ++m_scan_generation;
+
+    m_scan = batch;
+
+    if (batch->chunks.isEmpty()) {
+        batch_scanned(batch->generation);
+        return;
+    }
+
+    const uint64_t generation = batch->generation;
+
+    batch->done = [this, generation]() {
+        QMetaObject::invokeMethod(this, [this, generation]() { batch_scanned(generation); }, Qt::QueuedConnection);
+    };
+
+    for (int i = 0; i < batch->chunks.size(); ++i) {
+        m_pool.start(new MemorySearchTask(batch, i));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MemorySearcher::batch_scanned(uint64_t generation) {
+    // Batches of cancelled searches are still scanned to the end
+    if (!m_scan || m_scan->generation != generation) {
+        return;
+    }
+
+    QSharedPointer<MemorySearchBatch> done;
+    done.swap(m_scan);
+
+    QVector<uint64_t> hits;
+
+    for (const QVector<uint64_t>& chunk_hits : done->hits) {
+        hits += chunk_hits;
+    }
+
+    if (!add_hits(hits)) {
+        return;
+    }
+
+    update_progress(done->end);
+
+    if (!m_ready.isEmpty()) {
+        QVector<IBackendRequests::MemoryPage> pages;
+        pages.swap(m_ready);
+        scan_pages(pages);
+        request_pages();
+    } else if (m_batch.isEmpty() && m_next >= m_end) {
+        finish(false);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Sends the hits (up to MaxHits in total). Returns false if the search has finished because MaxHits was reached
+
+bool MemorySearcher::add_hits(const QVector<uint64_t>& hits) {
+    const int count = qMin(hits.size(), MaxHits - m_hit_count);
+
+    if (count > 0) {
+        m_hit_count += count;
+        hits_found(count == hits.size() ? hits : hits.mid(0, count));
+    }
+
+    if (m_hit_count >= MaxHits) {
+        finish(true);
+        return false;
+    }
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MemorySearcher::update_progress(uint64_t searched_to) {
+    progress(searched_to - m_start, m_end - m_start);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MemorySearcher::finish(bool limited) {
+    // Requests can still be in flight when MaxHits is reached
+    cancel();
+    finished(m_hit_count, limited);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <stdint.h>
+#include <QtCore/QObject>
+#include <QtCore/QPointer>
+#include <QtCore/QSharedPointer>
+#include <QtCore/QThreadPool>
+#include <QtCore/QVector>
+#include "Backend/IBackendRequests.h"
+#include "Core/MemorySearch.h"
+
+namespace prodbg {
+
+struct MemorySearchBatch;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Searches a range of target memory for a SearchPattern and streams the hits back as they are found.
+//
+// The range is first searched in the backend (see IBackendRequests::search_memory) in large chunks so only the hits
+// are sent over. Backends that can't search memory reply with supported = false and the rest of the range is read
+// with read_memory_pages in batches of 4 MB instead. The batches are made of aligned 4 KB pages as a page is dropped
+// by the backend if its first byte isn't mapped. Each batch is split in chunks that are scanned on a thread pool while
+// the next batch is being read. The last pattern size - 1 bytes of a batch are kept so matches that cross batches are
+// found.
+//
+// The hits are sent with hits_found in increasing address order and the search stops after MaxHits hits.
+
+class MemorySearcher : public QObject {
+    Q_OBJECT
+
+   public:
+    enum {
+        MaxHits = 10000,
+        // Size of the range searched with one search_memory request
+        BackendChunkSize = 64 * 1024 * 1024,
+        // Page size and number of pages in each read_memory_pages request when the backend can't search
+        PageSize = 4096,
+        PagesPerBatch = 1024,
+        // Size of the chunks each thread scans
+        ScanChunkSize = 256 * 1024,
+    };
+
+    explicit MemorySearcher(IBackendRequests* interface, QObject* parent = nullptr);
+    ~MemorySearcher();
+
+    // Starts searching [start, end) for pattern. Cancels any search in progress
+    void start(const SearchPattern& pattern, uint64_t start, uint64_t end);
+
+    // Stops the search in progress. finished isn't sent for it
+    void cancel();
+
+    bool is_running() const { return m_running; }
+    int hit_count() const { return m_hit_count; }
+
+    // Sent each time more hits has been found
+    Q_SIGNAL void hits_found(const QVector<uint64_t>& hits);
+
+    // Sent after each chunk with the number of bytes searched so far
+    Q_SIGNAL void progress(uint64_t searched, uint64_t total);
+
+    // Sent when the whole range has been searched or MaxHits was reached (limited is set then)
+    Q_SIGNAL void finished(int hit_count, bool limited);
+
+   private:
+    Q_SLOT void search_results(uint64_t address, const QVector<uint64_t>& hits, uint64_t searched_to, bool supported);
+    Q_SLOT void pages_received(uint64_t request_id, const QVector<IBackendRequests::MemoryPage>& pages,
+                               int address_width, uint64_t epoch);
+
+    void request_backend_chunk();
+    void request_pages();
+    void scan_pages(const QVector<IBackendRequests::MemoryPage>& pages);
+    void batch_scanned(uint64_t generation);
+    bool add_hits(const QVector<uint64_t>& hits);
+    void update_progress(uint64_t searched_to);
+    void finish(bool limited);
+    void reset();
+
+    QPointer<IBackendRequests> m_interface;
+    QThreadPool m_pool;
+
+    SearchPattern m_pattern;
+    uint64_t m_start = 0;
+    uint64_t m_end = 0;
+    // Next address to search or read
+    uint64_t m_next = 0;
+
+    bool m_running = false;
+    int m_hit_count = 0;
+
+    // Backend search in flight (searches up to m_request_end + the pattern size - 1)
+    bool m_waiting_results = false;
+    uint64_t m_request_address = 0;
+    uint64_t m_request_end = 0;
+
+    // Pages in flight (and the id of their request), the batch being scanned and a batch that has arrived while the
+    // previous was still scanning
+    QVector<uint64_t> m_batch;
+    uint64_t m_batch_request = 0;
+    QSharedPointer<MemorySearchBatch> m_scan;
+    uint64_t m_scan_generation = 0;
+    QVector<IBackendRequests::MemoryPage> m_ready;
+
+    // End of the last batch that is needed to find matches crossing into the next batch
+    QByteArray m_tail;
+    uint64_t m_tail_address = 0;
+
+    // Addresses of requests that were in flight when the search was cancelled. The session replies in order so the
+    // first reply with the address is dropped
+    QVector<uint64_t> m_stale_results;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
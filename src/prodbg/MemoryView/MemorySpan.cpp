@@ -0,0 +1,112 @@
+#include "MemorySpan.h"
+#include <algorithm>
+#include "Backend/IBackendRequests.h"
+#include "MemoryDiff.h"
+
+namespace prodbg {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MemorySpan::reset(uint64_t start, uint32_t size) {
+    address = start;
+    data.resize(int(size));
+    runs.resize(0);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MemorySpan::add_run(uint32_t offset, uint16_t flags) {
+    if (!runs.isEmpty()) {
+        Run& last = runs.last();
+
+        if (last.flags == flags) {
+            return;
+        }
+
+        // Replaces an empty run at the same offset
+        if (last.offset == offset) {
+            last.flags = flags;
+
+            if (runs.size() > 1 && runs[runs.size() - 2].flags == flags) {
+                runs.removeLast();
+            }
+
+            return;
+        }
+    }
+
+    runs.append(Run{offset, flags});
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Changes are usually sparse so the mask is scanned for the changed bytes and only those get runs of their own
+
+void MemorySpan::add_changed_runs(uint32_t offset, const uint8_t* mask, size_t start, size_t stop, uint16_t flags) {
+    size_t pos = start;
+
+    while (pos < stop) {
+        int64_t next = MemoryDiff_find_next(mask, stop, pos);
+
+        if (next < 0) {
+            add_run(uint32_t(offset + (pos - start)), flags);
+            return;
+        }
+
+        size_t changed_end = size_t(next) + 1;
+
+        while (changed_end < stop && ((mask[changed_end >> 3] >> (changed_end & 7)) & 1)) {
+            ++changed_end;
+        }
+
+        if (size_t(next) > pos) {
+            add_run(uint32_t(offset + (pos - start)), flags);
+        }
+
+        add_run(uint32_t(offset + (size_t(next) - start)), flags | IBackendRequests::Changed);
+        pos = changed_end;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static int find_run(const QVector<MemorySpan::Run>& runs, uint32_t offset) {
+    // Last run that starts at or before offset
+    auto it = std::upper_bound(runs.begin(), runs.end(), offset,
+                               [](uint32_t value, const MemorySpan::Run& run) { return value < run.offset; });
+
+    return int(it - runs.begin()) - 1;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+uint16_t MemorySpan::flags(uint32_t offset) const {
+    int index = find_run(runs, offset);
+    return index >= 0 ? runs[index].flags : 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+uint16_t MemorySpan::flags(uint32_t offset, uint32_t count) const {
+    int index = find_run(runs, offset);
+    uint16_t result = 0;
+
+    if (index < 0) {
+        result |= Unreadable;
+        index = 0;
+    }
+
+    for (; index < runs.size() && runs[index].offset < offset + count; ++index) {
+        uint16_t run_flags = runs[index].flags;
+
+        if (!(run_flags & IBackendRequests::Readable)) {
+            result |= Unreadable;
+        }
+
+        result |= run_flags;
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <QtCore/QByteArray>
+#include <QtCore/QVector>
+
+namespace prodbg {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// A range of target memory as raw bytes plus a run-length map of IBackendRequests::MemoryAddressFlags.
+//
+// Memory is mostly uniform (a whole page is readable or not) so the flags are stored as runs that each start at an
+// offset and last until the next run starts (or the end of the data). Bytes that aren't readable (unmapped or not
+// fetched yet) are zero in data and have no Readable flag.
+
+struct MemorySpan {
+    struct Run {
+        uint32_t offset;
+        uint16_t flags;
+    };
+
+    uint64_t address = 0;
+    QByteArray data;
+    QVector<Run> runs;
+
+    // Resizes data to size bytes (keeping the allocation) and clears the runs
+    void reset(uint64_t start, uint32_t size);
+
+    // Starts a new run at offset. Runs have to be added in increasing offset order and are merged with the previous
+    // run if the flags are the same
+    void add_run(uint32_t offset, uint16_t flags);
+
+    // Adds runs starting at offset for the bits start to stop of a changed mask (see MemoryDiff_changed_mask). The
+    // bytes get flags and the ones that are set in the mask Changed as well
+    void add_changed_runs(uint32_t offset, const uint8_t* mask, size_t start, size_t stop, uint16_t flags);
+
+    int size() const { return data.size(); }
+    const uint8_t* bytes() const { return (const uint8_t*)data.constData(); }
+
+    // Flags of the byte at offset
+    uint16_t flags(uint32_t offset) const;
+
+    // Flags of all bytes in [offset, offset + count) or'ed together, plus Unreadable if any byte isn't readable
+    uint16_t flags(uint32_t offset, uint32_t count) const;
+
+    enum {
+        // Only returned by flags(offset, count)
+        Unreadable = 1 << 15,
+    };
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
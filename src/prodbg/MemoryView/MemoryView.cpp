@@ -2,7 +2,17 @@
 #include <QtCore/QDebug>
 #include <QtCore/QMetaEnum>
 #include <QtCore/QSettings>
+#include <QtCore/QStringList>
+#include <QtGui/QClipboard>
+#include <QtWidgets/QAction>
+#include <QtWidgets/QApplication>
+#include <QtWidgets/QInputDialog>
+#include <QtWidgets/QMenu>
 #include "Backend/IBackendRequests.h"
+#include "Core/MemorySearch.h"
+#include "MemoryCache.h"
+#include "MemorySearcher.h"
+#include "SnapshotStore.h"
 #include "ui_MemoryView.h"
 
 namespace prodbg {
@@ -20,6 +30,37 @@ static void enumToCombo(QComboBox* combo, int startValue) {
     combo->setCurrentIndex(startValue);
 }
 
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Parses a comma separated list of ranges written as start-end or start+size
+
+static bool parseRanges(const QString& text, QVector<MemoryRange>* ranges, QString* error) {
+    for (const QString& part : text.split(QLatin1Char(','), QString::SkipEmptyParts)) {
+        const QString range = part.trimmed();
+        const bool isSize = range.contains(QLatin1Char('+'));
+        const QStringList values = range.split(QLatin1Char(isSize ? '+' : '-'));
+        bool startOk = false;
+        bool endOk = false;
+
+        if (values.size() != 2) {
+            *error = QStringLiteral("Invalid range '%1'").arg(range);
+            return false;
+        }
+
+        const uint64_t start = values[0].trimmed().toULongLong(&startOk, 0);
+        const uint64_t value = values[1].trimmed().toULongLong(&endOk, 0);
+        const uint64_t size = isSize ? value : value - start;
+
+        if (!startOk || !endOk || (!isSize && value <= start) || size == 0) {
+            *error = QStringLiteral("Invalid range '%1'").arg(range);
+            return false;
+        }
+
+        ranges->append(MemoryRange{start, size});
+    }
+
+    return true;
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 MemoryView::MemoryView(QWidget* parent) : Base(parent), m_Ui(new Ui_MemoryView) {
@@ -41,6 +82,33 @@ MemoryView::MemoryView(QWidget* parent) : Base(parent), m_Ui(new Ui_MemoryView)
     connect(m_Ui->m_Count, static_cast<void (QComboBox::*)(const QString&)>(&QComboBox::currentIndexChanged), this,
             &MemoryView::countChanged);
 
+    connect(m_Ui->m_Search, &QLineEdit::returnPressed, this, &MemoryView::searchRequested);
+
+    QAction* nextHitAction = new QAction(QStringLiteral("Next Search Hit"), this);
+    nextHitAction->setShortcut(QKeySequence::FindNext);
+    nextHitAction->setShortcutContext(Qt::WidgetWithChildrenShortcut);
+    connect(nextHitAction, &QAction::triggered, this, &MemoryView::displayNextHit);
+    addAction(nextHitAction);
+
+    QAction* prevHitAction = new QAction(QStringLiteral("Previous Search Hit"), this);
+    prevHitAction->setShortcut(QKeySequence::FindPrevious);
+    prevHitAction->setShortcutContext(Qt::WidgetWithChildrenShortcut);
+    connect(prevHitAction, &QAction::triggered, this, &MemoryView::displayPrevHit);
+    addAction(prevHitAction);
+
+    connect(m_Ui->m_Capture, &QPushButton::clicked, this, &MemoryView::captureSnapshot);
+    connect(m_Ui->m_SnapshotRange, &QLineEdit::returnPressed, this, &MemoryView::captureSnapshot);
+    connect(m_Ui->m_Snapshot, static_cast<void (QComboBox::*)(int)>(&QComboBox::currentIndexChanged), this,
+            &MemoryView::snapshotSelected);
+    connect(m_Ui->m_Compare, static_cast<void (QComboBox::*)(int)>(&QComboBox::currentIndexChanged), this,
+            &MemoryView::snapshotSelected);
+
+    QMenu* changesMenu = new QMenu(this);
+    m_Ui->m_Changes->setMenu(changesMenu);
+    connect(changesMenu, &QMenu::aboutToShow, this, &MemoryView::showChanges);
+
+    snapshotsChanged();
+
     readSettings();
 }
 
@@ -61,13 +129,33 @@ void MemoryView::endianChanged(int e) {
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 void MemoryView::interfaceSet() {
-    /*
     m_Ui->m_View->set_backend_interface(m_interface);
 
+    delete m_Searcher;
+    m_Searcher = nullptr;
+
+    if (m_Snapshots) {
+        disconnect(m_Snapshots, nullptr, this, nullptr);
+    }
+
+    m_Snapshots = SnapshotStore::for_interface(m_interface);
+
+    if (m_Snapshots) {
+        connect(m_Snapshots, &SnapshotStore::snapshot_captured, this, &MemoryView::snapshotCaptured);
+        connect(m_Snapshots, &SnapshotStore::snapshots_changed, this, &MemoryView::snapshotsChanged);
+    }
+
+    snapshotsChanged();
+
     if (m_interface) {
-        connect(m_interface, &IBackendRequests::endResolveAddress, this, &MemoryView::endResolveAddress);
+        connect(m_interface, &IBackendRequests::expressions_evaluated, this, &MemoryView::endResolveAddress);
+        connect(m_interface, &IBackendRequests::program_counter_changed, this, &MemoryView::programCounterChanged);
+
+        m_Searcher = new MemorySearcher(m_interface, this);
+        connect(m_Searcher, &MemorySearcher::hits_found, this, &MemoryView::searchHitsFound);
+        connect(m_Searcher, &MemorySearcher::progress, this, &MemoryView::searchProgress);
+        connect(m_Searcher, &MemorySearcher::finished, this, &MemoryView::searchFinished);
     }
-    */
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -85,25 +173,270 @@ void MemoryView::jumpAddressChanged() {
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 void MemoryView::jumpToAddressExpression(const QString& str) {
-    /*
-    if (m_interface) {
-        m_interface->beginResolveAddress(str, &m_evalAddress);
+    m_evalExpression = str.trimmed();
+
+    if (m_interface && !m_evalExpression.isEmpty()) {
+        m_interface->evaluate_expressions(QStringList(m_evalExpression));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MemoryView::programCounterChanged(const IBackendRequests::ProgramCounterChange&) {
+    // Expressions such as "sp + 4" needs to follow the target so evaluate it again. Compiled expressions are cached
+    // in the session so this is cheap
+
+    jumpToAddressExpression(m_evalExpression);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MemoryView::endResolveAddress(const QVector<IBackendRequests::ExpressionResult>& results, uint64_t) {
+    // Results are sent to all views bound to the session so only pick up the one for our expression
+
+    for (const IBackendRequests::ExpressionResult& result : results) {
+        if (result.expression != m_evalExpression) {
+            continue;
+        }
+
+        if (!result.valid) {
+            m_Ui->m_View->setExpressionStatus(false);
+            m_Ui->m_Address->setToolTip(result.error);
+        } else {
+            m_Ui->m_View->setExpressionStatus(true);
+            m_Ui->m_Address->setToolTip(QStringLiteral("0x") + QString::number(result.value, 16));
+            m_Ui->m_View->setAddress(result.value);
+        }
+
+        m_Ui->m_View->update();
+        break;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MemoryView::searchRequested() {
+    SearchPattern pattern;
+    QString error;
+
+    if (!m_Searcher) {
+        m_Ui->m_SearchStatus->setText(QStringLiteral("No target"));
+        return;
+    }
+
+    const bool bigEndian = m_Ui->m_View->endianess() == MemoryViewWidget::Big;
+
+    if (!SearchPattern_parse(m_Ui->m_Search->text(), bigEndian, &pattern, &error)) {
+        m_Ui->m_SearchStatus->setText(error);
+        return;
+    }
+
+    // Search the 32-bit address space or the 4 GB window around the view on 64-bit targets
+
+    const uint64_t windowSize = uint64_t(1) << 32;
+    uint64_t start = 0;
+    uint64_t end = windowSize;
+
+    MemoryCache* cache = MemoryCache::for_interface(m_interface);
+
+    if (cache && cache->address_width() > 4) {
+        start = m_Ui->m_View->address() & ~(windowSize - 1);
+        end = start + windowSize;
+
+        if (end == 0) {
+            end = ~uint64_t(0);
+        }
+    }
+
+    m_Hits.clear();
+    m_HitIndex = -1;
+    m_Ui->m_SearchStatus->setText(QStringLiteral("Searching..."));
+    m_Searcher->start(pattern, start, end);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MemoryView::searchHitsFound(const QVector<uint64_t>& hits) {
+    m_Hits += hits;
+
+    if (m_HitIndex < 0 && !m_Hits.isEmpty()) {
+        displayHit(0);
     }
-    */
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void MemoryView::endResolveAddress(uint64_t* out) {
-    if (!out) {
-        m_Ui->m_View->setExpressionStatus(false);
+void MemoryView::searchProgress(uint64_t searched, uint64_t total) {
+    const int percent = total ? int(searched * 100 / total) : 100;
+
+    m_Ui->m_SearchStatus->setText(QStringLiteral("Searching... %1% (%2 hits)").arg(percent).arg(m_Hits.size()));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MemoryView::searchFinished(int hitCount, bool limited) {
+    if (hitCount == 0) {
+        m_Ui->m_SearchStatus->setText(QStringLiteral("Not found"));
+    } else if (limited) {
+        m_Ui->m_SearchStatus->setText(QStringLiteral("%1+ hits").arg(hitCount));
     } else {
-        m_Ui->m_View->setExpressionStatus(true);
-        m_Ui->m_Address->setText(QStringLiteral("0x") + QString::number(*out, 16));
-        m_Ui->m_View->setAddress(*out);
+        m_Ui->m_SearchStatus->setText(QStringLiteral("%1 hits").arg(hitCount));
     }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MemoryView::displayHit(int index) {
+    m_HitIndex = index;
+    m_Ui->m_View->setAddress(m_Hits[index]);
 
-    m_Ui->m_View->update();
+    if (!m_Searcher->is_running()) {
+        m_Ui->m_SearchStatus->setText(QStringLiteral("Hit %1 of %2").arg(index + 1).arg(m_Hits.size()));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MemoryView::displayNextHit() {
+    if (!m_Hits.isEmpty()) {
+        displayHit((m_HitIndex + 1) % m_Hits.size());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MemoryView::displayPrevHit() {
+    if (!m_Hits.isEmpty()) {
+        displayHit(m_HitIndex > 0 ? m_HitIndex - 1 : m_Hits.size() - 1);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MemoryView::captureSnapshot() {
+    QVector<MemoryRange> ranges;
+    QString error;
+
+    if (!m_Snapshots) {
+        m_Ui->m_SnapshotStatus->setText(QStringLiteral("No target"));
+        return;
+    }
+
+    if (!parseRanges(m_Ui->m_SnapshotRange->text(), &ranges, &error)) {
+        m_Ui->m_SnapshotStatus->setText(error);
+        return;
+    }
+
+    if (ranges.isEmpty()) {
+        ranges.append(MemoryRange{m_Ui->m_View->address(), qMax(m_Ui->m_View->visibleBytes(), uint64_t(1))});
+    }
+
+    bool ok = false;
+    const QString defaultName = QStringLiteral("Snapshot %1").arg(m_Snapshots->names().size() + 1);
+    const QString name = QInputDialog::getText(this, QStringLiteral("Capture Snapshot"), QStringLiteral("Name:"),
+                                               QLineEdit::Normal, defaultName, &ok)
+                             .trimmed();
+
+    if (!ok || name.isEmpty()) {
+        return;
+    }
+
+    m_Ui->m_SnapshotStatus->setText(QStringLiteral("Capturing %1...").arg(name));
+    m_Snapshots->capture(name, ranges);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MemoryView::snapshotCaptured(const QString& name) {
+    m_Ui->m_SnapshotStatus->setText(QStringLiteral("Captured %1 (%2 pages stored for %3 in all snapshots)")
+                                        .arg(name)
+                                        .arg(m_Snapshots->stored_pages())
+                                        .arg(m_Snapshots->referenced_pages()));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Fills the snapshot combos again and keeps the selection if the snapshots are still there
+
+void MemoryView::snapshotsChanged() {
+    const QStringList names = m_Snapshots ? m_Snapshots->names() : QStringList();
+
+    QComboBox* combos[] = {m_Ui->m_Snapshot, m_Ui->m_Compare};
+    const QString first[] = {QStringLiteral("Live"), QStringLiteral("No compare")};
+
+    for (int i = 0; i < 2; ++i) {
+        QComboBox* combo = combos[i];
+        const QString selected = combo->currentIndex() > 0 ? combo->currentText() : QString();
+
+        combo->blockSignals(true);
+        combo->clear();
+        combo->addItem(first[i]);
+        combo->addItems(names);
+        combo->setCurrentIndex(qMax(0, names.indexOf(selected) + 1));
+        combo->blockSignals(false);
+    }
+
+    snapshotSelected();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MemoryView::snapshotSelected() {
+    const QString name = m_Ui->m_Snapshot->currentIndex() > 0 ? m_Ui->m_Snapshot->currentText() : QString();
+    const QString compare = m_Ui->m_Compare->currentIndex() > 0 ? m_Ui->m_Compare->currentText() : QString();
+
+    m_Ui->m_View->setSnapshot(name, compare);
+    m_Ui->m_Compare->setEnabled(!name.isEmpty());
+    m_Ui->m_Changes->setEnabled(!name.isEmpty() && !compare.isEmpty());
+
+    if (name.isEmpty() || compare.isEmpty()) {
+        return;
+    }
+
+    uint64_t bytes = 0;
+    const QVector<MemoryRange> diff = m_Ui->m_View->snapshotDiff();
+
+    for (const MemoryRange& range : diff) {
+        bytes += range.size;
+    }
+
+    m_Ui->m_SnapshotStatus->setText(QStringLiteral("%1 changed ranges (%2 bytes)").arg(diff.size()).arg(bytes));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Lists the changed ranges between the shown and compared snapshot. Selecting one jumps to it
+
+void MemoryView::showChanges() {
+    enum { MaxMenuRanges = 64 };
+
+    QMenu* menu = m_Ui->m_Changes->menu();
+    const QVector<MemoryRange> diff = m_Ui->m_View->snapshotDiff();
+
+    menu->clear();
+
+    QAction* copyAction = menu->addAction(QStringLiteral("Copy All to Clipboard"));
+    copyAction->setEnabled(!diff.isEmpty());
+
+    connect(copyAction, &QAction::triggered, this, [diff]() {
+        QString text;
+
+        for (const MemoryRange& range : diff) {
+            text += QStringLiteral("0x%1 %2\n").arg(range.address, 0, 16).arg(range.size);
+        }
+
+        QApplication::clipboard()->setText(text);
+    });
+
+    menu->addSeparator();
+
+    for (int i = 0; i < diff.size() && i < MaxMenuRanges; ++i) {
+        const uint64_t address = diff[i].address;
+        QAction* action = menu->addAction(QStringLiteral("0x%1 (%2 bytes)").arg(address, 0, 16).arg(diff[i].size));
+        connect(action, &QAction::triggered, this, [this, address]() { m_Ui->m_View->setAddress(address); });
+    }
+
+    if (diff.size() > MaxMenuRanges) {
+        menu->addAction(QStringLiteral("%1 more...").arg(diff.size() - MaxMenuRanges))->setEnabled(false);
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -12,6 +12,8 @@ namespace prodbg {
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 class IBackendRequests;
+class MemorySearcher;
+class SnapshotStore;
 
 class MemoryView : public View {
     using Base = View;
@@ -31,16 +33,41 @@ class MemoryView : public View {
    public:
     Q_SLOT void jumpToAddressExpression(const QString& expression);
 
+    // Moves to the next/previous hit of the last memory search
+    Q_SLOT void displayNextHit();
+    Q_SLOT void displayPrevHit();
+
    private:
-    Q_SLOT void endResolveAddress(uint64_t* out);
+    Q_SLOT void endResolveAddress(const QVector<IBackendRequests::ExpressionResult>& results, uint64_t epoch);
+    Q_SLOT void programCounterChanged(const IBackendRequests::ProgramCounterChange& pc);
     Q_SLOT void jumpAddressChanged();
     Q_SLOT void endianChanged(int);
     Q_SLOT void dataTypeChanged(int);
     Q_SLOT void countChanged(const QString&);
+    Q_SLOT void searchRequested();
+    Q_SLOT void searchHitsFound(const QVector<uint64_t>& hits);
+    Q_SLOT void searchProgress(uint64_t searched, uint64_t total);
+    Q_SLOT void searchFinished(int hitCount, bool limited);
+
+    void displayHit(int index);
+
+    Q_SLOT void captureSnapshot();
+    Q_SLOT void snapshotCaptured(const QString& name);
+    Q_SLOT void snapshotsChanged();
+    Q_SLOT void snapshotSelected();
+    Q_SLOT void showChanges();
 
    private:
     Ui_MemoryView* m_Ui = nullptr;
-    uint64_t m_evalAddress = 0;
+    // Address expression that is re-evaluated each time the target stops
+    QString m_evalExpression;
+
+    MemorySearcher* m_Searcher = nullptr;
+    // Hits of the last search in address order and the one shown last (-1 if none)
+    QVector<uint64_t> m_Hits;
+    int m_HitIndex = -1;
+
+    QPointer<SnapshotStore> m_Snapshots;
 };
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,142 @@
+#include "MemoryViewBenchmark.h"
+#include "Backend/IBackendRequests.h"
+#include "MemoryViewWidget.h"
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QStringList>
+#include <QtGui/QFontMetrics>
+#include <QtGui/QImage>
+
+#include <stdio.h>
+
+namespace prodbg {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Backend that answers memory reads with a fixed pattern. The replies are sent by flush so they never arrive in the
+// middle of a paint
+
+class BenchmarkBackend : public IBackendRequests {
+   public:
+    void add_address_breakpoint(uint64_t, const QString&, uint32_t) override {}
+    void add_file_line_breakpoint(const QString&, int, const QString&, uint32_t) override {}
+    void sync_breakpoints(const QVector<BreakpointChange>&) override {}
+    void fetch_trace_data(uint32_t) override {}
+    void remove_address_breakpoint(uint64_t) override {}
+    void remove_file_line_breakpoint(const QString&, int) override {}
+    void evaluate_expressions(const QStringList&) override {}
+
+    void search_memory(uint64_t, uint64_t, const QByteArray&, const QByteArray&, uint32_t, uint32_t) override {}
+    void write_memory(uint64_t, const QByteArray&) override {}
+    void request_target_info() override {}
+    void set_symbols(const QSharedPointer<const SymbolTable>&) override {}
+    void request_line_table() override {}
+
+    uint64_t read_memory_pages(const QVector<uint64_t>& addresses, uint32_t page_size) override {
+        Reply reply;
+        reply.request_id = ++m_request_id;
+
+        for (uint64_t address : addresses) {
+            MemoryPage page;
+            page.address = address;
+            page.data.resize(int(page_size));
+
+            for (uint32_t i = 0; i < page_size; ++i) {
+                page.data[int(i)] = char(((address + i) * 2654435761u) >> 13);
+            }
+
+            reply.pages.append(page);
+        }
+
+        m_replies.append(reply);
+        return reply.request_id;
+    }
+
+    void flush() {
+        QVector<Reply> replies;
+        replies.swap(m_replies);
+
+        for (const Reply& reply : replies) {
+            memory_pages_received(reply.request_id, reply.pages, 8, 1);
+        }
+    }
+
+   private:
+    struct Reply {
+        uint64_t request_id;
+        QVector<MemoryPage> pages;
+    };
+
+    QVector<Reply> m_replies;
+    uint64_t m_request_id = 0;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct BenchmarkConfig {
+    const char* name;
+    MemoryViewWidget::DataType type;
+    int bytesPerElement;
+    int elementsPerLine;
+};
+
+static const BenchmarkConfig s_configs[] = {
+    {"hex8 x 64", MemoryViewWidget::X8, 1, 64},
+    {"hex32 x 16", MemoryViewWidget::X32, 4, 16},
+    {"unsigned8 x 32", MemoryViewWidget::U8, 1, 32},
+    {"float x 16", MemoryViewWidget::F32, 4, 16},
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int MemoryView_runBenchmark(int frames) {
+    frames = frames > 0 ? frames : 1;
+
+    BenchmarkBackend backend;
+    MemoryViewWidget widget;
+
+    widget.resize(3840, 2160);
+    widget.set_backend_interface(&backend);
+
+    QImage image(widget.size(), QImage::Format_ARGB32_Premultiplied);
+
+    const int rowHeight = QFontMetrics(widget.font()).height();
+    const int rows = (widget.height() + rowHeight - 1) / rowHeight;
+
+    printf("memory view paint benchmark: %dx%d, %d rows, %d frames\n", widget.width(), widget.height(), rows, frames);
+
+    for (const BenchmarkConfig& config : s_configs) {
+        widget.setDataType(config.type);
+        widget.setElementsPerLine(config.elementsPerLine);
+
+        const uint64_t bytesPerRow = uint64_t(config.bytesPerElement * config.elementsPerLine);
+
+        // Fill the cache with the rows of both frames
+
+        for (int frame = 0; frame < 2; ++frame) {
+            widget.setAddress(0x10000 + uint64_t(frame) * bytesPerRow);
+            widget.render(&image);
+            backend.flush();
+        }
+
+        // Moving one row between frames makes every frame a full format and repaint (like scrolling without
+        // QWidget::scroll)
+
+        QElapsedTimer timer;
+        timer.start();
+
+        for (int frame = 0; frame < frames; ++frame) {
+            widget.setAddress(0x10000 + uint64_t(frame & 1) * bytesPerRow);
+            widget.render(&image);
+        }
+
+        double ms = double(timer.nsecsElapsed()) / 1000000.0;
+
+        printf("  %-16s %8.2f ms/frame %10.1f rows/ms\n", config.name, ms / frames,
+               double(rows) * double(frames) / (ms > 0.0 ? ms : 1.0));
+    }
+
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
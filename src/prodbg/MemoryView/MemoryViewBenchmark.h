@@ -0,0 +1,12 @@
+#pragma once
+
+namespace prodbg {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Paints a 4K sized MemoryViewWidget (with memory from a fake backend) for a number of frames in a few data type
+// configurations and prints the number of rows painted per millisecond. Started with prodbg --bench-memory-view which
+// runs on the offscreen platform plugin so it works without a display. Returns the exit code for main.
+
+int MemoryView_runBenchmark(int frames);
+
+}  // namespace prodbg
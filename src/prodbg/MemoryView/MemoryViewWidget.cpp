@@ -1,6 +1,12 @@
 #include "MemoryViewWidget.h"
 #include "Backend/IBackendRequests.h"
+#include "Core/ScrollPrefetcher.h"
+#include "GlyphAtlas.h"
+#include "MemoryCache.h"
+#include "MemorySpan.h"
+#include "SnapshotStore.h"
 
+#include <QtCore/QElapsedTimer>
 #include <QtCore/QPointer>
 #include <QtGui/QPaintEvent>
 #include <QtGui/QPainter>
@@ -9,42 +15,46 @@
 #include <QtWidgets/QMenu>
 
 #include <ctype.h>
-#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
 
 namespace prodbg {
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-static const QChar s_HexTable[16] = {
-    QLatin1Char('0'), QLatin1Char('1'), QLatin1Char('2'), QLatin1Char('3'), QLatin1Char('4'), QLatin1Char('5'),
-    QLatin1Char('6'), QLatin1Char('7'), QLatin1Char('8'), QLatin1Char('9'), QLatin1Char('a'), QLatin1Char('b'),
-    QLatin1Char('c'), QLatin1Char('d'), QLatin1Char('e'), QLatin1Char('f'),
-};
+static const char s_HexTable[] = "0123456789abcdef";
+
+// Two hex digits for each byte value and the char shown in the ASCII column
+static char s_HexPairs[256][2];
+static char s_AsciiTab[256];
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Formatters write exactly displayWidth chars to target (right aligned)
 
 struct MemViewTypeMeta {
     int m_BytesPerElement;
     int m_DisplayWidthChars;
-    void (*m_Formatter)(QString* target, int displayWidth, int byteCount, const uint16_t* values,
+    void (*m_Formatter)(char* target, int displayWidth, int byteCount, const uint8_t* bytes,
                         MemoryViewWidget::Endianess);
 };
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-static uint64_t decodeValue(const uint16_t* values, int count, MemoryViewWidget::Endianess endianess) {
+static uint64_t decodeValue(const uint8_t* bytes, int count, MemoryViewWidget::Endianess endianess) {
     uint64_t value = 0;
     switch (endianess) {
         case MemoryViewWidget::Big:
             for (int i = 0; i < count; ++i) {
                 value <<= 8;
-                value |= (values[i] & 0xff);
+                value |= bytes[i];
             }
             break;
         case MemoryViewWidget::Little:
             for (int i = count - 1; i >= 0; --i) {
                 value <<= 8;
-                value |= (values[i] & 0xff);
+                value |= bytes[i];
             }
             break;
     }
@@ -54,86 +64,66 @@ static uint64_t decodeValue(const uint16_t* values, int count, MemoryViewWidget:
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-static void formatHex(QString* target, int displayWidth, int byteCount, const uint16_t* values,
+static void formatHex(char* target, int displayWidth, int byteCount, const uint8_t* bytes,
                       MemoryViewWidget::Endianess endianess) {
-    const uint64_t value = decodeValue(values, byteCount, endianess);
+    (void)displayWidth;
 
-    int shift = (byteCount * 8) - 4;
-    while (shift >= 0) {
-        int val = (value >> shift) & 0xf;
-        target->push_back(s_HexTable[val]);
-        shift -= 4;
+    // Most significant byte first
+    const int first = endianess == MemoryViewWidget::Little ? byteCount - 1 : 0;
+    const int step = endianess == MemoryViewWidget::Little ? -1 : 1;
+
+    for (int i = 0, index = first; i < byteCount; ++i, index += step) {
+        const char* pair = s_HexPairs[bytes[index]];
+        target[i * 2 + 0] = pair[0];
+        target[i * 2 + 1] = pair[1];
     }
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-static void assignStr(const char* str, int len, int displayWidth, QString* target) {
-    for (int i = len; i < displayWidth; ++i) {
-        target->push_back(QLatin1Char(' '));  // Right align
+static void formatDecimal(char* target, int displayWidth, uint64_t value, bool negative) {
+    char* p = target + displayWidth;
+
+    do {
+        *--p = char('0' + (value % 10));
+        value /= 10;
+    } while (value != 0 && p > target);
+
+    if (negative && p > target) {
+        *--p = '-';
     }
-    for (const char* p = str; *p; ++p) {
-        target->push_back(QChar(int(*p)));
+
+    while (p > target) {
+        *--p = ' ';  // Right align
     }
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-static void formatUnsigned(QString* target, int displayWidth, int byteCount, const uint16_t* values,
+static void formatUnsigned(char* target, int displayWidth, int byteCount, const uint8_t* bytes,
                            MemoryViewWidget::Endianess endianess) {
-    const uint64_t value = decodeValue(values, byteCount, endianess);
-    char buffer[32];
-    buffer[0] = 0;
-    int len = 0;
-    switch (byteCount) {
-        case 1:
-            len = snprintf(buffer, sizeof buffer, "%u", (uint8_t)value);
-            break;
-        case 2:
-            len = snprintf(buffer, sizeof buffer, "%u", (uint16_t)value);
-            break;
-        case 4:
-            len = snprintf(buffer, sizeof buffer, "%u", (uint32_t)value);
-            break;
-        case 8:
-            len = snprintf(buffer, sizeof buffer, "%" PRIu64, (uint64_t)value);
-            break;
-    }
-
-    assignStr(buffer, len, displayWidth, target);
+    formatDecimal(target, displayWidth, decodeValue(bytes, byteCount, endianess), false);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-static void formatSigned(QString* target, int displayWidth, int byteCount, const uint16_t* values,
+static void formatSigned(char* target, int displayWidth, int byteCount, const uint8_t* bytes,
                          MemoryViewWidget::Endianess endianess) {
-    const uint64_t value = decodeValue(values, byteCount, endianess);
-    char buffer[32];
-    buffer[0] = 0;
-    int len = 0;
-    switch (byteCount) {
-        case 1:
-            len = snprintf(buffer, sizeof buffer, "%d", (int8_t)value);
-            break;
-        case 2:
-            len = snprintf(buffer, sizeof buffer, "%d", (int16_t)value);
-            break;
-        case 4:
-            len = snprintf(buffer, sizeof buffer, "%d", (int32_t)value);
-            break;
-        case 8:
-            len = snprintf(buffer, sizeof buffer, "%" PRId64, (int64_t)value);
-            break;
-    }
+    const uint64_t value = decodeValue(bytes, byteCount, endianess);
+    const int shift = 64 - byteCount * 8;
+
+    // Sign extend and format the magnitude (which is done in unsigned math so INT64_MIN works as well)
+    const int64_t signedValue = int64_t(value << shift) >> shift;
+    const uint64_t magnitude = signedValue < 0 ? 0 - uint64_t(signedValue) : uint64_t(signedValue);
 
-    assignStr(buffer, len, displayWidth, target);
+    formatDecimal(target, displayWidth, magnitude, signedValue < 0);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-static void formatFloat(QString* target, int displayWidth, int byteCount, const uint16_t* values,
+static void formatFloat(char* target, int displayWidth, int byteCount, const uint8_t* bytes,
                         MemoryViewWidget::Endianess endianess) {
-    const uint64_t value = decodeValue(values, byteCount, endianess);
+    const uint64_t value = decodeValue(bytes, byteCount, endianess);
 
     union {
         uint64_t i;
@@ -146,7 +136,6 @@ static void formatFloat(QString* target, int displayWidth, int byteCount, const
     } itof32;
 
     char buffer[32];
-    buffer[0] = 0;
     int len = 0;
     switch (byteCount) {
         case 4:
@@ -158,12 +147,12 @@ static void formatFloat(QString* target, int displayWidth, int byteCount, const
             // XXX: MSVC
             len = snprintf(buffer, sizeof buffer, "%15.5g", itof64.f);
             break;
-
-        default:
-            return;
     }
 
-    assignStr(buffer, len, displayWidth, target);
+    len = std::min(std::max(len, 0), displayWidth);
+
+    memset(target, ' ', size_t(displayWidth - len));
+    memcpy(target + displayWidth - len, buffer, size_t(len));
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -186,12 +175,49 @@ static const struct MemViewTypeMeta s_TypeMeta[] = {
 };
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// The view is a grid of fixed width cells (address, gutter, data, gutter, ascii on each row). The visible rows are
+// formatted into a text grid with an attribute per cell and painting only draws the cells inside the dirty region
+// from the glyph atlas. When new memory arrives the grid is formatted again and only cells that differ from the
+// previous grid are repainted. Line scrolling moves the pixels with QWidget::scroll so only the new rows are drawn.
+
+struct MemViewLayout {
+    uint64_t m_TopRow = 0;
+    int m_Rows = 0;
+    int m_RowChars = 0;
+    int m_CharWidth = 0;
+    int m_RowHeight = 0;
+    int m_AddressWidth = 0;
+    int m_ElementsPerRow = 0;
+    int m_DataType = -1;
+    int m_Endianess = -1;
+
+    bool operator==(const MemViewLayout& other) const {
+        return m_TopRow == other.m_TopRow && m_Rows == other.m_Rows && m_RowChars == other.m_RowChars &&
+               m_CharWidth == other.m_CharWidth && m_RowHeight == other.m_RowHeight &&
+               m_AddressWidth == other.m_AddressWidth && m_ElementsPerRow == other.m_ElementsPerRow &&
+               m_DataType == other.m_DataType && m_Endianess == other.m_Endianess;
+    }
+
+    bool operator!=(const MemViewLayout& other) const { return !(*this == other); }
+};
+
+enum MemViewCellAttribute {
+    // Cell is part of an element that changed since the previous stop
+    kCellChanged = 1 << 0,
+};
 
-static QChar s_AsciiTab[256];
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 class MemoryViewPrivate {
    public:
     QPointer<IBackendRequests> m_Interface;
+    QPointer<MemoryCache> m_cache;
+    QPointer<SnapshotStore> m_snapshots;
+
+    // Snapshot shown instead of live memory (if not empty), the snapshot it's compared with and their diff
+    QString m_Snapshot;
+    QString m_CompareSnapshot;
+    QVector<MemoryRange> m_SnapshotDiff;
 
     int m_ElementsPerRow = 8;
     MemoryViewWidget::DataType m_DataType = MemoryViewWidget::X8;
@@ -202,153 +228,450 @@ class MemoryViewPrivate {
     uint64_t m_TopRow = 0;
     int m_adddressWidth = 8;
 
-    uint64_t m_cachedRangeStart = 0;
-    uint64_t m_cachedRangeEnd = 0;
-    bool m_transferInProgress = false;
     bool m_expressionStatus = true;
 
-    QVector<uint16_t> m_Cache;
-    QVector<uint16_t> m_transferCache;
+    // Memory of the visible rows
+    MemorySpan m_Memory;
 
-    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Number of bytes shown at the last repaint and the changed byte navigated to last (see displayNextChanged)
+    uint64_t m_VisibleBytes = 0;
+    uint64_t m_ChangedCursor = 0;
+    bool m_HasChangedCursor = false;
+
+    // Fetches pages ahead of the viewport in the scroll direction so scrolling renders from the cache
+    ScrollPrefetcher m_prefetcher{MemoryCache::PageSize, 16};
+    QElapsedTimer m_scrollTimer;
 
-    void access(uint64_t address, uint64_t count, QVector<uint16_t>* values) {
-        uint64_t start = address;
-        uint64_t end = address + count;
+    // Formatted cells of the visible rows (m_Layout.m_Rows * m_Layout.m_RowChars) and the grid from before the last
+    // memory update that it's compared against
+    GlyphAtlas m_Glyphs;
+    MemViewLayout m_Layout;
+    QVector<char> m_Text;
+    QVector<uint8_t> m_Attributes;
+    QVector<char> m_PrevText;
+    QVector<uint8_t> m_PrevAttributes;
 
-        values->resize(0);
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Visible rows are assembled from the page cache shared by all memory views of the session. Pages that aren't
+    // cached yet are shown as unreadable until they arrive (the widget is repainted when they do)
 
-        // Very basic caching, we only support the exactly previous request as
-        // cache.
-        if ((m_cachedRangeStart == start && end == m_cachedRangeEnd) && !m_transferInProgress) {
-            *values = m_transferCache;
+    void access(uint64_t address, uint64_t count, MemorySpan* span) {
+        if (!m_Snapshot.isEmpty() && m_snapshots &&
+            m_snapshots->read(m_Snapshot, address, count, span, m_CompareSnapshot)) {
             return;
         }
 
-        // fill with dummy data for now until done
-        for (uint64_t ai = address, ae = address + count; ai != ae; ++ai) {
-            values->push_back(0 & 0xff);  // hack test
+        if (!m_cache) {
+            span->reset(address, uint32_t(count));
+            span->data.fill(0);
+            span->add_run(0, 0);
+            return;
         }
 
-        /*
-        if (m_Interface) {
-            m_Interface->beginReadMemory(start, end, &m_transferCache);
-            m_transferInProgress = true;
+        m_cache->read(address, count, span);
+
+        if (m_cache->address_width() > 0) {
+            m_adddressWidth = m_cache->address_width();
         }
-        */
     }
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void jump(int rowCount) { m_TopRow += rowCount * m_ElementsPerRow * bytesPerElement(); }
+    void jump(int rowCount) {
+        m_TopRow += rowCount * m_ElementsPerRow * bytesPerElement();
+        m_prefetcher.scrolled(m_TopRow, m_scrollTimer.elapsed());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Scrolls by rowCount rows. If the grid is on screen already the rows that stay visible are moved instead of
+    // being painted again
+
+    void scrollRows(QWidget* widget, int rowCount) {
+        const bool moveRows = !m_Text.isEmpty() && m_Layout.m_TopRow == m_TopRow && m_Layout.m_RowHeight > 0 &&
+                              abs(rowCount) < m_Layout.m_Rows;
+
+        jump(rowCount);
+
+        if (moveRows) {
+            widget->scroll(0, -rowCount * m_Layout.m_RowHeight);
+        } else {
+            widget->update();
+        }
+    }
 
     int bytesPerElement() const { return s_TypeMeta[m_DataType].m_BytesPerElement; }
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // First changed byte between the shown snapshot and the one it's compared with at or after address. Wraps around
+    // to the first change if there is none after it
 
-    void paintEvent(QWidget* widget, QPaintEvent* ev) {
-        QFont font = widget->font();
-        QFontMetrics fontMetrics(font);
-        // QRect widgetRect = widget->rect();
-        QRect dirtyRect = ev->rect();
-        const int elementsPerRow = m_ElementsPerRow;
-        const int bytesPerRow = elementsPerRow * bytesPerElement();
+    bool findNextSnapshotChange(uint64_t address, uint64_t* found) const {
+        if (m_SnapshotDiff.isEmpty()) {
+            return false;
+        }
 
-        QColor baseColor = QApplication::palette().base().color();
+        auto it = std::find_if(m_SnapshotDiff.begin(), m_SnapshotDiff.end(),
+                               [address](const MemoryRange& range) { return range.end() > address; });
 
-        QPainter painter(widget);
-        painter.setFont(font);
+        *found = it != m_SnapshotDiff.end() ? qMax(it->address, address) : m_SnapshotDiff.first().address;
 
-        painter.fillRect(dirtyRect, baseColor);
+        return true;
+    }
 
-        if (!m_expressionStatus) {
-            painter.drawText(dirtyRect, 0, QStringLiteral("Unable to evaluate expression."));
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void updateSnapshotDiff() {
+        if (m_snapshots && !m_snapshots->contains(m_Snapshot)) {
+            m_Snapshot.clear();
+        }
+
+        if (!m_snapshots || m_Snapshot.isEmpty() || !m_snapshots->contains(m_CompareSnapshot)) {
+            m_CompareSnapshot.clear();
+            m_SnapshotDiff.clear();
             return;
         }
 
-        const int charWidth = fontMetrics.boundingRect(QLatin1Char('W')).width();
-        const int rowHeight = fontMetrics.height();
-        const int rows = (widget->height() + rowHeight - 1) / rowHeight;
+        m_SnapshotDiff = m_snapshots->diff(m_CompareSnapshot, m_Snapshot);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Moves to the next byte that changed since the previous stop (or the compared snapshot). The view only scrolls
+    // if it isn't visible already and then keeps the current column alignment of the rows
+
+    bool nextChanged() {
+        uint64_t found = 0;
+        uint64_t start = m_HasChangedCursor ? m_ChangedCursor + 1 : m_TopRow;
+
+        if (!m_Snapshot.isEmpty()) {
+            if (!findNextSnapshotChange(start, &found)) {
+                return false;
+            }
+        } else if (!m_cache || !m_cache->find_next_changed(start, &found)) {
+            return false;
+        }
+
+        m_ChangedCursor = found;
+        m_HasChangedCursor = true;
+
+        if (found >= m_TopRow && found - m_TopRow < m_VisibleBytes) {
+            return true;
+        }
+
+        const uint64_t bytesPerRow = uint64_t(m_ElementsPerRow * bytesPerElement());
+
+        if (found >= m_TopRow) {
+            m_TopRow += ((found - m_TopRow) / bytesPerRow) * bytesPerRow;
+        } else {
+            m_TopRow -= ((m_TopRow - found + bytesPerRow - 1) / bytesPerRow) * bytesPerRow;
+        }
+
+        m_prefetcher.reset(m_TopRow);
+
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int dataColumn() const { return m_adddressWidth * 2 + 1; }
+
+    int asciiColumn() const {
+        const MemViewTypeMeta& typeMeta = s_TypeMeta[m_DataType];
+        return dataColumn() + m_ElementsPerRow * (typeMeta.m_DisplayWidthChars + 1);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Layout the grid would have if it was formatted now
+
+    MemViewLayout currentLayout(QWidget* widget) {
+        MemViewLayout layout;
 
-        uint64_t firstByte = m_TopRow;
-        uint64_t lastByte = m_TopRow + bytesPerRow * rows;
+        m_Glyphs.update(widget->font(), widget->palette().color(QPalette::WindowText), widget->devicePixelRatioF());
+
+        layout.m_TopRow = m_TopRow;
+        layout.m_CharWidth = m_Glyphs.char_width();
+        layout.m_RowHeight = std::max(1, m_Glyphs.row_height());
+        layout.m_Rows = (widget->height() + layout.m_RowHeight - 1) / layout.m_RowHeight;
+        layout.m_AddressWidth = m_adddressWidth;
+        layout.m_RowChars = asciiColumn() + m_ElementsPerRow * bytesPerElement();
+        layout.m_ElementsPerRow = m_ElementsPerRow;
+        layout.m_DataType = m_DataType;
+        layout.m_Endianess = m_Endianess;
+
+        return layout;
+    }
 
-        m_Cache.clear();
-        access(firstByte, lastByte - firstByte, &m_Cache);
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Formats the visible rows into the text grid
 
-        int screenY = 0;
-        int dataOffset = 0;
+    void format(QWidget* widget) {
+        MemViewLayout layout = currentLayout(widget);
 
         const MemViewTypeMeta& typeMeta = s_TypeMeta[m_DataType];
+        const int bytesPerRow = m_ElementsPerRow * typeMeta.m_BytesPerElement;
+        const uint64_t firstByte = m_TopRow;
+        const uint64_t lastByte = m_TopRow + uint64_t(bytesPerRow) * uint64_t(layout.m_Rows);
+
+        access(firstByte, lastByte - firstByte, &m_Memory);
+        m_VisibleBytes = lastByte - firstByte;
+
+        uint64_t prefetchStart = 0;
+        uint64_t prefetchSize = 0;
+
+        // Snapshots are already in memory so there is nothing to prefetch
+        if (m_cache && m_Snapshot.isEmpty() &&
+            m_prefetcher.prefetch_range(firstByte, lastByte - firstByte, m_scrollTimer.elapsed(), &prefetchStart,
+                                        &prefetchSize)) {
+            m_cache->prefetch(prefetchStart, prefetchSize);
+        }
+
+        // The address width is only known once the first memory has arrived
+        layout.m_AddressWidth = m_adddressWidth;
+        layout.m_RowChars = asciiColumn() + bytesPerRow;
+
+        const int rowChars = layout.m_RowChars;
+        const int cellCount = layout.m_Rows * rowChars;
+        const int dataColumn = this->dataColumn();
+        const int asciiColumn = this->asciiColumn();
+        const int elementChars = typeMeta.m_DisplayWidthChars + 1;
 
-        QString rowText;
-        rowText.reserve((1 + typeMeta.m_DisplayWidthChars));
+        m_Layout = layout;
+        m_Text.resize(cellCount);
+        m_Attributes.resize(cellCount);
 
-        const int addressWidth = (m_adddressWidth * 2) * charWidth;
-        const int dataWidth = charWidth * (elementsPerRow * typeMeta.m_DisplayWidthChars + elementsPerRow - 1);
-        const int asciiWidth = bytesPerRow * charWidth;
-        const int gutterWidth = charWidth;
+        memset(m_Text.data(), ' ', size_t(cellCount));
+        memset(m_Attributes.data(), 0, size_t(cellCount));
 
-        for (int row = 0; row < rows; ++row) {
-            QRect addressRect(0, screenY, addressWidth, rowHeight);
-            QRect dataRect(addressRect.x() + addressRect.width() + gutterWidth, screenY, dataWidth, rowHeight);
-            QRect asciiRect(dataRect.x() + dataRect.width() + gutterWidth, screenY, asciiWidth, rowHeight);
+        // Most of the time all visible memory has the same flags so the runs only need to be looked at otherwise
 
-            if (dirtyRect.intersects(addressRect)) {
-                rowText.resize(0);
-                uint64_t addr = (m_TopRow + dataOffset);
+        const bool uniform = m_Memory.runs.size() <= 1;
+        const uint16_t uniformFlags = m_Memory.flags(0, 1);
+        int runIndex = 0;
 
-                uint32_t byteShift = 56;
+        for (int row = 0; row < layout.m_Rows; ++row) {
+            char* text = m_Text.data() + row * rowChars;
+            uint8_t* attributes = m_Attributes.data() + row * rowChars;
+            const uint32_t rowOffset = uint32_t(row * bytesPerRow);
+            const uint8_t* rowBytes = m_Memory.bytes() + rowOffset;
 
-                if (m_adddressWidth == 4) {
-                    byteShift = 24;
+            // Address
+            uint64_t address = m_TopRow + uint64_t(row) * uint64_t(bytesPerRow);
+
+            for (int i = 0; i < m_adddressWidth; ++i) {
+                const char* pair = s_HexPairs[(address >> ((m_adddressWidth - 1 - i) * 8)) & 0xff];
+                text[i * 2 + 0] = pair[0];
+                text[i * 2 + 1] = pair[1];
+            }
+
+            // Data
+            for (int i = 0; i < m_ElementsPerRow; ++i) {
+                const uint32_t offset = rowOffset + uint32_t(i * typeMeta.m_BytesPerElement);
+                const uint16_t flags =
+                    uniform ? uniformFlags : m_Memory.flags(offset, uint32_t(typeMeta.m_BytesPerElement));
+                char* cell = text + dataColumn + i * elementChars;
+
+                if (flags & MemorySpan::Unreadable) {
+                    memset(cell, '?', size_t(typeMeta.m_DisplayWidthChars));
                 } else {
-                    byteShift = 8;
+                    (*typeMeta.m_Formatter)(cell, typeMeta.m_DisplayWidthChars, typeMeta.m_BytesPerElement,
+                                            m_Memory.bytes() + offset, m_Endianess);
                 }
 
-                for (int i = 0; i < m_adddressWidth; ++i) {
-                    uint8_t byte = addr >> byteShift;
-                    rowText.append(s_HexTable[byte >> 4]);
-                    rowText.append(s_HexTable[byte & 0xf]);
-                    addr <<= 8;
+                // Elements with any byte changed since the previous stop get a highlighted background
+
+                if (flags & IBackendRequests::Changed) {
+                    memset(attributes + dataColumn + i * elementChars, kCellChanged,
+                           size_t(typeMeta.m_DisplayWidthChars));
                 }
+            }
+
+            // Ascii
+            for (int i = 0; i < bytesPerRow; ++i) {
+                text[asciiColumn + i] = s_AsciiTab[rowBytes[i]];
+            }
 
-                painter.drawText(addressRect, 0, rowText);
+            if (!uniform || (uniformFlags & (MemorySpan::Unreadable | IBackendRequests::Changed))) {
+                formatAsciiFlags(text + asciiColumn, attributes + asciiColumn, rowOffset, uint32_t(bytesPerRow),
+                                 &runIndex);
             }
+        }
+    }
 
-            if (dirtyRect.intersects(dataRect)) {
-                rowText.resize(0);
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Applies the flag runs to count chars of the ASCII column starting at memory offset. Unreadable bytes are shown
+    // as '?' and changed bytes are highlighted. runIndex is where to start looking in the runs (rows are formatted in
+    // increasing offset order)
 
-                for (int i = 0; i < elementsPerRow; ++i) {
-                    if (i > 0) {
-                        rowText.push_back(QLatin1Char(' '));
-                    }
+    void formatAsciiFlags(char* text, uint8_t* attributes, uint32_t offset, uint32_t count, int* runIndex) const {
+        const QVector<MemorySpan::Run>& runs = m_Memory.runs;
+        const uint32_t end = offset + count;
 
-                    const uint16_t* values = m_Cache.constData() + dataOffset + i * typeMeta.m_BytesPerElement;
-                    (*typeMeta.m_Formatter)(&rowText, typeMeta.m_DisplayWidthChars, typeMeta.m_BytesPerElement, values,
-                                            m_Endianess);
-                }
+        // Bytes before the first run have no flags
+        const uint32_t covered = runs.isEmpty() ? end : runs.first().offset;
+
+        if (covered > offset) {
+            memset(text, '?', size_t(std::min(covered, end) - offset));
+        }
+
+        int i = *runIndex;
+
+        while (i + 1 < runs.size() && runs[i + 1].offset <= offset) {
+            ++i;
+        }
+
+        *runIndex = i;
+
+        for (; i < runs.size() && runs[i].offset < end; ++i) {
+            const uint32_t runStart = std::max(runs[i].offset, offset);
+            const uint32_t runEnd = std::min(i + 1 < runs.size() ? runs[i + 1].offset : end, end);
+
+            if (runStart >= runEnd) {
+                continue;
+            }
+
+            if (!(runs[i].flags & IBackendRequests::Readable)) {
+                memset(text + (runStart - offset), '?', size_t(runEnd - runStart));
+            }
 
-                painter.drawText(dataRect, 0, rowText);
+            if (runs[i].flags & IBackendRequests::Changed) {
+                memset(attributes + (runStart - offset), kCellChanged, size_t(runEnd - runStart));
             }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Called when the memory cache has new data. Formats the grid again and repaints the cells that changed
+
+    void memoryUpdated(QWidget* widget) {
+        if (m_Text.isEmpty() || !m_expressionStatus || currentLayout(widget) != m_Layout) {
+            widget->update();
+            return;
+        }
+
+        const MemViewLayout oldLayout = m_Layout;
+
+        m_PrevText.swap(m_Text);
+        m_PrevAttributes.swap(m_Attributes);
+
+        format(widget);
+
+        if (m_Layout != oldLayout) {
+            widget->update();
+            return;
+        }
+
+        const int rowChars = m_Layout.m_RowChars;
+        const char* text = m_Text.constData();
+        const char* prevText = m_PrevText.constData();
+        const uint8_t* attributes = m_Attributes.constData();
+        const uint8_t* prevAttributes = m_PrevAttributes.constData();
+
+        QRegion dirty;
+        int runCount = 0;
+
+        for (int row = 0; row < m_Layout.m_Rows; ++row) {
+            const int rowStart = row * rowChars;
+
+            for (int column = 0; column < rowChars;) {
+                const int index = rowStart + column;
+
+                if (text[index] == prevText[index] && attributes[index] == prevAttributes[index]) {
+                    ++column;
+                    continue;
+                }
+
+                int end = column + 1;
 
-            if (dirtyRect.intersects(asciiRect)) {
-                rowText.resize(0);
-                for (int i = 0; i < bytesPerRow; ++i) {
-                    uint16_t value = m_Cache.at(i + dataOffset);
-                    uint8_t byte = value & 0xff;
-                    rowText.append(s_AsciiTab[byte]);
+                while (end < rowChars && (text[rowStart + end] != prevText[rowStart + end] ||
+                                          attributes[rowStart + end] != prevAttributes[rowStart + end])) {
+                    ++end;
                 }
 
-                painter.drawText(asciiRect, 0, rowText);
+                // Repaint everything when most of the view changed instead of building a huge region
+
+                if (++runCount > m_Layout.m_Rows * 4) {
+                    widget->update();
+                    return;
+                }
+
+                dirty += QRect(column * m_Layout.m_CharWidth, row * m_Layout.m_RowHeight,
+                               (end - column) * m_Layout.m_CharWidth, m_Layout.m_RowHeight);
+                column = end;
+            }
+        }
+
+        if (!dirty.isEmpty()) {
+            widget->update(dirty);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void paintEvent(QWidget* widget, QPaintEvent* ev) {
+        QColor baseColor = QApplication::palette().base().color();
+
+        QPainter painter(widget);
+
+        if (!m_expressionStatus) {
+            painter.fillRect(ev->rect(), baseColor);
+            painter.setFont(widget->font());
+            painter.drawText(ev->rect(), 0, QStringLiteral("Unable to evaluate expression."));
+            m_Text.resize(0);
+            return;
+        }
+
+        if (m_Text.isEmpty() || currentLayout(widget) != m_Layout) {
+            format(widget);
+        }
+
+        QColor changedColor = QApplication::palette().highlight().color();
+        changedColor.setAlpha(96);
+
+        const MemViewLayout& layout = m_Layout;
+        const int charWidth = std::max(1, layout.m_CharWidth);
+        const int rowHeight = layout.m_RowHeight;
+
+        for (const QRect& rect : ev->region()) {
+            painter.fillRect(rect, baseColor);
+
+            const int firstRow = std::max(0, rect.top() / rowHeight);
+            const int lastRow = std::min(layout.m_Rows - 1, rect.bottom() / rowHeight);
+            const int firstColumn = std::max(0, rect.left() / charWidth);
+            const int lastColumn = std::min(layout.m_RowChars - 1, rect.right() / charWidth);
+
+            if (firstColumn > lastColumn) {
+                continue;
             }
 
-            screenY += rowHeight;
-            dataOffset += bytesPerRow;
+            for (int row = firstRow; row <= lastRow; ++row) {
+                const char* text = m_Text.constData() + row * layout.m_RowChars;
+                const uint8_t* attributes = m_Attributes.constData() + row * layout.m_RowChars;
+                const int y = row * rowHeight;
+
+                // Backgrounds of changed cells (one rect per run of cells)
+
+                for (int column = firstColumn; column <= lastColumn;) {
+                    if (!(attributes[column] & kCellChanged)) {
+                        ++column;
+                        continue;
+                    }
+
+                    int end = column + 1;
+
+                    while (end <= lastColumn && (attributes[end] & kCellChanged)) {
+                        ++end;
+                    }
+
+                    painter.fillRect(column * charWidth, y, (end - column) * charWidth, rowHeight, changedColor);
+                    column = end;
+                }
+
+                m_Glyphs.draw(&painter, firstColumn * charWidth, y, text + firstColumn, lastColumn - firstColumn + 1);
+            }
         }
     }
 };
 
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 MemoryViewWidget::MemoryViewWidget(QWidget* parent) : Base(parent), m_Private(new MemoryViewPrivate) {
@@ -364,13 +687,16 @@ MemoryViewWidget::MemoryViewWidget(QWidget* parent) : Base(parent), m_Private(ne
 
     setFocusPolicy(Qt::StrongFocus);
 
-    if (!s_AsciiTab[int('a')].unicode()) {
+    // All of the widget is painted from the cell grid so Qt doesn't need to clear the background first
+    setAttribute(Qt::WA_OpaquePaintEvent);
+
+    m_Private->m_scrollTimer.start();
+
+    if (!s_AsciiTab[int('a')]) {
         for (int i = 0; i < 256; ++i) {
-            if (isprint(i)) {
-                s_AsciiTab[i] = QLatin1Char(i);
-            } else {
-                s_AsciiTab[i] = QLatin1Char('.');
-            }
+            s_AsciiTab[i] = isprint(i) ? char(i) : '.';
+            s_HexPairs[i][0] = s_HexTable[i >> 4];
+            s_HexPairs[i][1] = s_HexTable[i & 0xf];
         }
     }
 
@@ -405,6 +731,14 @@ MemoryViewWidget::MemoryViewWidget(QWidget* parent) : Base(parent), m_Private(ne
         this->addAction(prevLineAction);
         connect(prevLineAction, &QAction::triggered, this, &MemoryViewWidget::displayPrevLine);
     }
+
+    {
+        QAction* nextChangedAction = new QAction(QStringLiteral("Next Changed Byte"), this);
+        nextChangedAction->setShortcut(QKeySequence(Qt::Key_N));
+        nextChangedAction->setShortcutContext(Qt::WidgetShortcut);
+        this->addAction(nextChangedAction);
+        connect(nextChangedAction, &QAction::triggered, this, &MemoryViewWidget::displayNextChanged);
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -414,86 +748,96 @@ MemoryViewWidget::~MemoryViewWidget() { delete m_Private; }
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 void MemoryViewWidget::set_backend_interface(IBackendRequests* interface) {
+    if (m_Private->m_cache) {
+        disconnect(m_Private->m_cache, nullptr, this, nullptr);
+    }
+
+    if (m_Private->m_snapshots) {
+        disconnect(m_Private->m_snapshots, nullptr, this, nullptr);
+    }
+
     m_Private->m_Interface = interface;
+    m_Private->m_cache = MemoryCache::for_interface(interface);
+    m_Private->m_snapshots = SnapshotStore::for_interface(interface);
+    m_Private->updateSnapshotDiff();
 
-    /*
-    if (interface) {
-        connect(interface, &IBackendRequests::endReadMemory, this, &MemoryViewWidget::endReadMemory);
-        connect(interface, &IBackendRequests::program_counter_changed, this, &MemoryViewWidget::program_counter_changed);
+    // The cache drops its pages when the target stops so a repaint is triggered here as well and the visible range
+    // is requested again
+
+    if (m_Private->m_cache) {
+        connect(m_Private->m_cache, &MemoryCache::pages_updated, this, &MemoryViewWidget::memoryUpdated);
+    }
+
+    if (m_Private->m_snapshots) {
+        connect(m_Private->m_snapshots, &SnapshotStore::snapshots_changed, this, &MemoryViewWidget::snapshotsChanged);
     }
-    */
 
     update();
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void MemoryViewWidget::program_counter_changed(const IBackendRequests::ProgramCounterChange&) {
-    // If pc has changed we re-request the current data again
-    /*
-    if (m_Private->m_Interface) {
-        m_Private->m_Interface->beginReadMemory(m_Private->m_cachedRangeStart, m_Private->m_cachedRangeEnd,
-                                                &m_Private->m_transferCache);
-        m_Private->m_transferInProgress = true;
-    }
-    */
-}
+void MemoryViewWidget::setExpressionStatus(bool status) { m_Private->m_expressionStatus = status; }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-// Gets called when transfor from backend to frontend has finished
 
-void MemoryViewWidget::endReadMemory(QVector<uint16_t>* target, uint64_t address, int addressWidth) {
-    // so this is a hack. We need a better way to do this. This is because if
-    // there are several memory requests in flight we must make sure that its
-    // "ours" that gets called here.
-    if (target != &m_Private->m_transferCache) {
-        return;
-    }
+void MemoryViewWidget::paintEvent(QPaintEvent* ev) { m_Private->paintEvent(this, ev); }
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    m_Private->m_adddressWidth = addressWidth;
+void MemoryViewWidget::memoryUpdated() { m_Private->memoryUpdated(this); }
 
-    m_Private->m_cachedRangeStart = address;
-    m_Private->m_cachedRangeEnd = address + target->count();
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    m_Private->m_transferInProgress = false;
+void MemoryViewWidget::snapshotsChanged() {
+    m_Private->updateSnapshotDiff();
+    m_Private->memoryUpdated(this);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void MemoryViewWidget::setSnapshot(const QString& name, const QString& compare) {
+    m_Private->m_Snapshot = name;
+    m_Private->m_CompareSnapshot = compare;
+    m_Private->m_HasChangedCursor = false;
+    m_Private->updateSnapshotDiff();
     update();
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void MemoryViewWidget::setExpressionStatus(bool status) { m_Private->m_expressionStatus = status; }
+QString MemoryViewWidget::snapshot() const { return m_Private->m_Snapshot; }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void MemoryViewWidget::paintEvent(QPaintEvent* ev) { m_Private->paintEvent(this, ev); }
+QVector<MemoryRange> MemoryViewWidget::snapshotDiff() const { return m_Private->m_SnapshotDiff; }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void MemoryViewWidget::displayNextPage() {
-    m_Private->jump(m_Private->m_PageSizeInRows);
-    update();
-}
+uint64_t MemoryViewWidget::visibleBytes() const { return m_Private->m_VisibleBytes; }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void MemoryViewWidget::displayPrevPage() {
-    m_Private->jump(-m_Private->m_PageSizeInRows);
-    update();
-}
+void MemoryViewWidget::displayNextPage() { m_Private->scrollRows(this, m_Private->m_PageSizeInRows); }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void MemoryViewWidget::displayNextLine() {
-    m_Private->jump(1);
-    update();
-}
+void MemoryViewWidget::displayPrevPage() { m_Private->scrollRows(this, -m_Private->m_PageSizeInRows); }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-void MemoryViewWidget::displayPrevLine() {
-    m_Private->jump(-1);
-    update();
+void MemoryViewWidget::displayNextLine() { m_Private->scrollRows(this, 1); }
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MemoryViewWidget::displayPrevLine() { m_Private->scrollRows(this, -1); }
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void MemoryViewWidget::displayNextChanged() {
+    if (m_Private->nextChanged()) {
+        update();
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -508,12 +852,10 @@ void MemoryViewWidget::contextMenuEvent(QContextMenuEvent* ev) {
 
 void MemoryViewWidget::wheelEvent(QWheelEvent* ev) {
     if (ev->angleDelta().y() < 0) {
-        m_Private->jump(m_Private->m_WheelSpeedRows);
+        m_Private->scrollRows(this, m_Private->m_WheelSpeedRows);
     } else if (ev->angleDelta().y() > 0) {
-        m_Private->jump(-m_Private->m_WheelSpeedRows);
+        m_Private->scrollRows(this, -m_Private->m_WheelSpeedRows);
     }
-
-    update();
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -553,8 +895,14 @@ void MemoryViewWidget::setElementsPerLine(int count) {
 
 void MemoryViewWidget::setAddress(uint64_t address) {
     m_Private->m_TopRow = address;
+    m_Private->m_HasChangedCursor = false;
+    m_Private->m_prefetcher.reset(address);
     update();
 }
 
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+uint64_t MemoryViewWidget::address() const { return m_Private->m_TopRow; }
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }  // namespace prodbg
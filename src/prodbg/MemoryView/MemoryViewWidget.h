@@ -6,6 +6,7 @@
 namespace prodbg {
 
 class MemoryViewPrivate;
+struct MemoryRange;
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -51,6 +52,18 @@ class MemoryViewWidget : public QWidget {
    public:
     void set_backend_interface(IBackendRequests* interface);
     void setAddress(uint64_t address);
+    uint64_t address() const;
+
+    // Number of bytes shown at the last repaint
+    uint64_t visibleBytes() const;
+
+    // Shows a snapshot (see SnapshotStore) instead of live memory. An empty name goes back to live memory. Bytes that
+    // differ from the compare snapshot are shown as changed and displayNextChanged moves between them
+    void setSnapshot(const QString& name, const QString& compare = QString());
+    QString snapshot() const;
+
+    // Changed ranges between the shown snapshot and the one it's compared with
+    QVector<MemoryRange> snapshotDiff() const;
     void setExpressionStatus(bool status);
 
    protected:
@@ -61,8 +74,6 @@ class MemoryViewWidget : public QWidget {
    public:
     DataType dataType() const;
     Q_SLOT void setDataType(DataType t);
-    Q_SLOT void endReadMemory(QVector<uint16_t>* target, uint64_t address, int addressWidth);
-    Q_SLOT void program_counter_changed(const IBackendRequests::ProgramCounterChange& pc);
 
     Endianess endianess() const;
     Q_SLOT void setEndianess(Endianess e);
@@ -76,7 +87,14 @@ class MemoryViewWidget : public QWidget {
     Q_SLOT void displayNextLine();
     Q_SLOT void displayPrevLine();
 
+    // Scrolls to the next byte that changed since the previous stop
+    Q_SLOT void displayNextChanged();
+
    private:
+    // Repaints the cells that changed when the memory cache has new data
+    Q_SLOT void memoryUpdated();
+    Q_SLOT void snapshotsChanged();
+
     MemoryViewPrivate* m_Private;
 };
 
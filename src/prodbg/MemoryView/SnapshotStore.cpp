@@ -0,0 +1,443 @@
+#include "SnapshotStore.h"
+#include <string.h>
+#include <algorithm>
+#include "MemoryDiff.h"
+
+namespace prodbg {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static uint64_t hash_page(const QByteArray& data) {
+    return MemoryDiff_hash((const uint8_t*)data.constData(), size_t(data.size()));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Sorts the ranges and merges the ones that overlap or touch. Ranges that wrap around the end of the address space are
+// cut at the end
+
+static QVector<MemoryRange> merge_ranges(QVector<MemoryRange> ranges) {
+    QVector<MemoryRange> merged;
+
+    std::sort(ranges.begin(), ranges.end(),
+              [](const MemoryRange& a, const MemoryRange& b) { return a.address < b.address; });
+
+    for (MemoryRange range : ranges) {
+        if (range.size == 0) {
+            continue;
+        }
+
+        if (range.address + range.size < range.address) {
+            range.size = ~uint64_t(0) - range.address;
+        }
+
+        if (!merged.isEmpty() && range.address <= merged.last().end()) {
+            MemoryRange& last = merged.last();
+            last.size = qMax(last.end(), range.end()) - last.address;
+        } else {
+            merged.append(range);
+        }
+    }
+
+    return merged;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static QVector<MemoryRange> intersect_ranges(const QVector<MemoryRange>& a, const QVector<MemoryRange>& b) {
+    QVector<MemoryRange> result;
+    int i = 0;
+    int n = 0;
+
+    while (i < a.size() && n < b.size()) {
+        const uint64_t start = qMax(a[i].address, b[n].address);
+        const uint64_t end = qMin(a[i].end(), b[n].end());
+
+        if (start < end) {
+            result.append(MemoryRange{start, end - start});
+        }
+
+        if (a[i].end() < b[n].end()) {
+            ++i;
+        } else {
+            ++n;
+        }
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void append_range(QVector<MemoryRange>* ranges, uint64_t address, uint64_t size) {
+    if (!ranges->isEmpty() && ranges->last().end() == address) {
+        ranges->last().size += size;
+    } else {
+        ranges->append(MemoryRange{address, size});
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Sets a bit in mask (PageSize / 8 bytes) for each byte that differs between the pages. Bytes past the end of the
+// shorter page are only readable in one of them and count as changed
+
+static void page_changed_mask(const QByteArray& a, const QByteArray& b, uint8_t* mask) {
+    const size_t common = size_t(qMin(a.size(), b.size()));
+    const size_t longest = size_t(qMax(a.size(), b.size()));
+
+    memset(mask, 0, SnapshotStore::PageSize / 8);
+
+    MemoryDiff_changed_mask((const uint8_t*)a.constData(), (const uint8_t*)b.constData(), common, mask);
+
+    for (size_t i = common; i < longest; ++i) {
+        mask[i >> 3] |= uint8_t(1 << (i & 7));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+SnapshotStore::SnapshotStore(IBackendRequests* interface) : QObject(interface), m_interface(interface) {
+    if (interface) {
+        connect(interface, &IBackendRequests::memory_pages_received, this, &SnapshotStore::pages_received);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+SnapshotStore* SnapshotStore::for_interface(IBackendRequests* interface) {
+    if (!interface) {
+        return nullptr;
+    }
+
+    SnapshotStore* store = interface->findChild<SnapshotStore*>(QString(), Qt::FindDirectChildrenOnly);
+
+    return store ? store : new SnapshotStore(interface);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void SnapshotStore::capture(const QString& name, const QVector<MemoryRange>& ranges) {
+    Capture capture;
+    capture.name = name;
+    capture.snapshot.ranges = merge_ranges(ranges);
+
+    if (!m_interface || capture.snapshot.ranges.isEmpty()) {
+        return;
+    }
+
+    QVector<QVector<uint64_t>> requests;
+    QVector<uint64_t> pages;
+    bool has_last = false;
+    uint64_t last_page = 0;
+
+    for (const MemoryRange& range : capture.snapshot.ranges) {
+        for (uint64_t page = range.address & ~uint64_t(PageSize - 1); page < range.end(); page += PageSize) {
+            // Merged ranges can still share the page they meet in
+            if (!has_last || page != last_page) {
+                pages.append(page);
+            }
+
+            has_last = true;
+            last_page = page;
+
+            if (pages.size() == PagesPerRequest) {
+                requests.append(pages);
+                pages.clear();
+            }
+
+            if (page + PageSize < page) {
+                break;
+            }
+        }
+    }
+
+    if (!pages.isEmpty()) {
+        requests.append(pages);
+    }
+
+    for (const QVector<uint64_t>& request : requests) {
+        capture.requests.append(m_interface->read_memory_pages(request, PageSize));
+    }
+
+    m_captures.append(capture);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void SnapshotStore::pages_received(uint64_t request_id, const QVector<IBackendRequests::MemoryPage>& pages, int,
+                                   uint64_t) {
+    // Replies to the MemoryCache and other requests are sent here as well so only take the ones of a capture
+
+    for (int i = 0; i < m_captures.size(); ++i) {
+        Capture& capture = m_captures[i];
+        const int request = capture.requests.indexOf(request_id);
+
+        if (request < 0) {
+            continue;
+        }
+
+        capture.requests.remove(request);
+
+        for (const IBackendRequests::MemoryPage& page : pages) {
+            if (!page.data.isEmpty()) {
+                capture.snapshot.pages.insert(page.address, store_page(page.data));
+            }
+        }
+
+        if (!capture.requests.isEmpty()) {
+            return;
+        }
+
+        const QString name = capture.name;
+
+        if (m_snapshots.contains(name)) {
+            release_pages(m_snapshots.value(name));
+            m_names.removeAll(name);
+        }
+
+        m_snapshots.insert(name, capture.snapshot);
+        m_names.append(name);
+        m_captures.remove(i);
+
+        snapshot_captured(name);
+        snapshots_changed();
+        return;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void SnapshotStore::remove(const QString& name) {
+    auto it = m_snapshots.find(name);
+
+    if (it == m_snapshots.end()) {
+        return;
+    }
+
+    release_pages(it.value());
+    m_snapshots.erase(it);
+    m_names.removeAll(name);
+
+    snapshots_changed();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+QVector<MemoryRange> SnapshotStore::ranges(const QString& name) const {
+    return m_snapshots.value(name).ranges;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int SnapshotStore::referenced_pages() const {
+    int count = 0;
+
+    for (const Snapshot& snapshot : m_snapshots) {
+        count += snapshot.pages.size();
+    }
+
+    return count;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Returns the index of a stored page with the same data (with one more reference) or stores a copy of it
+
+int SnapshotStore::store_page(const QByteArray& data) {
+    const uint64_t hash = hash_page(data);
+
+    for (auto it = m_by_hash.constFind(hash); it != m_by_hash.constEnd() && it.key() == hash; ++it) {
+        StoredPage& page = m_store[it.value()];
+
+        if (page.data == data) {
+            ++page.refs;
+            return it.value();
+        }
+    }
+
+    int index;
+
+    if (!m_free_slots.isEmpty()) {
+        index = m_free_slots.takeLast();
+    } else {
+        index = m_store.size();
+        m_store.append(StoredPage());
+    }
+
+    // QByteArray is implicitly shared so the data of the reply is kept without a copy
+    m_store[index] = StoredPage{hash, data, 1};
+    m_by_hash.insert(hash, index);
+    ++m_stored_pages;
+
+    return index;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void SnapshotStore::release_pages(const Snapshot& snapshot) {
+    for (int index : snapshot.pages) {
+        StoredPage& page = m_store[index];
+
+        if (--page.refs > 0) {
+            continue;
+        }
+
+        m_by_hash.remove(page.hash, index);
+        page.data.clear();
+        m_free_slots.append(index);
+        --m_stored_pages;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int SnapshotStore::page_index(const Snapshot& snapshot, uint64_t page_address) const {
+    return snapshot.pages.value(page_address, -1);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+const QByteArray& SnapshotStore::page_data(const Snapshot& snapshot, uint64_t page_address) const {
+    static const QByteArray s_unreadable;
+
+    int index = page_index(snapshot, page_address);
+
+    return index >= 0 ? m_store[index].data : s_unreadable;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool SnapshotStore::read(const QString& name, uint64_t address, uint64_t count, MemorySpan* span,
+                         const QString& compare) const {
+    auto it = m_snapshots.constFind(name);
+
+    if (it == m_snapshots.constEnd()) {
+        return false;
+    }
+
+    const Snapshot& snapshot = it.value();
+    auto compare_it = compare.isEmpty() ? m_snapshots.constEnd() : m_snapshots.constFind(compare);
+    const Snapshot* other = compare_it != m_snapshots.constEnd() ? &compare_it.value() : nullptr;
+
+    span->reset(address, uint32_t(count));
+
+    uint8_t* out = (uint8_t*)span->data.data();
+    uint8_t mask[PageSize / 8];
+    uint64_t end = address + count;
+    uint64_t page_address = address & ~uint64_t(PageSize - 1);
+
+    for (; page_address < end; page_address += PageSize) {
+        uint64_t start = qMax(page_address, address);
+        uint64_t stop = qMin(page_address + PageSize, end);
+        uint32_t out_offset = uint32_t(start - address);
+        int index = page_index(snapshot, page_address);
+        const QByteArray& data = page_data(snapshot, page_address);
+        uint64_t readable_stop = qMin(stop, page_address + uint64_t(data.size()));
+
+        if (readable_stop > start) {
+            memcpy(out + out_offset, data.constData() + (start - page_address), size_t(readable_stop - start));
+
+            // Pages that are shared between the snapshots are the same
+            if (other && page_index(*other, page_address) != index) {
+                page_changed_mask(page_data(*other, page_address), data, mask);
+                span->add_changed_runs(out_offset, mask, size_t(start - page_address),
+                                       size_t(readable_stop - page_address), IBackendRequests::Readable);
+            } else {
+                span->add_run(out_offset, IBackendRequests::Readable);
+            }
+        } else {
+            readable_stop = start;
+        }
+
+        if (readable_stop < stop) {
+            memset(out + (readable_stop - address), 0, size_t(stop - readable_stop));
+            span->add_run(uint32_t(readable_stop - address), 0);
+        }
+
+        // Wrapped around the end of the address space
+        if (page_address + PageSize < page_address) {
+            break;
+        }
+    }
+
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+QVector<MemoryRange> SnapshotStore::diff(const QString& from, const QString& to) const {
+    QVector<MemoryRange> result;
+
+    auto from_it = m_snapshots.constFind(from);
+    auto to_it = m_snapshots.constFind(to);
+
+    if (from_it == m_snapshots.constEnd() || to_it == m_snapshots.constEnd()) {
+        return result;
+    }
+
+    const Snapshot& a = from_it.value();
+    const Snapshot& b = to_it.value();
+    uint8_t mask[PageSize / 8];
+
+    for (const MemoryRange& range : intersect_ranges(a.ranges, b.ranges)) {
+        const uint64_t first_page = range.address & ~uint64_t(PageSize - 1);
+
+        // Only pages that were readable in either snapshot can differ so walk the pages of both in address order
+
+        auto ia = a.pages.lowerBound(first_page);
+        auto ib = b.pages.lowerBound(first_page);
+
+        for (;;) {
+            const bool has_a = ia != a.pages.constEnd() && ia.key() < range.end();
+            const bool has_b = ib != b.pages.constEnd() && ib.key() < range.end();
+
+            if (!has_a && !has_b) {
+                break;
+            }
+
+            const uint64_t page = (has_a && has_b) ? qMin(ia.key(), ib.key()) : (has_a ? ia.key() : ib.key());
+            int index_a = -1;
+            int index_b = -1;
+
+            if (has_a && ia.key() == page) {
+                index_a = ia.value();
+                ++ia;
+            }
+
+            if (has_b && ib.key() == page) {
+                index_b = ib.value();
+                ++ib;
+            }
+
+            if (index_a == index_b) {
+                continue;
+            }
+
+            page_changed_mask(page_data(a, page), page_data(b, page), mask);
+
+            const size_t start = size_t(qMax(page, range.address) - page);
+            const size_t stop = size_t(qMin(range.end() - page, uint64_t(PageSize)));
+            size_t pos = start;
+
+            while (pos < stop) {
+                int64_t next = MemoryDiff_find_next(mask, stop, pos);
+
+                if (next < 0) {
+                    break;
+                }
+
+                size_t changed_end = size_t(next) + 1;
+
+                while (changed_end < stop && ((mask[changed_end >> 3] >> (changed_end & 7)) & 1)) {
+                    ++changed_end;
+                }
+
+                append_range(&result, page + uint64_t(next), uint64_t(changed_end - size_t(next)));
+                pos = changed_end;
+            }
+        }
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
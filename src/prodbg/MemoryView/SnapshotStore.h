@@ -0,0 +1,123 @@
+#pragma once
+
+#include <stdint.h>
+#include <QtCore/QByteArray>
+#include <QtCore/QHash>
+#include <QtCore/QMap>
+#include <QtCore/QObject>
+#include <QtCore/QPointer>
+#include <QtCore/QStringList>
+#include <QtCore/QVector>
+#include "Backend/IBackendRequests.h"
+#include "MemorySpan.h"
+
+namespace prodbg {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct MemoryRange {
+    uint64_t address;
+    uint64_t size;
+
+    uint64_t end() const { return address + size; }
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Named snapshots of target memory shared by all memory views of a session.
+//
+// A snapshot is captured by reading the pages of a set of ranges with read_memory_pages. The pages are kept in a page
+// store where each page is stored once by content (hashed with a lookup on collisions) and reference counted, so a
+// snapshot only costs the pages that changed since earlier snapshots. Snapshots are never modified after they have
+// been captured which makes the shared pages copy-on-write.
+//
+// Two snapshots are compared page by page. Pages that are shared are skipped without looking at the data and the
+// rest is compared with MemoryDiff_changed_mask, so diffing mostly unchanged snapshots is cheap.
+
+class SnapshotStore : public QObject {
+    Q_OBJECT
+
+   public:
+    enum {
+        PageSize = 4096,
+        // Max number of pages in one read_memory_pages request
+        PagesPerRequest = 1024,
+    };
+
+    explicit SnapshotStore(IBackendRequests* interface);
+
+    // Store shared by all views for the interface. Created on first use and owned by the interface
+    static SnapshotStore* for_interface(IBackendRequests* interface);
+
+    // Reads the ranges into a snapshot called name. It replaces any snapshot with the same name when all pages have
+    // arrived and snapshot_captured is sent. Pages that can't be read are stored as unreadable
+    void capture(const QString& name, const QVector<MemoryRange>& ranges);
+
+    void remove(const QString& name);
+    bool contains(const QString& name) const { return m_snapshots.contains(name); }
+
+    // Names of the snapshots in the order they were captured
+    QStringList names() const { return m_names; }
+
+    // Ranges (sorted and merged) that were captured in the snapshot
+    QVector<MemoryRange> ranges(const QString& name) const;
+
+    // Copies count bytes at address from the snapshot into span like MemoryCache::read. Bytes that differ from the
+    // compare snapshot (if given) get the Changed flag. Returns false if there is no such snapshot.
+    bool read(const QString& name, uint64_t address, uint64_t count, MemorySpan* span,
+              const QString& compare = QString()) const;
+
+    // Ranges that differ between two snapshots in increasing address order with adjacent ranges merged. Only memory
+    // captured in both snapshots is compared and a byte is changed if it differs or is only readable in one of them
+    QVector<MemoryRange> diff(const QString& from, const QString& to) const;
+
+    // Number of pages in the store and the number of pages referenced by snapshots (shared pages count once for each)
+    int stored_pages() const { return m_stored_pages; }
+    int referenced_pages() const;
+
+    Q_SIGNAL void snapshot_captured(const QString& name);
+
+    // Sent when a snapshot has been added or removed
+    Q_SIGNAL void snapshots_changed();
+
+   private:
+    Q_SLOT void pages_received(uint64_t request_id, const QVector<IBackendRequests::MemoryPage>& pages,
+                               int address_width, uint64_t epoch);
+
+    struct StoredPage {
+        uint64_t hash;
+        QByteArray data;
+        int refs;
+    };
+
+    struct Snapshot {
+        QVector<MemoryRange> ranges;
+        // Page address -> index in m_store. Pages that couldn't be read at all aren't included
+        QMap<uint64_t, int> pages;
+    };
+
+    struct Capture {
+        QString name;
+        Snapshot snapshot;
+        // Ids of the read_memory_pages requests that haven't been replied to yet
+        QVector<uint64_t> requests;
+    };
+
+    int store_page(const QByteArray& data);
+    void release_pages(const Snapshot& snapshot);
+    const QByteArray& page_data(const Snapshot& snapshot, uint64_t page_address) const;
+    int page_index(const Snapshot& snapshot, uint64_t page_address) const;
+
+    QPointer<IBackendRequests> m_interface;
+
+    QHash<QString, Snapshot> m_snapshots;
+    QStringList m_names;
+    QVector<Capture> m_captures;
+
+    QVector<StoredPage> m_store;
+    QVector<int> m_free_slots;
+    QMultiHash<uint64_t, int> m_by_hash;
+    int m_stored_pages = 0;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}  // namespace prodbg
@@ -2,7 +2,9 @@
 #include <QDebug>
 #include <QFile>
 #include <QPainter>
+#include <algorithm>
 #include "BreakpointModel.h"
+#include "Core/LineTableStore.h"
 #include "edbee/edbee.h"
 #include "edbee/io/textdocumentserializer.h"
 #include "edbee/models/textdocument.h"
@@ -29,20 +31,58 @@ public:
     int widthBeforeLineNumber() { return 30; }
 
     void renderAfter(QPainter* painter, int start_line, int end_line, int width, int line_height) {
-        painter->setBrush(Qt::red);
         painter->setRenderHint(QPainter::Antialiasing);
 
-        for (int line = start_line; line <= end_line; ++line) {
+        renderCodeLines(painter, start_line, end_line, line_height);
+
+        painter->setBrush(Qt::red);
+
+        // Only the breakpoints in the visible range are fetched instead of checking each line
+
+        m_breakpoints->get_lines_in_range(m_breakpoints->find_file_id(m_filename), start_line, end_line, &m_lines);
+
+        for (int line : m_lines) {
             int y = line * line_height;
+            painter->drawEllipse(4, y + 1, line_height - 2, line_height - 2);
+        }
+    }
 
-            if (m_breakpoints->has_breakpoint_file_line(m_filename, line)) {
-                painter->drawEllipse(4, y + 1, line_height - 2, line_height - 2);
-            }
+    // Lines that have code get a small mark where a breakpoint can go. The lines of the file are looked up once per
+    // line table (the table lines are 1-based and the editor lines 0-based)
+
+    void renderCodeLines(QPainter* painter, int start_line, int end_line, int line_height) {
+        if (!m_line_tables) {
+            return;
+        }
+
+        QSharedPointer<const LineTable> table = m_line_tables->table();
+
+        if (table != m_code_table || m_filename != m_code_file) {
+            m_code_table = table;
+            m_code_file = m_filename;
+            m_code_lines.resize(0);
+            table->lines(table->find_file(m_filename), &m_code_lines);
+        }
+
+        auto it = std::lower_bound(m_code_lines.begin(), m_code_lines.end(), start_line + 1);
+
+        painter->setPen(Qt::NoPen);
+        painter->setBrush(Qt::gray);
+
+        for (; it != m_code_lines.end() && *it - 1 <= end_line; ++it) {
+            const int y = (*it - 1) * line_height + line_height / 2;
+            painter->drawRect(line_height / 2, y - 1, line_height / 2, 2);
         }
     }
 
     QString m_filename;
     BreakpointModel* m_breakpoints;
+    QVector<int> m_lines;
+
+    QPointer<LineTableStore> m_line_tables;
+    QSharedPointer<const LineTable> m_code_table;
+    QString m_code_file;
+    QVector<int> m_code_lines;
 };
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -84,13 +124,22 @@ void SourceCodeWidget::load_file(const QString& filename) {
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 void SourceCodeWidget::program_counter_changed(const IBackendRequests::ProgramCounterChange& pc) {
-    if (pc.filename != QStringLiteral("") && m_filename != pc.filename) {
+    QString filename = pc.filename;
+    int line = pc.line;
+
+    // Backends that only send the pc are mapped with the line tables
+
+    if (filename.isEmpty() && m_line_tables && !m_line_tables->line_of(pc.pc, &filename, &line)) {
+        return;
+    }
+
+    if (filename != QStringLiteral("") && m_filename != filename) {
         m_editor->textDocument()->lineDataManager()->clear();
-        load_file(pc.filename);
+        load_file(filename);
     }
 
     edbee::TextEditorController* controller = m_editor->controller();
-    controller->moveCaretTo(pc.line - 1, 0, false);
+    controller->moveCaretTo(line - 1, 0, false);
     controller->scrollCaretVisible();
 }
 
@@ -104,6 +153,18 @@ void SourceCodeWidget::toggle_breakpoint_current_line() {
         edbee::TextRange& range = sel->range(i);
         int line = doc->lineFromOffset(range.caret());
 
+        // Breakpoints on lines without code (blank lines, comments) go to the next line that has code, as that's
+        // where the backend would put them
+
+        if (m_line_tables) {
+            QSharedPointer<const LineTable> table = m_line_tables->table();
+            const int code_line = table->next_line(table->find_file(m_filename), line + 1);
+
+            if (code_line > 0) {
+                line = code_line - 1;
+            }
+        }
+
         m_breakpoints->toggle_file_line_breakpoint(m_filename, line);
         m_editor->update();
         // how to deal with more lines?
@@ -113,6 +174,23 @@ void SourceCodeWidget::toggle_breakpoint_current_line() {
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+void SourceCodeWidget::set_line_table_store(LineTableStore* store) {
+    if (m_line_tables) {
+        disconnect(m_line_tables, nullptr, this, nullptr);
+    }
+
+    m_line_tables = store;
+    m_margin_delegate->m_line_tables = store;
+
+    if (store) {
+        connect(store, &LineTableStore::lines_changed, this, [this]() { m_editor->update(); });
+    }
+
+    m_editor->update();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 SourceCodeWidget::~SourceCodeWidget() {
     printf("ending..\n");
     delete m_editor;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <QObject>
+#include <QPointer>
 #include <QString>
 #include "Backend/IBackendRequests.h"
 
@@ -21,6 +22,7 @@ namespace prodbg {
 
 class BreakpointModel;
 class BreakpointDelegate;
+class LineTableStore;
 
 class SourceCodeWidget : public QObject {
     Q_OBJECT
@@ -33,9 +35,14 @@ public:
 
     void toggle_breakpoint_current_line();
 
+    // Line tables of the current session. Used for the lines with code in the margin, to move breakpoints to the next
+    // line with code and for the pc line when the backend doesn't send one
+    void set_line_table_store(LineTableStore* store);
+
     edbee::TextEditorWidget* m_editor = nullptr;
     BreakpointModel* m_breakpoints = nullptr;
     BreakpointDelegate* m_margin_delegate = nullptr;
+    QPointer<LineTableStore> m_line_tables;
 
     QString m_filename;
 };
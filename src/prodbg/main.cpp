@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <QtCore/QCoreApplication>
 #include <QtCore/QFile>
 #include <QtCore/QResource>
@@ -10,11 +11,22 @@
 #include "Core/PluginHandler.h"
 #include "MainWindow.h"
 #include "Config/Config.h"
+#include "MemoryView/MemoryViewBenchmark.h"
 #include "edbee/edbee.h"
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 int main(int argc, const char** argv) {
+    // Paint benchmark of the memory view. Runs without a display unless another platform plugin is selected
+    if (argc > 1 && !strcmp(argv[1], "--bench-memory-view")) {
+        if (!qEnvironmentVariableIsSet("QT_QPA_PLATFORM")) {
+            qputenv("QT_QPA_PLATFORM", "offscreen");
+        }
+
+        QApplication app(argc, (char**)argv);
+        return prodbg::MemoryView_runBenchmark(argc > 2 ? atoi(argv[2]) : 200);
+    }
+
     QApplication app(argc, (char**)argv);
 
     QCoreApplication::setOrganizationName(QStringLiteral("TBL"));
@@ -34,6 +46,7 @@ int main(int argc, const char** argv) {
 
     //prodbg::PluginHandler_addPlugin(QStringLiteral("dummy_backend_plugin"));
     prodbg::PluginHandler_addPlugin(QStringLiteral("lldb_plugin"));
+    prodbg::PluginHandler_addPlugin(QStringLiteral("core_dump_plugin"));
 
     prodbg::MainWindow main_window;
 
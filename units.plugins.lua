@@ -150,6 +150,27 @@ SharedLibrary {
 
 -----------------------------------------------------------------------------------------------------------------------
 
+SharedLibrary {
+    Name = "core_dump_plugin",
+
+    Env = {
+        CPPPATH = {
+        	"api/include",
+        },
+    	CXXOPTS = { { "-fPIC"; Config = "linux-gcc"; }, },
+    },
+
+    Sources = {
+        "src/plugins/core_dump/core_dump_backend.cpp",
+    },
+
+	IdeGenerationHints = { Msvc = { SolutionFolder = "Plugins" } },
+
+	Depends = { "flatbuffers" },
+}
+
+-----------------------------------------------------------------------------------------------------------------------
+
 if native.host_platform == "macosx" or native.host_platform == "linux" then
    Default "lldb_plugin"
 end
@@ -159,6 +180,7 @@ end
 --end
 
 Default "amiga_uae_plugin"
+Default "core_dump_plugin"
 --Default "dummy_backend_plugin"
 Default "register_view"
 
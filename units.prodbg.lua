@@ -94,19 +94,33 @@ Program {
         gen_uic("src/prodbg/MainWindow.ui"),
         gen_uic("src/prodbg/MemoryView/MemoryView.ui"),
         gen_moc("src/prodbg/MainWindow.h"),
+        gen_moc("src/prodbg/BreakpointModel.h"),
 
         gen_moc("src/prodbg/Backend/IBackendRequests.h"),
         gen_moc("src/prodbg/Backend/BackendRequests.h"),
         gen_moc("src/prodbg/Backend/BackendSession.h"),
+        gen_moc("src/prodbg/Backend/SessionPool.h"),
+        gen_moc("src/prodbg/Core/SymbolIndex.h"),
+        gen_moc("src/prodbg/Core/LineTableStore.h"),
         gen_moc("src/prodbg/AmigaUAE/AmigaUAE.h"),
         -- gen_moc("src/prodbg/PluginUI/signal_wrappers.h"),
 
         gen_moc("src/prodbg/View.h"),
         gen_moc("src/prodbg/ViewHandler.h"),
         gen_moc("src/prodbg/CodeView/CodeView.h"),
-        -- gen_moc("src/prodbg/CodeView/DisassemblyView.h"),
+        gen_moc("src/prodbg/CodeView/DisassemblyView.h"),
+        gen_moc("src/prodbg/CodeView/DisassemblyModel.h"),
+        gen_moc("src/prodbg/CodeView/DisassemblyEngine.h"),
+        gen_moc("src/prodbg/CodeView/CodeAnalyzer.h"),
+        gen_moc("src/prodbg/CodeView/ControlFlowBuilder.h"),
+        gen_moc("src/prodbg/CodeView/FunctionGraphView.h"),
+        gen_moc("src/prodbg/CodeView/MixedModel.h"),
+        gen_moc("src/prodbg/CodeView/MixedView.h"),
         gen_moc("src/prodbg/MemoryView/MemoryView.h"),
         gen_moc("src/prodbg/MemoryView/MemoryViewWidget.h"),
+        gen_moc("src/prodbg/MemoryView/MemoryCache.h"),
+        gen_moc("src/prodbg/MemoryView/MemorySearcher.h"),
+        gen_moc("src/prodbg/MemoryView/SnapshotStore.h"),
 
         gen_moc("src/prodbg/PluginUI/generated/qt_api_gen.h"),
     },
@@ -128,7 +142,6 @@ Program {
 
         CPPPATH = {
             "$(QT5_INC)",
-            "src/native/external/tinyexpr",
             "src/prodbg",
         	"api/include",
         	"src/native/external",
@@ -160,7 +173,7 @@ Program {
 
     Frameworks = { "Cocoa", "QtWidgets", "QtGui", "QtCore" },
 
-    Depends = { "remote_api", "capstone", "tinyexpr", "toolwindowmanager", "edbee" },
+    Depends = { "remote_api", "capstone", "toolwindowmanager", "edbee" },
 }
 
 -----------------------------------------------------------------------------------------------------------------------